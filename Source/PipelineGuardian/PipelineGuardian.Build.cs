@@ -57,7 +57,8 @@ public class PipelineGuardian : ModuleRules
 				"StaticMeshDescription",
 				"MeshDescription",
 				"EditorScriptingUtilities",
-				"MeshLODToolset"
+				"MeshLODToolset",
+				"RHI"
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
@@ -4,6 +4,8 @@
 #include "Analysis/IAssetCheckRule.h"
 #include "Analysis/FAssetAnalysisResult.h"
 #include "Analysis/FPipelineGuardianProfile.h"
+#include "Analysis/Snapshots/FStaticMeshAnalysisSnapshot.h"
+#include "Core/FAnalysisTimingStats.h"
 #include "Analysis/Rules/StaticMesh/FStaticMeshNamingRule.h"
 #include "Analysis/Rules/StaticMesh/FStaticMeshLODMissingRule.h"
 #include "Analysis/Rules/StaticMesh/FStaticMeshLODPolyReductionRule.h"
@@ -20,9 +22,19 @@
 #include "Analysis/Rules/StaticMesh/FStaticMeshScalingRule.h"
 #include "Analysis/Rules/StaticMesh/FStaticMeshLightmapResolutionRule.h"
 #include "Analysis/Rules/StaticMesh/FStaticMeshSocketNamingRule.h"
+#include "Analysis/Rules/StaticMesh/FStaticMeshTexelDensityRule.h"
+#include "Analysis/Rules/StaticMesh/FStaticMeshVertexCacheRule.h"
+#include "Analysis/Rules/StaticMesh/FStaticMeshOverdrawRule.h"
+#include "Analysis/Rules/StaticMesh/FStaticMeshVertexSplitRule.h"
+#include "Analysis/Rules/StaticMesh/FStaticMeshLODGeometricErrorRule.h"
+#include "Analysis/Rules/StaticMesh/FStaticMeshMemoryBudgetRule.h"
+#include "Analysis/Rules/StaticMesh/FStaticMeshDuplicateGeometryRule.h"
+#include "Analysis/Rules/StaticMesh/FStaticMeshNearDuplicateRule.h"
+#include "Analysis/Rules/StaticMesh/FStaticMeshDrawCallRule.h"
 #include "Engine/StaticMesh.h"
 #include "AssetRegistry/AssetData.h"
 #include "PipelineGuardian.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 #define LOCTEXT_NAMESPACE "FStaticMeshAnalyzer"
 
@@ -50,9 +62,22 @@ void FStaticMeshAnalyzer::InitializeRules()
 	StaticMeshRules.Add(MakeShared<FStaticMeshScalingRule>());
 	StaticMeshRules.Add(MakeShared<FStaticMeshLightmapResolutionRule>());
 	StaticMeshRules.Add(MakeShared<FStaticMeshSocketNamingRule>());
-	
+	StaticMeshRules.Add(MakeShared<FStaticMeshTexelDensityRule>());
+	StaticMeshRules.Add(MakeShared<FStaticMeshVertexCacheRule>());
+	StaticMeshRules.Add(MakeShared<FStaticMeshOverdrawRule>());
+	StaticMeshRules.Add(MakeShared<FStaticMeshVertexSplitRule>());
+	StaticMeshRules.Add(MakeShared<FStaticMeshLODGeometricErrorRule>());
+	StaticMeshRules.Add(MakeShared<FStaticMeshMemoryBudgetRule>());
+	StaticMeshRules.Add(MakeShared<FStaticMeshDuplicateGeometryRule>());
+	StaticMeshRules.Add(MakeShared<FStaticMeshNearDuplicateRule>());
+	StaticMeshRules.Add(MakeShared<FStaticMeshDrawCallRule>());
+
+	RuleTraceNames.Reserve(StaticMeshRules.Num());
+	for (const TSharedPtr<IAssetCheckRule>& Rule : StaticMeshRules)
+	{
+		RuleTraceNames.Add(Rule.IsValid() ? Rule->GetRuleID().ToString() : FString());
+	}
 
-	
 	UE_LOG(LogPipelineGuardian, Log, TEXT("FStaticMeshAnalyzer initialized with %d rules"), StaticMeshRules.Num());
 }
 
@@ -71,7 +96,13 @@ void FStaticMeshAnalyzer::AnalyzeAsset(const FAssetData& AssetData, const UPipel
 	}
 
 	// Load the static mesh asset
-	UStaticMesh* StaticMesh = Cast<UStaticMesh>(AssetData.GetAsset());
+	const double LoadStartTime = FPlatformTime::Seconds();
+	UStaticMesh* StaticMesh = nullptr;
+	{
+		SCOPE_CYCLE_COUNTER(STAT_PipelineGuardian_LoadAsset);
+		StaticMesh = Cast<UStaticMesh>(AssetData.GetAsset());
+	}
+	FAnalysisTimingStats::Get().RecordPhase(EAnalysisTimingPhase::Load, AssetData.GetSoftObjectPath(), FPlatformTime::Seconds() - LoadStartTime);
 	if (!StaticMesh)
 	{
 		UE_LOG(LogPipelineGuardian, Error, TEXT("FStaticMeshAnalyzer: Failed to load StaticMesh asset: %s"), *AssetData.AssetName.ToString());
@@ -89,21 +120,131 @@ void FStaticMeshAnalyzer::AnalyzeAsset(const FAssetData& AssetData, const UPipel
 
 	UE_LOG(LogPipelineGuardian, Verbose, TEXT("FStaticMeshAnalyzer: Analyzing StaticMesh: %s with %d rules"), *AssetData.AssetName.ToString(), StaticMeshRules.Num());
 
-	// Run all static mesh rules
+	// Run both passes back to back so serial and scheduled analysis report results in the same order
+	const TSharedPtr<const FAssetAnalysisSnapshot> Snapshot = CreateSnapshot(AssetData, StaticMesh);
+	AnalyzeLoadedAsset(AssetData, StaticMesh, Snapshot.Get(), Profile, EAssetAnalysisPass::WorkerThread, OutResults);
+	AnalyzeLoadedAsset(AssetData, StaticMesh, Snapshot.Get(), Profile, EAssetAnalysisPass::GameThread, OutResults);
+
+	UE_LOG(LogPipelineGuardian, Verbose, TEXT("FStaticMeshAnalyzer: Completed analysis of %s. Total issues found so far: %d"), *AssetData.AssetName.ToString(), OutResults.Num());
+}
+
+bool FStaticMeshAnalyzer::CanAnalyzeWithoutLoading(const FAssetData& AssetData, const UPipelineGuardianProfile* Profile) const
+{
+	if (!AssetData.IsValid() || !Profile)
+	{
+		return false;
+	}
+
 	for (const TSharedPtr<IAssetCheckRule>& Rule : StaticMeshRules)
 	{
-		if (Rule.IsValid())
+		if (Rule.IsValid() && Rule->IsEnabled(Profile) && !Rule->CanCheckAssetData(AssetData))
 		{
-			UE_LOG(LogPipelineGuardian, VeryVerbose, TEXT("FStaticMeshAnalyzer: Running rule %s on asset %s"), *Rule->GetRuleID().ToString(), *AssetData.AssetName.ToString());
-			Rule->Check(StaticMesh, Profile, OutResults);
+			return false;
 		}
-		else
+	}
+
+	return true;
+}
+
+void FStaticMeshAnalyzer::AnalyzeAssetData(const FAssetData& AssetData, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	if (!AssetData.IsValid() || !Profile)
+	{
+		return;
+	}
+
+	UE_LOG(LogPipelineGuardian, Verbose, TEXT("FStaticMeshAnalyzer: Analyzing StaticMesh %s from asset registry tags"), *AssetData.AssetName.ToString());
+
+	for (const TSharedPtr<IAssetCheckRule>& Rule : StaticMeshRules)
+	{
+		if (!Rule.IsValid() || !Rule->IsEnabled(Profile))
 		{
-			UE_LOG(LogPipelineGuardian, Warning, TEXT("FStaticMeshAnalyzer: Invalid rule found in StaticMeshRules array"));
+			continue;
 		}
+
+		UE_LOG(LogPipelineGuardian, VeryVerbose, TEXT("FStaticMeshAnalyzer: Running rule %s on tags of %s"), *Rule->GetRuleID().ToString(), *AssetData.AssetName.ToString());
+		Rule->CheckAssetData(AssetData, Profile, OutResults);
 	}
+}
 
-	UE_LOG(LogPipelineGuardian, Verbose, TEXT("FStaticMeshAnalyzer: Completed analysis of %s. Total issues found so far: %d"), *AssetData.AssetName.ToString(), OutResults.Num());
+TSharedPtr<const FAssetAnalysisSnapshot> FStaticMeshAnalyzer::CreateSnapshot(const FAssetData& AssetData, UObject* AssetObject) const
+{
+	const UStaticMesh* StaticMesh = Cast<UStaticMesh>(AssetObject);
+	if (!StaticMesh)
+	{
+		return nullptr;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_PipelineGuardian_CreateSnapshot);
+	const double StartTime = FPlatformTime::Seconds();
+	TSharedPtr<const FAssetAnalysisSnapshot> Snapshot = FStaticMeshAnalysisSnapshot::Create(AssetData, StaticMesh);
+	FAnalysisTimingStats::Get().RecordPhase(EAnalysisTimingPhase::Snapshot, AssetData.GetSoftObjectPath(), FPlatformTime::Seconds() - StartTime);
+	return Snapshot;
+}
+
+bool FStaticMeshAnalyzer::RunsOnWorkerThread(const IAssetCheckRule& Rule, bool bHasSnapshot)
+{
+	// Check() reads the live mesh, which the editor may edit while a time-sliced scan runs in the background
+	return bHasSnapshot && Rule.SupportsSnapshot();
+}
+
+void FStaticMeshAnalyzer::AnalyzeLoadedAsset(const FAssetData& AssetData, UObject* AssetObject, const FAssetAnalysisSnapshot* Snapshot, const UPipelineGuardianProfile* Profile, EAssetAnalysisPass Pass, TArray<FAssetAnalysisResult>& OutResults)
+{
+	UStaticMesh* StaticMesh = Cast<UStaticMesh>(AssetObject);
+	if (!StaticMesh || !Profile)
+	{
+		return;
+	}
+
+	const bool bWorkerThreadPass = (Pass == EAssetAnalysisPass::WorkerThread);
+	check(bWorkerThreadPass || IsInGameThread());
+
+	const bool bHasSnapshot = (Snapshot != nullptr);
+
+	// Without a snapshot the snapshot rules run in this pass; they share one taken on demand instead of each taking its own in Check()
+	TSharedPtr<const FAssetAnalysisSnapshot> GameThreadSnapshot;
+
+	FAnalysisTimingStats& TimingStats = FAnalysisTimingStats::Get();
+	const FSoftObjectPath AssetPath = TimingStats.IsCollecting() ? AssetData.GetSoftObjectPath() : FSoftObjectPath();
+
+	for (int32 RuleIndex = 0; RuleIndex < StaticMeshRules.Num(); ++RuleIndex)
+	{
+		const TSharedPtr<IAssetCheckRule>& Rule = StaticMeshRules[RuleIndex];
+		if (!Rule.IsValid())
+		{
+			UE_LOG(LogPipelineGuardian, Warning, TEXT("FStaticMeshAnalyzer: Invalid rule found in StaticMeshRules array"));
+			continue;
+		}
+
+		if (RunsOnWorkerThread(*Rule, bHasSnapshot) != bWorkerThreadPass)
+		{
+			continue;
+		}
+
+		UE_LOG(LogPipelineGuardian, VeryVerbose, TEXT("FStaticMeshAnalyzer: Running rule %s on asset %s"), *Rule->GetRuleID().ToString(), *AssetData.AssetName.ToString());
+		const double RuleStartTime = FPlatformTime::Seconds();
+		{
+			SCOPE_CYCLE_COUNTER(STAT_PipelineGuardian_RuleCheck);
+			TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*RuleTraceNames[RuleIndex]);
+			if (bHasSnapshot && Rule->SupportsSnapshot())
+			{
+				Rule->CheckSnapshot(*Snapshot, Profile, OutResults);
+			}
+			else if (Rule->SupportsSnapshot())
+			{
+				if (!GameThreadSnapshot.IsValid())
+				{
+					GameThreadSnapshot = CreateSnapshot(AssetData, StaticMesh);
+				}
+				Rule->CheckSnapshot(*GameThreadSnapshot, Profile, OutResults);
+			}
+			else
+			{
+				Rule->Check(StaticMesh, Profile, OutResults);
+			}
+		}
+		TimingStats.RecordRule(Rule->GetRuleID(), AssetPath, FPlatformTime::Seconds() - RuleStartTime);
+	}
 }
 
 #undef LOCTEXT_NAMESPACE 
\ No newline at end of file
@@ -13,6 +13,7 @@ class UStaticMesh;
 class UPipelineGuardianProfile;
 struct FAssetData;
 struct FAssetAnalysisResult;
+struct FAssetAnalysisSnapshot;
 
 /**
  * Analyzer for Static Mesh assets.
@@ -26,11 +27,33 @@ public:
 
 	// IAssetAnalyzer interface
 	virtual void AnalyzeAsset(const FAssetData& AssetData, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
+	virtual int32 GetAnalyzerVersion() const override { return AnalyzerVersion; }
+	virtual bool CanAnalyzeWithoutLoading(const FAssetData& AssetData, const UPipelineGuardianProfile* Profile) const override;
+	virtual void AnalyzeAssetData(const FAssetData& AssetData, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
+	virtual TSharedPtr<const FAssetAnalysisSnapshot> CreateSnapshot(const FAssetData& AssetData, UObject* AssetObject) const override;
+	virtual void AnalyzeLoadedAsset(const FAssetData& AssetData, UObject* AssetObject, const FAssetAnalysisSnapshot* Snapshot, const UPipelineGuardianProfile* Profile, EAssetAnalysisPass Pass, TArray<FAssetAnalysisResult>& OutResults) override;
+
+	/** @return Every static mesh rule, in the order they run. */
+	const TArray<TSharedPtr<IAssetCheckRule>>& GetRules() const { return StaticMeshRules; }
 
 private:
 	/** Initialize all static mesh rules */
 	void InitializeRules();
 
+	/**
+	 * Whether a rule belongs to the worker thread pass.
+	 * @param Rule The rule to classify.
+	 * @param bHasSnapshot Whether a snapshot is available for the asset being analyzed.
+	 * @return True if the rule is evaluated from the snapshot, the only input that is safe to read off the game thread.
+	 */
+	static bool RunsOnWorkerThread(const IAssetCheckRule& Rule, bool bHasSnapshot);
+
+	/** Bump whenever a static mesh rule changes what it reports, to invalidate cached results */
+	static constexpr int32 AnalyzerVersion = 25;
+
 	/** Array of all static mesh analysis rules */
 	TArray<TSharedPtr<IAssetCheckRule>> StaticMeshRules;
+
+	/** Unreal Insights event name of each rule, parallel to StaticMeshRules */
+	TArray<FString> RuleTraceNames;
 }; 
\ No newline at end of file
@@ -46,6 +46,8 @@ void UPipelineGuardianProfile::InitializeDefaultRules()
 	SMUVOverlappingRule.Parameters.Add(TEXT("TextureErrorThreshold"), TEXT("15.0"));
 	SMUVOverlappingRule.Parameters.Add(TEXT("LightmapWarningThreshold"), TEXT("2.0"));
 	SMUVOverlappingRule.Parameters.Add(TEXT("LightmapErrorThreshold"), TEXT("8.0"));
+	SMUVOverlappingRule.Parameters.Add(TEXT("RasterizeOverlaps"), TEXT("true"));
+	SMUVOverlappingRule.Parameters.Add(TEXT("TextureRasterResolution"), TEXT("1024"));
 	SMUVOverlappingRule.Parameters.Add(TEXT("AllowAutoFix"), TEXT("true"));
 	SetRuleConfig(SMUVOverlappingRule);
 
@@ -0,0 +1,34 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Analysis/Geometry/FLightmapEfficiencyEstimator.h"
+#include "Analysis/Geometry/FTexelDensityEstimator.h"
+
+int32 FLightmapEfficiencyStats::GetResolutionForTexelDensity(float TexelsPerUnit) const
+{
+	if (UVArea <= 0.0 || WorldArea <= 0.0 || TexelsPerUnit <= 0.0f)
+	{
+		return 0;
+	}
+
+	// Density scales linearly with resolution: Density = Resolution * sqrt(UVArea / WorldArea)
+	const double RequiredResolution = TexelsPerUnit * FMath::Sqrt(WorldArea / UVArea);
+	const int32 Resolution = FMath::CeilToInt(FMath::Min(RequiredResolution, static_cast<double>(FUVCoverageRasterizer::MaxResolution)) / 4.0) * 4;
+	return FMath::Clamp(Resolution, 4, FUVCoverageRasterizer::MaxResolution);
+}
+
+FLightmapEfficiencyStats FLightmapEfficiencyEstimator::Estimate(TConstArrayView<FVector3f> Positions, TConstArrayView<FVector2f> UVs, TConstArrayView<uint32> Indices, int32 Resolution)
+{
+	FLightmapEfficiencyStats Stats;
+	Stats.Resolution = FMath::Clamp(Resolution, 0, FUVCoverageRasterizer::MaxResolution);
+
+	const FTexelDensityStats Areas = FTexelDensityEstimator::Measure(Positions, UVs, Indices);
+	Stats.UVArea = Areas.UVArea;
+	Stats.WorldArea = Areas.WorldArea;
+
+	if (Stats.Resolution > 0)
+	{
+		Stats.Coverage = FUVCoverageRasterizer::Rasterize(UVs, Indices, Stats.Resolution, ChartPaddingTexels);
+	}
+
+	return Stats;
+}
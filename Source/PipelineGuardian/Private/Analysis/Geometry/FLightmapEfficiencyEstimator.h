@@ -0,0 +1,63 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+#include "Analysis/Geometry/FUVCoverageRasterizer.h"
+
+/** How well a mesh's lightmap UV layout uses its lightmap */
+struct FLightmapEfficiencyStats
+{
+	/** Lightmap resolution the layout was rasterized at */
+	int32 Resolution = 0;
+
+	/** Summed UV area of all triangles; overlapping charts are counted twice */
+	double UVArea = 0.0;
+
+	/** Summed surface area of all triangles, in world units squared */
+	double WorldArea = 0.0;
+
+	/** Texel coverage at Resolution */
+	FUVCoverageStats Coverage;
+
+	/** @return Share of the 0-1 UV square taken up by charts, 0-1, independent of resolution. */
+	float GetChartAreaFraction() const { return static_cast<float>(FMath::Min(UVArea, 1.0)); }
+
+	/** @return Share of the lightmap's texels that receive lighting, 0-1. */
+	float GetUtilization() const { return Coverage.GetOccupiedFraction(); }
+
+	/** @return Texels that are baked and stored but not covered by any chart, including padding. */
+	int64 GetNumWastedTexels() const { return Coverage.GetNumTexels() - Coverage.NumCoveredTexels; }
+
+	/** @return Lightmap texels per world unit along a surface at Resolution. */
+	float GetTexelDensity() const { return WorldArea > 0.0 ? static_cast<float>(Resolution * FMath::Sqrt(UVArea / WorldArea)) : 0.0f; }
+
+	/**
+	 * @param TexelsPerUnit Target lightmap texels per world unit.
+	 * @return The smallest resolution, a multiple of 4, at which the layout reaches the target density; 0 if the layout has no area.
+	 */
+	int32 GetResolutionForTexelDensity(float TexelsPerUnit) const;
+};
+
+/**
+ * Measures lightmap UV layouts: how much of the lightmap the charts cover, how many texels are wasted at the current
+ * resolution, and what resolution a target texel density calls for. Areas come from FTexelDensityEstimator and coverage
+ * from FUVCoverageRasterizer, so the cost is one pass over the triangles plus one over the texels.
+ * Thread-safe; holds no state.
+ */
+class FLightmapEfficiencyEstimator
+{
+public:
+	/** Gutter around charts, in texels, reported as padding */
+	static constexpr int32 ChartPaddingTexels = 1;
+
+	/**
+	 * @param Positions Vertex positions.
+	 * @param UVs Lightmap texture coordinates, indexed by vertex.
+	 * @param Indices Triangle list indices.
+	 * @param Resolution Current lightmap resolution.
+	 * @return Areas, coverage and density of the layout.
+	 */
+	static FLightmapEfficiencyStats Estimate(TConstArrayView<FVector3f> Positions, TConstArrayView<FVector2f> UVs, TConstArrayView<uint32> Indices, int32 Resolution);
+};
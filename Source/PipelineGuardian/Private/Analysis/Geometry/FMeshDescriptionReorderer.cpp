@@ -0,0 +1,132 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Analysis/Geometry/FMeshDescriptionReorderer.h"
+#include "Analysis/Geometry/FVertexCacheOptimizer.h"
+#include "HAL/IConsoleManager.h"
+#include "MeshDescription.h"
+
+namespace MeshDescriptionReorderer
+{
+	/** Fills an element ID lookup with the new index of every element, in old index order */
+	void FillLookup(TSparseArray<int32>& OutLookup, TConstArrayView<int32> Remap)
+	{
+		OutLookup.Reserve(Remap.Num());
+		for (const int32 NewIndex : Remap)
+		{
+			OutLookup.Add(NewIndex);
+		}
+	}
+
+	/** Fills an element ID lookup that keeps every element where it is */
+	void FillIdentityLookup(TSparseArray<int32>& OutLookup, int32 Num)
+	{
+		OutLookup.Reserve(Num);
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			OutLookup.Add(Index);
+		}
+	}
+}
+
+bool FMeshDescriptionReorderer::IsOrderKeptByBuild(int64 NumVertexInstances)
+{
+	if (NumVertexInstances >= MinBuildKeptVertexInstances)
+	{
+		return true;
+	}
+
+	// 0 = NvTriStrip, 1 = Forsyth, 2 = no optimization. Registered by the mesh utilities module; the build uses its default of 1 until then.
+	const TConsoleVariableData<int32>* CVarTriangleOrderOptimization = IConsoleManager::Get().FindTConsoleVariableDataInt(TEXT("r.TriangleOrderOptimization"));
+	return CVarTriangleOrderOptimization && CVarTriangleOrderOptimization->GetValueOnAnyThread() == 2;
+}
+
+bool FMeshDescriptionReorderer::IsOrderKeptByBuild(const FMeshDescription& MeshDescription)
+{
+	return IsOrderKeptByBuild(MeshDescription.VertexInstances().Num());
+}
+
+bool FMeshDescriptionReorderer::Reorder(FMeshDescription& MeshDescription, FTriangleOrderFunction TriangleOrderFunction)
+{
+	using namespace MeshDescriptionReorderer;
+
+	if (MeshDescription.Triangles().Num() == 0)
+	{
+		return false;
+	}
+
+	// Dense element IDs, so every remapping below is a permutation of 0..N-1
+	FElementIDRemappings Compaction;
+	MeshDescription.Compact(Compaction);
+
+	TArray<FVector3f> VertexInstancePositions;
+	VertexInstancePositions.SetNumUninitialized(MeshDescription.VertexInstances().Num());
+	for (const FVertexInstanceID VertexInstanceID : MeshDescription.VertexInstances().GetElementIDs())
+	{
+		VertexInstancePositions[VertexInstanceID.GetValue()] = MeshDescription.GetVertexPosition(MeshDescription.GetVertexInstanceVertex(VertexInstanceID));
+	}
+
+	// Each polygon group becomes a section and is ordered on its own
+	TArray<int32> TriangleOrder;
+	TArray<uint32> OrderedVertexInstances;
+	TriangleOrder.Reserve(MeshDescription.Triangles().Num());
+	OrderedVertexInstances.Reserve(MeshDescription.Triangles().Num() * 3);
+	for (const FPolygonGroupID PolygonGroupID : MeshDescription.PolygonGroups().GetElementIDs())
+	{
+		TArray<int32> GroupTriangles;
+		TArray<uint32> GroupIndices;
+		for (const FTriangleID TriangleID : MeshDescription.GetPolygonGroupTriangles(PolygonGroupID))
+		{
+			GroupTriangles.Add(TriangleID.GetValue());
+			for (const FVertexInstanceID VertexInstanceID : MeshDescription.GetTriangleVertexInstances(TriangleID))
+			{
+				GroupIndices.Add(static_cast<uint32>(VertexInstanceID.GetValue()));
+			}
+		}
+
+		TArray<int32> GroupOrder;
+		TriangleOrderFunction(VertexInstancePositions, GroupIndices, GroupOrder);
+		check(GroupOrder.Num() == GroupTriangles.Num());
+		for (const int32 GroupTriangle : GroupOrder)
+		{
+			TriangleOrder.Add(GroupTriangles[GroupTriangle]);
+			OrderedVertexInstances.Append(&GroupIndices[GroupTriangle * 3], 3);
+		}
+	}
+
+	// Vertex instances and vertices in first-use order
+	TArray<int32> VertexInstanceRemap;
+	FVertexCacheOptimizer::OptimizeVertexFetch(OrderedVertexInstances, MeshDescription.VertexInstances().Num(), VertexInstanceRemap);
+
+	TArray<uint32> OrderedVertices;
+	OrderedVertices.SetNumUninitialized(MeshDescription.VertexInstances().Num());
+	for (const FVertexInstanceID VertexInstanceID : MeshDescription.VertexInstances().GetElementIDs())
+	{
+		OrderedVertices[VertexInstanceRemap[VertexInstanceID.GetValue()]] = static_cast<uint32>(MeshDescription.GetVertexInstanceVertex(VertexInstanceID).GetValue());
+	}
+	TArray<int32> VertexRemap;
+	FVertexCacheOptimizer::OptimizeVertexFetch(OrderedVertices, MeshDescription.Vertices().Num(), VertexRemap);
+
+	// Polygons follow their first triangle
+	TArray<int32> TriangleRemap;
+	TriangleRemap.SetNumUninitialized(TriangleOrder.Num());
+	TArray<uint32> OrderedPolygons;
+	OrderedPolygons.Reserve(TriangleOrder.Num());
+	for (int32 Position = 0; Position < TriangleOrder.Num(); ++Position)
+	{
+		TriangleRemap[TriangleOrder[Position]] = Position;
+		OrderedPolygons.Add(static_cast<uint32>(MeshDescription.GetTrianglePolygon(FTriangleID(TriangleOrder[Position])).GetValue()));
+	}
+	TArray<int32> PolygonRemap;
+	FVertexCacheOptimizer::OptimizeVertexFetch(OrderedPolygons, MeshDescription.Polygons().Num(), PolygonRemap);
+
+	FElementIDRemappings Reordering;
+	FillLookup(Reordering.NewVertexIndexLookup, VertexRemap);
+	FillLookup(Reordering.NewVertexInstanceIndexLookup, VertexInstanceRemap);
+	FillLookup(Reordering.NewTriangleIndexLookup, TriangleRemap);
+	FillLookup(Reordering.NewPolygonIndexLookup, PolygonRemap);
+	FillIdentityLookup(Reordering.NewEdgeIndexLookup, MeshDescription.Edges().Num());
+	FillIdentityLookup(Reordering.NewPolygonGroupIndexLookup, MeshDescription.PolygonGroups().Num());
+	MeshDescription.Remap(Reordering);
+
+	return true;
+}
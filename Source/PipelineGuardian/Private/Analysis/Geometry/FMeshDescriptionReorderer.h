@@ -0,0 +1,54 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+#include "Templates/Function.h"
+
+// Forward Declarations
+struct FMeshDescription;
+
+/**
+ * Applies a triangle order to a mesh description, so that a static mesh build emits its render buffers in that order.
+ * The builder emits triangles and vertices in element ID order, so reordering renumbers the elements: triangles
+ * (and their polygons) in the requested order within each polygon group, vertex instances and vertices in the
+ * order the reordered triangles first use them.
+ * The build runs its own vertex cache optimization over the vertex and index buffers of every LOD whose mesh description
+ * has fewer than MinBuildKeptVertexInstances vertex instances, unless r.TriangleOrderOptimization turns it off, so only
+ * LODs IsOrderKeptByBuild() accepts keep the order applied here.
+ * Game thread only, like any edit of a mesh description owned by an asset.
+ */
+class FMeshDescriptionReorderer
+{
+public:
+	/** Vertex instances from which the static mesh build emits a LOD in mesh description order instead of cache-optimizing it again */
+	static constexpr int32 MinBuildKeptVertexInstances = 300000;
+
+	/**
+	 * @param NumVertexInstances Vertex instances of a LOD's mesh description.
+	 * @return True if a rebuild keeps the triangle order of a LOD this size.
+	 */
+	static bool IsOrderKeptByBuild(int64 NumVertexInstances);
+
+	/**
+	 * @param MeshDescription Mesh description of a LOD.
+	 * @return True if a rebuild keeps the triangle order of the LOD.
+	 */
+	static bool IsOrderKeptByBuild(const FMeshDescription& MeshDescription);
+
+	/**
+	 * Computes the triangle order of one polygon group.
+	 * Positions are indexed by vertex instance; Indices is the group's triangle list of vertex instance indices.
+	 * OutTriangleOrder receives, for each position, the index of the group triangle to draw there.
+	 */
+	using FTriangleOrderFunction = TFunctionRef<void(TConstArrayView<FVector3f> Positions, TConstArrayView<uint32> Indices, TArray<int32>& OutTriangleOrder)>;
+
+	/**
+	 * Compacts the mesh description and renumbers its elements.
+	 * @param MeshDescription Mesh description to reorder; commit it to its mesh and rebuild afterwards.
+	 * @param TriangleOrderFunction Called once per polygon group.
+	 * @return False if the mesh description has no triangles.
+	 */
+	static bool Reorder(FMeshDescription& MeshDescription, FTriangleOrderFunction TriangleOrderFunction);
+};
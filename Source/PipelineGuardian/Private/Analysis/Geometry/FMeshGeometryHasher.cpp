@@ -0,0 +1,229 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Analysis/Geometry/FMeshGeometryHasher.h"
+#include "Async/ParallelFor.h"
+#include "Hash/xxhash.h"
+
+namespace MeshGeometryHasher
+{
+	constexpr int32 TrianglesPerChunk = 4096;
+	constexpr int32 VerticesPerChunk = 16384;
+
+	/** Words of a triangle corner: position and up to MaxUVChannels UVs */
+	constexpr int32 MaxCornerWords = 3 + 2 * FMeshGeometryHasher::MaxUVChannels;
+
+	/** @return The bits of a float, with negative zero folded into zero so that it hashes like positive zero. */
+	uint32 GetFloatBits(float Value)
+	{
+		if (Value == 0.0f)
+		{
+			return 0;
+		}
+		uint32 Bits;
+		FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+		return Bits;
+	}
+
+	/** @return Bits deciding whether a vertex is added to or subtracted from each shape sketch entry. */
+	uint32 GetSketchSigns(int32 VertexIndex)
+	{
+		// Murmur3 finalizer; index 0 would otherwise add vertex 0 to every entry
+		uint32 Hash = static_cast<uint32>(VertexIndex) + 1;
+		Hash ^= Hash >> 16;
+		Hash *= 0x85EBCA6Bu;
+		Hash ^= Hash >> 13;
+		Hash *= 0xC2B2AE35u;
+		Hash ^= Hash >> 16;
+		return Hash;
+	}
+
+	/** @return True if the corners of a triangle read from rotation A on order before those read from rotation B, comparing word by word. */
+	bool IsRotationLess(const uint32 (*Corners)[MaxCornerWords], int32 RotationA, int32 RotationB, int32 NumCornerWords)
+	{
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			const uint32* CornerA = Corners[(RotationA + Corner) % 3];
+			const uint32* CornerB = Corners[(RotationB + Corner) % 3];
+			for (int32 Word = 0; Word < NumCornerWords; ++Word)
+			{
+				if (CornerA[Word] != CornerB[Word])
+				{
+					return CornerA[Word] < CornerB[Word];
+				}
+			}
+		}
+		return false;
+	}
+
+	/** Hashes a range of triangles into ExactHashes and TopologyHashes at the same triangle indices */
+	void HashChunk(const FMeshGeometryStreams& Streams, int32 NumUVChannels, int32 FirstTriangle, int32 NumTriangles, TArray<uint64>& ExactHashes, TArray<uint64>& TopologyHashes)
+	{
+		const int32 NumVertices = Streams.Positions.Num();
+		const int32 NumCornerWords = 3 + 2 * NumUVChannels;
+
+		uint32 Corners[3][MaxCornerWords];
+		uint32 ExactWords[3 * MaxCornerWords];
+		uint32 TopologyWords[3 + 3 * 2 * FMeshGeometryHasher::MaxUVChannels];
+
+		for (int32 TriangleIndex = FirstTriangle; TriangleIndex < FirstTriangle + NumTriangles; ++TriangleIndex)
+		{
+			const uint32* TriangleIndices = &Streams.Indices[TriangleIndex * 3];
+			if (TriangleIndices[0] >= static_cast<uint32>(NumVertices) || TriangleIndices[1] >= static_cast<uint32>(NumVertices) || TriangleIndices[2] >= static_cast<uint32>(NumVertices))
+			{
+				ExactHashes[TriangleIndex] = 0;
+				TopologyHashes[TriangleIndex] = 0;
+				continue;
+			}
+
+			int32 NumTopologyWords = 0;
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const uint32 VertexIndex = TriangleIndices[Corner];
+				const FVector3f& Position = Streams.Positions[VertexIndex];
+				uint32* CornerWords = Corners[Corner];
+				CornerWords[0] = GetFloatBits(Position.X);
+				CornerWords[1] = GetFloatBits(Position.Y);
+				CornerWords[2] = GetFloatBits(Position.Z);
+				for (int32 Channel = 0; Channel < NumUVChannels; ++Channel)
+				{
+					const FVector2f& UV = Streams.UVChannels[Channel][VertexIndex];
+					CornerWords[3 + Channel * 2] = GetFloatBits(UV.X);
+					CornerWords[4 + Channel * 2] = GetFloatBits(UV.Y);
+				}
+
+				TopologyWords[NumTopologyWords++] = VertexIndex;
+				for (int32 Word = 3; Word < NumCornerWords; ++Word)
+				{
+					TopologyWords[NumTopologyWords++] = CornerWords[Word];
+				}
+			}
+
+			// Start from the lowest corner, comparing whole rotations so that degenerate triangles with a repeated corner
+			// start the same way too; rotating rather than sorting keeps the winding
+			int32 FirstCorner = 0;
+			for (int32 Corner = 1; Corner < 3; ++Corner)
+			{
+				if (IsRotationLess(Corners, Corner, FirstCorner, NumCornerWords))
+				{
+					FirstCorner = Corner;
+				}
+			}
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				FMemory::Memcpy(&ExactWords[Corner * NumCornerWords], Corners[(FirstCorner + Corner) % 3], NumCornerWords * sizeof(uint32));
+			}
+
+			ExactHashes[TriangleIndex] = FXxHash64::HashBuffer(ExactWords, 3 * NumCornerWords * sizeof(uint32)).Hash;
+			TopologyHashes[TriangleIndex] = FXxHash64::HashBuffer(TopologyWords, NumTopologyWords * sizeof(uint32)).Hash;
+		}
+	}
+}
+
+FMeshGeometryHash FMeshGeometryHasher::Hash(const FMeshGeometryStreams& Streams)
+{
+	using namespace MeshGeometryHasher;
+
+	FMeshGeometryHash Result;
+	Result.NumVertices = Streams.Positions.Num();
+	Result.NumTriangles = Streams.Indices.Num() / 3;
+	if (Result.NumVertices == 0 || Result.NumTriangles == 0)
+	{
+		Result.NumTriangles = 0;
+		return Result;
+	}
+
+	int32 NumUVChannels = 0;
+	while (NumUVChannels < FMath::Min(Streams.UVChannels.Num(), MaxUVChannels) && Streams.UVChannels[NumUVChannels].Num() == Result.NumVertices)
+	{
+		++NumUVChannels;
+	}
+
+	const int32 NumChunks = FMath::DivideAndRoundUp(Result.NumTriangles, TrianglesPerChunk);
+	TArray<uint64> ExactHashes;
+	TArray<uint64> TopologyHashes;
+	ExactHashes.SetNumUninitialized(Result.NumTriangles);
+	TopologyHashes.SetNumUninitialized(Result.NumTriangles);
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		const int32 FirstTriangle = ChunkIndex * TrianglesPerChunk;
+		HashChunk(Streams, NumUVChannels, FirstTriangle, FMath::Min(TrianglesPerChunk, Result.NumTriangles - FirstTriangle), ExactHashes, TopologyHashes);
+	}, NumChunks <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	// Sorted, the triangle hashes no longer depend on triangle order
+	ExactHashes.Sort();
+
+	const uint32 Counts[] = { static_cast<uint32>(Result.NumVertices), static_cast<uint32>(Result.NumTriangles), static_cast<uint32>(NumUVChannels) };
+	// Unreferenced vertices do not change the surface, so the exact hash leaves the vertex count out
+	FXxHash64Builder ExactBuilder;
+	ExactBuilder.Update(&Counts[1], 2 * sizeof(uint32));
+	ExactBuilder.Update(ExactHashes.GetData(), ExactHashes.Num() * sizeof(uint64));
+	Result.ExactHash = ExactBuilder.Finalize().Hash;
+
+	FXxHash64Builder TopologyBuilder;
+	TopologyBuilder.Update(Counts, sizeof(Counts));
+	TopologyBuilder.Update(TopologyHashes.GetData(), TopologyHashes.Num() * sizeof(uint64));
+	Result.TopologyHash = TopologyBuilder.Finalize().Hash;
+
+	FVector3f BoundsMin(MAX_flt);
+	FVector3f BoundsMax(-MAX_flt);
+	for (const FVector3f& Position : Streams.Positions)
+	{
+		BoundsMin = BoundsMin.ComponentMin(Position);
+		BoundsMax = BoundsMax.ComponentMax(Position);
+	}
+	const FVector3f HalfSize = (BoundsMax - BoundsMin) * 0.5f;
+	Result.Center = (BoundsMin + BoundsMax) * 0.5f;
+	Result.Extent = FMath::Max3(HalfSize.X, HalfSize.Y, HalfSize.Z);
+
+	constexpr int32 NumShapeSketches = FMeshGeometryHash::NumShapeSketches;
+	const double InvExtent = Result.Extent > UE_SMALL_NUMBER ? 1.0 / Result.Extent : 0.0;
+	const FVector3d Center(Result.Center);
+	const int32 NumVertexChunks = FMath::DivideAndRoundUp(Result.NumVertices, VerticesPerChunk);
+	TArray<FVector3d> ChunkSketches;
+	ChunkSketches.SetNumZeroed(NumVertexChunks * NumShapeSketches);
+	ParallelFor(NumVertexChunks, [&](int32 ChunkIndex)
+	{
+		FVector3d* Sketch = &ChunkSketches[ChunkIndex * NumShapeSketches];
+		const int32 FirstVertex = ChunkIndex * VerticesPerChunk;
+		const int32 EndVertex = FMath::Min(FirstVertex + VerticesPerChunk, Result.NumVertices);
+		for (int32 VertexIndex = FirstVertex; VertexIndex < EndVertex; ++VertexIndex)
+		{
+			const FVector3d Position = (FVector3d(Streams.Positions[VertexIndex]) - Center) * InvExtent;
+			const uint32 Signs = GetSketchSigns(VertexIndex);
+			for (int32 Entry = 0; Entry < NumShapeSketches; ++Entry)
+			{
+				Sketch[Entry] += ((Signs >> Entry) & 1) ? Position : -Position;
+			}
+		}
+	}, NumVertexChunks <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	// Chunks are summed in order, so the sketch does not depend on scheduling
+	for (int32 Entry = 0; Entry < NumShapeSketches; ++Entry)
+	{
+		FVector3d Sum = FVector3d::ZeroVector;
+		for (int32 ChunkIndex = 0; ChunkIndex < NumVertexChunks; ++ChunkIndex)
+		{
+			Sum += ChunkSketches[ChunkIndex * NumShapeSketches + Entry];
+		}
+		Result.ShapeSketch[Entry] = FVector3f(Sum);
+	}
+
+	return Result;
+}
+
+bool FMeshGeometryHasher::IsSameShape(const FMeshGeometryHash& A, const FMeshGeometryHash& B)
+{
+	if (!A.IsValid() || A.TopologyHash != B.TopologyHash || A.NumVertices != B.NumVertices || A.NumTriangles != B.NumTriangles)
+	{
+		return false;
+	}
+
+	for (int32 Entry = 0; Entry < FMeshGeometryHash::NumShapeSketches; ++Entry)
+	{
+		if (!A.ShapeSketch[Entry].Equals(B.ShapeSketch[Entry], ShapeTolerance))
+		{
+			return false;
+		}
+	}
+	return true;
+}
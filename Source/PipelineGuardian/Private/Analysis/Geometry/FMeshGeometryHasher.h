@@ -0,0 +1,85 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+
+/** Streams of one render LOD to hash; every UV channel is indexed like Positions */
+struct FMeshGeometryStreams
+{
+	TConstArrayView<FVector3f> Positions;
+	TArray<TConstArrayView<FVector2f>, TInlineAllocator<8>> UVChannels;
+
+	/** Triangle list indices */
+	TConstArrayView<uint32> Indices;
+};
+
+/** Hashes identifying the geometry of a mesh, for finding duplicates across assets */
+struct FMeshGeometryHash
+{
+	/** Entries of the shape sketch compared by FMeshGeometryHasher::IsSameShape() */
+	static constexpr int32 NumShapeSketches = 16;
+
+	/**
+	 * Hash of the exact positions and UVs of every triangle. Triangles are hashed from their lowest corner on and
+	 * combined in sorted order, so meshes that only differ in vertex order, triangle order or where each triangle's
+	 * index list starts hash the same.
+	 */
+	uint64 ExactHash = 0;
+
+	/**
+	 * Hash of the index buffer and the UVs, in buffer order. Positions are left out, so a mesh that was moved or
+	 * uniformly scaled on export hashes the same as the original; the shape sketch tells apart meshes that merely
+	 * share their topology and UV layout.
+	 */
+	uint64 TopologyHash = 0;
+
+	/** Center of the position bounds */
+	FVector3f Center = FVector3f::ZeroVector;
+
+	/** Largest half extent of the position bounds */
+	float Extent = 0.0f;
+
+	/**
+	 * Signed sums of every vertex, moved by -Center and scaled by 1 / Extent: entry K adds or subtracts each vertex by
+	 * bit K of a hash of its index. The sketches of two meshes with the same topology differ by the sketch of their
+	 * per-vertex differences, so any vertex that moved changes every entry by its displacement.
+	 */
+	FVector3f ShapeSketch[NumShapeSketches];
+
+	int32 NumVertices = 0;
+	int32 NumTriangles = 0;
+
+	/** @return True if there was geometry to hash. */
+	bool IsValid() const { return NumTriangles > 0; }
+};
+
+/**
+ * Hashes the positions, UVs and indices of a render LOD to find meshes imported more than once. Triangles are hashed
+ * in parallel chunks.
+ * Thread-safe; holds no state.
+ */
+class FMeshGeometryHasher
+{
+public:
+	/** Largest difference of a shape sketch coordinate still treated as the same shape, as a fraction of the extent */
+	static constexpr float ShapeTolerance = 1.0e-3f;
+
+	/** UV channels hashed; further channels are ignored */
+	static constexpr int32 MaxUVChannels = 8;
+
+	/**
+	 * @param Streams Streams to hash.
+	 * @return The hashes; invalid when there are no triangles.
+	 */
+	static FMeshGeometryHash Hash(const FMeshGeometryStreams& Streams);
+
+	/**
+	 * Whether two meshes with the same topology hash have the same shape up to translation and uniform scale.
+	 * @param A First mesh.
+	 * @param B Second mesh.
+	 * @return True if every shape sketch entry agrees within ShapeTolerance.
+	 */
+	static bool IsSameShape(const FMeshGeometryHash& A, const FMeshGeometryHash& B);
+};
@@ -0,0 +1,367 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Analysis/Geometry/FOverdrawEstimator.h"
+#include "Analysis/Geometry/FVertexCacheOptimizer.h"
+#include "Async/ParallelFor.h"
+
+namespace OverdrawEstimator
+{
+	/** Depth of pixels no triangle has covered yet */
+	constexpr float FarDepth = MAX_flt;
+
+	/** @return The view directions: the 6 axes and the 8 corners of a cube around the mesh. */
+	TArray<FVector3f, TInlineAllocator<FOverdrawEstimator::NumViews>> GetViewDirections()
+	{
+		TArray<FVector3f, TInlineAllocator<FOverdrawEstimator::NumViews>> Directions;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			for (const float Sign : { 1.0f, -1.0f })
+			{
+				FVector3f Direction = FVector3f::ZeroVector;
+				Direction[Axis] = Sign;
+				Directions.Add(Direction);
+			}
+		}
+		const float Diagonal = 1.0f / FMath::Sqrt(3.0f);
+		for (int32 Corner = 0; Corner < 8; ++Corner)
+		{
+			Directions.Add(FVector3f(Corner & 1 ? Diagonal : -Diagonal, Corner & 2 ? Diagonal : -Diagonal, Corner & 4 ? Diagonal : -Diagonal));
+		}
+		return Directions;
+	}
+
+	/**
+	 * @return Whether a triangle owns the pixels exactly on its edge from A to B. Adjacent triangles walk a shared edge
+	 * in opposite directions, so exactly one of them owns it and the edge is not drawn twice.
+	 */
+	bool OwnsEdge(const FVector3f& A, const FVector3f& B)
+	{
+		const float DeltaX = B.X - A.X;
+		const float DeltaY = B.Y - A.Y;
+		return DeltaY > 0.0f || (DeltaY == 0.0f && DeltaX < 0.0f);
+	}
+
+	/** @return Twice the signed screen area of the triangle A, B, P; positive when P is left of the edge from A to B. */
+	float EdgeFunction(const FVector3f& A, const FVector3f& B, float PixelX, float PixelY)
+	{
+		return (B.X - A.X) * (PixelY - A.Y) - (B.Y - A.Y) * (PixelX - A.X);
+	}
+
+	/** Depth-rasterizes all triangles, in order, looking along one direction */
+	FOverdrawStats RasterizeView(TConstArrayView<FVector3f> Positions, TConstArrayView<uint32> Indices, const FVector3f& Center, float Radius, const FVector3f& ViewDirection, bool bCullBackFaces, int32 Resolution)
+	{
+		FOverdrawStats Stats;
+
+		// Orthographic projection of the bounding sphere onto the depth buffer; Z holds the depth along the view
+		const FVector3f Up = FMath::Abs(ViewDirection.Z) < 0.9f ? FVector3f(0.0f, 0.0f, 1.0f) : FVector3f(1.0f, 0.0f, 0.0f);
+		const FVector3f AxisX = FVector3f::CrossProduct(Up, ViewDirection).GetSafeNormal();
+		const FVector3f AxisY = FVector3f::CrossProduct(ViewDirection, AxisX);
+		const float Scale = 0.5f * Resolution / Radius;
+		const float Offset = 0.5f * Resolution;
+		auto Project = [&](const FVector3f& Position)
+		{
+			const FVector3f Local = Position - Center;
+			return FVector3f(FVector3f::DotProduct(Local, AxisX) * Scale + Offset, FVector3f::DotProduct(Local, AxisY) * Scale + Offset, FVector3f::DotProduct(Local, ViewDirection));
+		};
+
+		TArray<float> Depth;
+		Depth.Init(FarDepth, Resolution * Resolution);
+
+		const int32 NumTriangles = Indices.Num() / 3;
+		const uint32 NumPositions = static_cast<uint32>(Positions.Num());
+		for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; ++TriangleIndex)
+		{
+			const uint32 Index0 = Indices[TriangleIndex * 3];
+			const uint32 Index1 = Indices[TriangleIndex * 3 + 1];
+			const uint32 Index2 = Indices[TriangleIndex * 3 + 2];
+			if (Index0 >= NumPositions || Index1 >= NumPositions || Index2 >= NumPositions)
+			{
+				continue;
+			}
+
+			const FVector3f& Position0 = Positions[Index0];
+			const FVector3f& Position1 = Positions[Index1];
+			const FVector3f& Position2 = Positions[Index2];
+			if (bCullBackFaces && FVector3f::DotProduct(FVector3f::CrossProduct(Position1 - Position0, Position2 - Position0), ViewDirection) >= 0.0f)
+			{
+				continue;
+			}
+
+			FVector3f Corner0 = Project(Position0);
+			FVector3f Corner1 = Project(Position1);
+			FVector3f Corner2 = Project(Position2);
+			float Area = EdgeFunction(Corner0, Corner1, Corner2.X, Corner2.Y);
+			if (FMath::Abs(Area) <= UE_SMALL_NUMBER)
+			{
+				continue;
+			}
+			if (Area < 0.0f)
+			{
+				Swap(Corner1, Corner2);
+				Area = -Area;
+			}
+
+			// Pixels whose centers lie inside the triangle's screen bounds
+			const int32 MinX = FMath::Max(FMath::CeilToInt(FMath::Min3(Corner0.X, Corner1.X, Corner2.X) - 0.5f), 0);
+			const int32 MaxX = FMath::Min(FMath::FloorToInt(FMath::Max3(Corner0.X, Corner1.X, Corner2.X) - 0.5f), Resolution - 1);
+			const int32 MinY = FMath::Max(FMath::CeilToInt(FMath::Min3(Corner0.Y, Corner1.Y, Corner2.Y) - 0.5f), 0);
+			const int32 MaxY = FMath::Min(FMath::FloorToInt(FMath::Max3(Corner0.Y, Corner1.Y, Corner2.Y) - 0.5f), Resolution - 1);
+
+			const bool bOwnsEdge0 = OwnsEdge(Corner1, Corner2);
+			const bool bOwnsEdge1 = OwnsEdge(Corner2, Corner0);
+			const bool bOwnsEdge2 = OwnsEdge(Corner0, Corner1);
+			const float InvArea = 1.0f / Area;
+
+			for (int32 Y = MinY; Y <= MaxY; ++Y)
+			{
+				const float PixelY = Y + 0.5f;
+				float* DepthRow = &Depth[Y * Resolution];
+				for (int32 X = MinX; X <= MaxX; ++X)
+				{
+					const float PixelX = X + 0.5f;
+					const float Weight0 = EdgeFunction(Corner1, Corner2, PixelX, PixelY);
+					const float Weight1 = EdgeFunction(Corner2, Corner0, PixelX, PixelY);
+					const float Weight2 = EdgeFunction(Corner0, Corner1, PixelX, PixelY);
+					if (Weight0 < 0.0f || Weight1 < 0.0f || Weight2 < 0.0f
+						|| (Weight0 == 0.0f && !bOwnsEdge0) || (Weight1 == 0.0f && !bOwnsEdge1) || (Weight2 == 0.0f && !bOwnsEdge2))
+					{
+						continue;
+					}
+
+					// Early-Z: the pixel shader runs only for fragments in front of everything drawn so far
+					const float PixelDepth = (Weight0 * Corner0.Z + Weight1 * Corner1.Z + Weight2 * Corner2.Z) * InvArea;
+					float& StoredDepth = DepthRow[X];
+					if (PixelDepth < StoredDepth)
+					{
+						if (StoredDepth == FarDepth)
+						{
+							++Stats.NumCoveredPixels;
+						}
+						StoredDepth = PixelDepth;
+						++Stats.NumShadedPixels;
+					}
+				}
+			}
+		}
+
+		return Stats;
+	}
+
+	/** FIFO vertex cache over a range of vertex indices that can be flushed in constant time */
+	class FFifoCache
+	{
+	public:
+		FFifoCache(uint32 InMinIndex, uint32 InMaxIndex)
+			: MinIndex(InMinIndex)
+		{
+			// A vertex stays cached until ClusterCacheSize further misses have pushed it out, so the miss count at
+			// which it entered tells whether it is still cached
+			EntryStamps.Init(MIN_int64 / 2, static_cast<int32>(InMaxIndex - InMinIndex) + 1);
+		}
+
+		/** @return Vertices of the triangle that missed the cache, 0-3. */
+		int32 AddTriangle(const uint32* Corners)
+		{
+			int32 NumMisses = 0;
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				int64& EntryStamp = EntryStamps[Corners[Corner] - MinIndex];
+				if (Clock - EntryStamp >= FOverdrawEstimator::ClusterCacheSize)
+				{
+					EntryStamp = Clock++;
+					++NumMisses;
+				}
+			}
+			return NumMisses;
+		}
+
+		/** Evicts every vertex, as if a new draw call started */
+		void Flush()
+		{
+			Clock += FOverdrawEstimator::ClusterCacheSize;
+		}
+
+	private:
+		TArray<int64> EntryStamps;
+		uint32 MinIndex = 0;
+		int64 Clock = 0;
+	};
+}
+
+FOverdrawStats FOverdrawEstimator::Estimate(TConstArrayView<FVector3f> Positions, TConstArrayView<uint32> Indices, bool bCullBackFaces, int32 Resolution)
+{
+	using namespace OverdrawEstimator;
+
+	FOverdrawStats Stats;
+	Stats.NumTriangles = Indices.Num() / 3;
+	Resolution = FMath::Clamp(Resolution, 16, 1024);
+
+	// Bounds of the vertices the triangles use, which may be a small part of the LOD's vertex buffer
+	FVector3f MinPosition(MAX_flt);
+	FVector3f MaxPosition(-MAX_flt);
+	for (int32 Index = 0; Index < Stats.NumTriangles * 3; ++Index)
+	{
+		if (Indices[Index] < static_cast<uint32>(Positions.Num()))
+		{
+			MinPosition = MinPosition.ComponentMin(Positions[Indices[Index]]);
+			MaxPosition = MaxPosition.ComponentMax(Positions[Indices[Index]]);
+		}
+	}
+	const float Radius = 0.5f * (MaxPosition - MinPosition).Size();
+	if (!(Radius > UE_SMALL_NUMBER))
+	{
+		return Stats;
+	}
+	const FVector3f Center = 0.5f * (MinPosition + MaxPosition);
+
+	const TArray<FVector3f, TInlineAllocator<NumViews>> ViewDirections = GetViewDirections();
+	TArray<FOverdrawStats> ViewStats;
+	ViewStats.SetNum(ViewDirections.Num());
+	ParallelFor(ViewDirections.Num(), [&](int32 ViewIndex)
+	{
+		ViewStats[ViewIndex] = RasterizeView(Positions, Indices, Center, Radius, ViewDirections[ViewIndex], bCullBackFaces, Resolution);
+	});
+
+	for (const FOverdrawStats& View : ViewStats)
+	{
+		Stats.NumCoveredPixels += View.NumCoveredPixels;
+		Stats.NumShadedPixels += View.NumShadedPixels;
+	}
+	return Stats;
+}
+
+void FOverdrawEstimator::OptimizeTriangleOrder(TConstArrayView<FVector3f> Positions, TConstArrayView<uint32> Indices, float CacheThreshold, TArray<int32>& OutTriangleOrder)
+{
+	using namespace OverdrawEstimator;
+
+	OutTriangleOrder.Reset();
+	const int32 NumTriangles = Indices.Num() / 3;
+	if (NumTriangles == 0)
+	{
+		return;
+	}
+
+	TArray<int32> CacheOrder;
+	TArray<uint32> OrderedIndices;
+	FVertexCacheOptimizer::OptimizeTriangleOrder(Indices, CacheOrder);
+	FVertexCacheOptimizer::ReorderTriangles(Indices, CacheOrder, OrderedIndices);
+
+	uint32 MinIndex = MAX_uint32;
+	uint32 MaxIndex = 0;
+	for (const uint32 Index : OrderedIndices)
+	{
+		MinIndex = FMath::Min(MinIndex, Index);
+		MaxIndex = FMath::Max(MaxIndex, Index);
+	}
+
+	// Hard boundaries: triangles whose three vertices all miss the cache, where the cache-optimized order restarts anyway.
+	// The first triangle always starts a cluster; with a repeated index it misses fewer than three times.
+	TArray<int32> HardStarts;
+	TArray<int32> HardMisses;
+	{
+		FFifoCache Cache(MinIndex, MaxIndex);
+		for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; ++TriangleIndex)
+		{
+			const int32 NumMisses = Cache.AddTriangle(&OrderedIndices[TriangleIndex * 3]);
+			if (NumMisses == 3 || HardStarts.Num() == 0)
+			{
+				HardStarts.Add(TriangleIndex);
+				HardMisses.Add(0);
+			}
+			HardMisses.Last() += NumMisses;
+		}
+	}
+
+	// Soft boundaries: split each hard cluster, with a cold cache, as soon as the part so far has an ACMR within
+	// CacheThreshold of the whole cluster's, so that sorting the parts costs little vertex cache reuse
+	TArray<int32> ClusterStarts;
+	{
+		FFifoCache Cache(MinIndex, MaxIndex);
+		for (int32 HardIndex = 0; HardIndex < HardStarts.Num(); ++HardIndex)
+		{
+			const int32 Start = HardStarts[HardIndex];
+			const int32 End = HardIndex + 1 < HardStarts.Num() ? HardStarts[HardIndex + 1] : NumTriangles;
+			const float MaxACMR = CacheThreshold * HardMisses[HardIndex] / (End - Start);
+
+			Cache.Flush();
+			ClusterStarts.Add(Start);
+			int32 ClusterStart = Start;
+			int32 ClusterMisses = 0;
+			for (int32 TriangleIndex = Start; TriangleIndex < End; ++TriangleIndex)
+			{
+				ClusterMisses += Cache.AddTriangle(&OrderedIndices[TriangleIndex * 3]);
+				if (TriangleIndex + 1 < End && ClusterMisses <= MaxACMR * (TriangleIndex + 1 - ClusterStart))
+				{
+					Cache.Flush();
+					ClusterStart = TriangleIndex + 1;
+					ClusterStarts.Add(ClusterStart);
+					ClusterMisses = 0;
+				}
+			}
+		}
+	}
+	const int32 NumClusters = ClusterStarts.Num();
+	ClusterStarts.Add(NumTriangles);
+
+	// Area-weighted centroid and normal of every cluster and of the whole mesh
+	TArray<FVector3f> ClusterCentroids;
+	TArray<FVector3f> ClusterNormals;
+	ClusterCentroids.SetNum(NumClusters);
+	ClusterNormals.SetNum(NumClusters);
+	FVector3f MeshCentroid = FVector3f::ZeroVector;
+	float MeshArea = 0.0f;
+	const uint32 NumPositions = static_cast<uint32>(Positions.Num());
+	for (int32 ClusterIndex = 0; ClusterIndex < NumClusters; ++ClusterIndex)
+	{
+		FVector3f Centroid = FVector3f::ZeroVector;
+		FVector3f Normal = FVector3f::ZeroVector;
+		float Area = 0.0f;
+		for (int32 TriangleIndex = ClusterStarts[ClusterIndex]; TriangleIndex < ClusterStarts[ClusterIndex + 1]; ++TriangleIndex)
+		{
+			const uint32* Corners = &OrderedIndices[TriangleIndex * 3];
+			if (Corners[0] >= NumPositions || Corners[1] >= NumPositions || Corners[2] >= NumPositions)
+			{
+				continue;
+			}
+
+			const FVector3f& Position0 = Positions[Corners[0]];
+			const FVector3f& Position1 = Positions[Corners[1]];
+			const FVector3f& Position2 = Positions[Corners[2]];
+			const FVector3f Cross = FVector3f::CrossProduct(Position1 - Position0, Position2 - Position0);
+			const float TriangleArea = Cross.Size();
+			Centroid += (Position0 + Position1 + Position2) * (TriangleArea / 3.0f);
+			Normal += Cross;
+			Area += TriangleArea;
+		}
+
+		MeshCentroid += Centroid;
+		MeshArea += Area;
+		ClusterCentroids[ClusterIndex] = Area > 0.0f ? Centroid / Area : FVector3f::ZeroVector;
+		ClusterNormals[ClusterIndex] = Normal.GetSafeNormal();
+	}
+	if (MeshArea > 0.0f)
+	{
+		MeshCentroid /= MeshArea;
+	}
+
+	// Clusters far out along their normal occlude the rest of the mesh from most directions they can be seen from, so they go first
+	TArray<float> SortKeys;
+	TArray<int32> ClusterOrder;
+	SortKeys.SetNumUninitialized(NumClusters);
+	ClusterOrder.SetNumUninitialized(NumClusters);
+	for (int32 ClusterIndex = 0; ClusterIndex < NumClusters; ++ClusterIndex)
+	{
+		SortKeys[ClusterIndex] = FVector3f::DotProduct(ClusterCentroids[ClusterIndex] - MeshCentroid, ClusterNormals[ClusterIndex]);
+		ClusterOrder[ClusterIndex] = ClusterIndex;
+	}
+	ClusterOrder.StableSort([&SortKeys](int32 A, int32 B) { return SortKeys[A] > SortKeys[B]; });
+
+	OutTriangleOrder.Reserve(NumTriangles);
+	for (const int32 ClusterIndex : ClusterOrder)
+	{
+		for (int32 TriangleIndex = ClusterStarts[ClusterIndex]; TriangleIndex < ClusterStarts[ClusterIndex + 1]; ++TriangleIndex)
+		{
+			OutTriangleOrder.Add(CacheOrder[TriangleIndex]);
+		}
+	}
+}
@@ -0,0 +1,70 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+
+/** Self-overdraw of a triangle list, summed over the canonical view directions */
+struct FOverdrawStats
+{
+	int32 NumTriangles = 0;
+
+	/** Pixels at least one triangle covers */
+	int64 NumCoveredPixels = 0;
+
+	/** Pixels that passed the depth test when they were drawn, i.e. would run the pixel shader with early-Z */
+	int64 NumShadedPixels = 0;
+
+	/** @return Pixel shader invocations per covered pixel: 1 when triangles are drawn front to back, higher the more they overlap back to front. */
+	float GetOverdraw() const { return NumCoveredPixels > 0 ? static_cast<float>(static_cast<double>(NumShadedPixels) / NumCoveredPixels) : 0.0f; }
+
+	FOverdrawStats& operator+=(const FOverdrawStats& Other)
+	{
+		NumTriangles += Other.NumTriangles;
+		NumCoveredPixels += Other.NumCoveredPixels;
+		NumShadedPixels += Other.NumShadedPixels;
+		return *this;
+	}
+};
+
+/**
+ * Estimates how much a triangle order overdraws itself, and reorders triangles to overdraw less while keeping most
+ * of their vertex cache reuse.
+ * Estimate() depth-rasterizes the triangles in draw order from the 6 axis and 8 corner directions of the bounding
+ * box, orthographically and at a low resolution, and counts the pixels that pass an early depth test.
+ * OptimizeTriangleOrder() follows Sander et al., "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw":
+ * it splits a cache-optimized order into clusters at points where the cache restarts, and sorts the clusters so that
+ * those on the outside of the mesh, facing away from its center, are drawn first.
+ * Indices are absolute into Positions. Thread-safe; holds no state.
+ */
+class FOverdrawEstimator
+{
+public:
+	/** Number of view directions Estimate() rasterizes */
+	static constexpr int32 NumViews = 14;
+
+	/** Default width and height of the depth buffer of each view */
+	static constexpr int32 DefaultResolution = 128;
+
+	/** FIFO cache size the cluster boundaries are found with */
+	static constexpr int32 ClusterCacheSize = 16;
+
+	/**
+	 * @param Positions Vertex positions.
+	 * @param Indices Triangle list indices, in draw order.
+	 * @param bCullBackFaces Skip triangles facing away from the view, as for one-sided materials.
+	 * @param Resolution Width and height of the depth buffer of each view.
+	 * @return Covered and shaded pixels over all views.
+	 */
+	static FOverdrawStats Estimate(TConstArrayView<FVector3f> Positions, TConstArrayView<uint32> Indices, bool bCullBackFaces, int32 Resolution = DefaultResolution);
+
+	/**
+	 * Orders triangles for low overdraw and vertex cache reuse.
+	 * @param Positions Vertex positions.
+	 * @param Indices Triangle list indices.
+	 * @param CacheThreshold How much worse than the cache-optimized order each cluster's ACMR may get, e.g. 1.05; higher values give smaller clusters that sort better.
+	 * @param OutTriangleOrder Index of the input triangle to draw at each position, as for FVertexCacheOptimizer::ReorderTriangles().
+	 */
+	static void OptimizeTriangleOrder(TConstArrayView<FVector3f> Positions, TConstArrayView<uint32> Indices, float CacheThreshold, TArray<int32>& OutTriangleOrder);
+};
@@ -0,0 +1,130 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Analysis/Geometry/FShapeDescriptorBuilder.h"
+#include "Algo/BinarySearch.h"
+#include "Async/ParallelFor.h"
+#include "Math/RandomStream.h"
+
+namespace ShapeDescriptorBuilder
+{
+	/** Points or pairs per parallel work item */
+	constexpr int32 SamplesPerChunk = 1024;
+
+	/** Seeds of the point and pair streams; a chunk adds its index */
+	constexpr int32 PointSeed = 0x5eed;
+	constexpr int32 PairSeed = 0x9a1d;
+
+	/** Adds Distances, divided by their mean, to NumBins bins starting at FirstBin, each distance weighing 1 / Distances.Num() */
+	void AddHistogram(TConstArrayView<float> Distances, float* FirstBin, int32 NumBins)
+	{
+		double DistanceSum = 0.0;
+		for (const float Distance : Distances)
+		{
+			DistanceSum += Distance;
+		}
+		const double MeanDistance = DistanceSum / FMath::Max(Distances.Num(), 1);
+		const float BinsPerRatio = MeanDistance > UE_SMALL_NUMBER ? static_cast<float>(NumBins / (FShapeDescriptor::MaxDistanceRatio * MeanDistance)) : 0.0f;
+		const float Weight = 1.0f / FMath::Max(Distances.Num(), 1);
+
+		for (const float Distance : Distances)
+		{
+			FirstBin[FMath::Min(static_cast<int32>(Distance * BinsPerRatio), NumBins - 1)] += Weight;
+		}
+	}
+}
+
+float FShapeDescriptor::GetSimilarity(const FShapeDescriptor& A, const FShapeDescriptor& B)
+{
+	float PairDistance = 0.0f;
+	for (int32 Bin = 0; Bin < NumPairBins; ++Bin)
+	{
+		PairDistance += FMath::Abs(A.Bins[Bin] - B.Bins[Bin]);
+	}
+	float RadialDistance = 0.0f;
+	for (int32 Bin = NumPairBins; Bin < NumBins; ++Bin)
+	{
+		RadialDistance += FMath::Abs(A.Bins[Bin] - B.Bins[Bin]);
+	}
+	return FMath::Clamp(1.0f - 0.25f * (PairDistance + RadialDistance), 0.0f, 1.0f);
+}
+
+FShapeDescriptor FShapeDescriptorBuilder::Build(TConstArrayView<FVector3f> Positions, TConstArrayView<uint32> Indices)
+{
+	using namespace ShapeDescriptorBuilder;
+
+	FShapeDescriptor Descriptor;
+	const int32 NumTriangles = Indices.Num() / 3;
+	const uint32 NumVertices = static_cast<uint32>(Positions.Num());
+
+	// Running area over the triangles, to pick triangles in proportion to their area
+	TArray<double> CumulativeAreas;
+	CumulativeAreas.SetNumUninitialized(NumTriangles);
+	double TotalArea = 0.0;
+	FVector3d WeightedCentroid = FVector3d::ZeroVector;
+	for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; ++TriangleIndex)
+	{
+		const uint32 Index0 = Indices[TriangleIndex * 3];
+		const uint32 Index1 = Indices[TriangleIndex * 3 + 1];
+		const uint32 Index2 = Indices[TriangleIndex * 3 + 2];
+		if (Index0 < NumVertices && Index1 < NumVertices && Index2 < NumVertices)
+		{
+			const FVector3d Position0(Positions[Index0]);
+			const FVector3d Position1(Positions[Index1]);
+			const FVector3d Position2(Positions[Index2]);
+			const double Area = 0.5 * FVector3d::CrossProduct(Position1 - Position0, Position2 - Position0).Size();
+			TotalArea += Area;
+			WeightedCentroid += (Position0 + Position1 + Position2) * (Area / 3.0);
+		}
+		CumulativeAreas[TriangleIndex] = TotalArea;
+	}
+	if (TotalArea <= 0.0)
+	{
+		return Descriptor;
+	}
+	const FVector3f Centroid(WeightedCentroid / TotalArea);
+
+	TArray<FVector3f> Points;
+	TArray<float> RadialDistances;
+	Points.SetNumUninitialized(NumSamplePoints);
+	RadialDistances.SetNumUninitialized(NumSamplePoints);
+	const int32 NumPointChunks = FMath::DivideAndRoundUp(NumSamplePoints, SamplesPerChunk);
+	ParallelFor(NumPointChunks, [&](int32 ChunkIndex)
+	{
+		FRandomStream RandomStream(PointSeed + ChunkIndex);
+		const int32 LastPoint = FMath::Min((ChunkIndex + 1) * SamplesPerChunk, NumSamplePoints);
+		for (int32 PointIndex = ChunkIndex * SamplesPerChunk; PointIndex < LastPoint; ++PointIndex)
+		{
+			const double AreaPosition = RandomStream.GetFraction() * TotalArea;
+			const int32 TriangleIndex = FMath::Min(Algo::UpperBound(CumulativeAreas, AreaPosition), NumTriangles - 1);
+
+			// Uniform over the triangle
+			const float SqrtU = FMath::Sqrt(RandomStream.GetFraction());
+			const float V = RandomStream.GetFraction();
+			const FVector3f& Position0 = Positions[Indices[TriangleIndex * 3]];
+			const FVector3f& Position1 = Positions[Indices[TriangleIndex * 3 + 1]];
+			const FVector3f& Position2 = Positions[Indices[TriangleIndex * 3 + 2]];
+			Points[PointIndex] = Position0 * (1.0f - SqrtU) + Position1 * (SqrtU * (1.0f - V)) + Position2 * (SqrtU * V);
+			RadialDistances[PointIndex] = (Points[PointIndex] - Centroid).Size();
+		}
+	}, NumPointChunks <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	TArray<float> PairDistances;
+	PairDistances.SetNumUninitialized(NumSamplePairs);
+	const int32 NumPairChunks = FMath::DivideAndRoundUp(NumSamplePairs, SamplesPerChunk);
+	ParallelFor(NumPairChunks, [&](int32 ChunkIndex)
+	{
+		FRandomStream RandomStream(PairSeed + ChunkIndex);
+		const int32 LastPair = FMath::Min((ChunkIndex + 1) * SamplesPerChunk, NumSamplePairs);
+		for (int32 PairIndex = ChunkIndex * SamplesPerChunk; PairIndex < LastPair; ++PairIndex)
+		{
+			const FVector3f& PointA = Points[RandomStream.RandHelper(NumSamplePoints)];
+			const FVector3f& PointB = Points[RandomStream.RandHelper(NumSamplePoints)];
+			PairDistances[PairIndex] = (PointA - PointB).Size();
+		}
+	}, NumPairChunks <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	AddHistogram(PairDistances, &Descriptor.Bins[0], FShapeDescriptor::NumPairBins);
+	AddHistogram(RadialDistances, &Descriptor.Bins[FShapeDescriptor::NumPairBins], FShapeDescriptor::NumRadialBins);
+	Descriptor.bValid = true;
+	return Descriptor;
+}
@@ -0,0 +1,58 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+
+/**
+ * Rotation, translation and scale invariant signature of a surface: the distribution of distances between random
+ * surface points (D2) followed by the distribution of distances from the surface points to the area centroid (D1).
+ * Distances are divided by their mean, and each histogram sums to 1.
+ */
+struct FShapeDescriptor
+{
+	static constexpr int32 NumPairBins = 32;
+	static constexpr int32 NumRadialBins = 16;
+	static constexpr int32 NumBins = NumPairBins + NumRadialBins;
+
+	/** Distances up to this multiple of the mean fall into the histograms; longer ones are counted in the last bin */
+	static constexpr float MaxDistanceRatio = 3.0f;
+
+	/** Pair distance histogram, then radial distance histogram */
+	float Bins[NumBins] = {};
+
+	bool bValid = false;
+
+	/** @return True if the surface had area to sample. */
+	bool IsValid() const { return bValid; }
+
+	/**
+	 * @param A First descriptor.
+	 * @param B Second descriptor.
+	 * @return 1 minus half the L1 distance of the histograms, averaged over both: 1 for identical distributions, 0 for disjoint ones.
+	 */
+	static float GetSimilarity(const FShapeDescriptor& A, const FShapeDescriptor& B);
+};
+
+/**
+ * Builds the shape descriptor of a triangle mesh from area-weighted random surface samples. Sampling uses fixed
+ * seeds, so a mesh always gets the same descriptor, and runs in parallel chunks.
+ * Thread-safe; holds no state.
+ */
+class FShapeDescriptorBuilder
+{
+public:
+	/** Surface points sampled */
+	static constexpr int32 NumSamplePoints = 4 * 1024;
+
+	/** Point pairs whose distance goes into the pair histogram */
+	static constexpr int32 NumSamplePairs = 32 * 1024;
+
+	/**
+	 * @param Positions Vertex positions.
+	 * @param Indices Triangle list indices into Positions.
+	 * @return The descriptor; invalid when the triangles have no area.
+	 */
+	static FShapeDescriptor Build(TConstArrayView<FVector3f> Positions, TConstArrayView<uint32> Indices);
+};
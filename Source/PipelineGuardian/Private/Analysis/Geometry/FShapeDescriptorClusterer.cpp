@@ -0,0 +1,265 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Analysis/Geometry/FShapeDescriptorClusterer.h"
+#include "Async/ParallelFor.h"
+#include "Math/RandomStream.h"
+
+namespace ShapeDescriptorClusterer
+{
+	/** Descriptors or pairs per parallel work item */
+	constexpr int32 ItemsPerChunk = 1024;
+
+	constexpr int32 ProjectionSeed = 0x15b;
+
+	/** Bucket width in units of the largest descriptor distance still at the similarity threshold */
+	constexpr float BucketWidthScale = 2.0f;
+
+	constexpr int32 NumProjections = FShapeDescriptorClusterer::NumTables * FShapeDescriptorClusterer::NumProjectionsPerTable;
+
+	/** Random direction in descriptor space and random offset of the bucket grid along it */
+	struct FProjection
+	{
+		float Direction[FShapeDescriptor::NumBins];
+		float Offset = 0.0f;
+	};
+
+	/** @return FNV-1a style combination of a key and a bucket coordinate. */
+	uint64 CombineKey(uint64 Key, int32 Value)
+	{
+		return (Key ^ static_cast<uint32>(Value)) * 0x100000001b3ULL;
+	}
+
+	int32 FindRoot(TArray<int32>& Parents, int32 Index)
+	{
+		while (Parents[Index] != Index)
+		{
+			Parents[Index] = Parents[Parents[Index]];
+			Index = Parents[Index];
+		}
+		return Index;
+	}
+}
+
+TArray<FShapeCluster> FShapeDescriptorClusterer::Cluster(TConstArrayView<FShapeDescriptor> Descriptors, float MinSimilarity)
+{
+	using namespace ShapeDescriptorClusterer;
+
+	TArray<int32> ValidDescriptors;
+	for (int32 DescriptorIndex = 0; DescriptorIndex < Descriptors.Num(); ++DescriptorIndex)
+	{
+		if (Descriptors[DescriptorIndex].IsValid())
+		{
+			ValidDescriptors.Add(DescriptorIndex);
+		}
+	}
+	const int32 NumValid = ValidDescriptors.Num();
+	if (NumValid < 2)
+	{
+		return {};
+	}
+
+	// Descriptors at the threshold are at most this far apart in L1, which bounds their L2 distance too; with p-stable
+	// projections the bucket width is what trades missed pairs against bucket size
+	const float MaxDistance = 4.0f * (1.0f - FMath::Clamp(MinSimilarity, 0.0f, 1.0f));
+	const float BucketWidth = FMath::Max(BucketWidthScale * MaxDistance, 1.0e-3f);
+
+	// Gaussian directions, drawn with the Box-Muller transform from a fixed seed so that keys are the same every run
+	TArray<FProjection> Projections;
+	Projections.SetNum(NumProjections);
+	FRandomStream RandomStream(ProjectionSeed);
+	for (FProjection& Projection : Projections)
+	{
+		for (float& Component : Projection.Direction)
+		{
+			const float Radius = FMath::Sqrt(-2.0f * FMath::Loge(FMath::Max(RandomStream.GetFraction(), 1.0e-7f)));
+			Component = Radius * FMath::Cos(2.0f * UE_PI * RandomStream.GetFraction());
+		}
+		Projection.Offset = RandomStream.GetFraction() * BucketWidth;
+	}
+
+	// Bucket key of every descriptor in every table, and its position along the first projection of the table
+	TArray<uint64> Keys;
+	TArray<float> BucketPositions;
+	Keys.SetNumUninitialized(NumValid * NumTables);
+	BucketPositions.SetNumUninitialized(NumValid * NumTables);
+	const int32 NumKeyChunks = FMath::DivideAndRoundUp(NumValid, ItemsPerChunk);
+	ParallelFor(NumKeyChunks, [&](int32 ChunkIndex)
+	{
+		const int32 LastValid = FMath::Min((ChunkIndex + 1) * ItemsPerChunk, NumValid);
+		for (int32 ValidIndex = ChunkIndex * ItemsPerChunk; ValidIndex < LastValid; ++ValidIndex)
+		{
+			const FShapeDescriptor& Descriptor = Descriptors[ValidDescriptors[ValidIndex]];
+			for (int32 Table = 0; Table < NumTables; ++Table)
+			{
+				uint64 Key = 0xcbf29ce484222325ULL;
+				for (int32 ProjectionIndex = Table * NumProjectionsPerTable; ProjectionIndex < (Table + 1) * NumProjectionsPerTable; ++ProjectionIndex)
+				{
+					const FProjection& Projection = Projections[ProjectionIndex];
+					float Dot = Projection.Offset;
+					for (int32 Bin = 0; Bin < FShapeDescriptor::NumBins; ++Bin)
+					{
+						Dot += Projection.Direction[Bin] * Descriptor.Bins[Bin];
+					}
+					Key = CombineKey(Key, FMath::FloorToInt(Dot / BucketWidth));
+					if (ProjectionIndex == Table * NumProjectionsPerTable)
+					{
+						BucketPositions[ValidIndex * NumTables + Table] = Dot;
+					}
+				}
+				Keys[ValidIndex * NumTables + Table] = Key;
+			}
+		}
+	}, NumKeyChunks <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	// Pairs sharing a bucket in any table, as (lower << 32 | higher) valid indices
+	TArray<uint64> CandidatePairs;
+	TArray<int32> Order;
+	Order.SetNumUninitialized(NumValid);
+	for (int32 Table = 0; Table < NumTables; ++Table)
+	{
+		for (int32 ValidIndex = 0; ValidIndex < NumValid; ++ValidIndex)
+		{
+			Order[ValidIndex] = ValidIndex;
+		}
+		// Within a bucket, by position along a projection, so that the neighbors a descriptor is compared with are the nearest ones
+		Order.Sort([&Keys, &BucketPositions, Table](int32 A, int32 B)
+		{
+			const uint64 KeyA = Keys[A * NumTables + Table];
+			const uint64 KeyB = Keys[B * NumTables + Table];
+			if (KeyA != KeyB)
+			{
+				return KeyA < KeyB;
+			}
+			const float PositionA = BucketPositions[A * NumTables + Table];
+			const float PositionB = BucketPositions[B * NumTables + Table];
+			return PositionA != PositionB ? PositionA < PositionB : A < B;
+		});
+
+		for (int32 First = 0; First < NumValid; )
+		{
+			const uint64 BucketKey = Keys[Order[First] * NumTables + Table];
+			int32 End = First + 1;
+			while (End < NumValid && Keys[Order[End] * NumTables + Table] == BucketKey)
+			{
+				++End;
+			}
+			for (int32 A = First; A < End; ++A)
+			{
+				for (int32 B = A + 1; B < FMath::Min(End, A + 1 + MaxComparisonsPerDescriptor); ++B)
+				{
+					const int32 Lower = FMath::Min(Order[A], Order[B]);
+					const int32 Higher = FMath::Max(Order[A], Order[B]);
+					CandidatePairs.Add((static_cast<uint64>(Lower) << 32) | static_cast<uint32>(Higher));
+				}
+			}
+			First = End;
+		}
+	}
+
+	CandidatePairs.Sort();
+	int32 NumUnique = 0;
+	for (int32 PairIndex = 0; PairIndex < CandidatePairs.Num(); ++PairIndex)
+	{
+		if (NumUnique == 0 || CandidatePairs[PairIndex] != CandidatePairs[NumUnique - 1])
+		{
+			CandidatePairs[NumUnique++] = CandidatePairs[PairIndex];
+		}
+	}
+	CandidatePairs.SetNum(NumUnique);
+
+	TArray<uint8> IsLinked;
+	IsLinked.SetNumZeroed(NumUnique);
+	const int32 NumPairChunks = FMath::DivideAndRoundUp(NumUnique, ItemsPerChunk);
+	ParallelFor(NumPairChunks, [&](int32 ChunkIndex)
+	{
+		const int32 LastPair = FMath::Min((ChunkIndex + 1) * ItemsPerChunk, NumUnique);
+		for (int32 PairIndex = ChunkIndex * ItemsPerChunk; PairIndex < LastPair; ++PairIndex)
+		{
+			const int32 A = static_cast<int32>(CandidatePairs[PairIndex] >> 32);
+			const int32 B = static_cast<int32>(CandidatePairs[PairIndex] & 0xffffffffu);
+			IsLinked[PairIndex] = FShapeDescriptor::GetSimilarity(Descriptors[ValidDescriptors[A]], Descriptors[ValidDescriptors[B]]) >= MinSimilarity;
+		}
+	}, NumPairChunks <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	TArray<int32> Parents;
+	TArray<int32> NumLinks;
+	Parents.SetNumUninitialized(NumValid);
+	NumLinks.SetNumZeroed(NumValid);
+	for (int32 ValidIndex = 0; ValidIndex < NumValid; ++ValidIndex)
+	{
+		Parents[ValidIndex] = ValidIndex;
+	}
+	for (int32 PairIndex = 0; PairIndex < NumUnique; ++PairIndex)
+	{
+		if (IsLinked[PairIndex])
+		{
+			const int32 A = static_cast<int32>(CandidatePairs[PairIndex] >> 32);
+			const int32 B = static_cast<int32>(CandidatePairs[PairIndex] & 0xffffffffu);
+			++NumLinks[A];
+			++NumLinks[B];
+			const int32 RootA = FindRoot(Parents, A);
+			const int32 RootB = FindRoot(Parents, B);
+			if (RootA != RootB)
+			{
+				Parents[FMath::Max(RootA, RootB)] = FMath::Min(RootA, RootB);
+			}
+		}
+	}
+
+	// Linked descriptors grouped by root; roots are the lowest index of their cluster, so clusters come out in index order
+	TArray<TArray<int32>> ClusterMembers;
+	TMap<int32, int32> ClusterByRoot;
+	for (int32 ValidIndex = 0; ValidIndex < NumValid; ++ValidIndex)
+	{
+		if (NumLinks[ValidIndex] == 0)
+		{
+			continue;
+		}
+		const int32 Root = FindRoot(Parents, ValidIndex);
+		if (const int32* ClusterIndex = ClusterByRoot.Find(Root))
+		{
+			ClusterMembers[*ClusterIndex].Add(ValidIndex);
+		}
+		else
+		{
+			ClusterByRoot.Add(Root, ClusterMembers.Num());
+			ClusterMembers.Add({ ValidIndex });
+		}
+	}
+
+	TArray<FShapeCluster> Clusters;
+	Clusters.Reserve(ClusterMembers.Num());
+	for (TArray<int32>& Members : ClusterMembers)
+	{
+		// Single-link clusters can chain; measuring everyone against the best connected member shows how far they drift
+		int32 Representative = Members[0];
+		for (const int32 ValidIndex : Members)
+		{
+			if (NumLinks[ValidIndex] > NumLinks[Representative])
+			{
+				Representative = ValidIndex;
+			}
+		}
+
+		TArray<TPair<float, int32>> ScoredMembers;
+		for (const int32 ValidIndex : Members)
+		{
+			if (ValidIndex != Representative)
+			{
+				const int32 DescriptorIndex = ValidDescriptors[ValidIndex];
+				ScoredMembers.Emplace(FShapeDescriptor::GetSimilarity(Descriptors[ValidDescriptors[Representative]], Descriptors[DescriptorIndex]), DescriptorIndex);
+			}
+		}
+		ScoredMembers.StableSort([](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key > B.Key; });
+
+		FShapeCluster& Cluster = Clusters.AddDefaulted_GetRef();
+		Cluster.Members.Add(ValidDescriptors[Representative]);
+		Cluster.Similarities.Add(1.0f);
+		for (const TPair<float, int32>& ScoredMember : ScoredMembers)
+		{
+			Cluster.Members.Add(ScoredMember.Value);
+			Cluster.Similarities.Add(ScoredMember.Key);
+		}
+	}
+	return Clusters;
+}
@@ -0,0 +1,44 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+#include "Analysis/Geometry/FShapeDescriptorBuilder.h"
+
+/** Descriptors found similar to each other */
+struct FShapeCluster
+{
+	/** Descriptor indices; the first is the representative, the one similar to the most others */
+	TArray<int32> Members;
+
+	/** Similarity of each member to the representative, in member order; 1 for the representative itself */
+	TArray<float> Similarities;
+};
+
+/**
+ * Clusters shape descriptors without comparing every pair. Descriptors are hashed into several tables with p-stable
+ * locality-sensitive hashing: each key is a few quantized random projections, so near descriptors likely share a
+ * bucket in at least one table. Only descriptors sharing a bucket are compared, and pairs at or above the similarity
+ * threshold are linked into clusters.
+ * Thread-safe; holds no state.
+ */
+class FShapeDescriptorClusterer
+{
+public:
+	/** Hash tables; more tables find more of the similar pairs */
+	static constexpr int32 NumTables = 12;
+
+	/** Projections combined into the key of a table; more projections make buckets smaller */
+	static constexpr int32 NumProjectionsPerTable = 4;
+
+	/** Bucket neighbors each descriptor is compared with; bounds the cost of buckets holding many equal shapes */
+	static constexpr int32 MaxComparisonsPerDescriptor = 64;
+
+	/**
+	 * @param Descriptors Descriptors to cluster; invalid ones are left out.
+	 * @param MinSimilarity Similarity, as of FShapeDescriptor::GetSimilarity(), at which two descriptors are linked.
+	 * @return Clusters of two or more descriptors, in order of their lowest descriptor index.
+	 */
+	static TArray<FShapeCluster> Cluster(TConstArrayView<FShapeDescriptor> Descriptors, float MinSimilarity);
+};
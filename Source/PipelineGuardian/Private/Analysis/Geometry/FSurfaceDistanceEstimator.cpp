@@ -0,0 +1,101 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Analysis/Geometry/FSurfaceDistanceEstimator.h"
+#include "Analysis/Geometry/FTriangleBVH.h"
+#include "Async/ParallelFor.h"
+
+namespace SurfaceDistanceEstimator
+{
+	/** Samples per parallel work item */
+	constexpr int32 SamplesPerChunk = 4 * 1024;
+}
+
+FSurfaceDistanceStats FSurfaceDistanceEstimator::Measure(TConstArrayView<FVector3f> SourcePositions, TConstArrayView<uint32> SourceIndices,
+	TConstArrayView<FVector3f> TargetPositions, TConstArrayView<uint32> TargetIndices, int32 MaxSamples)
+{
+	using namespace SurfaceDistanceEstimator;
+
+	FSurfaceDistanceStats Stats;
+	const FTriangleBVH TargetBVH(TargetPositions, TargetIndices);
+	if (!TargetBVH.IsValid())
+	{
+		return Stats;
+	}
+
+	// Vertices the source triangles use, then the centroids of the source triangles, each strided down to MaxSamples
+	MaxSamples = FMath::Max(MaxSamples, 1);
+	const uint32 NumSourcePositions = static_cast<uint32>(SourcePositions.Num());
+	TBitArray<> UsedVertices(false, SourcePositions.Num());
+	TArray<int32> ValidTriangles;
+	ValidTriangles.Reserve(SourceIndices.Num() / 3);
+	for (int32 TriangleIndex = 0; TriangleIndex < SourceIndices.Num() / 3; ++TriangleIndex)
+	{
+		const uint32 Index0 = SourceIndices[TriangleIndex * 3];
+		const uint32 Index1 = SourceIndices[TriangleIndex * 3 + 1];
+		const uint32 Index2 = SourceIndices[TriangleIndex * 3 + 2];
+		if (Index0 < NumSourcePositions && Index1 < NumSourcePositions && Index2 < NumSourcePositions)
+		{
+			UsedVertices[Index0] = true;
+			UsedVertices[Index1] = true;
+			UsedVertices[Index2] = true;
+			ValidTriangles.Add(TriangleIndex);
+		}
+	}
+
+	int32 NumUsedVertices = 0;
+	for (int32 VertexIndex = 0; VertexIndex < SourcePositions.Num(); ++VertexIndex)
+	{
+		NumUsedVertices += UsedVertices[VertexIndex] ? 1 : 0;
+	}
+	const int32 VertexStride = FMath::DivideAndRoundUp(FMath::Max(NumUsedVertices, 1), MaxSamples);
+	const int32 TriangleStride = FMath::DivideAndRoundUp(FMath::Max(ValidTriangles.Num(), 1), MaxSamples);
+	TArray<FVector3f> Samples;
+	Samples.Reserve(NumUsedVertices / VertexStride + ValidTriangles.Num() / TriangleStride + 2);
+	for (int32 VertexIndex = 0, UsedIndex = 0; VertexIndex < SourcePositions.Num(); ++VertexIndex)
+	{
+		if (UsedVertices[VertexIndex] && UsedIndex++ % VertexStride == 0)
+		{
+			Samples.Add(SourcePositions[VertexIndex]);
+		}
+	}
+	for (int32 Entry = 0; Entry < ValidTriangles.Num(); Entry += TriangleStride)
+	{
+		const int32 TriangleIndex = ValidTriangles[Entry];
+		Samples.Add((SourcePositions[SourceIndices[TriangleIndex * 3]] + SourcePositions[SourceIndices[TriangleIndex * 3 + 1]] + SourcePositions[SourceIndices[TriangleIndex * 3 + 2]]) / 3.0f);
+	}
+
+	const int32 NumChunks = FMath::DivideAndRoundUp(Samples.Num(), SamplesPerChunk);
+	TArray<FSurfaceDistanceStats> ChunkStats;
+	ChunkStats.SetNum(NumChunks);
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		FSurfaceDistanceStats& Chunk = ChunkStats[ChunkIndex];
+		const int32 FirstSample = ChunkIndex * SamplesPerChunk;
+		const int32 LastSample = FMath::Min(FirstSample + SamplesPerChunk, Samples.Num());
+		for (int32 SampleIndex = FirstSample; SampleIndex < LastSample; ++SampleIndex)
+		{
+			const float Distance = FMath::Sqrt(TargetBVH.FindClosestDistanceSquared(Samples[SampleIndex]));
+			++Chunk.NumSamples;
+			Chunk.MaxDistance = FMath::Max(Chunk.MaxDistance, Distance);
+			Chunk.SumDistance += Distance;
+			Chunk.SumSquaredDistance += static_cast<double>(Distance) * Distance;
+		}
+	}, NumChunks <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	for (const FSurfaceDistanceStats& Chunk : ChunkStats)
+	{
+		Stats += Chunk;
+	}
+	return Stats;
+}
+
+float FSurfaceDistanceEstimator::GetPixelError(float Distance, float BoundsRadius, float ScreenSize, int32 ScreenHeight)
+{
+	// At screen size S the bounds sphere's diameter spans S * ScreenHeight pixels
+	return BoundsRadius > 0.0f ? Distance * ScreenSize * ScreenHeight / (2.0f * BoundsRadius) : 0.0f;
+}
+
+float FSurfaceDistanceEstimator::GetScreenSizeForPixelError(float Distance, float BoundsRadius, float PixelError, int32 ScreenHeight)
+{
+	return Distance > 0.0f && ScreenHeight > 0 ? PixelError * 2.0f * BoundsRadius / (Distance * ScreenHeight) : 0.0f;
+}
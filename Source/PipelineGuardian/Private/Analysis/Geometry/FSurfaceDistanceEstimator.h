@@ -0,0 +1,77 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+
+/** Distances from sample points on one surface to another surface */
+struct FSurfaceDistanceStats
+{
+	int32 NumSamples = 0;
+
+	/** Largest distance: the one-sided Hausdorff distance, up to sampling */
+	float MaxDistance = 0.0f;
+
+	double SumDistance = 0.0;
+	double SumSquaredDistance = 0.0;
+
+	/** @return Mean distance. */
+	float GetMeanDistance() const { return NumSamples > 0 ? static_cast<float>(SumDistance / NumSamples) : 0.0f; }
+
+	/** @return Root mean square distance. */
+	float GetRMSDistance() const { return NumSamples > 0 ? static_cast<float>(FMath::Sqrt(SumSquaredDistance / NumSamples)) : 0.0f; }
+
+	FSurfaceDistanceStats& operator+=(const FSurfaceDistanceStats& Other)
+	{
+		NumSamples += Other.NumSamples;
+		MaxDistance = FMath::Max(MaxDistance, Other.MaxDistance);
+		SumDistance += Other.SumDistance;
+		SumSquaredDistance += Other.SumSquaredDistance;
+		return *this;
+	}
+};
+
+/**
+ * Measures how far a simplified surface deviates from its source: every sample on the source surface (its vertices
+ * and triangle centroids) is matched with the closest point of the target surface through an FTriangleBVH, in
+ * parallel chunks. Meshes with more samples than the limit are sampled with a stride.
+ * Screen-space helpers convert the distances into pixels at a LOD screen size, using the same definition of screen
+ * size as the engine: the projected diameter of the bounds sphere relative to the screen height.
+ * Thread-safe; holds no state.
+ */
+class FSurfaceDistanceEstimator
+{
+public:
+	/** Default limit on vertex and centroid samples, each */
+	static constexpr int32 DefaultMaxSamples = 256 * 1024;
+
+	/**
+	 * @param SourcePositions Vertex positions of the reference surface, e.g. LOD 0.
+	 * @param SourceIndices Triangle list indices of the reference surface.
+	 * @param TargetPositions Vertex positions of the simplified surface.
+	 * @param TargetIndices Triangle list indices of the simplified surface.
+	 * @param MaxSamples Limit on vertex samples and on centroid samples.
+	 * @return Distances from the source samples to the target surface; no samples if either surface is empty.
+	 */
+	static FSurfaceDistanceStats Measure(TConstArrayView<FVector3f> SourcePositions, TConstArrayView<uint32> SourceIndices,
+		TConstArrayView<FVector3f> TargetPositions, TConstArrayView<uint32> TargetIndices, int32 MaxSamples = DefaultMaxSamples);
+
+	/**
+	 * @param Distance World-space distance.
+	 * @param BoundsRadius Radius of the mesh's bounds sphere.
+	 * @param ScreenSize Screen size the mesh is drawn at.
+	 * @param ScreenHeight Screen height in pixels.
+	 * @return The distance in pixels.
+	 */
+	static float GetPixelError(float Distance, float BoundsRadius, float ScreenSize, int32 ScreenHeight);
+
+	/**
+	 * @param Distance World-space distance.
+	 * @param BoundsRadius Radius of the mesh's bounds sphere.
+	 * @param PixelError Pixel error budget.
+	 * @param ScreenHeight Screen height in pixels.
+	 * @return The screen size at which the distance spans PixelError pixels; 0 if the distance is 0.
+	 */
+	static float GetScreenSizeForPixelError(float Distance, float BoundsRadius, float PixelError, int32 ScreenHeight);
+};
@@ -0,0 +1,62 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Analysis/Geometry/FTexelDensityEstimator.h"
+#include "Async/ParallelFor.h"
+
+namespace TexelDensityEstimator
+{
+	/** Triangles per parallel work item */
+	constexpr int32 TrianglesPerChunk = 16 * 1024;
+
+	/** Sums the areas of one chunk */
+	FTexelDensityStats MeasureChunk(TConstArrayView<FVector3f> Positions, TConstArrayView<FVector2f> UVs, TConstArrayView<uint32> Indices, int32 FirstTriangle, int32 NumTriangles)
+	{
+		const uint32 NumVertices = static_cast<uint32>(FMath::Min(Positions.Num(), UVs.Num()));
+
+		FTexelDensityStats Stats;
+		for (int32 TriangleIndex = FirstTriangle; TriangleIndex < FirstTriangle + NumTriangles; ++TriangleIndex)
+		{
+			const uint32 Index0 = Indices[TriangleIndex * 3];
+			const uint32 Index1 = Indices[TriangleIndex * 3 + 1];
+			const uint32 Index2 = Indices[TriangleIndex * 3 + 2];
+			if (Index0 >= NumVertices || Index1 >= NumVertices || Index2 >= NumVertices)
+			{
+				continue;
+			}
+
+			const FVector2f UVEdge1 = UVs[Index1] - UVs[Index0];
+			const FVector2f UVEdge2 = UVs[Index2] - UVs[Index0];
+			Stats.UVArea += 0.5 * FMath::Abs(static_cast<double>(UVEdge1.X) * UVEdge2.Y - static_cast<double>(UVEdge1.Y) * UVEdge2.X);
+
+			const FVector3f WorldEdge1 = Positions[Index1] - Positions[Index0];
+			const FVector3f WorldEdge2 = Positions[Index2] - Positions[Index0];
+			Stats.WorldArea += 0.5 * FVector3d::CrossProduct(FVector3d(WorldEdge1), FVector3d(WorldEdge2)).Size();
+			++Stats.NumTriangles;
+		}
+		return Stats;
+	}
+}
+
+FTexelDensityStats FTexelDensityEstimator::Measure(TConstArrayView<FVector3f> Positions, TConstArrayView<FVector2f> UVs, TConstArrayView<uint32> Indices)
+{
+	using namespace TexelDensityEstimator;
+
+	const int32 NumTriangles = Indices.Num() / 3;
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumTriangles, TrianglesPerChunk);
+
+	TArray<FTexelDensityStats> ChunkStats;
+	ChunkStats.SetNum(NumChunks);
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		const int32 FirstTriangle = ChunkIndex * TrianglesPerChunk;
+		ChunkStats[ChunkIndex] = MeasureChunk(Positions, UVs, Indices, FirstTriangle, FMath::Min(TrianglesPerChunk, NumTriangles - FirstTriangle));
+	}, NumChunks <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	// Summed in chunk order so the result does not depend on scheduling
+	FTexelDensityStats Stats;
+	for (const FTexelDensityStats& Chunk : ChunkStats)
+	{
+		Stats += Chunk;
+	}
+	return Stats;
+}
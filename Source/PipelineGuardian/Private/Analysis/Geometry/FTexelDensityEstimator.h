@@ -0,0 +1,52 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+
+/** World-space and UV-space area of a set of triangles, from which its texel density follows for any texture size */
+struct FTexelDensityStats
+{
+	int32 NumTriangles = 0;
+
+	/** Summed UV area; tiling and overlapping triangles count in full */
+	double UVArea = 0.0;
+
+	/** Summed surface area, in world units squared */
+	double WorldArea = 0.0;
+
+	/**
+	 * @param TextureSize Width of the texture mapped onto the UVs, in texels.
+	 * @return Texels per world unit along the surface; 0 if the triangles have no area.
+	 */
+	float GetTexelDensity(int32 TextureSize) const
+	{
+		return WorldArea > 0.0 && UVArea > 0.0 ? static_cast<float>(TextureSize * FMath::Sqrt(UVArea / WorldArea)) : 0.0f;
+	}
+
+	FTexelDensityStats& operator+=(const FTexelDensityStats& Other)
+	{
+		NumTriangles += Other.NumTriangles;
+		UVArea += Other.UVArea;
+		WorldArea += Other.WorldArea;
+		return *this;
+	}
+};
+
+/**
+ * Sums the world and UV areas of the triangles of an index buffer, over chunks that are measured in parallel.
+ * The ratio of the two gives the texel density of any texture mapped through the UVs.
+ * Thread-safe; holds no state.
+ */
+class FTexelDensityEstimator
+{
+public:
+	/**
+	 * @param Positions Vertex positions.
+	 * @param UVs Texture coordinates, indexed by vertex.
+	 * @param Indices Triangle list indices; pass a slice to measure one section. Triangles with out of range indices are skipped.
+	 * @return Areas of the triangles.
+	 */
+	static FTexelDensityStats Measure(TConstArrayView<FVector3f> Positions, TConstArrayView<FVector2f> UVs, TConstArrayView<uint32> Indices);
+};
@@ -0,0 +1,240 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Analysis/Geometry/FTriangleBVH.h"
+
+namespace TriangleBVH
+{
+	/**
+	 * Depth below which nodes are split by triangle count instead of space. Spatial splits can be lopsided on
+	 * oddly distributed geometry; count splits halve the triangles, so no path gets deeper than this plus 31.
+	 */
+	constexpr int32 MaxSpatialSplitDepth = 30;
+
+	/** Entries a query's traversal stack needs: one per level plus the sibling pushed last */
+	constexpr int32 MaxStackDepth = MaxSpatialSplitDepth + 34;
+
+	/** @return Squared distance from a point to an axis-aligned box; 0 inside it. */
+	float GetBoxDistanceSquared(const FVector3f& Point, const FVector3f& BoundsMin, const FVector3f& BoundsMax)
+	{
+		const float DeltaX = FMath::Max3(BoundsMin.X - Point.X, 0.0f, Point.X - BoundsMax.X);
+		const float DeltaY = FMath::Max3(BoundsMin.Y - Point.Y, 0.0f, Point.Y - BoundsMax.Y);
+		const float DeltaZ = FMath::Max3(BoundsMin.Z - Point.Z, 0.0f, Point.Z - BoundsMax.Z);
+		return DeltaX * DeltaX + DeltaY * DeltaY + DeltaZ * DeltaZ;
+	}
+
+	/** @return Squared distance from a point to the closest point of a triangle (Ericson, Real-Time Collision Detection 5.1.5). */
+	float GetTriangleDistanceSquared(const FVector3f& Point, const FVector3f& A, const FVector3f& B, const FVector3f& C)
+	{
+		const FVector3f AB = B - A;
+		const FVector3f AC = C - A;
+		const FVector3f AP = Point - A;
+		const float D1 = FVector3f::DotProduct(AB, AP);
+		const float D2 = FVector3f::DotProduct(AC, AP);
+		if (D1 <= 0.0f && D2 <= 0.0f)
+		{
+			return AP.SizeSquared();
+		}
+
+		const FVector3f BP = Point - B;
+		const float D3 = FVector3f::DotProduct(AB, BP);
+		const float D4 = FVector3f::DotProduct(AC, BP);
+		if (D3 >= 0.0f && D4 <= D3)
+		{
+			return BP.SizeSquared();
+		}
+
+		const float VC = D1 * D4 - D3 * D2;
+		if (VC <= 0.0f && D1 >= 0.0f && D3 <= 0.0f)
+		{
+			const float V = D1 / (D1 - D3);
+			return (AP - AB * V).SizeSquared();
+		}
+
+		const FVector3f CP = Point - C;
+		const float D5 = FVector3f::DotProduct(AB, CP);
+		const float D6 = FVector3f::DotProduct(AC, CP);
+		if (D6 >= 0.0f && D5 <= D6)
+		{
+			return CP.SizeSquared();
+		}
+
+		const float VB = D5 * D2 - D1 * D6;
+		if (VB <= 0.0f && D2 >= 0.0f && D6 <= 0.0f)
+		{
+			const float W = D2 / (D2 - D6);
+			return (AP - AC * W).SizeSquared();
+		}
+
+		const float VA = D3 * D6 - D5 * D4;
+		if (VA <= 0.0f && (D4 - D3) >= 0.0f && (D5 - D6) >= 0.0f)
+		{
+			const float W = (D4 - D3) / ((D4 - D3) + (D5 - D6));
+			return (BP - (C - B) * W).SizeSquared();
+		}
+
+		const float Denominator = VA + VB + VC;
+		if (Denominator <= 0.0f)
+		{
+			// Degenerate triangle whose corners all failed the tests above; its corners are as close as it gets
+			return FMath::Min3(AP.SizeSquared(), BP.SizeSquared(), CP.SizeSquared());
+		}
+		const float V = VB / Denominator;
+		const float W = VC / Denominator;
+		return (AP - AB * V - AC * W).SizeSquared();
+	}
+}
+
+FTriangleBVH::FTriangleBVH(TConstArrayView<FVector3f> InPositions, TConstArrayView<uint32> InIndices)
+	: Positions(InPositions)
+	, Indices(InIndices)
+{
+	using namespace TriangleBVH;
+
+	const int32 NumTriangles = Indices.Num() / 3;
+	const uint32 NumPositions = static_cast<uint32>(Positions.Num());
+
+	TArray<FVector3f> Centroids;
+	Centroids.SetNumUninitialized(NumTriangles);
+	Triangles.Reserve(NumTriangles);
+	for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; ++TriangleIndex)
+	{
+		const uint32 Index0 = Indices[TriangleIndex * 3];
+		const uint32 Index1 = Indices[TriangleIndex * 3 + 1];
+		const uint32 Index2 = Indices[TriangleIndex * 3 + 2];
+		if (Index0 < NumPositions && Index1 < NumPositions && Index2 < NumPositions)
+		{
+			Centroids[TriangleIndex] = (Positions[Index0] + Positions[Index1] + Positions[Index2]) / 3.0f;
+			Triangles.Add(TriangleIndex);
+		}
+	}
+	if (Triangles.Num() == 0)
+	{
+		return;
+	}
+
+	// A binary tree with leaves of at least one triangle has fewer than twice as many nodes as triangles
+	Nodes.Reserve(2 * FMath::DivideAndRoundUp(Triangles.Num(), MaxLeafTriangles));
+	Nodes.AddDefaulted();
+
+	struct FBuildTask
+	{
+		int32 NodeIndex;
+		int32 Start;
+		int32 End;
+		int32 Depth;
+	};
+	TArray<FBuildTask> Tasks;
+	Tasks.Add({ 0, 0, Triangles.Num(), 0 });
+	while (Tasks.Num() > 0)
+	{
+		const FBuildTask Task = Tasks.Pop(EAllowShrinking::No);
+
+		FVector3f BoundsMin(MAX_flt);
+		FVector3f BoundsMax(-MAX_flt);
+		FVector3f CentroidMin(MAX_flt);
+		FVector3f CentroidMax(-MAX_flt);
+		for (int32 Entry = Task.Start; Entry < Task.End; ++Entry)
+		{
+			const int32 TriangleIndex = Triangles[Entry];
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const FVector3f& Position = Positions[Indices[TriangleIndex * 3 + Corner]];
+				BoundsMin = BoundsMin.ComponentMin(Position);
+				BoundsMax = BoundsMax.ComponentMax(Position);
+			}
+			CentroidMin = CentroidMin.ComponentMin(Centroids[TriangleIndex]);
+			CentroidMax = CentroidMax.ComponentMax(Centroids[TriangleIndex]);
+		}
+		Nodes[Task.NodeIndex].BoundsMin = BoundsMin;
+		Nodes[Task.NodeIndex].BoundsMax = BoundsMax;
+
+		const int32 NumNodeTriangles = Task.End - Task.Start;
+		if (NumNodeTriangles <= MaxLeafTriangles)
+		{
+			Nodes[Task.NodeIndex].FirstIndex = Task.Start;
+			Nodes[Task.NodeIndex].NumTriangles = NumNodeTriangles;
+			continue;
+		}
+
+		// Partition around the middle of the centroid bounds on their longest axis
+		int32 Middle = Task.Start;
+		if (Task.Depth < MaxSpatialSplitDepth)
+		{
+			const FVector3f CentroidExtent = CentroidMax - CentroidMin;
+			const int32 Axis = CentroidExtent.X >= CentroidExtent.Y && CentroidExtent.X >= CentroidExtent.Z ? 0 : (CentroidExtent.Y >= CentroidExtent.Z ? 1 : 2);
+			const float SplitPosition = 0.5f * (CentroidMin[Axis] + CentroidMax[Axis]);
+			for (int32 Entry = Task.Start; Entry < Task.End; ++Entry)
+			{
+				if (Centroids[Triangles[Entry]][Axis] < SplitPosition)
+				{
+					Swap(Triangles[Entry], Triangles[Middle++]);
+				}
+			}
+		}
+
+		// Coincident centroids cannot be separated spatially; splitting by count keeps the tree balanced
+		if (Middle == Task.Start || Middle == Task.End)
+		{
+			Middle = Task.Start + NumNodeTriangles / 2;
+		}
+
+		const int32 FirstChild = Nodes.Num();
+		Nodes.AddDefaulted(2);
+		Nodes[Task.NodeIndex].FirstIndex = FirstChild;
+		Tasks.Add({ FirstChild, Task.Start, Middle, Task.Depth + 1 });
+		Tasks.Add({ FirstChild + 1, Middle, Task.End, Task.Depth + 1 });
+	}
+}
+
+float FTriangleBVH::FindClosestDistanceSquared(const FVector3f& Point, float MaxDistanceSquared) const
+{
+	using namespace TriangleBVH;
+
+	float BestDistanceSquared = MaxDistanceSquared;
+	if (Nodes.Num() == 0)
+	{
+		return BestDistanceSquared;
+	}
+
+	int32 Stack[MaxStackDepth];
+	int32 StackSize = 0;
+	Stack[StackSize++] = 0;
+	while (StackSize > 0)
+	{
+		const FNode& Node = Nodes[Stack[--StackSize]];
+		if (GetBoxDistanceSquared(Point, Node.BoundsMin, Node.BoundsMax) >= BestDistanceSquared)
+		{
+			continue;
+		}
+
+		if (Node.NumTriangles > 0)
+		{
+			for (int32 Entry = Node.FirstIndex; Entry < Node.FirstIndex + Node.NumTriangles; ++Entry)
+			{
+				const int32 TriangleIndex = Triangles[Entry];
+				const float DistanceSquared = GetTriangleDistanceSquared(Point,
+					Positions[Indices[TriangleIndex * 3]], Positions[Indices[TriangleIndex * 3 + 1]], Positions[Indices[TriangleIndex * 3 + 2]]);
+				BestDistanceSquared = FMath::Min(BestDistanceSquared, DistanceSquared);
+			}
+			continue;
+		}
+
+		// Visit the nearer child first so that its result prunes the farther one
+		const int32 FirstChild = Node.FirstIndex;
+		const float FirstDistanceSquared = GetBoxDistanceSquared(Point, Nodes[FirstChild].BoundsMin, Nodes[FirstChild].BoundsMax);
+		const float SecondDistanceSquared = GetBoxDistanceSquared(Point, Nodes[FirstChild + 1].BoundsMin, Nodes[FirstChild + 1].BoundsMax);
+		check(StackSize + 2 <= MaxStackDepth);
+		if (FirstDistanceSquared <= SecondDistanceSquared)
+		{
+			Stack[StackSize++] = FirstChild + 1;
+			Stack[StackSize++] = FirstChild;
+		}
+		else
+		{
+			Stack[StackSize++] = FirstChild;
+			Stack[StackSize++] = FirstChild + 1;
+		}
+	}
+
+	return BestDistanceSquared;
+}
@@ -0,0 +1,56 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+
+/**
+ * Bounding volume hierarchy over the triangles of an index buffer, for closest point queries.
+ * Nodes split at the spatial median of their triangle centroids along the longest axis, which builds in linear time
+ * per level and is close enough to SAH quality for distance queries on meshes.
+ * The positions and indices must outlive the hierarchy. Build on one thread; queries are thread-safe.
+ */
+class FTriangleBVH
+{
+public:
+	/** Most triangles a leaf holds */
+	static constexpr int32 MaxLeafTriangles = 4;
+
+	/**
+	 * @param InPositions Vertex positions.
+	 * @param InIndices Triangle list indices. Triangles with out of range indices are left out.
+	 */
+	FTriangleBVH(TConstArrayView<FVector3f> InPositions, TConstArrayView<uint32> InIndices);
+
+	/** @return False if the hierarchy holds no triangles. */
+	bool IsValid() const { return Nodes.Num() > 0; }
+
+	/**
+	 * @param Point Query point.
+	 * @param MaxDistanceSquared Triangles farther away than this are not searched; pass a previous result to speed up coherent queries.
+	 * @return Squared distance to the closest point on any triangle, or MaxDistanceSquared if none is closer.
+	 */
+	float FindClosestDistanceSquared(const FVector3f& Point, float MaxDistanceSquared = MAX_flt) const;
+
+private:
+	struct FNode
+	{
+		FVector3f BoundsMin;
+		FVector3f BoundsMax;
+
+		/** Leaves: first entry in Triangles. Inner nodes: index of the first child; the second follows it. */
+		int32 FirstIndex = 0;
+
+		/** Triangles of a leaf; 0 for inner nodes */
+		int32 NumTriangles = 0;
+	};
+
+	TConstArrayView<FVector3f> Positions;
+	TConstArrayView<uint32> Indices;
+
+	/** Triangle indices, ordered so that every leaf owns a contiguous range */
+	TArray<int32> Triangles;
+
+	TArray<FNode> Nodes;
+};
@@ -0,0 +1,147 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Analysis/Geometry/FTriangleQualityScanner.h"
+#include "Async/ParallelFor.h"
+#include "Math/VectorRegister.h"
+
+namespace TriangleQualityScanner
+{
+	/** Triangles per parallel work item */
+	constexpr int32 TrianglesPerChunk = 16 * 1024;
+
+	/** Triangles per SIMD batch */
+	constexpr int32 BatchSize = 4;
+
+	/** Counts the triangles of one chunk */
+	FTriangleQualityStats ScanChunk(TConstArrayView<FVector3f> Positions, TConstArrayView<uint32> Indices, int32 FirstTriangle, int32 NumTriangles, float MinArea, float MaxAspectRatio)
+	{
+		FTriangleQualityStats Stats;
+		Stats.NumTriangles = NumTriangles;
+
+		// Zero area: |Cross|^2 <= (2 * MinArea)^2. Sliver: LongestEdge^2 / |Cross| > MaxAspectRatio, i.e. LongestEdge^4 > MaxAspectRatio^2 * |Cross|^2.
+		const VectorRegister4Float MaxCrossSquared = VectorSetFloat1(4.0f * MinArea * MinArea);
+		const VectorRegister4Float AspectRatioSquared = VectorSetFloat1(MaxAspectRatio * MaxAspectRatio);
+		const uint32 SliverMaskEnabled = MaxAspectRatio > 0.0f ? 0xF : 0x0;
+
+		const int32 NumPositions = Positions.Num();
+		for (int32 BatchStart = 0; BatchStart < NumTriangles; BatchStart += BatchSize)
+		{
+			// Gather the corners into structure-of-arrays lanes. Collapsed triangles and the tail of the chunk get
+			// the corners of a unit triangle, and their lanes are masked off.
+			alignas(16) float Corners[3][3][BatchSize];
+			uint32 ValidLanes = 0;
+			for (int32 Lane = 0; Lane < BatchSize; ++Lane)
+			{
+				const int32 TriangleIndex = FirstTriangle + BatchStart + Lane;
+				bool bValid = false;
+				if (BatchStart + Lane < NumTriangles)
+				{
+					const uint32 Index0 = Indices[TriangleIndex * 3];
+					const uint32 Index1 = Indices[TriangleIndex * 3 + 1];
+					const uint32 Index2 = Indices[TriangleIndex * 3 + 2];
+					const bool bInRange = Index0 < static_cast<uint32>(NumPositions) && Index1 < static_cast<uint32>(NumPositions) && Index2 < static_cast<uint32>(NumPositions);
+					if (!bInRange || Index0 == Index1 || Index1 == Index2 || Index0 == Index2)
+					{
+						++Stats.NumCollapsedIndices;
+					}
+					else
+					{
+						const uint32 CornerIndices[3] = { Index0, Index1, Index2 };
+						for (int32 Corner = 0; Corner < 3; ++Corner)
+						{
+							const FVector3f& Position = Positions[CornerIndices[Corner]];
+							Corners[Corner][0][Lane] = Position.X;
+							Corners[Corner][1][Lane] = Position.Y;
+							Corners[Corner][2][Lane] = Position.Z;
+						}
+						ValidLanes |= 1u << Lane;
+						bValid = true;
+					}
+				}
+
+				if (!bValid)
+				{
+					for (int32 Corner = 0; Corner < 3; ++Corner)
+					{
+						for (int32 Axis = 0; Axis < 3; ++Axis)
+						{
+							Corners[Corner][Axis][Lane] = Corner == Axis + 1 ? 1.0f : 0.0f;
+						}
+					}
+				}
+			}
+
+			if (ValidLanes == 0)
+			{
+				continue;
+			}
+
+			const VectorRegister4Float AX = VectorLoadAligned(Corners[0][0]);
+			const VectorRegister4Float AY = VectorLoadAligned(Corners[0][1]);
+			const VectorRegister4Float AZ = VectorLoadAligned(Corners[0][2]);
+			const VectorRegister4Float BX = VectorLoadAligned(Corners[1][0]);
+			const VectorRegister4Float BY = VectorLoadAligned(Corners[1][1]);
+			const VectorRegister4Float BZ = VectorLoadAligned(Corners[1][2]);
+			const VectorRegister4Float CX = VectorLoadAligned(Corners[2][0]);
+			const VectorRegister4Float CY = VectorLoadAligned(Corners[2][1]);
+			const VectorRegister4Float CZ = VectorLoadAligned(Corners[2][2]);
+
+			// Edges AB, AC and BC
+			const VectorRegister4Float ABX = VectorSubtract(BX, AX);
+			const VectorRegister4Float ABY = VectorSubtract(BY, AY);
+			const VectorRegister4Float ABZ = VectorSubtract(BZ, AZ);
+			const VectorRegister4Float ACX = VectorSubtract(CX, AX);
+			const VectorRegister4Float ACY = VectorSubtract(CY, AY);
+			const VectorRegister4Float ACZ = VectorSubtract(CZ, AZ);
+			const VectorRegister4Float BCX = VectorSubtract(CX, BX);
+			const VectorRegister4Float BCY = VectorSubtract(CY, BY);
+			const VectorRegister4Float BCZ = VectorSubtract(CZ, BZ);
+
+			// Cross = AB x AC; its length is twice the triangle's area
+			const VectorRegister4Float CrossX = VectorSubtract(VectorMultiply(ABY, ACZ), VectorMultiply(ABZ, ACY));
+			const VectorRegister4Float CrossY = VectorSubtract(VectorMultiply(ABZ, ACX), VectorMultiply(ABX, ACZ));
+			const VectorRegister4Float CrossZ = VectorSubtract(VectorMultiply(ABX, ACY), VectorMultiply(ABY, ACX));
+			const VectorRegister4Float CrossSquared = VectorMultiplyAdd(CrossX, CrossX, VectorMultiplyAdd(CrossY, CrossY, VectorMultiply(CrossZ, CrossZ)));
+
+			const VectorRegister4Float ABSquared = VectorMultiplyAdd(ABX, ABX, VectorMultiplyAdd(ABY, ABY, VectorMultiply(ABZ, ABZ)));
+			const VectorRegister4Float ACSquared = VectorMultiplyAdd(ACX, ACX, VectorMultiplyAdd(ACY, ACY, VectorMultiply(ACZ, ACZ)));
+			const VectorRegister4Float BCSquared = VectorMultiplyAdd(BCX, BCX, VectorMultiplyAdd(BCY, BCY, VectorMultiply(BCZ, BCZ)));
+			const VectorRegister4Float LongestSquared = VectorMax(ABSquared, VectorMax(ACSquared, BCSquared));
+
+			const uint32 ZeroAreaLanes = static_cast<uint32>(VectorMaskBits(VectorCompareLE(CrossSquared, MaxCrossSquared))) & ValidLanes;
+			const uint32 SliverLanes = static_cast<uint32>(VectorMaskBits(VectorCompareGT(VectorMultiply(LongestSquared, LongestSquared), VectorMultiply(AspectRatioSquared, CrossSquared))))
+				& ValidLanes & SliverMaskEnabled & ~ZeroAreaLanes;
+
+			Stats.NumZeroArea += FMath::CountBits(ZeroAreaLanes);
+			Stats.NumSlivers += FMath::CountBits(SliverLanes);
+		}
+
+		return Stats;
+	}
+}
+
+FTriangleQualityStats FTriangleQualityScanner::Scan(TConstArrayView<FVector3f> Positions, TConstArrayView<uint32> Indices, float MinArea, float MaxAspectRatio)
+{
+	using namespace TriangleQualityScanner;
+
+	const int32 NumTriangles = Indices.Num() / 3;
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumTriangles, TrianglesPerChunk);
+
+	TArray<FTriangleQualityStats> ChunkStats;
+	ChunkStats.SetNum(NumChunks);
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		const int32 FirstTriangle = ChunkIndex * TrianglesPerChunk;
+		ChunkStats[ChunkIndex] = ScanChunk(Positions, Indices, FirstTriangle, FMath::Min(TrianglesPerChunk, NumTriangles - FirstTriangle), MinArea, MaxAspectRatio);
+	}, NumChunks <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	FTriangleQualityStats Stats;
+	for (const FTriangleQualityStats& Chunk : ChunkStats)
+	{
+		Stats.NumTriangles += Chunk.NumTriangles;
+		Stats.NumCollapsedIndices += Chunk.NumCollapsedIndices;
+		Stats.NumZeroArea += Chunk.NumZeroArea;
+		Stats.NumSlivers += Chunk.NumSlivers;
+	}
+	return Stats;
+}
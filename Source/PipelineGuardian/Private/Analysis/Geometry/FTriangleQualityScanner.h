@@ -0,0 +1,45 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+
+/** Degenerate triangle counts of one index buffer. Every triangle is counted in at most one category. */
+struct FTriangleQualityStats
+{
+	int32 NumTriangles = 0;
+
+	/** Triangles that reference the same vertex more than once, or a vertex outside the position buffer */
+	int32 NumCollapsedIndices = 0;
+
+	/** Triangles with three distinct vertices but (nearly) no area, e.g. coincident or collinear positions */
+	int32 NumZeroArea = 0;
+
+	/** Triangles with area whose longest edge is many times their height; they rasterize to needles and shade badly */
+	int32 NumSlivers = 0;
+
+	int32 GetNumDegenerate() const { return NumCollapsedIndices + NumZeroArea + NumSlivers; }
+
+	/** @return Share of degenerate triangles, 0-100. */
+	float GetDegeneratePercentage() const { return NumTriangles > 0 ? static_cast<float>(GetNumDegenerate()) / NumTriangles * 100.0f : 0.0f; }
+};
+
+/**
+ * Classifies the triangles of an index buffer by their geometry.
+ * Cross products, edge lengths and the area and aspect ratio tests run four triangles at a time with SIMD,
+ * over chunks of the index buffer that are scanned in parallel.
+ * Thread-safe; holds no state.
+ */
+class FTriangleQualityScanner
+{
+public:
+	/**
+	 * @param Positions Vertex positions.
+	 * @param Indices Triangle list indices into Positions.
+	 * @param MinArea Area (in squared position units) at or below which a triangle counts as zero-area.
+	 * @param MaxAspectRatio Longest edge over the height onto it above which a triangle is a sliver; 0 disables sliver detection.
+	 * @return Per-category counts.
+	 */
+	static FTriangleQualityStats Scan(TConstArrayView<FVector3f> Positions, TConstArrayView<uint32> Indices, float MinArea, float MaxAspectRatio);
+};
@@ -0,0 +1,380 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Analysis/Geometry/FUVCoverageRasterizer.h"
+#include "Async/ParallelFor.h"
+#include "Math/VectorRegister.h"
+
+namespace UVCoverageRasterizer
+{
+	/** Vertices are snapped to 1/16 texel so that edge functions are exact integers */
+	constexpr int32 SubPixelBits = 4;
+	constexpr int64 SubPixelScale = int64(1) << SubPixelBits;
+	constexpr int64 HalfSubPixel = SubPixelScale / 2;
+
+	/** Texels per block side; a block row is two four-wide vectors */
+	constexpr int32 BlockSize = 8;
+
+	/** UVs are clamped to this range before snapping, which keeps edge function products well inside 64 bits */
+	constexpr double MaxAbsUV = 1024.0;
+
+	/** Edge values are clamped to this magnitude before going to 32-bit lanes; offsets within a block are far smaller, so the sign survives */
+	constexpr int64 MaxLaneEdgeValue = int64(1) << 30;
+
+	/** Buffers up to this resolution are too small to be worth spreading over workers */
+	constexpr int32 SingleThreadedResolution = 256;
+
+	/** Widest gutter the padding pass measures */
+	constexpr int32 MaxPaddingTexels = 16;
+
+	/** A triangle set up for rasterization */
+	struct FRasterTriangle
+	{
+		/** Edge functions E = A * X + B * Y + C over sub-texel sample positions; a sample is inside when all three are >= 0 */
+		int64 A[3];
+		int64 B[3];
+		int64 C[3];
+
+		/** Inclusive bounds of the texels whose centers the triangle may cover, clipped to the buffer */
+		int32 MinX;
+		int32 MinY;
+		int32 MaxX;
+		int32 MaxY;
+	};
+
+	int64 FloorDiv(int64 Numerator, int64 Denominator)
+	{
+		return Numerator >= 0 ? Numerator / Denominator : -((-Numerator + Denominator - 1) / Denominator);
+	}
+
+	void IncrementTexel(uint8& Texel)
+	{
+		Texel = Texel < MAX_uint8 ? Texel + 1 : MAX_uint8;
+	}
+
+	/** @return False if the triangle has no area or covers no texel center of the buffer. */
+	bool SetupTriangle(const FVector2f& UV0, const FVector2f& UV1, const FVector2f& UV2, int32 Resolution, FRasterTriangle& OutTriangle)
+	{
+		const double Scale = static_cast<double>(Resolution) * SubPixelScale;
+		auto Snap = [Scale](const FVector2f& UV)
+		{
+			return FInt64Point(
+				FMath::RoundToInt64(FMath::Clamp<double>(UV.X, -MaxAbsUV, MaxAbsUV) * Scale),
+				FMath::RoundToInt64(FMath::Clamp<double>(UV.Y, -MaxAbsUV, MaxAbsUV) * Scale));
+		};
+
+		FInt64Point Vertices[3] = { Snap(UV0), Snap(UV1), Snap(UV2) };
+		const int64 DoubleArea = (Vertices[1].X - Vertices[0].X) * (Vertices[2].Y - Vertices[0].Y) - (Vertices[1].Y - Vertices[0].Y) * (Vertices[2].X - Vertices[0].X);
+		if (DoubleArea == 0)
+		{
+			return false;
+		}
+		if (DoubleArea < 0)
+		{
+			// Mirrored UVs; flip to counter-clockwise so the interior is on the positive side of every edge
+			Swap(Vertices[1], Vertices[2]);
+		}
+
+		for (int32 Edge = 0; Edge < 3; ++Edge)
+		{
+			const FInt64Point& Start = Vertices[Edge];
+			const FInt64Point& End = Vertices[(Edge + 1) % 3];
+			OutTriangle.A[Edge] = Start.Y - End.Y;
+			OutTriangle.B[Edge] = End.X - Start.X;
+			OutTriangle.C[Edge] = -OutTriangle.A[Edge] * Start.X - OutTriangle.B[Edge] * Start.Y;
+
+			// Fill rule: a sample exactly on an edge belongs to only one of the two triangles sharing it, whose edge
+			// function has the opposite sign. Excluded edges require E >= 1, which is E > 0 in integers.
+			const bool bOwnsEdgeSamples = OutTriangle.A[Edge] > 0 || (OutTriangle.A[Edge] == 0 && OutTriangle.B[Edge] > 0);
+			if (!bOwnsEdgeSamples)
+			{
+				OutTriangle.C[Edge] -= 1;
+			}
+		}
+
+		// Texel X covers sample X * SubPixelScale + HalfSubPixel
+		const int64 MinX = FloorDiv(FMath::Min3(Vertices[0].X, Vertices[1].X, Vertices[2].X) - HalfSubPixel + SubPixelScale - 1, SubPixelScale);
+		const int64 MinY = FloorDiv(FMath::Min3(Vertices[0].Y, Vertices[1].Y, Vertices[2].Y) - HalfSubPixel + SubPixelScale - 1, SubPixelScale);
+		const int64 MaxX = FloorDiv(FMath::Max3(Vertices[0].X, Vertices[1].X, Vertices[2].X) - HalfSubPixel, SubPixelScale);
+		const int64 MaxY = FloorDiv(FMath::Max3(Vertices[0].Y, Vertices[1].Y, Vertices[2].Y) - HalfSubPixel, SubPixelScale);
+		if (MinX > MaxX || MinY > MaxY || MaxX < 0 || MaxY < 0 || MinX >= Resolution || MinY >= Resolution)
+		{
+			return false;
+		}
+
+		OutTriangle.MinX = static_cast<int32>(FMath::Max<int64>(MinX, 0));
+		OutTriangle.MinY = static_cast<int32>(FMath::Max<int64>(MinY, 0));
+		OutTriangle.MaxX = static_cast<int32>(FMath::Min<int64>(MaxX, Resolution - 1));
+		OutTriangle.MaxY = static_cast<int32>(FMath::Min<int64>(MaxY, Resolution - 1));
+		return true;
+	}
+
+	/** Adds the texels a triangle covers within one row of blocks to the coverage counts */
+	void RasterizeTriangleInBand(const FRasterTriangle& Triangle, int32 Band, int32 Resolution, uint8* Coverage)
+	{
+		const int32 BlockY = Band * BlockSize;
+		const int32 MinY = FMath::Max(Triangle.MinY, BlockY);
+		const int32 MaxY = FMath::Min(Triangle.MaxY, BlockY + BlockSize - 1);
+		const VectorRegister4Int Zero = MakeVectorRegisterInt(0, 0, 0, 0);
+
+		// Per-texel steps, the range of offsets within a block, and the offsets of the eight lanes of a block row.
+		// Triangles spanning many UV tiles have steps too large for 32-bit lanes and take the scalar path.
+		int64 StepX[3];
+		int64 StepY[3];
+		int64 MinBlockOffset[3];
+		int64 MaxBlockOffset[3];
+		VectorRegister4Int LaneOffsetsLow[3];
+		VectorRegister4Int LaneOffsetsHigh[3];
+		bool bLanesFit = true;
+		for (int32 Edge = 0; Edge < 3; ++Edge)
+		{
+			StepX[Edge] = Triangle.A[Edge] * SubPixelScale;
+			StepY[Edge] = Triangle.B[Edge] * SubPixelScale;
+			MinBlockOffset[Edge] = FMath::Min<int64>(0, StepX[Edge] * (BlockSize - 1)) + FMath::Min<int64>(0, StepY[Edge] * (BlockSize - 1));
+			MaxBlockOffset[Edge] = FMath::Max<int64>(0, StepX[Edge] * (BlockSize - 1)) + FMath::Max<int64>(0, StepY[Edge] * (BlockSize - 1));
+			bLanesFit &= MaxBlockOffset[Edge] - MinBlockOffset[Edge] < MaxLaneEdgeValue;
+
+			const int32 LaneStep = bLanesFit ? static_cast<int32>(StepX[Edge]) : 0;
+			LaneOffsetsLow[Edge] = MakeVectorRegisterInt(0, LaneStep, 2 * LaneStep, 3 * LaneStep);
+			LaneOffsetsHigh[Edge] = MakeVectorRegisterInt(4 * LaneStep, 5 * LaneStep, 6 * LaneStep, 7 * LaneStep);
+		}
+
+		for (int32 BlockX = Triangle.MinX / BlockSize * BlockSize; BlockX <= Triangle.MaxX; BlockX += BlockSize)
+		{
+			// Edge values at the block's first sample decide whether the block is outside, inside or crossed by the triangle
+			const int64 SampleX = BlockX * SubPixelScale + HalfSubPixel;
+			const int64 SampleY = BlockY * SubPixelScale + HalfSubPixel;
+			int64 BlockOrigin[3];
+			bool bOutside = false;
+			bool bInside = true;
+			for (int32 Edge = 0; Edge < 3 && !bOutside; ++Edge)
+			{
+				BlockOrigin[Edge] = Triangle.A[Edge] * SampleX + Triangle.B[Edge] * SampleY + Triangle.C[Edge];
+				bOutside = BlockOrigin[Edge] + MaxBlockOffset[Edge] < 0;
+				bInside &= BlockOrigin[Edge] + MinBlockOffset[Edge] >= 0;
+			}
+			if (bOutside)
+			{
+				continue;
+			}
+
+			const int32 MinX = FMath::Max(Triangle.MinX, BlockX);
+			const int32 MaxX = FMath::Min(Triangle.MaxX, BlockX + BlockSize - 1);
+			if (bInside)
+			{
+				for (int32 Y = MinY; Y <= MaxY; ++Y)
+				{
+					uint8* RowTexels = Coverage + static_cast<int64>(Y) * Resolution;
+					for (int32 X = MinX; X <= MaxX; ++X)
+					{
+						IncrementTexel(RowTexels[X]);
+					}
+				}
+				continue;
+			}
+
+			// Lanes outside the clipped bounds are masked off, which also keeps partial blocks at the buffer edge inside the buffer
+			const uint32 ColumnMask = ((1u << (MaxX - MinX + 1)) - 1) << (MinX - BlockX);
+			if (!bLanesFit)
+			{
+				for (int32 Y = MinY; Y <= MaxY; ++Y)
+				{
+					uint8* RowTexels = Coverage + static_cast<int64>(Y) * Resolution;
+					for (int32 X = MinX; X <= MaxX; ++X)
+					{
+						bool bCovered = true;
+						for (int32 Edge = 0; Edge < 3 && bCovered; ++Edge)
+						{
+							bCovered = BlockOrigin[Edge] + StepX[Edge] * (X - BlockX) + StepY[Edge] * (Y - BlockY) >= 0;
+						}
+						if (bCovered)
+						{
+							IncrementTexel(RowTexels[X]);
+						}
+					}
+				}
+				continue;
+			}
+
+			for (int32 Y = MinY; Y <= MaxY; ++Y)
+			{
+				VectorRegister4Int InsideLow = Zero;
+				VectorRegister4Int InsideHigh = Zero;
+				for (int32 Edge = 0; Edge < 3; ++Edge)
+				{
+					const int32 RowValue = static_cast<int32>(FMath::Clamp(BlockOrigin[Edge] + StepY[Edge] * (Y - BlockY), -MaxLaneEdgeValue, MaxLaneEdgeValue));
+					const VectorRegister4Int Row = MakeVectorRegisterInt(RowValue, RowValue, RowValue, RowValue);
+					const VectorRegister4Int EdgeInsideLow = VectorIntCompareGE(VectorIntAdd(Row, LaneOffsetsLow[Edge]), Zero);
+					const VectorRegister4Int EdgeInsideHigh = VectorIntCompareGE(VectorIntAdd(Row, LaneOffsetsHigh[Edge]), Zero);
+					InsideLow = Edge == 0 ? EdgeInsideLow : VectorIntAnd(InsideLow, EdgeInsideLow);
+					InsideHigh = Edge == 0 ? EdgeInsideHigh : VectorIntAnd(InsideHigh, EdgeInsideHigh);
+				}
+
+				uint32 LaneMask = (static_cast<uint32>(VectorMaskBits(VectorCastIntToFloat(InsideLow)))
+					| (static_cast<uint32>(VectorMaskBits(VectorCastIntToFloat(InsideHigh))) << 4)) & ColumnMask;
+				uint8* BlockTexels = Coverage + static_cast<int64>(Y) * Resolution + BlockX;
+				while (LaneMask)
+				{
+					IncrementTexel(BlockTexels[FMath::CountTrailingZeros(LaneMask)]);
+					LaneMask &= LaneMask - 1;
+				}
+			}
+		}
+	}
+
+	/** @return Empty texels within Padding texels (Chebyshev distance) of a covered texel. */
+	int64 CountPaddingTexels(const TArray<uint8>& Coverage, int32 Resolution, int32 Padding)
+	{
+		// Dilate along rows, then test the dilated rows above and below each empty texel
+		TArray<uint8> NearCoveredInRow;
+		NearCoveredInRow.SetNumZeroed(Coverage.Num());
+		ParallelFor(Resolution, [&Coverage, &NearCoveredInRow, Resolution, Padding](int32 Y)
+		{
+			const uint8* RowTexels = Coverage.GetData() + static_cast<int64>(Y) * Resolution;
+			uint8* RowNear = NearCoveredInRow.GetData() + static_cast<int64>(Y) * Resolution;
+
+			int32 LastCovered = -MaxPaddingTexels - 1;
+			for (int32 X = 0; X < Resolution; ++X)
+			{
+				LastCovered = RowTexels[X] ? X : LastCovered;
+				RowNear[X] = X - LastCovered <= Padding;
+			}
+
+			int32 NextCovered = Resolution + MaxPaddingTexels;
+			for (int32 X = Resolution - 1; X >= 0; --X)
+			{
+				NextCovered = RowTexels[X] ? X : NextCovered;
+				RowNear[X] |= NextCovered - X <= Padding;
+			}
+		});
+
+		TArray<int64> RowPaddingTexels;
+		RowPaddingTexels.SetNumZeroed(Resolution);
+		ParallelFor(Resolution, [&Coverage, &NearCoveredInRow, &RowPaddingTexels, Resolution, Padding](int32 Y)
+		{
+			const int32 MinY = FMath::Max(0, Y - Padding);
+			const int32 MaxY = FMath::Min(Resolution - 1, Y + Padding);
+			const uint8* RowTexels = Coverage.GetData() + static_cast<int64>(Y) * Resolution;
+			for (int32 X = 0; X < Resolution; ++X)
+			{
+				if (RowTexels[X])
+				{
+					continue;
+				}
+				for (int32 NearY = MinY; NearY <= MaxY; ++NearY)
+				{
+					if (NearCoveredInRow[static_cast<int64>(NearY) * Resolution + X])
+					{
+						++RowPaddingTexels[Y];
+						break;
+					}
+				}
+			}
+		});
+
+		int64 NumPaddingTexels = 0;
+		for (const int64 Count : RowPaddingTexels)
+		{
+			NumPaddingTexels += Count;
+		}
+		return NumPaddingTexels;
+	}
+}
+
+FUVCoverageStats FUVCoverageRasterizer::Rasterize(TConstArrayView<FVector2f> UVs, TConstArrayView<uint32> Indices, int32 Resolution, int32 PaddingTexels)
+{
+	using namespace UVCoverageRasterizer;
+
+	FUVCoverageStats Stats;
+	Stats.Resolution = FMath::Clamp(Resolution, 0, MaxResolution);
+	Resolution = Stats.Resolution;
+	if (Resolution == 0)
+	{
+		return Stats;
+	}
+
+	const int32 NumSourceTriangles = Indices.Num() / 3;
+	TArray<FRasterTriangle> Triangles;
+	Triangles.Reserve(NumSourceTriangles);
+	for (int32 TriangleIndex = 0; TriangleIndex < NumSourceTriangles; ++TriangleIndex)
+	{
+		const uint32 Index0 = Indices[TriangleIndex * 3];
+		const uint32 Index1 = Indices[TriangleIndex * 3 + 1];
+		const uint32 Index2 = Indices[TriangleIndex * 3 + 2];
+		if (!UVs.IsValidIndex(Index0) || !UVs.IsValidIndex(Index1) || !UVs.IsValidIndex(Index2))
+		{
+			continue;
+		}
+
+		FRasterTriangle Triangle;
+		if (SetupTriangle(UVs[Index0], UVs[Index1], UVs[Index2], Resolution, Triangle))
+		{
+			Triangles.Add(Triangle);
+		}
+	}
+
+	// Bin triangles into rows of blocks (counting sort). Each row owns its texel rows, so rows rasterize in parallel without locks.
+	const int32 NumBands = FMath::DivideAndRoundUp(Resolution, BlockSize);
+	TArray<int32> BandStart;
+	BandStart.SetNumZeroed(NumBands + 1);
+	for (const FRasterTriangle& Triangle : Triangles)
+	{
+		for (int32 Band = Triangle.MinY / BlockSize; Band <= Triangle.MaxY / BlockSize; ++Band)
+		{
+			++BandStart[Band + 1];
+		}
+	}
+	for (int32 Band = 0; Band < NumBands; ++Band)
+	{
+		BandStart[Band + 1] += BandStart[Band];
+	}
+
+	TArray<int32> BandTriangles;
+	BandTriangles.SetNumUninitialized(BandStart[NumBands]);
+	TArray<int32> BandCursor(BandStart.GetData(), NumBands);
+	for (int32 TriangleIndex = 0; TriangleIndex < Triangles.Num(); ++TriangleIndex)
+	{
+		for (int32 Band = Triangles[TriangleIndex].MinY / BlockSize; Band <= Triangles[TriangleIndex].MaxY / BlockSize; ++Band)
+		{
+			BandTriangles[BandCursor[Band]++] = TriangleIndex;
+		}
+	}
+
+	TArray<uint8> Coverage;
+	Coverage.SetNumZeroed(Resolution * Resolution);
+	TArray<int64> BandCoveredTexels;
+	TArray<int64> BandOverlappedTexels;
+	BandCoveredTexels.SetNumZeroed(NumBands);
+	BandOverlappedTexels.SetNumZeroed(NumBands);
+
+	ParallelFor(NumBands, [&](int32 Band)
+	{
+		for (int32 EntryIndex = BandStart[Band]; EntryIndex < BandStart[Band + 1]; ++EntryIndex)
+		{
+			RasterizeTriangleInBand(Triangles[BandTriangles[EntryIndex]], Band, Resolution, Coverage.GetData());
+		}
+
+		int64 NumCovered = 0;
+		int64 NumOverlapped = 0;
+		const int32 EndY = FMath::Min(Resolution, (Band + 1) * BlockSize);
+		for (int64 TexelIndex = static_cast<int64>(Band) * BlockSize * Resolution; TexelIndex < static_cast<int64>(EndY) * Resolution; ++TexelIndex)
+		{
+			NumCovered += Coverage[TexelIndex] > 0;
+			NumOverlapped += Coverage[TexelIndex] > 1;
+		}
+		BandCoveredTexels[Band] = NumCovered;
+		BandOverlappedTexels[Band] = NumOverlapped;
+	}, Resolution <= SingleThreadedResolution ? EParallelForFlags::ForceSingleThread : EParallelForFlags::Unbalanced);
+
+	for (int32 Band = 0; Band < NumBands; ++Band)
+	{
+		Stats.NumCoveredTexels += BandCoveredTexels[Band];
+		Stats.NumOverlappedTexels += BandOverlappedTexels[Band];
+	}
+
+	if (PaddingTexels > 0 && Stats.NumCoveredTexels > 0)
+	{
+		Stats.NumPaddingTexels = CountPaddingTexels(Coverage, Resolution, FMath::Min(PaddingTexels, MaxPaddingTexels));
+	}
+
+	return Stats;
+}
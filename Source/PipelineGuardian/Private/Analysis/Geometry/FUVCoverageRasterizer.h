@@ -0,0 +1,58 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+
+/** Texel coverage of one UV channel, rasterized over the 0-1 UV square */
+struct FUVCoverageStats
+{
+	/** Texels per side of the coverage buffer; 0 when nothing was rasterized */
+	int32 Resolution = 0;
+
+	/** Texels whose center is covered by at least one triangle */
+	int64 NumCoveredTexels = 0;
+
+	/** Texels whose center is covered by two or more triangles */
+	int64 NumOverlappedTexels = 0;
+
+	/** Empty texels within the padding distance of a covered texel, i.e. the gutter kept around charts */
+	int64 NumPaddingTexels = 0;
+
+	int64 GetNumTexels() const { return static_cast<int64>(Resolution) * Resolution; }
+
+	/** @return Share of all texels that are covered, 0-1. */
+	float GetOccupiedFraction() const { return GetNumTexels() > 0 ? static_cast<float>(static_cast<double>(NumCoveredTexels) / GetNumTexels()) : 0.0f; }
+
+	/** @return Share of all texels lost to padding, 0-1. */
+	float GetPaddingFraction() const { return GetNumTexels() > 0 ? static_cast<float>(static_cast<double>(NumPaddingTexels) / GetNumTexels()) : 0.0f; }
+
+	/** @return Share of the covered texels that are covered more than once, 0-100. */
+	float GetOverlapPercentage() const { return NumCoveredTexels > 0 ? static_cast<float>(static_cast<double>(NumOverlappedTexels) / NumCoveredTexels * 100.0) : 0.0f; }
+};
+
+/**
+ * Rasterizes the triangles of a UV channel into a per-texel coverage count buffer, the way a lightmap baker samples them.
+ * A texel belongs to a triangle when the triangle covers the texel center. Vertices are snapped to sub-texel precision
+ * and edges follow a tie-breaking fill rule, so triangles that share an edge never both cover a texel on it.
+ * Triangles are set up once, binned into rows of 8x8 blocks and the rows are rasterized in parallel. Blocks entirely inside
+ * a triangle are filled directly; the rest evaluate the edge functions eight texels at a time with SIMD.
+ * The cost grows with the resolution and the covered texels rather than with pairs of triangles.
+ * Thread-safe; holds no state.
+ */
+class FUVCoverageRasterizer
+{
+public:
+	/** Largest supported resolution; the count buffer holds one byte per texel */
+	static constexpr int32 MaxResolution = 4096;
+
+	/**
+	 * @param UVs Texture coordinates of one UV channel, indexed by vertex.
+	 * @param Indices Triangle list indices into UVs.
+	 * @param Resolution Texels per side, e.g. the mesh's lightmap resolution. Clamped to MaxResolution.
+	 * @param PaddingTexels Gutter width in texels counted into NumPaddingTexels; 0 skips the padding pass.
+	 * @return Covered, overlapped and padding texel counts. UV area outside the 0-1 square is not counted.
+	 */
+	static FUVCoverageStats Rasterize(TConstArrayView<FVector2f> UVs, TConstArrayView<uint32> Indices, int32 Resolution, int32 PaddingTexels);
+};
@@ -0,0 +1,338 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Analysis/Geometry/FUVOverlapDetector.h"
+#include "Containers/BitArray.h"
+#include "Math/Box2D.h"
+
+namespace UVOverlapDetector
+{
+	/** Upper bound on grid cells per side */
+	constexpr int32 MaxCellsPerSide = 4096;
+
+	/** Average number of grid cells per triangle the grid is allowed to grow to */
+	constexpr int32 MaxCellsPerTriangle = 4;
+
+	/** Triangles sampled to estimate the median triangle extent */
+	constexpr int32 MaxExtentSamples = 4096;
+
+	/** Area below which a UV triangle is considered to cover nothing */
+	constexpr double MinTriangleArea = 1e-12;
+
+	/** Share of its area at which a triangle counts as fully overlapped, allowing for the rounding of the clipped areas */
+	constexpr double FullyOverlappedFraction = 0.999;
+
+	/** Boxes are a separating axis test of their own; a cheap reject before the exact test */
+	bool BoundsOverlap(const FBox2f& A, const FBox2f& B, float Tolerance)
+	{
+		return FMath::Min(A.Max.X, B.Max.X) - FMath::Max(A.Min.X, B.Min.X) > Tolerance
+			&& FMath::Min(A.Max.Y, B.Max.Y) - FMath::Max(A.Min.Y, B.Min.Y) > Tolerance;
+	}
+}
+
+FUVOverlapStats FUVOverlapDetector::Detect(TConstArrayView<FVector2f> UVs, TConstArrayView<uint32> Indices, float Tolerance)
+{
+	using namespace UVOverlapDetector;
+
+	FUVOverlapStats Stats;
+
+	// Triangles with an area in UV space, with their corners copied out for cache-friendly pair tests
+	const int32 NumSourceTriangles = Indices.Num() / 3;
+	TArray<FVector2f> Corners;
+	TArray<FBox2f> TriangleBounds;
+	TArray<double> TriangleAreas;
+	TArray<int32> SourceTriangles;
+	Corners.Reserve(NumSourceTriangles * 3);
+	TriangleBounds.Reserve(NumSourceTriangles);
+	TriangleAreas.Reserve(NumSourceTriangles);
+	SourceTriangles.Reserve(NumSourceTriangles);
+
+	FBox2f UVBounds(ForceInit);
+	for (int32 TriangleIndex = 0; TriangleIndex < NumSourceTriangles; ++TriangleIndex)
+	{
+		const uint32 Index0 = Indices[TriangleIndex * 3];
+		const uint32 Index1 = Indices[TriangleIndex * 3 + 1];
+		const uint32 Index2 = Indices[TriangleIndex * 3 + 2];
+		if (!UVs.IsValidIndex(Index0) || !UVs.IsValidIndex(Index1) || !UVs.IsValidIndex(Index2))
+		{
+			continue;
+		}
+
+		const FVector2f& A = UVs[Index0];
+		const FVector2f& B = UVs[Index1];
+		const FVector2f& C = UVs[Index2];
+		const double Area = 0.5 * FMath::Abs(FVector2D::CrossProduct(FVector2D(B - A), FVector2D(C - A)));
+		if (Area <= MinTriangleArea)
+		{
+			continue;
+		}
+
+		Corners.Add(A);
+		Corners.Add(B);
+		Corners.Add(C);
+
+		FBox2f& Bounds = TriangleBounds.Emplace_GetRef(ForceInit);
+		Bounds += A;
+		Bounds += B;
+		Bounds += C;
+		UVBounds += Bounds;
+
+		TriangleAreas.Add(Area);
+		SourceTriangles.Add(TriangleIndex);
+		Stats.TotalArea += Area;
+	}
+
+	const int32 NumTriangles = SourceTriangles.Num();
+	Stats.NumTriangles = NumTriangles;
+	if (NumTriangles < 2)
+	{
+		return Stats;
+	}
+
+	// Cells about the size of a typical triangle keep the per-cell lists short for unique layouts and the
+	// number of cells per triangle small for stacked ones. The grid is capped for meshes with a few huge triangles.
+	TArray<float> Extents;
+	const int32 SampleStride = FMath::Max(1, NumTriangles / MaxExtentSamples);
+	for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex += SampleStride)
+	{
+		const FVector2f Size = TriangleBounds[TriangleIndex].GetSize();
+		Extents.Add(FMath::Max(Size.X, Size.Y));
+	}
+	Extents.Sort();
+
+	const FVector2f BoundsSize = UVBounds.GetSize();
+	const float MinCellSizeForCount = FMath::Sqrt(BoundsSize.X * BoundsSize.Y / (static_cast<float>(NumTriangles) * MaxCellsPerTriangle));
+	const float CellSize = FMath::Max(FMath::Max3(Extents[Extents.Num() / 2], MinCellSizeForCount, UE_KINDA_SMALL_NUMBER),
+		FMath::Max(BoundsSize.X, BoundsSize.Y) / MaxCellsPerSide);
+	const int32 CellsX = FMath::Clamp(FMath::CeilToInt(BoundsSize.X / CellSize), 1, MaxCellsPerSide);
+	const int32 CellsY = FMath::Clamp(FMath::CeilToInt(BoundsSize.Y / CellSize), 1, MaxCellsPerSide);
+	const int32 NumCells = CellsX * CellsY;
+
+	auto GetCell = [&UVBounds, CellSize, CellsX, CellsY](const FVector2f& Point)
+	{
+		return FIntPoint(
+			FMath::Clamp(FMath::FloorToInt((Point.X - UVBounds.Min.X) / CellSize), 0, CellsX - 1),
+			FMath::Clamp(FMath::FloorToInt((Point.Y - UVBounds.Min.Y) / CellSize), 0, CellsY - 1));
+	};
+
+	auto GetCellRange = [&GetCell](const FBox2f& Bounds, FIntPoint& OutMin, FIntPoint& OutMax)
+	{
+		OutMin = GetCell(Bounds.Min);
+		OutMax = GetCell(Bounds.Max);
+	};
+
+	// Bucket triangles into cells (counting sort), keeping each cell's list in triangle order
+	TArray<int32> CellStart;
+	CellStart.SetNumZeroed(NumCells + 1);
+	for (const FBox2f& Bounds : TriangleBounds)
+	{
+		FIntPoint MinCell, MaxCell;
+		GetCellRange(Bounds, MinCell, MaxCell);
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+			{
+				++CellStart[Y * CellsX + X + 1];
+			}
+		}
+	}
+	for (int32 CellIndex = 0; CellIndex < NumCells; ++CellIndex)
+	{
+		CellStart[CellIndex + 1] += CellStart[CellIndex];
+	}
+
+	TArray<int32> CellTriangles;
+	CellTriangles.SetNumUninitialized(CellStart[NumCells]);
+	TArray<int32> CellCursor(CellStart.GetData(), NumCells);
+	for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; ++TriangleIndex)
+	{
+		FIntPoint MinCell, MaxCell;
+		GetCellRange(TriangleBounds[TriangleIndex], MinCell, MaxCell);
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+			{
+				CellTriangles[CellCursor[Y * CellsX + X]++] = TriangleIndex;
+			}
+		}
+	}
+
+	// Overlapped area of each triangle, capped at its own area; a triangle whose whole area is overlapped is done
+	TBitArray<> Overlapping(false, NumTriangles);
+	TBitArray<> FullyOverlapped(false, NumTriangles);
+	TArray<double> OverlappedAreas;
+	OverlappedAreas.SetNumZeroed(NumTriangles);
+	auto AddOverlappedArea = [&OverlappedAreas, &TriangleAreas, &FullyOverlapped](int32 Triangle, double Area)
+	{
+		OverlappedAreas[Triangle] = FMath::Min(OverlappedAreas[Triangle] + Area, TriangleAreas[Triangle]);
+		if (OverlappedAreas[Triangle] >= TriangleAreas[Triangle] * FullyOverlappedFraction)
+		{
+			OverlappedAreas[Triangle] = TriangleAreas[Triangle];
+			FullyOverlapped[Triangle] = true;
+		}
+	};
+
+	// A pair that shares several cells is only tested in the cell holding the minimum corner of their bounds overlap,
+	// so its area is counted once
+	auto TestPair = [&](int32 Triangle, int32 Other, int32 CellIndex)
+	{
+		const FBox2f& Bounds = TriangleBounds[Triangle];
+		const FBox2f& OtherBounds = TriangleBounds[Other];
+		if (!BoundsOverlap(Bounds, OtherBounds, Tolerance))
+		{
+			return;
+		}
+
+		const FIntPoint OwnerCell = GetCell(FVector2f(FMath::Max(Bounds.Min.X, OtherBounds.Min.X), FMath::Max(Bounds.Min.Y, OtherBounds.Min.Y)));
+		if (OwnerCell.Y * CellsX + OwnerCell.X != CellIndex || !TrianglesOverlap(&Corners[Triangle * 3], &Corners[Other * 3], Tolerance))
+		{
+			return;
+		}
+
+		Overlapping[Triangle] = true;
+		Overlapping[Other] = true;
+		const double IntersectionArea = GetIntersectionArea(&Corners[Triangle * 3], &Corners[Other * 3]);
+		AddOverlappedArea(Triangle, IntersectionArea);
+		AddOverlappedArea(Other, IntersectionArea);
+	};
+
+	// Every pair that shares a cell and has at least one triangle not yet fully overlapped is tested. A fully overlapped
+	// triangle only needs testing against the others, and the others stop once they are fully overlapped too, so stacks
+	// of identical triangles cost one test per triangle instead of one per pair.
+	TArray<int32> PartialTriangles;
+	TArray<int32> FullTriangles;
+	for (int32 CellIndex = 0; CellIndex < NumCells; ++CellIndex)
+	{
+		PartialTriangles.Reset();
+		FullTriangles.Reset();
+
+		for (int32 EntryIndex = CellStart[CellIndex]; EntryIndex < CellStart[CellIndex + 1]; ++EntryIndex)
+		{
+			const int32 Triangle = CellTriangles[EntryIndex];
+
+			for (int32 PartialIndex = 0; PartialIndex < PartialTriangles.Num();)
+			{
+				const int32 Other = PartialTriangles[PartialIndex];
+				if (!FullyOverlapped[Other])
+				{
+					TestPair(Triangle, Other, CellIndex);
+				}
+				if (!FullyOverlapped[Other])
+				{
+					++PartialIndex;
+					continue;
+				}
+
+				// Fully overlapped, here or in another cell
+				FullTriangles.Add(Other);
+				PartialTriangles.RemoveAtSwap(PartialIndex, 1, EAllowShrinking::No);
+			}
+
+			for (int32 FullIndex = 0; FullIndex < FullTriangles.Num() && !FullyOverlapped[Triangle]; ++FullIndex)
+			{
+				TestPair(Triangle, FullTriangles[FullIndex], CellIndex);
+			}
+
+			(FullyOverlapped[Triangle] ? FullTriangles : PartialTriangles).Add(Triangle);
+		}
+	}
+
+	for (TConstSetBitIterator<> It(Overlapping); It; ++It)
+	{
+		Stats.OverlappingTriangles.Add(SourceTriangles[It.GetIndex()]);
+		Stats.OverlappingArea += OverlappedAreas[It.GetIndex()];
+	}
+
+	return Stats;
+}
+
+bool FUVOverlapDetector::TrianglesOverlap(const FVector2f* A, const FVector2f* B, float Tolerance)
+{
+	// Two convex polygons are disjoint iff one of their edge normals separates them
+	return !HasSeparatingEdge(A, B, Tolerance) && !HasSeparatingEdge(B, A, Tolerance);
+}
+
+double FUVOverlapDetector::GetIntersectionArea(const FVector2f* A, const FVector2f* B)
+{
+	// Clipping a triangle by the three half-planes of another adds at most one corner per edge
+	constexpr int32 MaxCorners = 6;
+	FVector2D Polygon[MaxCorners];
+	FVector2D Clipped[MaxCorners];
+	int32 NumCorners = 3;
+	for (int32 Corner = 0; Corner < 3; ++Corner)
+	{
+		Polygon[Corner] = FVector2D(A[Corner]);
+	}
+
+	// Inside is to the left of every edge of a counter-clockwise B
+	const double Winding = FVector2D::CrossProduct(FVector2D(B[1] - B[0]), FVector2D(B[2] - B[0])) >= 0.0 ? 1.0 : -1.0;
+	for (int32 EdgeIndex = 0; EdgeIndex < 3 && NumCorners > 0; ++EdgeIndex)
+	{
+		const FVector2D Start(B[EdgeIndex]);
+		const FVector2D Edge = FVector2D(B[(EdgeIndex + 1) % 3]) - Start;
+
+		int32 NumClipped = 0;
+		for (int32 Corner = 0; Corner < NumCorners && NumClipped < MaxCorners; ++Corner)
+		{
+			const FVector2D& Current = Polygon[Corner];
+			const FVector2D& Next = Polygon[(Corner + 1) % NumCorners];
+			const double CurrentSide = Winding * FVector2D::CrossProduct(Edge, Current - Start);
+			const double NextSide = Winding * FVector2D::CrossProduct(Edge, Next - Start);
+			if (CurrentSide >= 0.0)
+			{
+				Clipped[NumClipped++] = Current;
+			}
+			if ((CurrentSide >= 0.0) != (NextSide >= 0.0) && NumClipped < MaxCorners)
+			{
+				Clipped[NumClipped++] = Current + (Next - Current) * (CurrentSide / (CurrentSide - NextSide));
+			}
+		}
+
+		NumCorners = NumClipped;
+		for (int32 Corner = 0; Corner < NumCorners; ++Corner)
+		{
+			Polygon[Corner] = Clipped[Corner];
+		}
+	}
+
+	// Shoelace formula
+	double TwiceArea = 0.0;
+	for (int32 Corner = 0; Corner < NumCorners; ++Corner)
+	{
+		TwiceArea += FVector2D::CrossProduct(Polygon[Corner], Polygon[(Corner + 1) % NumCorners]);
+	}
+	return 0.5 * FMath::Abs(TwiceArea);
+}
+
+bool FUVOverlapDetector::HasSeparatingEdge(const FVector2f* Triangle, const FVector2f* Other, float Tolerance)
+{
+	for (int32 EdgeIndex = 0; EdgeIndex < 3; ++EdgeIndex)
+	{
+		const FVector2f& Start = Triangle[EdgeIndex];
+		const FVector2f& End = Triangle[(EdgeIndex + 1) % 3];
+		FVector2f Axis(End.Y - Start.Y, Start.X - End.X);
+		const float Length = Axis.Size();
+		if (Length <= UE_SMALL_NUMBER)
+		{
+			continue;
+		}
+		Axis /= Length;
+
+		float MinA = MAX_flt, MaxA = -MAX_flt;
+		float MinB = MAX_flt, MaxB = -MAX_flt;
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			const float ProjectionA = FVector2f::DotProduct(Triangle[Corner], Axis);
+			const float ProjectionB = FVector2f::DotProduct(Other[Corner], Axis);
+			MinA = FMath::Min(MinA, ProjectionA);
+			MaxA = FMath::Max(MaxA, ProjectionA);
+			MinB = FMath::Min(MinB, ProjectionB);
+			MaxB = FMath::Max(MaxB, ProjectionB);
+		}
+
+		if (FMath::Min(MaxA, MaxB) - FMath::Max(MinA, MinB) <= Tolerance)
+		{
+			return true;
+		}
+	}
+	return false;
+}
@@ -0,0 +1,70 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+
+/** Overlap statistics of one UV channel */
+struct FUVOverlapStats
+{
+	/** Triangles with a non-zero area in UV space; zero-area triangles cover nothing and are ignored */
+	int32 NumTriangles = 0;
+
+	/** Indices (into the triangle list) of the triangles that overlap at least one other triangle */
+	TArray<int32> OverlappingTriangles;
+
+	/** UV area of all triangles */
+	double TotalArea = 0.0;
+
+	/** UV area of the triangles that lies under at least one other triangle; a spot covered twice counts for both triangles, as in TotalArea */
+	double OverlappingArea = 0.0;
+
+	int32 GetNumOverlappingTriangles() const { return OverlappingTriangles.Num(); }
+
+	/** @return Share of the UV area that overlaps another triangle, 0-100. */
+	float GetOverlapPercentage() const { return TotalArea > 0.0 ? static_cast<float>(OverlappingArea / TotalArea * 100.0) : 0.0f; }
+};
+
+/**
+ * Finds the triangles of a mesh whose UV-space interiors intersect, and the UV area they overlap on.
+ * Candidate pairs come from a uniform grid over the UV bounds, sized from the median triangle extent so that both
+ * unique layouts (many small triangles) and stacked layouts (every triangle over the same area) stay close to linear.
+ * Candidates are confirmed with an exact separating axis test, so triangles that only share an edge or a vertex do not overlap,
+ * and the area of each overlapping pair is clipped exactly. The overlapped area of a triangle is the sum of its pair areas,
+ * capped at its own area, so it is only overestimated where three or more triangles partially overlap in the same spot.
+ * Thread-safe; holds no state.
+ */
+class FUVOverlapDetector
+{
+public:
+	/**
+	 * @param UVs Texture coordinates of one UV channel, indexed by vertex.
+	 * @param Indices Triangle list indices into UVs.
+	 * @param Tolerance Depth in UV units by which two triangles must interpenetrate to count as overlapping.
+	 * @return The overlapping triangles and their share of the UV area.
+	 */
+	static FUVOverlapStats Detect(TConstArrayView<FVector2f> UVs, TConstArrayView<uint32> Indices, float Tolerance);
+
+	/**
+	 * Exact 2D triangle overlap test.
+	 * @param A Corners of the first triangle, either winding.
+	 * @param B Corners of the second triangle, either winding.
+	 * @param Tolerance Penetration depth below which touching triangles are not considered overlapping.
+	 * @return True if the interiors intersect by more than Tolerance.
+	 */
+	static bool TrianglesOverlap(const FVector2f* A, const FVector2f* B, float Tolerance);
+
+	/**
+	 * Exact 2D triangle intersection area, by clipping one triangle against the other.
+	 * @param A Corners of the first triangle, either winding.
+	 * @param B Corners of the second triangle, either winding.
+	 * @return Area of the intersection in UV units squared; 0 if the triangles do not intersect.
+	 */
+	static double GetIntersectionArea(const FVector2f* A, const FVector2f* B);
+
+private:
+	/** @return True if one of Triangle's edges is a separating axis between the two triangles. */
+	static bool HasSeparatingEdge(const FVector2f* Triangle, const FVector2f* Other, float Tolerance);
+};
@@ -0,0 +1,360 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Analysis/Geometry/FVertexCacheOptimizer.h"
+
+namespace VertexCacheOptimizer
+{
+	// Scoring constants from Forsyth, "Linear-Speed Vertex Cache Optimisation"
+	constexpr float CacheDecayPower = 1.5f;
+	constexpr float LastTriangleScore = 0.75f;
+	constexpr float ValenceBoostScale = 2.0f;
+	constexpr float ValenceBoostPower = 0.5f;
+
+	/** Valences with a precomputed score; higher ones are computed on demand */
+	constexpr int32 NumValenceScores = 32;
+
+	/** Stamp of vertices the FIFO simulation has not seen yet; far enough below any miss count to read as evicted */
+	constexpr int64 NeverCached = MIN_int64 / 2;
+
+	/** Vertex scores by cache position and by remaining valence */
+	struct FScoreTables
+	{
+		float CachePosition[FVertexCacheOptimizer::OptimizedCacheSize];
+		float Valence[NumValenceScores];
+
+		FScoreTables()
+		{
+			constexpr int32 CacheSize = FVertexCacheOptimizer::OptimizedCacheSize;
+			for (int32 Position = 0; Position < CacheSize; ++Position)
+			{
+				// The three vertices of the last triangle score the same, so the next triangle's winding does not matter
+				CachePosition[Position] = Position < 3
+					? LastTriangleScore
+					: FMath::Pow(1.0f - static_cast<float>(Position - 3) / (CacheSize - 3), CacheDecayPower);
+			}
+			Valence[0] = 0.0f;
+			for (int32 NumRemaining = 1; NumRemaining < NumValenceScores; ++NumRemaining)
+			{
+				Valence[NumRemaining] = ValenceBoostScale * FMath::Pow(static_cast<float>(NumRemaining), -ValenceBoostPower);
+			}
+		}
+
+		/** @return Score of a vertex; vertices used by no remaining triangle score -1. */
+		float GetVertexScore(int32 Position, int32 NumRemaining) const
+		{
+			if (NumRemaining == 0)
+			{
+				return -1.0f;
+			}
+
+			const float CacheScore = Position >= 0 ? CachePosition[Position] : 0.0f;
+			const float ValenceScore = NumRemaining < NumValenceScores
+				? Valence[NumRemaining]
+				: ValenceBoostScale * FMath::Pow(static_cast<float>(NumRemaining), -ValenceBoostPower);
+			return CacheScore + ValenceScore;
+		}
+	};
+
+	/** @return False if there are no complete triangles; otherwise the smallest and largest index they use. */
+	bool GetIndexRange(TConstArrayView<uint32> Indices, uint32& OutMinIndex, uint32& OutMaxIndex)
+	{
+		const int32 NumIndices = Indices.Num() / 3 * 3;
+		if (NumIndices == 0)
+		{
+			return false;
+		}
+
+		OutMinIndex = MAX_uint32;
+		OutMaxIndex = 0;
+		for (int32 Index = 0; Index < NumIndices; ++Index)
+		{
+			OutMinIndex = FMath::Min(OutMinIndex, Indices[Index]);
+			OutMaxIndex = FMath::Max(OutMaxIndex, Indices[Index]);
+		}
+		return true;
+	}
+}
+
+FVertexCacheStats FVertexCacheOptimizer::Simulate(TConstArrayView<uint32> Indices, int32 CacheSize, bool bLRU)
+{
+	using namespace VertexCacheOptimizer;
+
+	FVertexCacheStats Stats;
+	uint32 MinIndex = 0;
+	uint32 MaxIndex = 0;
+	if (!GetIndexRange(Indices, MinIndex, MaxIndex))
+	{
+		return Stats;
+	}
+
+	Stats.NumTriangles = Indices.Num() / 3;
+	const int32 NumIndices = Stats.NumTriangles * 3;
+	const int32 IndexRange = static_cast<int32>(MaxIndex - MinIndex) + 1;
+	CacheSize = FMath::Max(CacheSize, 1);
+
+	if (!bLRU)
+	{
+		// A vertex stays in a FIFO cache until CacheSize further misses have pushed it out, so the miss count
+		// at which it entered tells whether it is still cached
+		TArray<int64> EntryStamps;
+		EntryStamps.Init(NeverCached, IndexRange);
+		for (int32 Index = 0; Index < NumIndices; ++Index)
+		{
+			int64& EntryStamp = EntryStamps[Indices[Index] - MinIndex];
+			if (EntryStamp == NeverCached)
+			{
+				++Stats.NumVertices;
+			}
+			if (Stats.NumCacheMisses - EntryStamp >= CacheSize)
+			{
+				EntryStamp = Stats.NumCacheMisses++;
+			}
+		}
+		return Stats;
+	}
+
+	// Most recently used first
+	TArray<uint32, TInlineAllocator<64>> Cache;
+	TBitArray<> Seen(false, IndexRange);
+	for (int32 Index = 0; Index < NumIndices; ++Index)
+	{
+		const uint32 VertexIndex = Indices[Index];
+		FBitReference SeenBit = Seen[VertexIndex - MinIndex];
+		if (!SeenBit)
+		{
+			SeenBit = true;
+			++Stats.NumVertices;
+		}
+
+		const int32 CachePosition = Cache.Find(VertexIndex);
+		if (CachePosition == INDEX_NONE)
+		{
+			++Stats.NumCacheMisses;
+			if (Cache.Num() == CacheSize)
+			{
+				Cache.Pop(EAllowShrinking::No);
+			}
+			Cache.Insert(VertexIndex, 0);
+		}
+		else if (CachePosition > 0)
+		{
+			Cache.RemoveAt(CachePosition, 1, EAllowShrinking::No);
+			Cache.Insert(VertexIndex, 0);
+		}
+	}
+	return Stats;
+}
+
+void FVertexCacheOptimizer::OptimizeTriangleOrder(TConstArrayView<uint32> Indices, TArray<int32>& OutTriangleOrder)
+{
+	using namespace VertexCacheOptimizer;
+
+	OutTriangleOrder.Reset();
+	uint32 MinIndex = 0;
+	uint32 MaxIndex = 0;
+	if (!GetIndexRange(Indices, MinIndex, MaxIndex))
+	{
+		return;
+	}
+
+	static const FScoreTables ScoreTables;
+
+	const int32 NumTriangles = Indices.Num() / 3;
+	const int32 IndexRange = static_cast<int32>(MaxIndex - MinIndex) + 1;
+	auto GetLocalVertex = [&Indices, MinIndex](int32 TriangleIndex, int32 Corner)
+	{
+		return static_cast<int32>(Indices[TriangleIndex * 3 + Corner] - MinIndex);
+	};
+
+	// Triangles adjacent to each vertex, as ranges of one array. The first NumRemaining entries of a vertex's range
+	// are the triangles not emitted yet.
+	TArray<int32> NumRemaining;
+	NumRemaining.SetNumZeroed(IndexRange);
+	for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; ++TriangleIndex)
+	{
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			++NumRemaining[GetLocalVertex(TriangleIndex, Corner)];
+		}
+	}
+
+	TArray<int32> AdjacencyOffsets;
+	AdjacencyOffsets.SetNumUninitialized(IndexRange + 1);
+	AdjacencyOffsets[0] = 0;
+	for (int32 Vertex = 0; Vertex < IndexRange; ++Vertex)
+	{
+		AdjacencyOffsets[Vertex + 1] = AdjacencyOffsets[Vertex] + NumRemaining[Vertex];
+	}
+
+	TArray<int32> AdjacentTriangles;
+	AdjacentTriangles.SetNumUninitialized(NumTriangles * 3);
+	{
+		TArray<int32> FillCounts;
+		FillCounts.SetNumZeroed(IndexRange);
+		for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; ++TriangleIndex)
+		{
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const int32 Vertex = GetLocalVertex(TriangleIndex, Corner);
+				AdjacentTriangles[AdjacencyOffsets[Vertex] + FillCounts[Vertex]++] = TriangleIndex;
+			}
+		}
+	}
+
+	TArray<int32> CachePositions;
+	CachePositions.Init(INDEX_NONE, IndexRange);
+	TArray<float> VertexScores;
+	VertexScores.SetNumUninitialized(IndexRange);
+	for (int32 Vertex = 0; Vertex < IndexRange; ++Vertex)
+	{
+		VertexScores[Vertex] = ScoreTables.GetVertexScore(INDEX_NONE, NumRemaining[Vertex]);
+	}
+
+	TArray<float> TriangleScores;
+	TriangleScores.SetNumUninitialized(NumTriangles);
+	int32 BestTriangle = INDEX_NONE;
+	float BestScore = -1.0f;
+	for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; ++TriangleIndex)
+	{
+		TriangleScores[TriangleIndex] = VertexScores[GetLocalVertex(TriangleIndex, 0)] + VertexScores[GetLocalVertex(TriangleIndex, 1)] + VertexScores[GetLocalVertex(TriangleIndex, 2)];
+		if (TriangleScores[TriangleIndex] > BestScore)
+		{
+			BestScore = TriangleScores[TriangleIndex];
+			BestTriangle = TriangleIndex;
+		}
+	}
+
+	TBitArray<> Emitted(false, NumTriangles);
+	int32 NextUnemitted = 0;
+
+	// Three extra entries hold the vertices pushed out by the last triangle until their scores are updated
+	int32 Cache[OptimizedCacheSize + 3];
+	int32 NumCached = 0;
+
+	OutTriangleOrder.Reserve(NumTriangles);
+	for (int32 NumEmitted = 0; NumEmitted < NumTriangles; ++NumEmitted)
+	{
+		// No cached vertex has a remaining triangle: continue with the next triangle in input order
+		if (BestTriangle == INDEX_NONE)
+		{
+			while (Emitted[NextUnemitted])
+			{
+				++NextUnemitted;
+			}
+			BestTriangle = NextUnemitted;
+		}
+
+		Emitted[BestTriangle] = true;
+		OutTriangleOrder.Add(BestTriangle);
+		int32 TriangleVertices[3];
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			TriangleVertices[Corner] = GetLocalVertex(BestTriangle, Corner);
+
+			// Swap the triangle out of the vertex's remaining range
+			const int32 Vertex = TriangleVertices[Corner];
+			int32* Adjacent = &AdjacentTriangles[AdjacencyOffsets[Vertex]];
+			const int32 Last = --NumRemaining[Vertex];
+			for (int32 Slot = 0; Slot <= Last; ++Slot)
+			{
+				if (Adjacent[Slot] == BestTriangle)
+				{
+					Swap(Adjacent[Slot], Adjacent[Last]);
+					break;
+				}
+			}
+		}
+
+		// The triangle's vertices move to the front of the cache, the rest shift back
+		int32 NewCache[OptimizedCacheSize + 3];
+		int32 NumNewCached = 0;
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			const int32 Vertex = TriangleVertices[Corner];
+			if (Corner == 0 || (Vertex != TriangleVertices[0] && (Corner == 1 || Vertex != TriangleVertices[1])))
+			{
+				NewCache[NumNewCached++] = Vertex;
+			}
+		}
+		for (int32 Position = 0; Position < NumCached; ++Position)
+		{
+			const int32 Vertex = Cache[Position];
+			if (Vertex != TriangleVertices[0] && Vertex != TriangleVertices[1] && Vertex != TriangleVertices[2])
+			{
+				NewCache[NumNewCached++] = Vertex;
+			}
+		}
+
+		// Rescore the vertices whose position changed
+		for (int32 Position = 0; Position < NumNewCached; ++Position)
+		{
+			const int32 Vertex = NewCache[Position];
+			CachePositions[Vertex] = Position < OptimizedCacheSize ? Position : INDEX_NONE;
+
+			const float NewScore = ScoreTables.GetVertexScore(CachePositions[Vertex], NumRemaining[Vertex]);
+			const float ScoreDelta = NewScore - VertexScores[Vertex];
+			VertexScores[Vertex] = NewScore;
+
+			const int32* Adjacent = &AdjacentTriangles[AdjacencyOffsets[Vertex]];
+			for (int32 Slot = 0; Slot < NumRemaining[Vertex]; ++Slot)
+			{
+				TriangleScores[Adjacent[Slot]] += ScoreDelta;
+			}
+		}
+
+		NumCached = FMath::Min(NumNewCached, OptimizedCacheSize);
+		FMemory::Memcpy(Cache, NewCache, NumCached * sizeof(int32));
+
+		// Only triangles of cached vertices gained score, so the next best triangle is one of theirs
+		BestTriangle = INDEX_NONE;
+		BestScore = -1.0f;
+		for (int32 Position = 0; Position < NumCached; ++Position)
+		{
+			const int32 Vertex = Cache[Position];
+			const int32* Adjacent = &AdjacentTriangles[AdjacencyOffsets[Vertex]];
+			for (int32 Slot = 0; Slot < NumRemaining[Vertex]; ++Slot)
+			{
+				const int32 TriangleIndex = Adjacent[Slot];
+				if (TriangleScores[TriangleIndex] > BestScore)
+				{
+					BestScore = TriangleScores[TriangleIndex];
+					BestTriangle = TriangleIndex;
+				}
+			}
+		}
+	}
+}
+
+void FVertexCacheOptimizer::ReorderTriangles(TConstArrayView<uint32> Indices, TConstArrayView<int32> TriangleOrder, TArray<uint32>& OutIndices)
+{
+	OutIndices.SetNumUninitialized(TriangleOrder.Num() * 3);
+	for (int32 Position = 0; Position < TriangleOrder.Num(); ++Position)
+	{
+		const int32 TriangleIndex = TriangleOrder[Position];
+		OutIndices[Position * 3] = Indices[TriangleIndex * 3];
+		OutIndices[Position * 3 + 1] = Indices[TriangleIndex * 3 + 1];
+		OutIndices[Position * 3 + 2] = Indices[TriangleIndex * 3 + 2];
+	}
+}
+
+void FVertexCacheOptimizer::OptimizeVertexFetch(TConstArrayView<uint32> Indices, int32 NumVertices, TArray<int32>& OutVertexRemap)
+{
+	OutVertexRemap.Init(INDEX_NONE, NumVertices);
+
+	int32 NextVertex = 0;
+	for (const uint32 VertexIndex : Indices)
+	{
+		if (VertexIndex < static_cast<uint32>(NumVertices) && OutVertexRemap[VertexIndex] == INDEX_NONE)
+		{
+			OutVertexRemap[VertexIndex] = NextVertex++;
+		}
+	}
+
+	for (int32& NewIndex : OutVertexRemap)
+	{
+		if (NewIndex == INDEX_NONE)
+		{
+			NewIndex = NextVertex++;
+		}
+	}
+}
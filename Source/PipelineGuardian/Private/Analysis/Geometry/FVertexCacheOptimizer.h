@@ -0,0 +1,78 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+
+/** Post-transform vertex cache behavior of an index buffer */
+struct FVertexCacheStats
+{
+	int32 NumTriangles = 0;
+
+	/** Distinct vertices referenced by the triangles */
+	int32 NumVertices = 0;
+
+	/** Vertices the simulated cache had to transform */
+	int64 NumCacheMisses = 0;
+
+	/** @return Average cache miss ratio: transformed vertices per triangle, 0.5 at best for large grids and 3 at worst. */
+	float GetACMR() const { return NumTriangles > 0 ? static_cast<float>(static_cast<double>(NumCacheMisses) / NumTriangles) : 0.0f; }
+
+	/** @return Average transform to vertex ratio: how often each vertex is transformed, 1 at best. */
+	float GetATVR() const { return NumVertices > 0 ? static_cast<float>(static_cast<double>(NumCacheMisses) / NumVertices) : 0.0f; }
+
+	FVertexCacheStats& operator+=(const FVertexCacheStats& Other)
+	{
+		NumTriangles += Other.NumTriangles;
+		NumVertices += Other.NumVertices;
+		NumCacheMisses += Other.NumCacheMisses;
+		return *this;
+	}
+};
+
+/**
+ * Measures and improves how well an index buffer reuses the GPU's post-transform vertex cache.
+ * Simulate() replays the indices through a FIFO or LRU cache. OptimizeTriangleOrder() reorders triangles with Tom
+ * Forsyth's linear-speed vertex cache optimization, and OptimizeVertexFetch() numbers vertices in first-use order so
+ * that fetches walk the vertex buffer front to back.
+ * Indices are absolute; all working memory spans only the range of vertex indices actually referenced.
+ * Thread-safe; holds no state.
+ */
+class FVertexCacheOptimizer
+{
+public:
+	/** Cache size the triangle order is optimized for; small enough to also suit the caches of older GPUs */
+	static constexpr int32 OptimizedCacheSize = 32;
+
+	/**
+	 * @param Indices Triangle list indices.
+	 * @param CacheSize Entries in the simulated cache.
+	 * @param bLRU Simulate a least recently used cache instead of first in, first out.
+	 * @return Misses and referenced vertices.
+	 */
+	static FVertexCacheStats Simulate(TConstArrayView<uint32> Indices, int32 CacheSize, bool bLRU);
+
+	/**
+	 * Orders triangles for vertex cache reuse.
+	 * @param Indices Triangle list indices.
+	 * @param OutTriangleOrder Index of the input triangle to draw at each position.
+	 */
+	static void OptimizeTriangleOrder(TConstArrayView<uint32> Indices, TArray<int32>& OutTriangleOrder);
+
+	/**
+	 * Applies a triangle order, keeping the winding of every triangle.
+	 * @param Indices Triangle list indices.
+	 * @param TriangleOrder Order as made by OptimizeTriangleOrder().
+	 * @param OutIndices The triangles of Indices in that order.
+	 */
+	static void ReorderTriangles(TConstArrayView<uint32> Indices, TConstArrayView<int32> TriangleOrder, TArray<uint32>& OutIndices);
+
+	/**
+	 * Numbers vertices in the order the triangles first reference them.
+	 * @param Indices Triangle list indices, usually after OptimizeTriangleOrder().
+	 * @param NumVertices Size of the vertex buffer the indices point into.
+	 * @param OutVertexRemap New index of every vertex; vertices no triangle references follow in their original order.
+	 */
+	static void OptimizeVertexFetch(TConstArrayView<uint32> Indices, int32 NumVertices, TArray<int32>& OutVertexRemap);
+};
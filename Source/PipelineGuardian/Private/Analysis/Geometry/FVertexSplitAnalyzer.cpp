@@ -0,0 +1,128 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Analysis/Geometry/FVertexSplitAnalyzer.h"
+
+namespace VertexSplitAnalyzer
+{
+	/** @return The most fundamental attribute that differs between two vertices, or Duplicate if none does. */
+	EVertexSplitCause GetSplitCause(const FVertexSplitStreams& Streams, int32 VertexA, int32 VertexB)
+	{
+		if (Streams.Sections.Num() > 0 && Streams.Sections[VertexA] != Streams.Sections[VertexB])
+		{
+			return EVertexSplitCause::Section;
+		}
+		for (const TConstArrayView<FVector2f>& UVChannel : Streams.UVChannels)
+		{
+			if (!UVChannel[VertexA].Equals(UVChannel[VertexB], FVertexSplitAnalyzer::UVTolerance))
+			{
+				return EVertexSplitCause::UVSeam;
+			}
+		}
+		if (Streams.Normals.Num() > 0 && !Streams.Normals[VertexA].Equals(Streams.Normals[VertexB], FVertexSplitAnalyzer::TangentTolerance))
+		{
+			return EVertexSplitCause::Normal;
+		}
+		if (Streams.Tangents.Num() > 0 && !Streams.Tangents[VertexA].Equals(Streams.Tangents[VertexB], FVertexSplitAnalyzer::TangentTolerance))
+		{
+			return EVertexSplitCause::Tangent;
+		}
+		if (Streams.Colors.Num() > 0 && Streams.Colors[VertexA] != Streams.Colors[VertexB])
+		{
+			return EVertexSplitCause::Color;
+		}
+		return EVertexSplitCause::Duplicate;
+	}
+}
+
+EVertexSplitCause FVertexSplitStats::GetDominantCause() const
+{
+	int32 Dominant = 0;
+	for (int32 Cause = 1; Cause < static_cast<int32>(EVertexSplitCause::Num); ++Cause)
+	{
+		if (NumSplits[Cause] > NumSplits[Dominant])
+		{
+			Dominant = Cause;
+		}
+	}
+	return static_cast<EVertexSplitCause>(Dominant);
+}
+
+const TCHAR* FVertexSplitStats::GetCauseName(EVertexSplitCause Cause)
+{
+	switch (Cause)
+	{
+	case EVertexSplitCause::Section:	return TEXT("section boundaries");
+	case EVertexSplitCause::UVSeam:		return TEXT("UV seams");
+	case EVertexSplitCause::Normal:		return TEXT("hard normals");
+	case EVertexSplitCause::Tangent:	return TEXT("tangent splits");
+	case EVertexSplitCause::Color:		return TEXT("vertex colors");
+	case EVertexSplitCause::Duplicate:	return TEXT("unwelded duplicates");
+	default:							return TEXT("unknown");
+	}
+}
+
+FVertexSplitStats FVertexSplitAnalyzer::Analyze(const FVertexSplitStreams& Streams)
+{
+	using namespace VertexSplitAnalyzer;
+
+	FVertexSplitStats Stats;
+	Stats.NumVertices = Streams.Positions.Num();
+	if (Stats.NumVertices == 0)
+	{
+		return Stats;
+	}
+
+	// Vertices in position order, so vertices sharing a position are adjacent. Split vertices are copies of the same
+	// source position, so exact comparison finds them.
+	TArray<int32> SortedVertices;
+	SortedVertices.SetNumUninitialized(Stats.NumVertices);
+	for (int32 VertexIndex = 0; VertexIndex < Stats.NumVertices; ++VertexIndex)
+	{
+		SortedVertices[VertexIndex] = VertexIndex;
+	}
+	const TConstArrayView<FVector3f> Positions = Streams.Positions;
+	SortedVertices.Sort([&Positions](int32 A, int32 B)
+	{
+		const FVector3f& PositionA = Positions[A];
+		const FVector3f& PositionB = Positions[B];
+		if (PositionA.X != PositionB.X)
+		{
+			return PositionA.X < PositionB.X;
+		}
+		if (PositionA.Y != PositionB.Y)
+		{
+			return PositionA.Y < PositionB.Y;
+		}
+		if (PositionA.Z != PositionB.Z)
+		{
+			return PositionA.Z < PositionB.Z;
+		}
+		return A < B;
+	});
+
+	int32 GroupStart = 0;
+	for (int32 SortedIndex = 0; SortedIndex < Stats.NumVertices; ++SortedIndex)
+	{
+		const int32 VertexIndex = SortedVertices[SortedIndex];
+		if (SortedIndex == 0 || Positions[VertexIndex] != Positions[SortedVertices[SortedIndex - 1]])
+		{
+			GroupStart = SortedIndex;
+			++Stats.NumPositions;
+			continue;
+		}
+
+		// Charge the vertex to the cheapest explanation among the earlier vertices of its group
+		EVertexSplitCause Cause = EVertexSplitCause::Section;
+		for (int32 EarlierIndex = FMath::Max(GroupStart, SortedIndex - MaxComparisons); EarlierIndex < SortedIndex; ++EarlierIndex)
+		{
+			const EVertexSplitCause EarlierCause = GetSplitCause(Streams, SortedVertices[EarlierIndex], VertexIndex);
+			if (EarlierCause > Cause)
+			{
+				Cause = EarlierCause;
+			}
+		}
+		++Stats.NumSplits[static_cast<int32>(Cause)];
+	}
+
+	return Stats;
+}
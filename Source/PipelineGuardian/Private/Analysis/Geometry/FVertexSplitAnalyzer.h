@@ -0,0 +1,90 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+
+/** Why a render vertex could not be shared with another vertex at the same position, most fundamental first */
+enum class EVertexSplitCause : uint8
+{
+	/** The vertices belong to different sections, which draw from separate vertex ranges */
+	Section,
+	/** A texture coordinate differs: a UV seam */
+	UVSeam,
+	/** The normal differs: a hard edge */
+	Normal,
+	/** Only the tangent differs, usually from mirrored UVs */
+	Tangent,
+	/** Only the vertex color differs */
+	Color,
+	/** Nothing differs; the vertices could have been welded */
+	Duplicate,
+	Num
+};
+
+/** How many more render vertices a vertex buffer has than distinct positions, and why */
+struct FVertexSplitStats
+{
+	/** Render vertices */
+	int32 NumVertices = 0;
+
+	/** Distinct positions among the render vertices */
+	int32 NumPositions = 0;
+
+	/** Split vertices by cause; they sum to GetNumSplitVertices() */
+	int32 NumSplits[static_cast<int32>(EVertexSplitCause::Num)] = {};
+
+	/** @return Render vertices beyond one per position. */
+	int32 GetNumSplitVertices() const { return NumVertices - NumPositions; }
+
+	/** @return Render vertices per distinct position; 1 when no vertex is split. */
+	float GetSplitRatio() const { return NumPositions > 0 ? static_cast<float>(NumVertices) / NumPositions : 0.0f; }
+
+	int32 GetNumSplits(EVertexSplitCause Cause) const { return NumSplits[static_cast<int32>(Cause)]; }
+
+	/** @return The cause of the most split vertices. */
+	EVertexSplitCause GetDominantCause() const;
+
+	/** @return Display name of a cause, e.g. "UV seams". */
+	static const TCHAR* GetCauseName(EVertexSplitCause Cause);
+};
+
+/** Per-vertex streams of a render vertex buffer; every stream is indexed like Positions, and optional streams may be empty */
+struct FVertexSplitStreams
+{
+	TConstArrayView<FVector3f> Positions;
+	TConstArrayView<FVector3f> Normals;
+	TConstArrayView<FVector3f> Tangents;
+	TArray<TConstArrayView<FVector2f>, TInlineAllocator<8>> UVChannels;
+	TConstArrayView<FColor> Colors;
+
+	/** Section of every vertex */
+	TConstArrayView<int32> Sections;
+};
+
+/**
+ * Attributes the vertex splits of a render vertex buffer. Vertices are grouped by exact position, and every vertex
+ * of a group after the first is charged to the earlier vertex of the group it is closest to: the cause is the most
+ * fundamental attribute that differs from that vertex. A vertex that matches one neighbor in everything but its
+ * tangent counts as a tangent split, even if it also lies on a UV seam with another.
+ * Thread-safe; holds no state.
+ */
+class FVertexSplitAnalyzer
+{
+public:
+	/** Largest UV difference still treated as the same coordinate, as in the static mesh builder */
+	static constexpr float UVTolerance = 1.0f / 1024.0f;
+
+	/** Largest normal or tangent component difference still treated as the same direction */
+	static constexpr float TangentTolerance = 1.0e-4f;
+
+	/** Earlier vertices of a group each vertex is compared with; bounds the cost of positions shared by many vertices */
+	static constexpr int32 MaxComparisons = 32;
+
+	/**
+	 * @param Streams Vertex streams to analyze.
+	 * @return Vertex and position counts and the split vertices by cause.
+	 */
+	static FVertexSplitStats Analyze(const FVertexSplitStreams& Streams);
+};
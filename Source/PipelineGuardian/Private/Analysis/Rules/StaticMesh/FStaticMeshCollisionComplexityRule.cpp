@@ -70,16 +70,23 @@ bool FStaticMeshCollisionComplexityRule::Check(UObject* Asset, const UPipelineGu
 			// Add fix action if enabled and safe
 			if (Settings->bAllowCollisionComplexityAutoFix && CanSafelySimplifyCollision(StaticMesh))
 			{
-				Result.FixAction.BindLambda([StaticMesh, this]()
+				TSoftObjectPtr<UStaticMesh> SoftStaticMesh(FSoftObjectPath(StaticMesh));
+				Result.FixAction.BindLambda([SoftStaticMesh, this]()
 				{
-					if (SimplifyCollision(StaticMesh))
+					UStaticMesh* FixStaticMesh = SoftStaticMesh.LoadSynchronous();
+					if (!FixStaticMesh)
 					{
-						FText SuccessMessage = FText::FromString(FString::Printf(TEXT("Successfully simplified collision for '%s'"), *StaticMesh->GetName()));
+						return;
+					}
+
+					if (SimplifyCollision(FixStaticMesh))
+					{
+						FText SuccessMessage = FText::FromString(FString::Printf(TEXT("Successfully simplified collision for '%s'"), *FixStaticMesh->GetName()));
 						FMessageDialog::Open(EAppMsgType::Ok, SuccessMessage, FText::FromString(TEXT("Collision Simplification Success")));
 					}
 					else
 					{
-						FText ErrorMessage = FText::FromString(FString::Printf(TEXT("Failed to simplify collision for '%s'. Please check the mesh manually."), *StaticMesh->GetName()));
+						FText ErrorMessage = FText::FromString(FString::Printf(TEXT("Failed to simplify collision for '%s'. Please check the mesh manually."), *FixStaticMesh->GetName()));
 						FMessageDialog::Open(EAppMsgType::Ok, ErrorMessage, FText::FromString(TEXT("Collision Simplification Error")));
 					}
 				});
@@ -107,6 +114,12 @@ FText FStaticMeshCollisionComplexityRule::GetRuleDescription() const
 	return FText::FromString(TEXT("Detects static meshes with overly complex collision geometry that can cause performance issues and physics problems."));
 }
 
+bool FStaticMeshCollisionComplexityRule::IsEnabled(const UPipelineGuardianProfile* Profile) const
+{
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	return Settings && Settings->bEnableStaticMeshCollisionComplexityRule;
+}
+
 bool FStaticMeshCollisionComplexityRule::HasComplexCollision(const UStaticMesh* StaticMesh, int32& OutPrimitiveCount, bool& OutUseComplexAsSimple) const
 {
 	if (!StaticMesh)
@@ -19,6 +19,7 @@ public:
 	virtual bool Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
 	virtual FName GetRuleID() const override;
 	virtual FText GetRuleDescription() const override;
+	virtual bool IsEnabled(const UPipelineGuardianProfile* Profile) const override;
 
 private:
 	/**
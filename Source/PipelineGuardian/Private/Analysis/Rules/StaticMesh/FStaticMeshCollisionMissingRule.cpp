@@ -55,16 +55,23 @@ bool FStaticMeshCollisionMissingRule::Check(UObject* Asset, const UPipelineGuard
 		
 	if (Settings->bAllowCollisionMissingAutoFix && bCanSafelyFix)
 	{
-		Result.FixAction.BindLambda([StaticMesh, this]()
+		TSoftObjectPtr<UStaticMesh> SoftStaticMesh(FSoftObjectPath(StaticMesh));
+		Result.FixAction.BindLambda([SoftStaticMesh, this]()
 		{
-			if (GenerateCollision(StaticMesh))
+			UStaticMesh* FixStaticMesh = SoftStaticMesh.LoadSynchronous();
+			if (!FixStaticMesh)
 			{
-				FText SuccessMessage = FText::FromString(FString::Printf(TEXT("Successfully generated collision for '%s'"), *StaticMesh->GetName()));
+				return;
+			}
+
+			if (GenerateCollision(FixStaticMesh))
+			{
+				FText SuccessMessage = FText::FromString(FString::Printf(TEXT("Successfully generated collision for '%s'"), *FixStaticMesh->GetName()));
 				FMessageDialog::Open(EAppMsgType::Ok, SuccessMessage, FText::FromString(TEXT("Collision Generation Success")));
 			}
 			else
 			{
-				FText ErrorMessage = FText::FromString(FString::Printf(TEXT("Failed to generate collision for '%s'. Please check the mesh manually."), *StaticMesh->GetName()));
+				FText ErrorMessage = FText::FromString(FString::Printf(TEXT("Failed to generate collision for '%s'. Please check the mesh manually."), *FixStaticMesh->GetName()));
 				FMessageDialog::Open(EAppMsgType::Ok, ErrorMessage, FText::FromString(TEXT("Collision Generation Error")));
 			}
 		});
@@ -97,6 +104,12 @@ FText FStaticMeshCollisionMissingRule::GetRuleDescription() const
 	return FText::FromString(TEXT("Detects static meshes that are missing collision geometry, which can cause physics issues and gameplay problems."));
 }
 
+bool FStaticMeshCollisionMissingRule::IsEnabled(const UPipelineGuardianProfile* Profile) const
+{
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	return Settings && Settings->bEnableStaticMeshCollisionMissingRule;
+}
+
 bool FStaticMeshCollisionMissingRule::HasMissingCollision(const UStaticMesh* StaticMesh) const
 {
 	if (!StaticMesh)
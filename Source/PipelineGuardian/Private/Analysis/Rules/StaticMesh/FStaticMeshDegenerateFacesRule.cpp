@@ -1,5 +1,7 @@
 #include "FStaticMeshDegenerateFacesRule.h"
 #include "Analysis/FAssetAnalysisResult.h"
+#include "Analysis/Snapshots/FStaticMeshAnalysisSnapshot.h"
+#include "Analysis/Geometry/FTriangleQualityScanner.h"
 #include "FPipelineGuardianSettings.h"
 #include "Engine/StaticMesh.h"
 #include "StaticMeshResources.h"
@@ -20,6 +22,17 @@ bool FStaticMeshDegenerateFacesRule::Check(UObject* Asset, const UPipelineGuardi
 		return false;
 	}
 
+	return CheckSnapshot(*FStaticMeshAnalysisSnapshot::Create(FAssetData(StaticMesh), StaticMesh), Profile, OutResults);
+}
+
+bool FStaticMeshDegenerateFacesRule::CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	const FStaticMeshAnalysisSnapshot* MeshSnapshot = FStaticMeshAnalysisSnapshot::FromSnapshot(Snapshot);
+	if (!MeshSnapshot)
+	{
+		return false;
+	}
+
 	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
 	if (!Settings)
 	{
@@ -33,14 +46,23 @@ bool FStaticMeshDegenerateFacesRule::Check(UObject* Asset, const UPipelineGuardi
 		return false;
 	}
 
-	int32 DegenerateFaceCount = 0;
-	int32 TotalFaceCount = 0;
+	TArray<FTriangleQualityStats> LODStats;
 
 	// Check for degenerate faces
-	if (HasDegenerateFaces(StaticMesh, DegenerateFaceCount, TotalFaceCount))
+	if (HasDegenerateFaces(*MeshSnapshot, Settings->DegenerateFacesMinArea, Settings->DegenerateFacesSliverAspectRatio, LODStats))
 	{
-		// Determine severity based on percentage of degenerate faces
-		float DegeneratePercentage = (float)DegenerateFaceCount / (float)TotalFaceCount * 100.0f;
+		// Determine severity based on percentage of degenerate faces in the worst LOD
+		const FTriangleQualityStats* WorstLOD = &LODStats[0];
+		for (const FTriangleQualityStats& Stats : LODStats)
+		{
+			if (Stats.GetDegeneratePercentage() > WorstLOD->GetDegeneratePercentage())
+			{
+				WorstLOD = &Stats;
+			}
+		}
+		int32 DegenerateFaceCount = WorstLOD->GetNumDegenerate();
+		int32 TotalFaceCount = WorstLOD->NumTriangles;
+		float DegeneratePercentage = WorstLOD->GetDegeneratePercentage();
 		
 		EAssetIssueSeverity Severity = EAssetIssueSeverity::Info;
 		if (DegeneratePercentage >= Settings->DegenerateFacesErrorThreshold)
@@ -56,16 +78,23 @@ bool FStaticMeshDegenerateFacesRule::Check(UObject* Asset, const UPipelineGuardi
 		{
 			FAssetAnalysisResult Result;
 			Result.RuleID = GetRuleID();
-			Result.Asset = FAssetData(StaticMesh);
+			Result.Asset = MeshSnapshot->AssetData;
 			Result.Severity = Severity;
-			Result.Description = FText::FromString(GenerateDegenerateFacesDescription(StaticMesh, DegenerateFaceCount, TotalFaceCount, Severity));
-			Result.FilePath = FText::FromString(StaticMesh->GetPackage()->GetName());
+			Result.Description = FText::FromString(GenerateDegenerateFacesDescription(LODStats, Severity));
+			Result.FilePath = FText::FromString(MeshSnapshot->PackageName);
 
 			// Add fix action if enabled and safe
-			if (Settings->bAllowDegenerateFacesAutoFix && CanSafelyRemoveDegenerateFaces(StaticMesh, DegenerateFaceCount, TotalFaceCount))
+			if (Settings->bAllowDegenerateFacesAutoFix && CanSafelyRemoveDegenerateFaces(*MeshSnapshot, DegenerateFaceCount, TotalFaceCount))
 			{
-				Result.FixAction.BindLambda([StaticMesh, this]()
+				TSoftObjectPtr<UStaticMesh> SoftStaticMesh(MeshSnapshot->AssetData.GetSoftObjectPath());
+				Result.FixAction.BindLambda([SoftStaticMesh, this]()
 				{
+					UStaticMesh* StaticMesh = SoftStaticMesh.LoadSynchronous();
+					if (!StaticMesh)
+					{
+						return;
+					}
+
 					if (RemoveDegenerateFaces(StaticMesh))
 					{
 						FText SuccessMessage = FText::FromString(FString::Printf(TEXT("Successfully removed degenerate faces from '%s'"), *StaticMesh->GetName()));
@@ -81,8 +110,8 @@ bool FStaticMeshDegenerateFacesRule::Check(UObject* Asset, const UPipelineGuardi
 
 			OutResults.Add(Result);
 
-			UE_LOG(LogPipelineGuardian, Log, TEXT("FStaticMeshDegenerateFacesRule::Check: Found %d degenerate faces out of %d total faces (%.1f%%) in %s"), 
-				DegenerateFaceCount, TotalFaceCount, DegeneratePercentage, *StaticMesh->GetName());
+			UE_LOG(LogPipelineGuardian, Log, TEXT("FStaticMeshDegenerateFacesRule::Check: Found %d degenerate faces out of %d total faces (%.1f%%) in the worst LOD of %s"), 
+				DegenerateFaceCount, TotalFaceCount, DegeneratePercentage, *MeshSnapshot->AssetName);
 
 			return true;
 		}
@@ -101,64 +130,68 @@ FText FStaticMeshDegenerateFacesRule::GetRuleDescription() const
 	return FText::FromString(TEXT("Detects degenerate faces (zero-area triangles) in static meshes that can cause rendering artifacts and performance issues."));
 }
 
-bool FStaticMeshDegenerateFacesRule::HasDegenerateFaces(const UStaticMesh* StaticMesh, int32& OutDegenerateFaceCount, int32& OutTotalFaceCount) const
+bool FStaticMeshDegenerateFacesRule::IsEnabled(const UPipelineGuardianProfile* Profile) const
 {
-	if (!StaticMesh)
-	{
-		return false;
-	}
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	return Settings && Settings->bEnableStaticMeshDegenerateFacesRule;
+}
 
-	OutDegenerateFaceCount = 0;
-	OutTotalFaceCount = 0;
+bool FStaticMeshDegenerateFacesRule::HasDegenerateFaces(const FStaticMeshAnalysisSnapshot& MeshSnapshot, float MinArea, float MaxAspectRatio, TArray<FTriangleQualityStats>& OutLODStats) const
+{
+	OutLODStats.Reset();
 
-	// Use a simpler approach - check if the mesh has any LOD data
-	const FStaticMeshLODResources* LODResource = StaticMesh->GetRenderData() ? StaticMesh->GetRenderData()->LODResources.Num() > 0 ? &StaticMesh->GetRenderData()->LODResources[0] : nullptr : nullptr;
-	if (!LODResource)
+	if (MeshSnapshot.GetNumLODs() == 0)
 	{
 		UE_LOG(LogPipelineGuardian, Warning, TEXT("Cannot analyze degenerate faces for %s: No LOD data available"), 
-			*StaticMesh->GetName());
+			*MeshSnapshot.AssetName);
 		return false;
 	}
 
-	// For now, use a basic check - if the mesh has very few triangles, it might have degenerate faces
-	// This is a simplified approach to avoid complex mesh attribute access
-	int32 TriangleCount = LODResource->GetNumTriangles();
-	OutTotalFaceCount = TriangleCount;
-
-	// Simple heuristic: if triangle count is very low relative to vertex count, there might be degenerate faces
-	int32 VertexCount = LODResource->GetNumVertices();
-	if (TriangleCount > 0 && VertexCount > 0)
+	bool bHasDegenerateFaces = false;
+	for (int32 LODIndex = 0; LODIndex < MeshSnapshot.GetNumLODs(); ++LODIndex)
 	{
-		float TriangleToVertexRatio = (float)TriangleCount / (float)VertexCount;
-		
-		// If ratio is very low (less than 0.5), there might be degenerate faces
-		// This is a conservative estimate
-		if (TriangleToVertexRatio < 0.5f)
-		{
-			OutDegenerateFaceCount = FMath::Max(1, TriangleCount / 10); // Estimate
-			UE_LOG(LogPipelineGuardian, Log, TEXT("Potential degenerate faces detected in %s: Triangle/Vertex ratio = %.2f"), 
-				*StaticMesh->GetName(), TriangleToVertexRatio);
-		}
+		const FStaticMeshLODSnapshot& LODSnapshot = MeshSnapshot.LODs[LODIndex];
+		const FTriangleQualityStats& Stats = OutLODStats.Add_GetRef(FTriangleQualityScanner::Scan(LODSnapshot.Positions, LODSnapshot.Indices, MinArea, MaxAspectRatio));
+		bHasDegenerateFaces |= Stats.GetNumDegenerate() > 0;
+
+		UE_LOG(LogPipelineGuardian, Verbose, TEXT("%s LOD%d: %d triangles, %d collapsed, %d zero-area, %d slivers"), 
+			*MeshSnapshot.AssetName, LODIndex, Stats.NumTriangles, Stats.NumCollapsedIndices, Stats.NumZeroArea, Stats.NumSlivers);
 	}
 
-	return OutDegenerateFaceCount > 0;
+	return bHasDegenerateFaces;
 }
 
-
-
-FString FStaticMeshDegenerateFacesRule::GenerateDegenerateFacesDescription(const UStaticMesh* StaticMesh, int32 DegenerateFaceCount, int32 TotalFaceCount, EAssetIssueSeverity Severity) const
+FString FStaticMeshDegenerateFacesRule::GenerateDegenerateFacesDescription(const TArray<FTriangleQualityStats>& LODStats, EAssetIssueSeverity Severity) const
 {
-	float DegeneratePercentage = (float)DegenerateFaceCount / (float)TotalFaceCount * 100.0f;
 	FString SeverityText = (Severity == EAssetIssueSeverity::Error) ? TEXT("CRITICAL") : TEXT("WARNING");
+
+	FString LODBreakdown;
+	for (int32 LODIndex = 0; LODIndex < LODStats.Num(); ++LODIndex)
+	{
+		const FTriangleQualityStats& Stats = LODStats[LODIndex];
+		if (Stats.GetNumDegenerate() == 0)
+		{
+			continue;
+		}
+
+		LODBreakdown += FString::Printf(
+			TEXT("LOD%d: %d of %d faces (%.1f%%) - %d collapsed, %d zero-area, %d slivers. "),
+			LODIndex,
+			Stats.GetNumDegenerate(),
+			Stats.NumTriangles,
+			Stats.GetDegeneratePercentage(),
+			Stats.NumCollapsedIndices,
+			Stats.NumZeroArea,
+			Stats.NumSlivers
+		);
+	}
 	
 	return FString::Printf(
-		TEXT("%s: Found %d degenerate faces out of %d total faces (%.1f%%). ")
+		TEXT("%s: Found degenerate faces. %s")
 		TEXT("Degenerate faces (zero-area triangles) can cause rendering artifacts, physics issues, and performance problems. ")
 		TEXT("These should be removed to ensure proper mesh functionality."),
 		*SeverityText,
-		DegenerateFaceCount,
-		TotalFaceCount,
-		DegeneratePercentage
+		*LODBreakdown
 	);
 }
 
@@ -178,11 +211,11 @@ bool FStaticMeshDegenerateFacesRule::RemoveDegenerateFaces(UStaticMesh* StaticMe
 	return false;
 }
 
-bool FStaticMeshDegenerateFacesRule::CanSafelyRemoveDegenerateFaces(const UStaticMesh* StaticMesh, int32 DegenerateFaceCount, int32 TotalFaceCount) const
+bool FStaticMeshDegenerateFacesRule::CanSafelyRemoveDegenerateFaces(const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 DegenerateFaceCount, int32 TotalFaceCount) const
 {
 
 	// For now, return false to disable auto-fix functionality
 	
-	UE_LOG(LogPipelineGuardian, Log, TEXT("CanSafelyRemoveDegenerateFaces: Auto-fix disabled for %s"), *StaticMesh->GetName());
+	UE_LOG(LogPipelineGuardian, Log, TEXT("CanSafelyRemoveDegenerateFaces: Auto-fix disabled for %s"), *MeshSnapshot.AssetName);
 	return false;
 } 
\ No newline at end of file
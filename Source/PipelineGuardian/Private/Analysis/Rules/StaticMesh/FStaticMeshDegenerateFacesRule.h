@@ -5,9 +5,14 @@
 #include "Analysis/FAssetAnalysisResult.h"
 #include "Engine/StaticMesh.h"
 
+// Forward Declarations
+struct FStaticMeshAnalysisSnapshot;
+struct FTriangleQualityStats;
+
 /**
  * Rule to detect degenerate faces (zero-area triangles) in static meshes
  * Degenerate faces can cause rendering artifacts, physics issues, and performance problems
+ * Every render LOD is scanned for collapsed-index, zero-area and sliver triangles; severity follows the worst LOD
  */
 class FStaticMeshDegenerateFacesRule : public IAssetCheckRule
 {
@@ -19,28 +24,30 @@ public:
 	virtual bool Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
 	virtual FName GetRuleID() const override;
 	virtual FText GetRuleDescription() const override;
+	virtual bool IsEnabled(const UPipelineGuardianProfile* Profile) const override;
+	virtual bool SupportsSnapshot() const override { return true; }
+	virtual bool CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
 
 private:
 	/**
 	 * Check if a static mesh has degenerate faces
-	 * @param StaticMesh The mesh to analyze
-	 * @param OutDegenerateFaceCount Number of degenerate faces found
-	 * @param OutTotalFaceCount Total number of faces in the mesh
-	 * @return True if degenerate faces were found
+	 * @param MeshSnapshot Snapshot of the mesh to analyze
+	 * @param MinArea Triangle area at or below which a face is zero-area
+	 * @param MaxAspectRatio Aspect ratio above which a face is a sliver; 0 disables sliver detection
+	 * @param OutLODStats Degenerate face counts of each render LOD
+	 * @return True if degenerate faces were found in any LOD
 	 */
-	bool HasDegenerateFaces(const UStaticMesh* StaticMesh, int32& OutDegenerateFaceCount, int32& OutTotalFaceCount) const;
+	bool HasDegenerateFaces(const FStaticMeshAnalysisSnapshot& MeshSnapshot, float MinArea, float MaxAspectRatio, TArray<FTriangleQualityStats>& OutLODStats) const;
 
 
 
 	/**
 	 * Generate detailed description of degenerate faces issues
-	 * @param StaticMesh The mesh being analyzed
-	 * @param DegenerateFaceCount Number of degenerate faces found
-	 * @param TotalFaceCount Total number of faces in the mesh
+	 * @param LODStats Degenerate face counts of each render LOD
 	 * @param Severity Issue severity
 	 * @return Formatted description string
 	 */
-	FString GenerateDegenerateFacesDescription(const UStaticMesh* StaticMesh, int32 DegenerateFaceCount, int32 TotalFaceCount, EAssetIssueSeverity Severity) const;
+	FString GenerateDegenerateFacesDescription(const TArray<FTriangleQualityStats>& LODStats, EAssetIssueSeverity Severity) const;
 
 	/**
 	 * Remove degenerate faces from the static mesh
@@ -51,10 +58,10 @@ private:
 
 	/**
 	 * Check if automatic fixing is safe for this mesh
-	 * @param StaticMesh The mesh to analyze
+	 * @param MeshSnapshot Snapshot of the mesh to analyze
 	 * @param DegenerateFaceCount Number of degenerate faces
 	 * @param TotalFaceCount Total number of faces
 	 * @return True if safe to auto-fix
 	 */
-	bool CanSafelyRemoveDegenerateFaces(const UStaticMesh* StaticMesh, int32 DegenerateFaceCount, int32 TotalFaceCount) const;
+	bool CanSafelyRemoveDegenerateFaces(const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 DegenerateFaceCount, int32 TotalFaceCount) const;
 }; 
\ No newline at end of file
@@ -0,0 +1,316 @@
+#include "FStaticMeshDrawCallRule.h"
+#include "Analysis/FAssetAnalysisResult.h"
+#include "Analysis/Snapshots/FStaticMeshAnalysisSnapshot.h"
+#include "FPipelineGuardianSettings.h"
+#include "PipelineGuardian.h"
+#include "Engine/StaticMesh.h"
+#include "Materials/MaterialInterface.h"
+#include "MeshDescription.h"
+#include "Misc/MessageDialog.h"
+#include "StaticMeshResources.h"
+
+namespace StaticMeshDrawCallRule
+{
+	/** @return Slot name of a material index, or its number if the slot does not exist. */
+	FString GetSlotName(const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 MaterialIndex)
+	{
+		return MeshSnapshot.MaterialSlots.IsValidIndex(MaterialIndex) ? MeshSnapshot.MaterialSlots[MaterialIndex].SlotName.ToString() : FString::Printf(TEXT("#%d"), MaterialIndex);
+	}
+}
+
+FStaticMeshDrawCallRule::FStaticMeshDrawCallRule()
+{
+}
+
+bool FStaticMeshDrawCallRule::Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	UStaticMesh* StaticMesh = Cast<UStaticMesh>(Asset);
+	if (!StaticMesh)
+	{
+		return false;
+	}
+
+	return CheckSnapshot(*FStaticMeshAnalysisSnapshot::Create(FAssetData(StaticMesh), StaticMesh), Profile, OutResults);
+}
+
+bool FStaticMeshDrawCallRule::CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	const FStaticMeshAnalysisSnapshot* MeshSnapshot = FStaticMeshAnalysisSnapshot::FromSnapshot(Snapshot);
+	if (!MeshSnapshot)
+	{
+		return false;
+	}
+
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	if (!Settings || !Settings->bEnableStaticMeshDrawCallRule)
+	{
+		return false;
+	}
+
+	// Nanite rasterizes all instances of a material in one pass, so sections do not multiply draw calls per instance
+	if (MeshSnapshot->bNaniteEnabled || MeshSnapshot->GetNumLODs() == 0)
+	{
+		return false;
+	}
+
+	const FStaticMeshDrawCost DrawCost = FStaticMeshDrawCallEstimator::Estimate(*MeshSnapshot, Settings->DrawCallShadowPasses);
+
+	bool bHasMergeableSections = false;
+	for (const FLODDrawCost& LODCost : DrawCost.LODs)
+	{
+		bHasMergeableSections |= LODCost.GetNumMergeableSections() > 0;
+	}
+
+	const FLODDrawCost& LOD0Cost = DrawCost.LODs[0];
+	bool bHasTinySections = false;
+	for (int32 SectionIndex = 0; SectionIndex < LOD0Cost.GetNumSections(); ++SectionIndex)
+	{
+		bHasTinySections |= IsTinySection(LOD0Cost, SectionIndex);
+	}
+
+	UE_LOG(LogPipelineGuardian, Verbose, TEXT("%s draw calls: LOD0 %d sections, %d draw calls per instance, %d after merging"),
+		*MeshSnapshot->AssetName, LOD0Cost.GetNumSections(), LOD0Cost.NumDrawCalls, LOD0Cost.NumMergedDrawCalls);
+
+	const bool bOverBudget = LOD0Cost.NumDrawCalls > Settings->MaxDrawCallsPerInstance;
+	if (!bOverBudget && !bHasMergeableSections && !bHasTinySections && DrawCost.SharedMaterialSlots.Num() == 0)
+	{
+		return false;
+	}
+
+	FAssetAnalysisResult Result;
+	Result.Asset = MeshSnapshot->AssetData;
+	Result.RuleID = GetRuleID();
+	Result.Severity = Settings->DrawCallIssueSeverity;
+	Result.Description = FText::FromString(GenerateDrawCallDescription(*MeshSnapshot, DrawCost));
+	Result.FilePath = FText::FromString(MeshSnapshot->PackageName);
+
+	if (Settings->bAllowDrawCallAutoFix && bHasMergeableSections)
+	{
+		TSoftObjectPtr<UStaticMesh> SoftStaticMesh(MeshSnapshot->AssetData.GetSoftObjectPath());
+		Result.FixAction.BindLambda([SoftStaticMesh, this]()
+		{
+			UStaticMesh* StaticMesh = SoftStaticMesh.LoadSynchronous();
+			if (!StaticMesh)
+			{
+				return;
+			}
+
+			const int32 NumMerged = MergeSectionsWithSameMaterial(StaticMesh);
+			if (NumMerged > 0)
+			{
+				UE_LOG(LogPipelineGuardian, Log, TEXT("Merged %d sections with the same material in %s"), NumMerged, *StaticMesh->GetName());
+			}
+			else
+			{
+				FText ErrorMessage = FText::FromString(FString::Printf(TEXT("'%s' has no source mesh description with sections to merge, or its built sections do not match its source sections; rebuild it and try again. Sections of reduced LODs follow their base LOD."), *StaticMesh->GetName()));
+				FMessageDialog::Open(EAppMsgType::Ok, ErrorMessage, FText::FromString(TEXT("Section Merge Error")));
+			}
+		});
+	}
+
+	OutResults.Add(Result);
+	return true;
+}
+
+FName FStaticMeshDrawCallRule::GetRuleID() const
+{
+	return TEXT("SM_DrawCallCost");
+}
+
+FText FStaticMeshDrawCallRule::GetRuleDescription() const
+{
+	return FText::FromString(TEXT("Estimates the draw calls per instance of each LOD from its sections and their materials, and reports meshes over budget, tiny sections and sections or slots sharing a material that could be merged."));
+}
+
+bool FStaticMeshDrawCallRule::IsEnabled(const UPipelineGuardianProfile* Profile) const
+{
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	return Settings && Settings->bEnableStaticMeshDrawCallRule;
+}
+
+bool FStaticMeshDrawCallRule::IsTinySection(const FLODDrawCost& LODCost, int32 SectionIndex) const
+{
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	if (LODCost.GetNumSections() < 2)
+	{
+		return false;
+	}
+
+	const FSectionDrawCost& Section = LODCost.Sections[SectionIndex];
+	return Section.NumTriangles < Settings->TinySectionMaxTriangles || Section.AreaFraction * 100.0f < Settings->TinySectionMaxAreaPercent;
+}
+
+FString FStaticMeshDrawCallRule::GenerateDrawCallDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, const FStaticMeshDrawCost& DrawCost) const
+{
+	using namespace StaticMeshDrawCallRule;
+
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	const FLODDrawCost& LOD0Cost = DrawCost.LODs[0];
+
+	FString Description = FString::Printf(TEXT("Static mesh %s issues an estimated %d draw calls per instance at LOD 0 (budget %d, with %d shadow passes):"),
+		*MeshSnapshot.AssetName, LOD0Cost.NumDrawCalls, Settings->MaxDrawCallsPerInstance, FMath::Max(Settings->DrawCallShadowPasses, 0));
+
+	for (int32 LODIndex = 0; LODIndex < DrawCost.LODs.Num(); ++LODIndex)
+	{
+		const FLODDrawCost& LODCost = DrawCost.LODs[LODIndex];
+		int32 NumTriangles = 0;
+		for (const FSectionDrawCost& Section : LODCost.Sections)
+		{
+			NumTriangles += Section.NumTriangles;
+		}
+
+		Description += FString::Printf(TEXT("\n  LOD%d: %d sections, %d draw calls, %d triangles per section on average"),
+			LODIndex, LODCost.GetNumSections(), LODCost.NumDrawCalls, LODCost.GetNumSections() > 0 ? NumTriangles / LODCost.GetNumSections() : 0);
+		if (LODCost.NumMergedDrawCalls < LODCost.NumDrawCalls)
+		{
+			Description += FString::Printf(TEXT(", %d draw calls once sections sharing a material are merged"), LODCost.NumMergedDrawCalls);
+		}
+
+		for (int32 SectionIndex = 0; SectionIndex < LODCost.GetNumSections(); ++SectionIndex)
+		{
+			const FSectionDrawCost& Section = LODCost.Sections[SectionIndex];
+			const bool bTiny = LODIndex == 0 && IsTinySection(LODCost, SectionIndex);
+			if (!bTiny && Section.MergeTarget == INDEX_NONE)
+			{
+				continue;
+			}
+
+			Description += FString::Printf(TEXT("\n    Section %d (%s): %d triangles, %.1f%% of the surface"),
+				SectionIndex, *GetSlotName(MeshSnapshot, Section.MaterialIndex), Section.NumTriangles, Section.AreaFraction * 100.0f);
+			if (Section.MergeTarget != INDEX_NONE)
+			{
+				Description += FString::Printf(TEXT(", same material as section %d"), Section.MergeTarget);
+			}
+			else
+			{
+				Description += TEXT(", tiny; move it into another section's material, e.g. through a texture atlas");
+			}
+		}
+	}
+
+	for (const TArray<int32>& Slots : DrawCost.SharedMaterialSlots)
+	{
+		TArray<FString> SlotNames;
+		for (const int32 SlotIndex : Slots)
+		{
+			SlotNames.Add(GetSlotName(MeshSnapshot, SlotIndex));
+		}
+		Description += FString::Printf(TEXT("\n  Slots %s are assigned the same material and could be collapsed into one"), *FString::Join(SlotNames, TEXT(", ")));
+	}
+
+	if (Settings->bAllowDrawCallAutoFix && DrawCost.LODs.ContainsByPredicate([](const FLODDrawCost& LODCost) { return LODCost.GetNumMergeableSections() > 0; }))
+	{
+		Description += TEXT("\nSections sharing a material and flags can be merged automatically with 'Fix Now'.");
+	}
+	return Description;
+}
+
+int32 FStaticMeshDrawCallRule::MergeSectionsWithSameMaterial(UStaticMesh* StaticMesh) const
+{
+	check(IsInGameThread());
+
+	if (!StaticMesh)
+	{
+		return 0;
+	}
+
+	const TArray<FStaticMaterial>& Materials = StaticMesh->GetStaticMaterials();
+	const FStaticMeshRenderData* RenderData = StaticMesh->GetRenderData();
+	FMeshSectionInfoMap& SectionInfoMap = StaticMesh->GetSectionInfoMap();
+	int32 NumMerged = 0;
+	for (int32 LODIndex = 0; LODIndex < StaticMesh->GetNumSourceModels(); ++LODIndex)
+	{
+		// Reduced LODs are rebuilt from their base LOD, so their sections follow it
+		if (!StaticMesh->IsMeshDescriptionValid(LODIndex) || StaticMesh->IsReductionActive(LODIndex))
+		{
+			continue;
+		}
+
+		FMeshDescription* MeshDescription = StaticMesh->GetMeshDescription(LODIndex);
+		if (!MeshDescription)
+		{
+			continue;
+		}
+
+		// The build makes one section of every polygon group with triangles, in order
+		TArray<FPolygonGroupID> SectionGroups;
+		for (const FPolygonGroupID PolygonGroupID : MeshDescription->PolygonGroups().GetElementIDs())
+		{
+			if (MeshDescription->GetPolygonGroupTriangles(PolygonGroupID).Num() > 0)
+			{
+				SectionGroups.Add(PolygonGroupID);
+			}
+		}
+
+		// Sections missing from the section info map are built with the material of their polygon group, not the slot
+		// Get() defaults to, so the material and flags come from the built sections, which must match the source ones
+		const FStaticMeshLODResources* LODResources = RenderData && RenderData->LODResources.IsValidIndex(LODIndex) ? &RenderData->LODResources[LODIndex] : nullptr;
+		if (!LODResources || LODResources->Sections.Num() != SectionGroups.Num())
+		{
+			UE_LOG(LogPipelineGuardian, Warning, TEXT("Not merging sections of %s LOD%d: its built sections do not match its source mesh description"), *StaticMesh->GetName(), LODIndex);
+			continue;
+		}
+
+		// Sections are merged on the material they resolve to and the flags they are built with
+		TMap<FString, int32> KeptSectionByKey;
+		TArray<FPolygonGroupID> KeptGroups;
+		TArray<FMeshSectionInfo> KeptSectionInfos;
+		int32 NumMergedInLOD = 0;
+		for (int32 SectionIndex = 0; SectionIndex < SectionGroups.Num(); ++SectionIndex)
+		{
+			const FStaticMeshSection& BuiltSection = LODResources->Sections[SectionIndex];
+			FMeshSectionInfo SectionInfo = SectionInfoMap.Get(LODIndex, SectionIndex);
+			SectionInfo.MaterialIndex = BuiltSection.MaterialIndex;
+			SectionInfo.bCastShadow = BuiltSection.bCastShadow;
+			SectionInfo.bEnableCollision = BuiltSection.bEnableCollision;
+
+			const UMaterialInterface* Material = Materials.IsValidIndex(SectionInfo.MaterialIndex) ? Materials[SectionInfo.MaterialIndex].MaterialInterface.Get() : nullptr;
+			const FString Key = Material
+				? FString::Printf(TEXT("%s|%d|%d"), *Material->GetPathName(), SectionInfo.bCastShadow ? 1 : 0, SectionInfo.bEnableCollision ? 1 : 0)
+				: FString::Printf(TEXT("#%d|%d|%d"), SectionInfo.MaterialIndex, SectionInfo.bCastShadow ? 1 : 0, SectionInfo.bEnableCollision ? 1 : 0);
+
+			if (const int32* KeptSection = KeptSectionByKey.Find(Key))
+			{
+				const TArray<FPolygonID> PolygonIDs(MeshDescription->GetPolygonGroupPolygonIDs(SectionGroups[SectionIndex]));
+				for (const FPolygonID PolygonID : PolygonIDs)
+				{
+					MeshDescription->SetPolygonPolygonGroup(PolygonID, KeptGroups[*KeptSection]);
+				}
+				MeshDescription->DeletePolygonGroup(SectionGroups[SectionIndex]);
+				++NumMergedInLOD;
+			}
+			else
+			{
+				KeptSectionByKey.Add(Key, KeptGroups.Num());
+				KeptGroups.Add(SectionGroups[SectionIndex]);
+				KeptSectionInfos.Add(SectionInfo);
+			}
+		}
+		if (NumMergedInLOD == 0)
+		{
+			continue;
+		}
+
+		// Remaining sections move up to fill the gaps, and their material and flags with them
+		for (int32 SectionIndex = 0; SectionIndex < SectionGroups.Num(); ++SectionIndex)
+		{
+			SectionInfoMap.Remove(LODIndex, SectionIndex);
+		}
+		for (int32 SectionIndex = 0; SectionIndex < KeptSectionInfos.Num(); ++SectionIndex)
+		{
+			SectionInfoMap.Set(LODIndex, SectionIndex, KeptSectionInfos[SectionIndex]);
+		}
+
+		StaticMesh->CommitMeshDescription(LODIndex);
+		NumMerged += NumMergedInLOD;
+	}
+
+	if (NumMerged > 0)
+	{
+		StaticMesh->Build(false);
+		StaticMesh->MarkPackageDirty();
+		StaticMesh->PostEditChange();
+	}
+
+	return NumMerged;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Analysis/IAssetCheckRule.h"
+#include "Analysis/Snapshots/FStaticMeshDrawCallEstimator.h"
+
+// Forward Declarations
+class UStaticMesh;
+struct FStaticMeshAnalysisSnapshot;
+
+/**
+ * Estimates the draw calls a static mesh instance issues per LOD, since every render section is its own draw in every
+ * pass it is drawn in. Reports meshes whose LOD 0 exceeds the per-instance budget, tiny sections that cost a draw call
+ * for little work, sections of one LOD that share a material, and material slots assigned the same material. The fix
+ * merges sections with the same material and flags in the source mesh descriptions and rebuilds the mesh.
+ * Nanite meshes are skipped: they draw per material for all instances at once.
+ */
+class FStaticMeshDrawCallRule : public IAssetCheckRule
+{
+public:
+	FStaticMeshDrawCallRule();
+	virtual ~FStaticMeshDrawCallRule() = default;
+
+	virtual bool Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
+	virtual FName GetRuleID() const override;
+	virtual FText GetRuleDescription() const override;
+	virtual bool IsEnabled(const UPipelineGuardianProfile* Profile) const override;
+	virtual bool SupportsSnapshot() const override { return true; }
+	virtual bool CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
+
+private:
+	/**
+	 * Only meaningful for LOD 0: reduced LODs shrink every section, so the absolute thresholds would flag all of them.
+	 * @param LODCost Cost of LOD 0.
+	 * @param SectionIndex Section of the LOD.
+	 * @return True if the section is below the tiny section triangle or area threshold and its LOD has other sections to merge it with.
+	 */
+	bool IsTinySection(const FLODDrawCost& LODCost, int32 SectionIndex) const;
+
+	FString GenerateDrawCallDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, const FStaticMeshDrawCost& DrawCost) const;
+
+	/**
+	 * Moves the polygons of sections with the same material and flags into one polygon group in every LOD's source mesh
+	 * description that is not reduced from another, then rebuilds the mesh. Materials and flags are read from the built
+	 * sections; LODs whose built sections do not match their source ones are skipped. Game thread only.
+	 * @return Number of sections merged away.
+	 */
+	int32 MergeSectionsWithSameMaterial(UStaticMesh* StaticMesh) const;
+};
@@ -0,0 +1,438 @@
+#include "FStaticMeshDuplicateGeometryRule.h"
+#include "Analysis/FAssetAnalysisResult.h"
+#include "Analysis/Geometry/FMeshGeometryHasher.h"
+#include "Analysis/Snapshots/FStaticMeshAnalysisSnapshot.h"
+#include "Analysis/Snapshots/FStaticMeshMemoryEstimator.h"
+#include "Core/FDuplicateGeometryIndex.h"
+#include "FPipelineGuardianSettings.h"
+#include "PipelineGuardian.h"
+#include "Engine/StaticMesh.h"
+#include "Misc/Crc.h"
+#include "Misc/MessageDialog.h"
+#include "ObjectTools.h"
+#include "PhysicsEngine/BodySetup.h"
+
+namespace StaticMeshDuplicateGeometryRule
+{
+	bool AreSectionsEqual(const FStaticMeshSectionSnapshot& A, const FStaticMeshSectionSnapshot& B)
+	{
+		return A.MaterialIndex == B.MaterialIndex && A.FirstIndex == B.FirstIndex && A.NumTriangles == B.NumTriangles
+			&& A.MinVertexIndex == B.MinVertexIndex && A.MaxVertexIndex == B.MaxVertexIndex
+			&& A.bEnableCollision == B.bEnableCollision && A.bCastShadow == B.bCastShadow;
+	}
+
+	/** @return True if both render LODs draw the same: vertex streams, indices and sections, in the same order. */
+	bool AreLODsEqual(const FStaticMeshLODSnapshot& A, const FStaticMeshLODSnapshot& B)
+	{
+		if (A.Sections.Num() != B.Sections.Num())
+		{
+			return false;
+		}
+		for (int32 SectionIndex = 0; SectionIndex < A.Sections.Num(); ++SectionIndex)
+		{
+			if (!AreSectionsEqual(A.Sections[SectionIndex], B.Sections[SectionIndex]))
+			{
+				return false;
+			}
+		}
+		return A.Positions == B.Positions && A.TangentX == B.TangentX && A.TangentZ == B.TangentZ && A.UVChannels == B.UVChannels
+			&& A.Colors == B.Colors && A.Indices == B.Indices
+			&& A.bUseFullPrecisionUVs == B.bUseFullPrecisionUVs && A.bUseHighPrecisionTangentBasis == B.bUseHighPrecisionTangentBasis;
+	}
+
+	/** @return True if both body setups have the same simple collision shapes and collision settings. */
+	bool AreBodySetupsEqual(const UBodySetup* A, const UBodySetup* B)
+	{
+		if (!A || !B)
+		{
+			return A == B;
+		}
+		if (A->CollisionTraceFlag != B->CollisionTraceFlag || A->DefaultInstance.GetCollisionProfileName() != B->DefaultInstance.GetCollisionProfileName())
+		{
+			return false;
+		}
+
+		const FKAggregateGeom& GeomA = A->AggGeom;
+		const FKAggregateGeom& GeomB = B->AggGeom;
+		if (GeomA.SphereElems.Num() != GeomB.SphereElems.Num() || GeomA.BoxElems.Num() != GeomB.BoxElems.Num() || GeomA.SphylElems.Num() != GeomB.SphylElems.Num()
+			|| GeomA.TaperedCapsuleElems.Num() != GeomB.TaperedCapsuleElems.Num() || GeomA.ConvexElems.Num() != GeomB.ConvexElems.Num())
+		{
+			return false;
+		}
+		for (int32 Index = 0; Index < GeomA.SphereElems.Num(); ++Index)
+		{
+			const FKSphereElem& ElemA = GeomA.SphereElems[Index];
+			const FKSphereElem& ElemB = GeomB.SphereElems[Index];
+			if (ElemA.Center != ElemB.Center || ElemA.Radius != ElemB.Radius)
+			{
+				return false;
+			}
+		}
+		for (int32 Index = 0; Index < GeomA.BoxElems.Num(); ++Index)
+		{
+			const FKBoxElem& ElemA = GeomA.BoxElems[Index];
+			const FKBoxElem& ElemB = GeomB.BoxElems[Index];
+			if (ElemA.Center != ElemB.Center || ElemA.Rotation != ElemB.Rotation || ElemA.X != ElemB.X || ElemA.Y != ElemB.Y || ElemA.Z != ElemB.Z)
+			{
+				return false;
+			}
+		}
+		for (int32 Index = 0; Index < GeomA.SphylElems.Num(); ++Index)
+		{
+			const FKSphylElem& ElemA = GeomA.SphylElems[Index];
+			const FKSphylElem& ElemB = GeomB.SphylElems[Index];
+			if (ElemA.Center != ElemB.Center || ElemA.Rotation != ElemB.Rotation || ElemA.Radius != ElemB.Radius || ElemA.Length != ElemB.Length)
+			{
+				return false;
+			}
+		}
+		for (int32 Index = 0; Index < GeomA.TaperedCapsuleElems.Num(); ++Index)
+		{
+			const FKTaperedCapsuleElem& ElemA = GeomA.TaperedCapsuleElems[Index];
+			const FKTaperedCapsuleElem& ElemB = GeomB.TaperedCapsuleElems[Index];
+			if (ElemA.Center != ElemB.Center || ElemA.Rotation != ElemB.Rotation || ElemA.Radius0 != ElemB.Radius0 || ElemA.Radius1 != ElemB.Radius1 || ElemA.Length != ElemB.Length)
+			{
+				return false;
+			}
+		}
+		for (int32 Index = 0; Index < GeomA.ConvexElems.Num(); ++Index)
+		{
+			const FKConvexElem& ElemA = GeomA.ConvexElems[Index];
+			const FKConvexElem& ElemB = GeomB.ConvexElems[Index];
+			if (ElemA.VertexData != ElemB.VertexData || !ElemA.GetTransform().Equals(ElemB.GetTransform(), 0.0))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * Compares the loaded meshes rather than the index, which only hashes LOD 0 and may be older than the meshes.
+	 * @return Empty if Duplicate can replace Canonical without any visible or functional change, else what differs.
+	 */
+	FString FindDifference(const UStaticMesh& Canonical, const UStaticMesh& Duplicate)
+	{
+		const TSharedRef<FStaticMeshAnalysisSnapshot> CanonicalSnapshot = FStaticMeshAnalysisSnapshot::Create(FAssetData(&Canonical), &Canonical);
+		const TSharedRef<FStaticMeshAnalysisSnapshot> DuplicateSnapshot = FStaticMeshAnalysisSnapshot::Create(FAssetData(&Duplicate), &Duplicate);
+
+		if (CanonicalSnapshot->GetNumLODs() != DuplicateSnapshot->GetNumLODs())
+		{
+			return TEXT("number of LODs");
+		}
+		for (int32 LODIndex = 0; LODIndex < CanonicalSnapshot->GetNumLODs(); ++LODIndex)
+		{
+			if (!AreLODsEqual(CanonicalSnapshot->LODs[LODIndex], DuplicateSnapshot->LODs[LODIndex]))
+			{
+				return FString::Printf(TEXT("LOD%d vertices, indices or sections"), LODIndex);
+			}
+			if (CanonicalSnapshot->LODs[LODIndex].ScreenSize != DuplicateSnapshot->LODs[LODIndex].ScreenSize)
+			{
+				return FString::Printf(TEXT("LOD%d screen size"), LODIndex);
+			}
+		}
+
+		if (CanonicalSnapshot->MaterialSlots.Num() != DuplicateSnapshot->MaterialSlots.Num())
+		{
+			return TEXT("number of material slots");
+		}
+		for (int32 SlotIndex = 0; SlotIndex < CanonicalSnapshot->MaterialSlots.Num(); ++SlotIndex)
+		{
+			const FStaticMeshMaterialSlotSnapshot& SlotA = CanonicalSnapshot->MaterialSlots[SlotIndex];
+			const FStaticMeshMaterialSlotSnapshot& SlotB = DuplicateSnapshot->MaterialSlots[SlotIndex];
+			if (SlotA.SlotName != SlotB.SlotName || SlotA.MaterialPath != SlotB.MaterialPath)
+			{
+				return FString::Printf(TEXT("material slot %d"), SlotIndex);
+			}
+		}
+
+		// Components and blueprints attach to sockets by name
+		if (CanonicalSnapshot->Sockets.Num() != DuplicateSnapshot->Sockets.Num())
+		{
+			return TEXT("number of sockets");
+		}
+		for (int32 SocketIndex = 0; SocketIndex < CanonicalSnapshot->Sockets.Num(); ++SocketIndex)
+		{
+			const FStaticMeshSocketSnapshot& SocketA = CanonicalSnapshot->Sockets[SocketIndex];
+			const FStaticMeshSocketSnapshot& SocketB = DuplicateSnapshot->Sockets[SocketIndex];
+			if (SocketA.SocketName != SocketB.SocketName || SocketA.RelativeLocation != SocketB.RelativeLocation || SocketA.RelativeRotation != SocketB.RelativeRotation
+				|| SocketA.RelativeScale != SocketB.RelativeScale || SocketA.Tag != SocketB.Tag)
+			{
+				return FString::Printf(TEXT("socket %s"), *SocketA.SocketName.ToString());
+			}
+		}
+
+		if (!AreBodySetupsEqual(Canonical.GetBodySetup(), Duplicate.GetBodySetup()) || CanonicalSnapshot->Resources.LODForCollision != DuplicateSnapshot->Resources.LODForCollision)
+		{
+			return TEXT("collision");
+		}
+
+		// Build settings decide what the next rebuild produces, even where the current render data is the same
+		if (CanonicalSnapshot->SourceModels.Num() != DuplicateSnapshot->SourceModels.Num())
+		{
+			return TEXT("number of source models");
+		}
+		for (int32 SourceModelIndex = 0; SourceModelIndex < CanonicalSnapshot->SourceModels.Num(); ++SourceModelIndex)
+		{
+			const FStaticMeshSourceModelSnapshot& ModelA = CanonicalSnapshot->SourceModels[SourceModelIndex];
+			const FStaticMeshSourceModelSnapshot& ModelB = DuplicateSnapshot->SourceModels[SourceModelIndex];
+			if (!(ModelA.BuildSettings == ModelB.BuildSettings) || !(ModelA.ReductionSettings == ModelB.ReductionSettings) || ModelA.ScreenSize != ModelB.ScreenSize)
+			{
+				return FString::Printf(TEXT("LOD%d build settings"), SourceModelIndex);
+			}
+		}
+
+		if (CanonicalSnapshot->LightMapResolution != DuplicateSnapshot->LightMapResolution || CanonicalSnapshot->LightMapCoordinateIndex != DuplicateSnapshot->LightMapCoordinateIndex)
+		{
+			return TEXT("lightmap settings");
+		}
+		if (!(Canonical.NaniteSettings == Duplicate.NaniteSettings))
+		{
+			return TEXT("Nanite settings");
+		}
+		if (Canonical.LODGroup != Duplicate.LODGroup || Canonical.bAutoComputeLODScreenSize != Duplicate.bAutoComputeLODScreenSize
+			|| Canonical.bAllowCPUAccess != Duplicate.bAllowCPUAccess || Canonical.bSupportRayTracing != Duplicate.bSupportRayTracing)
+		{
+			return TEXT("mesh settings");
+		}
+		return FString();
+	}
+}
+
+FStaticMeshDuplicateGeometryRule::FStaticMeshDuplicateGeometryRule()
+{
+}
+
+bool FStaticMeshDuplicateGeometryRule::Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	UStaticMesh* StaticMesh = Cast<UStaticMesh>(Asset);
+	if (!StaticMesh)
+	{
+		return false;
+	}
+
+	return CheckSnapshot(*FStaticMeshAnalysisSnapshot::Create(FAssetData(StaticMesh), StaticMesh), Profile, OutResults);
+}
+
+bool FStaticMeshDuplicateGeometryRule::CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	const FStaticMeshAnalysisSnapshot* MeshSnapshot = FStaticMeshAnalysisSnapshot::FromSnapshot(Snapshot);
+	if (!MeshSnapshot || MeshSnapshot->GetNumLODs() == 0)
+	{
+		return false;
+	}
+
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	if (!Settings || !Settings->bEnableStaticMeshDuplicateGeometryRule)
+	{
+		return false;
+	}
+
+	// Duplicates can only be told apart from the whole run; a single mesh analyzed on its own, e.g. after a fix, has nothing to compare with
+	FDuplicateGeometryIndex& DuplicateGeometryIndex = FDuplicateGeometryIndex::Get();
+	if (!DuplicateGeometryIndex.IsCollecting())
+	{
+		return false;
+	}
+
+	const FStaticMeshLODSnapshot& LOD = MeshSnapshot->LODs[0];
+	FMeshGeometryStreams Streams;
+	Streams.Positions = LOD.Positions;
+	for (const TArray<FVector2f>& UVChannel : LOD.UVChannels)
+	{
+		Streams.UVChannels.Add(UVChannel);
+	}
+	Streams.Indices = LOD.Indices;
+
+	// Hashed from the path strings, which unlike FName hashes are the same in every process
+	FString MaterialPaths;
+	for (const FStaticMeshMaterialSlotSnapshot& MaterialSlot : MeshSnapshot->MaterialSlots)
+	{
+		MaterialPaths += MaterialSlot.MaterialPath.ToString();
+		MaterialPaths += TEXT(";");
+	}
+
+	DuplicateGeometryIndex.RecordGeometry(MeshSnapshot->AssetData.GetSoftObjectPath(), FMeshGeometryHasher::Hash(Streams), FCrc::StrCrc32(*MaterialPaths),
+		FStaticMeshMemoryEstimator::Estimate(*MeshSnapshot).GetTotalBytes());
+	return false;
+}
+
+FName FStaticMeshDuplicateGeometryRule::GetRuleID() const
+{
+	return TEXT("SM_DuplicateGeometry");
+}
+
+FText FStaticMeshDuplicateGeometryRule::GetRuleDescription() const
+{
+	return FText::FromString(TEXT("Hashes the LOD 0 geometry of every static mesh and reports groups of meshes with the same geometry, optionally up to translation and uniform scale, with the memory consolidating them would reclaim."));
+}
+
+bool FStaticMeshDuplicateGeometryRule::IsEnabled(const UPipelineGuardianProfile* Profile) const
+{
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	return Settings && Settings->bEnableStaticMeshDuplicateGeometryRule;
+}
+
+int32 FStaticMeshDuplicateGeometryRule::AppendGroupResults(const TSet<FSoftObjectPath>& ScannedAssets, TArray<FAssetAnalysisResult>& OutResults)
+{
+	check(IsInGameThread());
+
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	if (!Settings || !Settings->bEnableStaticMeshDuplicateGeometryRule)
+	{
+		return 0;
+	}
+
+	const TArray<FDuplicateGeometryGroup> Groups = FDuplicateGeometryIndex::Get().FindGroups(Settings->bDetectTransformedDuplicates);
+	int32 NumReported = 0;
+	int64 TotalReclaimableBytes = 0;
+	for (const FDuplicateGeometryGroup& Group : Groups)
+	{
+		// The index spans the project; groups made up only of meshes other scans recorded belong to those scans
+		const bool bHasScannedMember = Group.Members.ContainsByPredicate([&ScannedAssets](const FDuplicateGeometryGroup::FMember& Member)
+		{
+			return ScannedAssets.Contains(Member.AssetData.GetSoftObjectPath());
+		});
+		if (!bHasScannedMember)
+		{
+			continue;
+		}
+
+		const FDuplicateGeometryGroup::FMember& Canonical = Group.Members[0];
+
+		// Only exact copies with the same materials can be swapped without changing what is rendered
+		TArray<FSoftObjectPath> DuplicatePaths;
+		int64 ReclaimableBytes = 0;
+		int64 ReclaimableDiskBytes = 0;
+		for (int32 MemberIndex = 1; MemberIndex < Group.Members.Num(); ++MemberIndex)
+		{
+			const FDuplicateGeometryGroup::FMember& Member = Group.Members[MemberIndex];
+			ReclaimableBytes += Member.Entry.MemoryBytes;
+			ReclaimableDiskBytes += Member.DiskBytes;
+			if (Member.Entry.Hash.ExactHash == Canonical.Entry.Hash.ExactHash && Member.Entry.MaterialHash == Canonical.Entry.MaterialHash)
+			{
+				DuplicatePaths.Add(Member.AssetData.GetSoftObjectPath());
+			}
+		}
+		TotalReclaimableBytes += ReclaimableBytes;
+
+		FAssetAnalysisResult Result;
+		Result.Asset = Canonical.AssetData;
+		Result.RuleID = TEXT("SM_DuplicateGeometry");
+		Result.Severity = Settings->DuplicateGeometryIssueSeverity;
+		Result.Description = FText::FromString(GenerateGroupDescription(Group, DuplicatePaths.Num(), ReclaimableBytes, ReclaimableDiskBytes));
+		Result.FilePath = FText::FromString(Canonical.AssetData.PackageName.ToString());
+		Result.MemoryBytes = ReclaimableBytes;
+
+		if (Settings->bAllowDuplicateGeometryAutoFix && DuplicatePaths.Num() > 0)
+		{
+			Result.FixAction.BindLambda([CanonicalPath = Canonical.AssetData.GetSoftObjectPath(), DuplicatePaths]()
+			{
+				// Consolidation deletes assets, so every group is confirmed on its own, also under Fix All
+				FString Message = FString::Printf(TEXT("Replace every reference to these meshes with %s and delete them, leaving redirectors?"), *CanonicalPath.ToString());
+				for (const FSoftObjectPath& DuplicatePath : DuplicatePaths)
+				{
+					Message += FString::Printf(TEXT("\n  %s"), *DuplicatePath.ToString());
+				}
+				if (FMessageDialog::Open(EAppMsgType::YesNo, FText::FromString(Message), FText::FromString(TEXT("Consolidate Duplicate Meshes"))) != EAppReturnType::Yes)
+				{
+					return;
+				}
+
+				FString Error;
+				const int32 NumConsolidated = ConsolidateDuplicates(CanonicalPath, DuplicatePaths, Error);
+				if (!Error.IsEmpty())
+				{
+					FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(Error), FText::FromString(TEXT("Consolidate Duplicate Meshes")));
+					return;
+				}
+				UE_LOG(LogPipelineGuardian, Log, TEXT("Consolidated %d duplicate meshes onto %s"), NumConsolidated, *CanonicalPath.ToString());
+			});
+		}
+
+		OutResults.Add(Result);
+		++NumReported;
+	}
+
+	if (NumReported > 0)
+	{
+		UE_LOG(LogPipelineGuardian, Log, TEXT("Duplicate geometry: %d groups, %s reclaimable"), NumReported, *FText::AsMemory(TotalReclaimableBytes).ToString());
+	}
+	return NumReported;
+}
+
+FString FStaticMeshDuplicateGeometryRule::GenerateGroupDescription(const FDuplicateGeometryGroup& Group, int32 NumConsolidated, int64 ReclaimableBytes, int64 ReclaimableDiskBytes)
+{
+	const FDuplicateGeometryGroup::FMember& Canonical = Group.Members[0];
+	const FMeshGeometryHash& CanonicalHash = Canonical.Entry.Hash;
+
+	FString Description = FString::Printf(TEXT("Static mesh %s has the same LOD 0 geometry (%d triangles) as %d other meshes%s. Replacing them with it would reclaim about %s of memory and %s on disk:"),
+		*Canonical.AssetData.AssetName.ToString(), CanonicalHash.NumTriangles, Group.Members.Num() - 1, Group.bExact ? TEXT("") : TEXT(", some only up to translation and uniform scale"),
+		*FText::AsMemory(ReclaimableBytes).ToString(), *FText::AsMemory(ReclaimableDiskBytes).ToString());
+
+	Description += FString::Printf(TEXT("\n  %s (kept, %d referencing packages)"), *Canonical.AssetData.GetSoftObjectPath().ToString(), Canonical.NumReferencers);
+	for (int32 MemberIndex = 1; MemberIndex < Group.Members.Num(); ++MemberIndex)
+	{
+		const FDuplicateGeometryGroup::FMember& Member = Group.Members[MemberIndex];
+		Description += FString::Printf(TEXT("\n  %s (%d referencing packages, %s)"), *Member.AssetData.GetSoftObjectPath().ToString(), Member.NumReferencers, *FText::AsMemory(Member.Entry.MemoryBytes).ToString());
+
+		if (Member.Entry.Hash.ExactHash != CanonicalHash.ExactHash)
+		{
+			// Member = Canonical * Scale + Offset
+			const float Scale = CanonicalHash.Extent > UE_SMALL_NUMBER ? Member.Entry.Hash.Extent / CanonicalHash.Extent : 1.0f;
+			const FVector3f Offset = Member.Entry.Hash.Center - CanonicalHash.Center * Scale;
+			Description += FString::Printf(TEXT(": the kept mesh scaled by %.4g and moved by (%.2f, %.2f, %.2f); place it with that transform instead"), Scale, Offset.X, Offset.Y, Offset.Z);
+		}
+		else if (Member.Entry.MaterialHash != Canonical.Entry.MaterialHash)
+		{
+			Description += TEXT(": uses different materials; replace it with the kept mesh and override the materials on its components");
+		}
+	}
+
+	if (NumConsolidated > 0)
+	{
+		Description += FString::Printf(TEXT("\nThe fix consolidates the %d exact copies with the same materials onto the kept mesh, leaving redirectors."), NumConsolidated);
+	}
+	return Description;
+}
+
+int32 FStaticMeshDuplicateGeometryRule::ConsolidateDuplicates(const FSoftObjectPath& CanonicalPath, const TArray<FSoftObjectPath>& DuplicatePaths, FString& OutError)
+{
+	using namespace StaticMeshDuplicateGeometryRule;
+
+	UStaticMesh* CanonicalMesh = Cast<UStaticMesh>(CanonicalPath.TryLoad());
+	if (!CanonicalMesh)
+	{
+		OutError = FString::Printf(TEXT("Could not load %s to consolidate duplicates onto. Nothing was changed."), *CanonicalPath.ToString());
+		return 0;
+	}
+
+	// All or nothing: one mesh that is not an exact copy means the group is not what the index says it is
+	TArray<UObject*> DuplicateMeshes;
+	for (const FSoftObjectPath& DuplicatePath : DuplicatePaths)
+	{
+		UStaticMesh* DuplicateMesh = Cast<UStaticMesh>(DuplicatePath.TryLoad());
+		if (!DuplicateMesh)
+		{
+			OutError = FString::Printf(TEXT("Could not load %s. Nothing was changed."), *DuplicatePath.ToString());
+			return 0;
+		}
+
+		const FString Difference = FindDifference(*CanonicalMesh, *DuplicateMesh);
+		if (!Difference.IsEmpty())
+		{
+			OutError = FString::Printf(TEXT("%s differs from %s in its %s, so it is not an exact copy. Nothing was changed; run the analysis again to refresh the groups."),
+				*DuplicatePath.ToString(), *CanonicalPath.ToString(), *Difference);
+			return 0;
+		}
+		DuplicateMeshes.Add(DuplicateMesh);
+	}
+	if (DuplicateMeshes.Num() == 0)
+	{
+		return 0;
+	}
+
+	const int32 NumConsolidated = DuplicateMeshes.Num();
+	ObjectTools::ConsolidateObjects(CanonicalMesh, DuplicateMeshes, false);
+	return NumConsolidated;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Analysis/IAssetCheckRule.h"
+
+// Forward Declarations
+struct FDuplicateGeometryGroup;
+
+/**
+ * Finds static meshes imported more than once. Each analyzed mesh only has the positions, UVs and indices of its LOD 0
+ * hashed into the project-wide FDuplicateGeometryIndex; the duplicates themselves are reported by AppendGroupResults()
+ * once the whole run is done, one result per group of meshes with the same geometry. Groups can also take in meshes
+ * that were moved or uniformly scaled on export. Exact duplicates can be consolidated onto the most referenced mesh,
+ * which replaces references to the others and leaves redirectors behind.
+ */
+class FStaticMeshDuplicateGeometryRule : public IAssetCheckRule
+{
+public:
+	FStaticMeshDuplicateGeometryRule();
+	virtual ~FStaticMeshDuplicateGeometryRule() = default;
+
+	virtual bool Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
+	virtual FName GetRuleID() const override;
+	virtual FText GetRuleDescription() const override;
+	virtual bool IsEnabled(const UPipelineGuardianProfile* Profile) const override;
+	virtual bool SupportsSnapshot() const override { return true; }
+	virtual bool CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
+
+	/**
+	 * Reports the duplicate groups of the index, with the memory replacing the duplicates would reclaim. Call on the
+	 * game thread once the index has ended, after all assets of the run were analyzed.
+	 * @param ScannedAssets Assets of the run; groups without any of them are left out, since the index keeps the meshes of earlier scans.
+	 * @param OutResults Array to append one result per group to.
+	 * @return Number of groups reported.
+	 */
+	static int32 AppendGroupResults(const TSet<FSoftObjectPath>& ScannedAssets, TArray<FAssetAnalysisResult>& OutResults);
+
+private:
+	static FString GenerateGroupDescription(const FDuplicateGeometryGroup& Group, int32 NumConsolidated, int64 ReclaimableBytes, int64 ReclaimableDiskBytes);
+
+	/**
+	 * Replaces every reference to the duplicates with the canonical mesh and deletes the duplicates, leaving redirectors.
+	 * The loaded meshes are compared first: all render LODs and vertex streams, materials, sockets, collision, build,
+	 * lightmap and Nanite settings. If any duplicate differs in any of them, nothing is consolidated. Game thread only.
+	 * @param OutError Receives why nothing was consolidated.
+	 * @return Number of meshes consolidated.
+	 */
+	static int32 ConsolidateDuplicates(const FSoftObjectPath& CanonicalPath, const TArray<FSoftObjectPath>& DuplicatePaths, FString& OutError);
+};
@@ -0,0 +1,212 @@
+#include "FStaticMeshLODGeometricErrorRule.h"
+#include "Analysis/FAssetAnalysisResult.h"
+#include "Analysis/Snapshots/FStaticMeshAnalysisSnapshot.h"
+#include "FPipelineGuardianSettings.h"
+#include "PipelineGuardian.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshSourceData.h"
+
+FStaticMeshLODGeometricErrorRule::FStaticMeshLODGeometricErrorRule()
+{
+}
+
+bool FStaticMeshLODGeometricErrorRule::Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	UStaticMesh* StaticMesh = Cast<UStaticMesh>(Asset);
+	if (!StaticMesh)
+	{
+		return false;
+	}
+
+	return CheckSnapshot(*FStaticMeshAnalysisSnapshot::Create(FAssetData(StaticMesh), StaticMesh), Profile, OutResults);
+}
+
+bool FStaticMeshLODGeometricErrorRule::CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	const FStaticMeshAnalysisSnapshot* MeshSnapshot = FStaticMeshAnalysisSnapshot::FromSnapshot(Snapshot);
+	if (!MeshSnapshot)
+	{
+		return false;
+	}
+
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	if (!Settings || !Settings->bEnableStaticMeshLODGeometricErrorRule)
+	{
+		return false;
+	}
+
+	// Nanite meshes pick their detail per cluster; their LODs are only fallbacks
+	if (MeshSnapshot->bNaniteEnabled || MeshSnapshot->GetNumLODs() < 2 || MeshSnapshot->GetNumTriangles(0) == 0)
+	{
+		return false;
+	}
+
+	const float PixelErrorBudget = FMath::Max(Settings->LODPixelErrorBudget, UE_KINDA_SMALL_NUMBER);
+	const int32 ScreenHeight = FMath::Max(Settings->LODReferenceScreenHeight, 1);
+	const float Tolerance = FMath::Max(Settings->LODScreenSizeTolerance, 1.0f);
+
+	TArray<FLODGeometricError> MisplacedLODs;
+	for (const FLODGeometricError& LODError : MeasureLODs(*MeshSnapshot, PixelErrorBudget, ScreenHeight))
+	{
+		UE_LOG(LogPipelineGuardian, Verbose, TEXT("%s LOD%d deviation: max %.3f, RMS %.3f, %.2f px at screen size %.3f"),
+			*MeshSnapshot->AssetName, LODError.LODIndex, LODError.Distance.MaxDistance, LODError.Distance.GetRMSDistance(), LODError.PixelError, LODError.ScreenSize);
+
+		// A LOD identical to LOD 0 saves nothing wherever it switches; other rules report it
+		if (LODError.Distance.MaxDistance <= 0.0f)
+		{
+			continue;
+		}
+
+		if (LODError.PixelError > PixelErrorBudget * Tolerance || LODError.PixelError < PixelErrorBudget / Tolerance)
+		{
+			MisplacedLODs.Add(LODError);
+		}
+	}
+
+	if (MisplacedLODs.Num() == 0)
+	{
+		return false;
+	}
+
+	FAssetAnalysisResult Result;
+	Result.Asset = MeshSnapshot->AssetData;
+	Result.RuleID = GetRuleID();
+	Result.Severity = Settings->LODGeometricErrorIssueSeverity;
+	Result.Description = FText::FromString(GenerateGeometricErrorDescription(*MeshSnapshot, MisplacedLODs, PixelErrorBudget, ScreenHeight));
+	Result.FilePath = FText::FromString(MeshSnapshot->PackageName);
+
+	if (Settings->bAllowLODScreenSizeAutoFix)
+	{
+		TSoftObjectPtr<UStaticMesh> SoftStaticMesh(MeshSnapshot->AssetData.GetSoftObjectPath());
+		Result.FixAction.BindLambda([SoftStaticMesh, PixelErrorBudget, ScreenHeight]()
+		{
+			UStaticMesh* StaticMesh = SoftStaticMesh.LoadSynchronous();
+			if (!StaticMesh)
+			{
+				return;
+			}
+
+			const int32 NumChanged = CalibrateScreenSizes(StaticMesh, PixelErrorBudget, ScreenHeight);
+			UE_LOG(LogPipelineGuardian, Log, TEXT("Calibrated screen sizes of %d LODs of %s"), NumChanged, *StaticMesh->GetName());
+		});
+	}
+
+	OutResults.Add(Result);
+	return true;
+}
+
+FName FStaticMeshLODGeometricErrorRule::GetRuleID() const
+{
+	return TEXT("SM_LODGeometricError");
+}
+
+FText FStaticMeshLODGeometricErrorRule::GetRuleDescription() const
+{
+	return FText::FromString(TEXT("Measures each LOD's surface deviation from LOD 0 and reports LODs whose deviation at their screen size is far above (visual pop) or below (wasted triangles) the pixel error budget."));
+}
+
+bool FStaticMeshLODGeometricErrorRule::IsEnabled(const UPipelineGuardianProfile* Profile) const
+{
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	return Settings && Settings->bEnableStaticMeshLODGeometricErrorRule;
+}
+
+int32 FStaticMeshLODGeometricErrorRule::CalibrateScreenSizes(UStaticMesh* StaticMesh, float PixelErrorBudget, int32 ScreenHeight)
+{
+	check(IsInGameThread());
+
+	if (!StaticMesh || !StaticMesh->GetRenderData() || StaticMesh->GetNumSourceModels() < 2)
+	{
+		return 0;
+	}
+
+	const TSharedRef<FStaticMeshAnalysisSnapshot> MeshSnapshot = FStaticMeshAnalysisSnapshot::Create(FAssetData(StaticMesh), StaticMesh);
+	if (MeshSnapshot->GetNumLODs() < 2 || MeshSnapshot->GetNumTriangles(0) == 0)
+	{
+		return 0;
+	}
+
+	const TArray<FLODGeometricError> LODErrors = MeasureLODs(*MeshSnapshot, FMath::Max(PixelErrorBudget, UE_KINDA_SMALL_NUMBER), FMath::Max(ScreenHeight, 1));
+
+	StaticMesh->Modify();
+	StaticMesh->bAutoComputeLODScreenSize = false;
+
+	int32 NumChanged = 0;
+	float PreviousScreenSize = MeshSnapshot->LODs[0].ScreenSize;
+	for (const FLODGeometricError& LODError : LODErrors)
+	{
+		if (LODError.LODIndex >= StaticMesh->GetNumSourceModels())
+		{
+			break;
+		}
+
+		// A LOD identical to its base may switch in as soon as the previous one; screen sizes must not increase
+		const float CalibratedScreenSize = LODError.Distance.MaxDistance > 0.0f
+			? FMath::Clamp(LODError.CalibratedScreenSize, UE_KINDA_SMALL_NUMBER, PreviousScreenSize)
+			: PreviousScreenSize;
+
+		FStaticMeshSourceModel& SourceModel = StaticMesh->GetSourceModel(LODError.LODIndex);
+		if (!FMath::IsNearlyEqual(SourceModel.ScreenSize.Default, CalibratedScreenSize, 1.0e-3f))
+		{
+			UE_LOG(LogPipelineGuardian, Log, TEXT("%s LOD%d screen size: %.3f -> %.3f (deviation %.3f units)"),
+				*StaticMesh->GetName(), LODError.LODIndex, LODError.ScreenSize, CalibratedScreenSize, LODError.Distance.MaxDistance);
+			++NumChanged;
+		}
+		SourceModel.ScreenSize.Default = CalibratedScreenSize;
+		PreviousScreenSize = CalibratedScreenSize;
+	}
+
+	// Screen sizes are copied into the render data when it is built; PostEditChange refreshes the components using the mesh
+	StaticMesh->Build(false);
+	StaticMesh->MarkPackageDirty();
+	StaticMesh->PostEditChange();
+
+	return NumChanged;
+}
+
+TArray<FStaticMeshLODGeometricErrorRule::FLODGeometricError> FStaticMeshLODGeometricErrorRule::MeasureLODs(const FStaticMeshAnalysisSnapshot& MeshSnapshot, float PixelErrorBudget, int32 ScreenHeight)
+{
+	const FStaticMeshLODSnapshot& BaseLOD = MeshSnapshot.LODs[0];
+	const float BoundsRadius = static_cast<float>(MeshSnapshot.Bounds.SphereRadius);
+
+	TArray<FLODGeometricError> LODErrors;
+	for (int32 LODIndex = 1; LODIndex < MeshSnapshot.GetNumLODs(); ++LODIndex)
+	{
+		const FStaticMeshLODSnapshot& LODSnapshot = MeshSnapshot.LODs[LODIndex];
+
+		FLODGeometricError& LODError = LODErrors.AddDefaulted_GetRef();
+		LODError.LODIndex = LODIndex;
+		LODError.ScreenSize = LODSnapshot.ScreenSize;
+		LODError.Distance = FSurfaceDistanceEstimator::Measure(BaseLOD.Positions, BaseLOD.Indices, LODSnapshot.Positions, LODSnapshot.Indices);
+		LODError.PixelError = FSurfaceDistanceEstimator::GetPixelError(LODError.Distance.MaxDistance, BoundsRadius, LODError.ScreenSize, ScreenHeight);
+		LODError.CalibratedScreenSize = FSurfaceDistanceEstimator::GetScreenSizeForPixelError(LODError.Distance.MaxDistance, BoundsRadius, PixelErrorBudget, ScreenHeight);
+	}
+	return LODErrors;
+}
+
+FString FStaticMeshLODGeometricErrorRule::GenerateGeometricErrorDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, TConstArrayView<FLODGeometricError> MisplacedLODs, float PixelErrorBudget, int32 ScreenHeight) const
+{
+	FString Description = FString::Printf(TEXT("Static mesh %s has LODs whose switch does not match their deviation from LOD 0 (budget %.1f px at %dp):"),
+		*MeshSnapshot.AssetName, PixelErrorBudget, ScreenHeight);
+
+	for (const FLODGeometricError& LODError : MisplacedLODs)
+	{
+		const bool bTooEarly = LODError.PixelError > PixelErrorBudget;
+		Description += FString::Printf(TEXT("\n  LOD%d: deviation max %.3f, RMS %.3f units; %.2f px at screen size %.3f. "),
+			LODError.LODIndex, LODError.Distance.MaxDistance, LODError.Distance.GetRMSDistance(), LODError.PixelError, LODError.ScreenSize);
+
+		if (bTooEarly)
+		{
+			Description += FString::Printf(TEXT("Switches too early (visual pop); a screen size of %.3f meets the budget."), LODError.CalibratedScreenSize);
+		}
+		else
+		{
+			// The previous LOD keeps drawing from the calibrated size down to the configured one
+			Description += FString::Printf(TEXT("Switches too late: LOD%d's %d triangles stay on screen down to %.3f where this LOD's %d would meet the budget from %.3f."),
+				LODError.LODIndex - 1, MeshSnapshot.GetNumTriangles(LODError.LODIndex - 1), LODError.ScreenSize,
+				MeshSnapshot.GetNumTriangles(LODError.LODIndex), LODError.CalibratedScreenSize);
+		}
+	}
+
+	return Description;
+}
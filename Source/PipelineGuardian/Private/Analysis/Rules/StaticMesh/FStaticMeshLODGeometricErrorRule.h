@@ -0,0 +1,70 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Analysis/IAssetCheckRule.h"
+#include "Analysis/Geometry/FSurfaceDistanceEstimator.h"
+
+// Forward Declarations
+class UStaticMesh;
+struct FStaticMeshAnalysisSnapshot;
+
+/**
+ * Measures how far each LOD's surface deviates from LOD 0 (one-sided Hausdorff and RMS distance) and converts the
+ * deviation into pixels at the LOD's screen size. LODs whose error at the switch exceeds the pixel budget pop
+ * visibly; LODs far below it switch later than needed and keep the previous, denser LOD on screen.
+ * The fix writes the screen sizes at which every LOD's deviation spans the budget.
+ */
+class FStaticMeshLODGeometricErrorRule : public IAssetCheckRule
+{
+public:
+	FStaticMeshLODGeometricErrorRule();
+	virtual ~FStaticMeshLODGeometricErrorRule() = default;
+
+	virtual bool Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
+	virtual FName GetRuleID() const override;
+	virtual FText GetRuleDescription() const override;
+	virtual bool IsEnabled(const UPipelineGuardianProfile* Profile) const override;
+	virtual bool SupportsSnapshot() const override { return true; }
+	virtual bool CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
+
+	/**
+	 * Measures the built LODs of a mesh against LOD 0 and sets each LOD's screen size to where its deviation spans the
+	 * pixel error budget, turning off automatic screen size computation and rebuilding the mesh. Sizes never increase
+	 * from one LOD to the next. Used by this rule's fix and by the LOD generation fixes. Game thread only.
+	 * @param StaticMesh Mesh whose LODs are built.
+	 * @param PixelErrorBudget Pixels of deviation allowed at a LOD switch.
+	 * @param ScreenHeight Screen height, in pixels, the budget refers to.
+	 * @return Number of LODs whose screen size changed.
+	 */
+	static int32 CalibrateScreenSizes(UStaticMesh* StaticMesh, float PixelErrorBudget, int32 ScreenHeight);
+
+private:
+	/** Deviation of one LOD from LOD 0 and what it means at the LOD's switch */
+	struct FLODGeometricError
+	{
+		int32 LODIndex = INDEX_NONE;
+
+		/** Configured screen size at which the LOD becomes active */
+		float ScreenSize = 0.0f;
+
+		/** Distances from LOD 0's surface to this LOD's */
+		FSurfaceDistanceStats Distance;
+
+		/** Hausdorff distance in pixels at ScreenSize */
+		float PixelError = 0.0f;
+
+		/** Screen size at which the Hausdorff distance spans the pixel budget */
+		float CalibratedScreenSize = 0.0f;
+	};
+
+	/**
+	 * Measures every LOD after the first against LOD 0.
+	 * @param MeshSnapshot Snapshot of the mesh.
+	 * @param PixelErrorBudget Pixels of deviation allowed at a LOD switch.
+	 * @param ScreenHeight Screen height, in pixels, the budget refers to.
+	 * @return One entry per LOD from LOD 1 on.
+	 */
+	static TArray<FLODGeometricError> MeasureLODs(const FStaticMeshAnalysisSnapshot& MeshSnapshot, float PixelErrorBudget, int32 ScreenHeight);
+
+	FString GenerateGeometricErrorDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, TConstArrayView<FLODGeometricError> MisplacedLODs, float PixelErrorBudget, int32 ScreenHeight) const;
+};
@@ -1,8 +1,10 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "FStaticMeshLODMissingRule.h"
+#include "FStaticMeshLODGeometricErrorRule.h"
 #include "Analysis/FAssetAnalysisResult.h"
 #include "Analysis/FPipelineGuardianProfile.h"
+#include "Analysis/Snapshots/FStaticMeshAnalysisSnapshot.h"
 #include "FPipelineGuardianSettings.h"
 #include "Engine/StaticMesh.h"
 #include "PipelineGuardian.h"
@@ -18,6 +20,10 @@
 
 #define LOCTEXT_NAMESPACE "FStaticMeshLODMissingRule"
 
+/** Asset registry tags UStaticMesh writes with its render LOD count and LOD0 vertex count */
+static const FName LODsTagName(TEXT("LODs"));
+static const FName VerticesTagName(TEXT("Vertices"));
+
 FStaticMeshLODMissingRule::FStaticMeshLODMissingRule()
 {
 }
@@ -31,12 +37,47 @@ bool FStaticMeshLODMissingRule::Check(UObject* Asset, const UPipelineGuardianPro
 		return false;
 	}
 
+	return CheckSnapshot(*FStaticMeshAnalysisSnapshot::Create(FAssetData(StaticMesh), StaticMesh), Profile, OutResults);
+}
+
+bool FStaticMeshLODMissingRule::CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	const FStaticMeshAnalysisSnapshot* MeshSnapshot = FStaticMeshAnalysisSnapshot::FromSnapshot(Snapshot);
+	if (!MeshSnapshot)
+	{
+		UE_LOG(LogPipelineGuardian, Warning, TEXT("FStaticMeshLODMissingRule: Snapshot is not from a UStaticMesh"));
+		return false;
+	}
+
 	if (!Profile)
 	{
 		UE_LOG(LogPipelineGuardian, Warning, TEXT("FStaticMeshLODMissingRule: No profile provided"));
 		return false;
 	}
 
+	return CheckLODCount(MeshSnapshot->AssetData, MeshSnapshot->GetNumLODs(), CanGenerateLODs(*MeshSnapshot), Profile, OutResults);
+}
+
+bool FStaticMeshLODMissingRule::CanCheckAssetData(const FAssetData& AssetData) const
+{
+	return AssetData.FindTag(LODsTagName) && AssetData.FindTag(VerticesTagName);
+}
+
+bool FStaticMeshLODMissingRule::CheckAssetData(const FAssetData& AssetData, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	int32 LODCount = 0;
+	int32 VertexCount = 0;
+	if (!Profile || !AssetData.GetTagValue(LODsTagName, LODCount) || !AssetData.GetTagValue(VerticesTagName, VertexCount))
+	{
+		return false;
+	}
+
+	// Same condition as CanGenerateLODs(): the base LOD has geometry to reduce
+	return CheckLODCount(AssetData, LODCount, VertexCount > 0, Profile, OutResults);
+}
+
+bool FStaticMeshLODMissingRule::CheckLODCount(const FAssetData& AssetData, int32 CurrentLODCount, bool bCanGenerateLODs, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) const
+{
 	// Check if this rule is enabled in the profile
 	if (!Profile->IsRuleEnabled(GetRuleID()))
 	{
@@ -47,9 +88,6 @@ bool FStaticMeshLODMissingRule::Check(UObject* Asset, const UPipelineGuardianPro
 	// Get the minimum required LODs from the profile
 	int32 MinRequiredLODs = FCString::Atoi(*Profile->GetRuleParameter(GetRuleID(), TEXT("MinLODs_SM"), TEXT("3")));
 	
-	// Get current LOD count
-	int32 CurrentLODCount = GetStaticMeshLODCount(StaticMesh);
-	
 	// Check if LODs are missing
 	if (CurrentLODCount < MinRequiredLODs)
 	{
@@ -65,36 +103,36 @@ bool FStaticMeshLODMissingRule::Check(UObject* Asset, const UPipelineGuardianPro
 		}
 		
 		FAssetAnalysisResult Result;
-		Result.Asset = FAssetData(StaticMesh);
+		Result.Asset = AssetData;
 		Result.Severity = Severity;
 		Result.RuleID = GetRuleID();
 		Result.Description = FText::Format(
 			LOCTEXT("StaticMeshLODMissing", "Static Mesh '{0}' has {1} LOD(s) but requires {2} LOD(s) for proper optimization"),
-			FText::FromString(StaticMesh->GetName()),
+			FText::FromName(AssetData.AssetName),
 			FText::AsNumber(CurrentLODCount),
 			FText::AsNumber(MinRequiredLODs)
 		);
-		Result.FilePath = FText::FromString(StaticMesh->GetPackage()->GetName());
+		Result.FilePath = FText::FromName(AssetData.PackageName);
 		
-		// Create fix action if LOD generation is possible
-		if (CanGenerateLODs(StaticMesh))
+		// Create fix action if LOD generation is possible. The asset may have been checked from its tags alone, so load it when the fix runs.
+		if (bCanGenerateLODs)
 		{
-			Result.FixAction.BindLambda([StaticMesh, MinRequiredLODs]()
+			Result.FixAction.BindLambda([AssetData, MinRequiredLODs]()
 			{
-				GenerateLODs(StaticMesh, MinRequiredLODs);
+				GenerateLODs(Cast<UStaticMesh>(AssetData.GetAsset()), MinRequiredLODs);
 			});
 		}
 		
 		OutResults.Add(Result);
 		
 		UE_LOG(LogPipelineGuardian, Log, TEXT("FStaticMeshLODMissingRule: LOD deficiency found for %s (%d/%d LODs)"), 
-			*StaticMesh->GetName(), CurrentLODCount, MinRequiredLODs);
+			*AssetData.AssetName.ToString(), CurrentLODCount, MinRequiredLODs);
 		return true; // Issue found
 	}
 	else
 	{
 		UE_LOG(LogPipelineGuardian, VeryVerbose, TEXT("FStaticMeshLODMissingRule: %s has sufficient LODs (%d/%d)"), 
-			*StaticMesh->GetName(), CurrentLODCount, MinRequiredLODs);
+			*AssetData.AssetName.ToString(), CurrentLODCount, MinRequiredLODs);
 		return false; // No issues found
 	}
 }
@@ -109,41 +147,15 @@ FText FStaticMeshLODMissingRule::GetRuleDescription() const
 	return LOCTEXT("StaticMeshLODMissingRuleDescription", "Validates that Static Mesh assets have the minimum required number of LOD levels for performance optimization.");
 }
 
-int32 FStaticMeshLODMissingRule::GetStaticMeshLODCount(UStaticMesh* StaticMesh) const
+bool FStaticMeshLODMissingRule::IsEnabled(const UPipelineGuardianProfile* Profile) const
 {
-	if (!StaticMesh || !StaticMesh->GetRenderData())
-	{
-		return 0;
-	}
-	
-	return StaticMesh->GetRenderData()->LODResources.Num();
+	return Profile && Profile->IsRuleEnabled(GetRuleID());
 }
 
-bool FStaticMeshLODMissingRule::CanGenerateLODs(UStaticMesh* StaticMesh) const
+bool FStaticMeshLODMissingRule::CanGenerateLODs(const FStaticMeshAnalysisSnapshot& MeshSnapshot) const
 {
-	if (!StaticMesh)
-	{
-		return false;
-	}
-	
-	// Check if mesh has valid geometry
-	if (!StaticMesh->GetRenderData() || StaticMesh->GetRenderData()->LODResources.Num() == 0)
-	{
-		return false;
-	}
-	
-	// Check if base LOD has vertices
-	const FStaticMeshLODResources& BaseLOD = StaticMesh->GetRenderData()->LODResources[0];
-	if (BaseLOD.GetNumVertices() == 0)
-	{
-		return false;
-	}
-	
-	// Check if mesh reduction is available
-	IMeshReductionManagerModule& MeshReductionModule = FModuleManager::Get().LoadModuleChecked<IMeshReductionManagerModule>("MeshReductionInterface");
-	IMeshReduction* MeshReduction = MeshReductionModule.GetStaticMeshReductionInterface();
-	
-	return MeshReduction != nullptr;
+	// Check if mesh has valid geometry and the base LOD has vertices
+	return MeshSnapshot.GetNumVertices(0) > 0;
 }
 
 void FStaticMeshLODMissingRule::GenerateLODs(UStaticMesh* StaticMesh, int32 TargetLODCount)
@@ -287,6 +299,12 @@ void FStaticMeshLODMissingRule::GenerateLODs(UStaticMesh* StaticMesh, int32 Targ
 		// Mark package as dirty
 		StaticMesh->MarkPackageDirty();
 		
+		// Place the switches from the measured deviation of the new LODs instead of keeping the configured screen sizes
+		if (Settings && Settings->bCalibrateGeneratedLODScreenSizes)
+		{
+			FStaticMeshLODGeometricErrorRule::CalibrateScreenSizes(StaticMesh, Settings->LODPixelErrorBudget, Settings->LODReferenceScreenHeight);
+		}
+		
 		// Verify LODs were created
 		int32 NewLODCount = StaticMesh->GetRenderData()->LODResources.Num();
 		
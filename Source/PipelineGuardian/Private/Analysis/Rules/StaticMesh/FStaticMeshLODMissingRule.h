@@ -9,6 +9,8 @@
 class UStaticMesh;
 class UPipelineGuardianProfile;
 struct FAssetAnalysisResult;
+struct FAssetData;
+struct FStaticMeshAnalysisSnapshot;
 
 /**
  * Rule to check if Static Meshes have the minimum required number of LODs.
@@ -24,14 +26,19 @@ public:
 	virtual bool Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
 	virtual FName GetRuleID() const override;
 	virtual FText GetRuleDescription() const override;
+	virtual bool IsEnabled(const UPipelineGuardianProfile* Profile) const override;
+	virtual bool SupportsSnapshot() const override { return true; }
+	virtual bool CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
+	virtual bool CanCheckAssetData(const FAssetData& AssetData) const override;
+	virtual bool CheckAssetData(const FAssetData& AssetData, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
 
-private:
-	/** Get the number of LODs for a static mesh */
-	int32 GetStaticMeshLODCount(UStaticMesh* StaticMesh) const;
+private:	
+	/** Compare the LOD count against the profile minimum; shared by the snapshot and asset registry paths */
+	bool CheckLODCount(const FAssetData& AssetData, int32 CurrentLODCount, bool bCanGenerateLODs, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) const;
 	
 	/** Generate LODs for the static mesh */
 	static void GenerateLODs(UStaticMesh* StaticMesh, int32 TargetLODCount);
 	
-	/** Check if LOD generation is possible for this mesh */
-	bool CanGenerateLODs(UStaticMesh* StaticMesh) const;
+	/** Check if the mesh has geometry to generate LODs from. Reduction interface availability is checked when the fix runs. */
+	bool CanGenerateLODs(const FStaticMeshAnalysisSnapshot& MeshSnapshot) const;
 }; 
\ No newline at end of file
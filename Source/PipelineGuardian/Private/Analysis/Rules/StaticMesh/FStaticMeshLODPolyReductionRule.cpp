@@ -1,8 +1,11 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "FStaticMeshLODPolyReductionRule.h"
+#include "FStaticMeshLODGeometricErrorRule.h"
 #include "Analysis/FAssetAnalysisResult.h"
 #include "Analysis/FPipelineGuardianProfile.h"
+#include "Analysis/Snapshots/FStaticMeshAnalysisSnapshot.h"
+#include "FPipelineGuardianSettings.h"
 #include "Engine/StaticMesh.h"
 #include "PipelineGuardian.h"
 #include "StaticMeshResources.h"
@@ -27,6 +30,18 @@ bool FStaticMeshLODPolyReductionRule::Check(UObject* Asset, const UPipelineGuard
 		return false;
 	}
 
+	return CheckSnapshot(*FStaticMeshAnalysisSnapshot::Create(FAssetData(StaticMesh), StaticMesh), Profile, OutResults);
+}
+
+bool FStaticMeshLODPolyReductionRule::CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	const FStaticMeshAnalysisSnapshot* MeshSnapshot = FStaticMeshAnalysisSnapshot::FromSnapshot(Snapshot);
+	if (!MeshSnapshot)
+	{
+		UE_LOG(LogPipelineGuardian, Warning, TEXT("FStaticMeshLODPolyReductionRule: Snapshot is not from a UStaticMesh"));
+		return false;
+	}
+
 	if (!Profile)
 	{
 		UE_LOG(LogPipelineGuardian, Warning, TEXT("FStaticMeshLODPolyReductionRule: No profile provided"));
@@ -46,25 +61,25 @@ bool FStaticMeshLODPolyReductionRule::Check(UObject* Asset, const UPipelineGuard
 	float ErrorThreshold = FCString::Atof(*Profile->GetRuleParameter(GetRuleID(), TEXT("ErrorThreshold"), TEXT("10.0")));
 	
 	// Ensure we have render data
-	if (!StaticMesh->GetRenderData() || StaticMesh->GetRenderData()->LODResources.Num() < 2)
+	if (MeshSnapshot->GetNumLODs() < 2)
 	{
 		UE_LOG(LogPipelineGuardian, VeryVerbose, TEXT("FStaticMeshLODPolyReductionRule: %s has insufficient LODs for reduction analysis"), 
-			*StaticMesh->GetName());
+			*MeshSnapshot->AssetName);
 		return false; // Need at least 2 LODs to check reduction
 	}
 
-	int32 LODCount = StaticMesh->GetRenderData()->LODResources.Num();
+	int32 LODCount = MeshSnapshot->GetNumLODs();
 	bool bFoundIssues = false;
 
 	// Enhanced debugging: Log all LOD triangle counts first
 	UE_LOG(LogPipelineGuardian, Log, TEXT("FStaticMeshLODPolyReductionRule: Analyzing %s with %d LODs"), 
-		*StaticMesh->GetName(), LODCount);
+		*MeshSnapshot->AssetName, LODCount);
 	
 	for (int32 i = 0; i < LODCount; ++i)
 	{
-		int32 TriangleCount = GetLODTriangleCount(StaticMesh, i);
+		int32 TriangleCount = MeshSnapshot->GetNumTriangles(i);
 		UE_LOG(LogPipelineGuardian, Log, TEXT("FStaticMeshLODPolyReductionRule: %s LOD%d has %d triangles"), 
-			*StaticMesh->GetName(), i, TriangleCount);
+			*MeshSnapshot->AssetName, i, TriangleCount);
 	}
 
 	// Collect all problematic LODs for a comprehensive fix
@@ -75,17 +90,17 @@ bool FStaticMeshLODPolyReductionRule::Check(UObject* Asset, const UPipelineGuard
 	// Check reduction between each consecutive LOD pair
 	for (int32 LODIndex = 1; LODIndex < LODCount; ++LODIndex)
 	{
-		int32 PreviousLODTriangles = GetLODTriangleCount(StaticMesh, LODIndex - 1);
-		int32 CurrentLODTriangles = GetLODTriangleCount(StaticMesh, LODIndex);
+		int32 PreviousLODTriangles = MeshSnapshot->GetNumTriangles(LODIndex - 1);
+		int32 CurrentLODTriangles = MeshSnapshot->GetNumTriangles(LODIndex);
 		
 		// Debug logging to understand the triangle counts
 		UE_LOG(LogPipelineGuardian, Log, TEXT("FStaticMeshLODPolyReductionRule: %s LOD%d: %d triangles → LOD%d: %d triangles"), 
-			*StaticMesh->GetName(), LODIndex - 1, PreviousLODTriangles, LODIndex, CurrentLODTriangles);
+			*MeshSnapshot->AssetName, LODIndex - 1, PreviousLODTriangles, LODIndex, CurrentLODTriangles);
 		
 		if (PreviousLODTriangles == 0 || CurrentLODTriangles == 0)
 		{
 			UE_LOG(LogPipelineGuardian, Warning, TEXT("FStaticMeshLODPolyReductionRule: %s has LOD with zero triangles (LOD%d: %d, LOD%d: %d) - SKIPPING"), 
-				*StaticMesh->GetName(), LODIndex - 1, PreviousLODTriangles, LODIndex, CurrentLODTriangles);
+				*MeshSnapshot->AssetName, LODIndex - 1, PreviousLODTriangles, LODIndex, CurrentLODTriangles);
 			continue;
 		}
 
@@ -93,13 +108,13 @@ bool FStaticMeshLODPolyReductionRule::Check(UObject* Asset, const UPipelineGuard
 		
 		// Debug logging for reduction calculation
 		UE_LOG(LogPipelineGuardian, Log, TEXT("FStaticMeshLODPolyReductionRule: %s LOD%d→LOD%d reduction: %.2f%% (Min required: %.2f%%)"), 
-			*StaticMesh->GetName(), LODIndex - 1, LODIndex, ReductionPercentage, MinReductionPercentage);
+			*MeshSnapshot->AssetName, LODIndex - 1, LODIndex, ReductionPercentage, MinReductionPercentage);
 		
 		// Check if reduction is insufficient
 		if (ReductionPercentage < MinReductionPercentage)
 		{
 			UE_LOG(LogPipelineGuardian, Warning, TEXT("FStaticMeshLODPolyReductionRule: ISSUE DETECTED - %s LOD%d→LOD%d has insufficient reduction (%.2f%% < %.2f%%)"), 
-				*StaticMesh->GetName(), LODIndex - 1, LODIndex, ReductionPercentage, MinReductionPercentage);
+				*MeshSnapshot->AssetName, LODIndex - 1, LODIndex, ReductionPercentage, MinReductionPercentage);
 				
 			// Add to problematic LODs list
 			ProblematicLODs.AddUnique(LODIndex);
@@ -135,7 +150,7 @@ bool FStaticMeshLODPolyReductionRule::Check(UObject* Asset, const UPipelineGuard
 		else
 		{
 			UE_LOG(LogPipelineGuardian, Log, TEXT("FStaticMeshLODPolyReductionRule: %s LOD%d→LOD%d has SUFFICIENT reduction (%.1f%% >= %.1f%%)"), 
-				*StaticMesh->GetName(), LODIndex - 1, LODIndex, ReductionPercentage, MinReductionPercentage);
+				*MeshSnapshot->AssetName, LODIndex - 1, LODIndex, ReductionPercentage, MinReductionPercentage);
 		}
 	}
 
@@ -143,37 +158,38 @@ bool FStaticMeshLODPolyReductionRule::Check(UObject* Asset, const UPipelineGuard
 	if (bFoundIssues && ProblematicLODs.Num() > 0)
 	{
 		FAssetAnalysisResult Result;
-		Result.Asset = FAssetData(StaticMesh);
+		Result.Asset = MeshSnapshot->AssetData;
 		Result.Severity = WorstSeverity;
 		Result.RuleID = GetRuleID();
 		
 		// Create comprehensive description
 		Result.Description = FText::Format(
 			LOCTEXT("StaticMeshLODPolyReductionComprehensive", "Static Mesh '{0}' has insufficient polygon reduction in {1} LOD level(s): {2}. Required: {3}% reduction between consecutive LODs."),
-			FText::FromString(StaticMesh->GetName()),
+			FText::FromString(MeshSnapshot->AssetName),
 			FText::AsNumber(ProblematicLODs.Num()),
 			FText::FromString(IssueDescription),
 			FText::AsNumber(FMath::RoundToInt(MinReductionPercentage))
 		);
-		Result.FilePath = FText::FromString(StaticMesh->GetPackage()->GetName());
+		Result.FilePath = FText::FromString(MeshSnapshot->PackageName);
 		
 		// Create comprehensive fix action that handles all problematic LODs
-		if (CanFixLODReduction(StaticMesh))
+		if (CanFixLODReduction(*MeshSnapshot))
 		{
-			Result.FixAction.BindLambda([StaticMesh, ProblematicLODs, MinReductionPercentage]()
+			TSoftObjectPtr<UStaticMesh> SoftStaticMesh(MeshSnapshot->AssetData.GetSoftObjectPath());
+			Result.FixAction.BindLambda([SoftStaticMesh, ProblematicLODs, MinReductionPercentage]()
 			{
-				FixAllLODReductions(StaticMesh, ProblematicLODs, MinReductionPercentage);
+				FixAllLODReductions(SoftStaticMesh.LoadSynchronous(), ProblematicLODs, MinReductionPercentage);
 			});
 		}
 		
 		OutResults.Add(Result);
 		
 		UE_LOG(LogPipelineGuardian, Log, TEXT("FStaticMeshLODPolyReductionRule: Added comprehensive issue for %s covering %d problematic LODs"), 
-			*StaticMesh->GetName(), ProblematicLODs.Num());
+			*MeshSnapshot->AssetName, ProblematicLODs.Num());
 	}
 
 	UE_LOG(LogPipelineGuardian, Log, TEXT("FStaticMeshLODPolyReductionRule: Analysis complete for %s - Found issues: %s"), 
-		*StaticMesh->GetName(), bFoundIssues ? TEXT("YES") : TEXT("NO"));
+		*MeshSnapshot->AssetName, bFoundIssues ? TEXT("YES") : TEXT("NO"));
 
 	return bFoundIssues;
 }
@@ -188,20 +204,9 @@ FText FStaticMeshLODPolyReductionRule::GetRuleDescription() const
 	return LOCTEXT("StaticMeshLODPolyReductionRuleDescription", "Validates that Static Mesh LOD levels have sufficient polygon reduction between consecutive levels for optimal performance.");
 }
 
-int32 FStaticMeshLODPolyReductionRule::GetLODTriangleCount(UStaticMesh* StaticMesh, int32 LODIndex) const
+bool FStaticMeshLODPolyReductionRule::IsEnabled(const UPipelineGuardianProfile* Profile) const
 {
-	if (!StaticMesh || !StaticMesh->GetRenderData())
-	{
-		return 0;
-	}
-	
-	const FStaticMeshLODResourcesArray& LODResources = StaticMesh->GetRenderData()->LODResources;
-	if (!LODResources.IsValidIndex(LODIndex))
-	{
-		return 0;
-	}
-	
-	return LODResources[LODIndex].GetNumTriangles();
+	return Profile && Profile->IsRuleEnabled(GetRuleID());
 }
 
 float FStaticMeshLODPolyReductionRule::CalculateReductionPercentage(int32 HigherLODTriangles, int32 LowerLODTriangles) const
@@ -216,31 +221,10 @@ float FStaticMeshLODPolyReductionRule::CalculateReductionPercentage(int32 Higher
 	return ReductionRatio * 100.0f;
 }
 
-bool FStaticMeshLODPolyReductionRule::CanFixLODReduction(UStaticMesh* StaticMesh) const
+bool FStaticMeshLODPolyReductionRule::CanFixLODReduction(const FStaticMeshAnalysisSnapshot& MeshSnapshot) const
 {
-	if (!StaticMesh)
-	{
-		return false;
-	}
-	
-	// Check if mesh has valid geometry
-	if (!StaticMesh->GetRenderData() || StaticMesh->GetRenderData()->LODResources.Num() == 0)
-	{
-		return false;
-	}
-	
-	// Check if base LOD has vertices
-	const FStaticMeshLODResources& BaseLOD = StaticMesh->GetRenderData()->LODResources[0];
-	if (BaseLOD.GetNumVertices() == 0)
-	{
-		return false;
-	}
-	
-	// Check if mesh reduction is available
-	IMeshReductionManagerModule& MeshReductionModule = FModuleManager::Get().LoadModuleChecked<IMeshReductionManagerModule>("MeshReductionInterface");
-	IMeshReduction* MeshReduction = MeshReductionModule.GetStaticMeshReductionInterface();
-	
-	return MeshReduction != nullptr;
+	// Check if mesh has valid geometry and the base LOD has vertices
+	return MeshSnapshot.GetNumVertices(0) > 0;
 }
 
 EAssetIssueSeverity FStaticMeshLODPolyReductionRule::GetSeverityForReduction(float ActualReduction, float MinReduction, float WarningThreshold, float ErrorThreshold) const
@@ -355,6 +339,13 @@ void FStaticMeshLODPolyReductionRule::FixLODReduction(UStaticMesh* StaticMesh, i
 	// Mark package as dirty
 	StaticMesh->MarkPackageDirty();
 	
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	// Place the switches from the measured deviation of the new LODs instead of keeping the configured screen sizes
+	if (Settings && Settings->bCalibrateGeneratedLODScreenSizes)
+	{
+		FStaticMeshLODGeometricErrorRule::CalibrateScreenSizes(StaticMesh, Settings->LODPixelErrorBudget, Settings->LODReferenceScreenHeight);
+	}
+	
 	// Verify the fix worked by checking the NEW triangle counts
 	int32 NewTriangleCount = StaticMesh->GetRenderData()->LODResources[ProblematicLODIndex].GetNumTriangles();
 	float ActualReductionFromPrevious = ((float)(PreviousLODTriangles - NewTriangleCount) / (float)PreviousLODTriangles) * 100.0f;
@@ -497,6 +488,13 @@ void FStaticMeshLODPolyReductionRule::FixAllLODReductions(UStaticMesh* StaticMes
 	// Mark package as dirty
 	StaticMesh->MarkPackageDirty();
 	
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	// Place the switches from the measured deviation of the new LODs instead of keeping the configured screen sizes
+	if (Settings && Settings->bCalibrateGeneratedLODScreenSizes)
+	{
+		FStaticMeshLODGeometricErrorRule::CalibrateScreenSizes(StaticMesh, Settings->LODPixelErrorBudget, Settings->LODReferenceScreenHeight);
+	}
+	
 	// Verify the fix worked by checking ALL LOD triangle counts
 	TArray<int32> NewTriangleCounts;
 	TArray<float> ActualReductions;
@@ -9,6 +9,7 @@
 class UStaticMesh;
 class UPipelineGuardianProfile;
 struct FAssetAnalysisResult;
+struct FStaticMeshAnalysisSnapshot;
 enum class EAssetIssueSeverity : uint8;
 
 /**
@@ -25,11 +26,11 @@ public:
 	virtual bool Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
 	virtual FName GetRuleID() const override;
 	virtual FText GetRuleDescription() const override;
+	virtual bool IsEnabled(const UPipelineGuardianProfile* Profile) const override;
+	virtual bool SupportsSnapshot() const override { return true; }
+	virtual bool CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
 
 private:
-	/** Get the triangle count for a specific LOD level */
-	int32 GetLODTriangleCount(UStaticMesh* StaticMesh, int32 LODIndex) const;
-	
 	/** Calculate the reduction percentage between two LOD levels */
 	float CalculateReductionPercentage(int32 HigherLODTriangles, int32 LowerLODTriangles) const;
 	
@@ -39,8 +40,8 @@ private:
 	/** Fix all problematic LODs in one comprehensive operation */
 	static void FixAllLODReductions(UStaticMesh* StaticMesh, const TArray<int32>& ProblematicLODs, float TargetReductionPercentage);
 	
-	/** Check if LOD reduction can be fixed for this mesh */
-	bool CanFixLODReduction(UStaticMesh* StaticMesh) const;
+	/** Check if the mesh has geometry to regenerate LODs from. Reduction interface availability is checked when the fix runs. */
+	bool CanFixLODReduction(const FStaticMeshAnalysisSnapshot& MeshSnapshot) const;
 	
 	/** Get severity level based on reduction percentage deficit */
 	EAssetIssueSeverity GetSeverityForReduction(float ActualReduction, float MinReduction, float WarningThreshold, float ErrorThreshold) const;
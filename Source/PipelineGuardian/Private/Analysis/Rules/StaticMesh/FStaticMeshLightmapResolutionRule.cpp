@@ -1,5 +1,7 @@
 #include "FStaticMeshLightmapResolutionRule.h"
 #include "Analysis/FAssetAnalysisResult.h"
+#include "Analysis/Snapshots/FStaticMeshAnalysisSnapshot.h"
+#include "Analysis/Geometry/FLightmapEfficiencyEstimator.h"
 #include "FPipelineGuardianSettings.h"
 #include "PipelineGuardian.h"
 #include "Engine/StaticMesh.h"
@@ -7,6 +9,18 @@
 #include "StaticMeshResources.h"
 #include "Misc/MessageDialog.h"
 
+namespace LightmapResolutionRule
+{
+	/** Largest exponent the Min/Max resolution settings may use: 2^12 = 4096 */
+	constexpr int32 MaxResolutionExponent = 12;
+
+	/** @return The resolution a LightmapResolutionMin/Max setting stands for. */
+	int32 ResolutionFromExponent(int32 Exponent)
+	{
+		return 1 << FMath::Clamp(Exponent, 0, MaxResolutionExponent);
+	}
+}
+
 FStaticMeshLightmapResolutionRule::FStaticMeshLightmapResolutionRule()
 {
 }
@@ -19,6 +33,17 @@ bool FStaticMeshLightmapResolutionRule::Check(UObject* Asset, const UPipelineGua
 		return false;
 	}
 
+	return CheckSnapshot(*FStaticMeshAnalysisSnapshot::Create(FAssetData(StaticMesh), StaticMesh), Profile, OutResults);
+}
+
+bool FStaticMeshLightmapResolutionRule::CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	const FStaticMeshAnalysisSnapshot* MeshSnapshot = FStaticMeshAnalysisSnapshot::FromSnapshot(Snapshot);
+	if (!MeshSnapshot)
+	{
+		return false;
+	}
+
 	// Get settings
 	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
 	if (!Settings || !Settings->bEnableStaticMeshLightmapResolutionRule)
@@ -26,39 +51,54 @@ bool FStaticMeshLightmapResolutionRule::Check(UObject* Asset, const UPipelineGua
 		return false;
 	}
 
-	// Check lightmap resolution
-	int32 CurrentResolution = 0;
-	bool HasInappropriateResolution = HasInappropriateLightmapResolution(StaticMesh, Settings->LightmapResolutionMin, Settings->LightmapResolutionMax, CurrentResolution);
+	const int32 MinResolution = LightmapResolutionRule::ResolutionFromExponent(Settings->LightmapResolutionMin);
+	const int32 MaxResolution = LightmapResolutionRule::ResolutionFromExponent(Settings->LightmapResolutionMax);
 
-	if (HasInappropriateResolution)
+	// Measure the lightmap UV layout; the resolution it needs replaces the triangle count heuristic when available
+	FLightmapEfficiencyStats EfficiencyStats;
+	const bool bHasLayout = AnalyzeLightmapEfficiency(*MeshSnapshot, EfficiencyStats);
+	int32 RecommendedResolution = bHasLayout ? EfficiencyStats.GetResolutionForTexelDensity(Settings->LightmapTargetTexelDensity) : 0;
+	if (RecommendedResolution > 0)
 	{
-		FAssetAnalysisResult Result;
-		Result.Asset = FAssetData(StaticMesh);
-		Result.RuleID = GetRuleID();
-		Result.Severity = Settings->LightmapResolutionIssueSeverity;
-		Result.Description = FText::FromString(GenerateLightmapResolutionDescription(StaticMesh, CurrentResolution, Settings->LightmapResolutionMin, Settings->LightmapResolutionMax));
+		RecommendedResolution = FMath::Clamp(RecommendedResolution, MinResolution, MaxResolution);
+	}
 
-		// Add fix action if auto-fix is enabled
-		if (Settings->bAllowLightmapResolutionAutoFix && CanSafelySetLightmapResolution(StaticMesh))
-		{
-			Result.FixAction = FSimpleDelegate::CreateLambda([this, StaticMesh, Settings]()
-			{
-				if (SetOptimalLightmapResolution(StaticMesh, Settings->LightmapResolutionMin, Settings->LightmapResolutionMax))
-				{
-					UE_LOG(LogPipelineGuardian, Log, TEXT("Successfully set optimal lightmap resolution for %s"), *StaticMesh->GetName());
-				}
-				else
-				{
-					UE_LOG(LogPipelineGuardian, Warning, TEXT("Failed to set lightmap resolution for %s"), *StaticMesh->GetName());
-				}
-			});
-		}
-
-		OutResults.Add(Result);
+	// Check lightmap resolution
+	if (HasInappropriateLightmapResolution(MeshSnapshot->LightMapResolution, MinResolution, MaxResolution))
+	{
+		const int32 FixResolution = RecommendedResolution > 0 ? RecommendedResolution : CalculateOptimalLightmapResolution(*MeshSnapshot, MinResolution, MaxResolution);
+		AddResult(*MeshSnapshot, GenerateLightmapResolutionDescription(*MeshSnapshot, MinResolution, MaxResolution), FixResolution, OutResults);
 		return true;
 	}
 
-	return false;
+	if (!bHasLayout)
+	{
+		return false;
+	}
+
+	bool bFoundIssue = false;
+
+	// Resolution far from what the target texel density calls for, in either direction
+	const float Tolerance = FMath::Max(Settings->LightmapDensityTolerance, 1.0f);
+	if (RecommendedResolution > 0
+		&& (MeshSnapshot->LightMapResolution > RecommendedResolution * Tolerance || MeshSnapshot->LightMapResolution * Tolerance < RecommendedResolution))
+	{
+		AddResult(*MeshSnapshot, GenerateLightmapDensityDescription(*MeshSnapshot, EfficiencyStats, Settings->LightmapTargetTexelDensity, RecommendedResolution), RecommendedResolution, OutResults);
+		bFoundIssue = true;
+	}
+
+	// Charts that leave most of the lightmap empty waste baked texels at any resolution; they need repacking, not a new resolution
+	if (EfficiencyStats.GetUtilization() * 100.0f < Settings->LightmapMinUtilization)
+	{
+		AddResult(*MeshSnapshot, GenerateLightmapUtilizationDescription(*MeshSnapshot, EfficiencyStats), 0, OutResults);
+		bFoundIssue = true;
+	}
+
+	UE_LOG(LogPipelineGuardian, Verbose, TEXT("%s lightmap: %dx%d, chart area %.1f%%, %.1f%% of texels used, %lld wasted, %.3f texels/unit, %d recommended"),
+		*MeshSnapshot->AssetName, EfficiencyStats.Resolution, EfficiencyStats.Resolution, EfficiencyStats.GetChartAreaFraction() * 100.0f,
+		EfficiencyStats.GetUtilization() * 100.0f, EfficiencyStats.GetNumWastedTexels(), EfficiencyStats.GetTexelDensity(), RecommendedResolution);
+
+	return bFoundIssue;
 }
 
 FName FStaticMeshLightmapResolutionRule::GetRuleID() const
@@ -68,41 +108,113 @@ FName FStaticMeshLightmapResolutionRule::GetRuleID() const
 
 FText FStaticMeshLightmapResolutionRule::GetRuleDescription() const
 {
-	return FText::FromString(TEXT("Checks if static meshes have appropriate lightmap resolution settings for optimal lighting quality and performance."));
+	return FText::FromString(TEXT("Checks if static meshes have appropriate lightmap resolution settings for optimal lighting quality and performance, based on their lightmap UV layout and the target texel density."));
 }
 
-bool FStaticMeshLightmapResolutionRule::HasInappropriateLightmapResolution(const UStaticMesh* StaticMesh, int32 MinResolution, int32 MaxResolution, int32& OutCurrentResolution) const
+bool FStaticMeshLightmapResolutionRule::IsEnabled(const UPipelineGuardianProfile* Profile) const
 {
-	if (!StaticMesh)
-	{
-		return false;
-	}
-
-	// Get current lightmap resolution
-	int32 CurrentResolution = StaticMesh->GetLightMapResolution();
-	OutCurrentResolution = CurrentResolution;
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	return Settings && Settings->bEnableStaticMeshLightmapResolutionRule;
+}
 
+bool FStaticMeshLightmapResolutionRule::HasInappropriateLightmapResolution(int32 CurrentResolution, int32 MinResolution, int32 MaxResolution) const
+{
 	// Check if resolution is outside the acceptable range
 	return CurrentResolution < MinResolution || CurrentResolution > MaxResolution;
 }
 
-FString FStaticMeshLightmapResolutionRule::GenerateLightmapResolutionDescription(const UStaticMesh* StaticMesh, int32 CurrentResolution, int32 MinResolution, int32 MaxResolution) const
+FString FStaticMeshLightmapResolutionRule::GenerateLightmapResolutionDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 MinResolution, int32 MaxResolution) const
 {
+	const int32 CurrentResolution = MeshSnapshot.LightMapResolution;
 	if (CurrentResolution < MinResolution)
 	{
-		return FString::Printf(TEXT("Static mesh %s has low lightmap resolution (%d < %d minimum). This may result in poor lighting quality."), 
-			*StaticMesh->GetName(), CurrentResolution, MinResolution);
+		return FString::Printf(TEXT("Static mesh %s has low lightmap resolution (%d < %d minimum). This may result in poor lighting quality."),
+			*MeshSnapshot.AssetName, CurrentResolution, MinResolution);
 	}
 	else if (CurrentResolution > MaxResolution)
 	{
-		return FString::Printf(TEXT("Static mesh %s has high lightmap resolution (%d > %d maximum). This may impact performance unnecessarily."), 
-			*StaticMesh->GetName(), CurrentResolution, MaxResolution);
+		return FString::Printf(TEXT("Static mesh %s has high lightmap resolution (%d > %d maximum). This may impact performance unnecessarily."),
+			*MeshSnapshot.AssetName, CurrentResolution, MaxResolution);
+	}
+
+	return FString::Printf(TEXT("Lightmap resolution check failed for %s"), *MeshSnapshot.AssetName);
+}
+
+bool FStaticMeshLightmapResolutionRule::AnalyzeLightmapEfficiency(const FStaticMeshAnalysisSnapshot& MeshSnapshot, FLightmapEfficiencyStats& OutStats) const
+{
+	if (MeshSnapshot.GetNumLODs() == 0 || MeshSnapshot.LightMapResolution <= 0)
+	{
+		return false;
+	}
+
+	const FStaticMeshLODSnapshot& LODSnapshot = MeshSnapshot.LODs[0];
+	if (!LODSnapshot.UVChannels.IsValidIndex(MeshSnapshot.LightMapCoordinateIndex))
+	{
+		return false;
+	}
+
+	OutStats = FLightmapEfficiencyEstimator::Estimate(LODSnapshot.Positions, LODSnapshot.UVChannels[MeshSnapshot.LightMapCoordinateIndex], LODSnapshot.Indices, MeshSnapshot.LightMapResolution);
+	return OutStats.UVArea > 0.0 && OutStats.WorldArea > 0.0;
+}
+
+FString FStaticMeshLightmapResolutionRule::GenerateLightmapDensityDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, const FLightmapEfficiencyStats& Stats, float TargetTexelDensity, int32 RecommendedResolution) const
+{
+	const int64 CurrentTexels = Stats.Coverage.GetNumTexels();
+	const int64 RecommendedTexels = static_cast<int64>(RecommendedResolution) * RecommendedResolution;
+	if (RecommendedResolution < MeshSnapshot.LightMapResolution)
+	{
+		return FString::Printf(TEXT("Static mesh %s has a lightmap resolution of %d, giving %.3f texels per unit. Its lightmap UV layout reaches the target density of %.3f at %d, which would save %lld baked texels."),
+			*MeshSnapshot.AssetName, MeshSnapshot.LightMapResolution, Stats.GetTexelDensity(), TargetTexelDensity, RecommendedResolution, CurrentTexels - RecommendedTexels);
+	}
+
+	return FString::Printf(TEXT("Static mesh %s has a lightmap resolution of %d, giving only %.3f texels per unit. Its lightmap UV layout needs %d to reach the target density of %.3f (%lld more baked texels)."),
+		*MeshSnapshot.AssetName, MeshSnapshot.LightMapResolution, Stats.GetTexelDensity(), RecommendedResolution, TargetTexelDensity, RecommendedTexels - CurrentTexels);
+}
+
+FString FStaticMeshLightmapResolutionRule::GenerateLightmapUtilizationDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, const FLightmapEfficiencyStats& Stats) const
+{
+	return FString::Printf(TEXT("Static mesh %s uses only %.1f%% of its %dx%d lightmap: charts cover %.1f%% of the UV space, %lld of %lld texels are wasted (%lld of them as padding). Repack the lightmap UVs or enable Generate Lightmap UVs."),
+		*MeshSnapshot.AssetName, Stats.GetUtilization() * 100.0f, Stats.Resolution, Stats.Resolution, Stats.GetChartAreaFraction() * 100.0f,
+		Stats.GetNumWastedTexels(), Stats.Coverage.GetNumTexels(), Stats.Coverage.NumPaddingTexels);
+}
+
+void FStaticMeshLightmapResolutionRule::AddResult(const FStaticMeshAnalysisSnapshot& MeshSnapshot, const FString& Description, int32 FixResolution, TArray<FAssetAnalysisResult>& OutResults) const
+{
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+
+	FAssetAnalysisResult Result;
+	Result.Asset = MeshSnapshot.AssetData;
+	Result.RuleID = GetRuleID();
+	Result.Severity = Settings->LightmapResolutionIssueSeverity;
+	Result.Description = FText::FromString(Description);
+
+	// Add fix action if auto-fix is enabled
+	if (FixResolution > 0 && Settings->bAllowLightmapResolutionAutoFix && CanSafelySetLightmapResolution(MeshSnapshot))
+	{
+		TSoftObjectPtr<UStaticMesh> SoftStaticMesh(MeshSnapshot.AssetData.GetSoftObjectPath());
+		Result.FixAction = FSimpleDelegate::CreateLambda([this, SoftStaticMesh, FixResolution]()
+		{
+			UStaticMesh* FixStaticMesh = SoftStaticMesh.LoadSynchronous();
+			if (!FixStaticMesh)
+			{
+				return;
+			}
+
+			if (SetOptimalLightmapResolution(FixStaticMesh, FixResolution))
+			{
+				UE_LOG(LogPipelineGuardian, Log, TEXT("Successfully set optimal lightmap resolution for %s"), *FixStaticMesh->GetName());
+			}
+			else
+			{
+				UE_LOG(LogPipelineGuardian, Warning, TEXT("Failed to set lightmap resolution for %s"), *FixStaticMesh->GetName());
+			}
+		});
 	}
 
-	return FString::Printf(TEXT("Lightmap resolution check failed for %s"), *StaticMesh->GetName());
+	OutResults.Add(Result);
 }
 
-bool FStaticMeshLightmapResolutionRule::SetOptimalLightmapResolution(UStaticMesh* StaticMesh, int32 MinResolution, int32 MaxResolution) const
+bool FStaticMeshLightmapResolutionRule::SetOptimalLightmapResolution(UStaticMesh* StaticMesh, int32 OptimalResolution) const
 {
 	if (!StaticMesh)
 	{
@@ -111,9 +223,6 @@ bool FStaticMeshLightmapResolutionRule::SetOptimalLightmapResolution(UStaticMesh
 
 	UE_LOG(LogPipelineGuardian, Log, TEXT("Setting optimal lightmap resolution for %s"), *StaticMesh->GetName());
 
-	// Calculate optimal resolution based on mesh complexity
-	int32 OptimalResolution = CalculateOptimalLightmapResolution(StaticMesh, MinResolution, MaxResolution);
-
 	// Set the lightmap resolution
 	StaticMesh->SetLightMapResolution(OptimalResolution);
 
@@ -126,46 +235,40 @@ bool FStaticMeshLightmapResolutionRule::SetOptimalLightmapResolution(UStaticMesh
 	return true;
 }
 
-bool FStaticMeshLightmapResolutionRule::CanSafelySetLightmapResolution(const UStaticMesh* StaticMesh) const
+bool FStaticMeshLightmapResolutionRule::CanSafelySetLightmapResolution(const FStaticMeshAnalysisSnapshot& MeshSnapshot) const
 {
-	if (!StaticMesh)
-	{
-		return false;
-	}
-
 	// Check if mesh has valid geometry
-	if (!StaticMesh->GetRenderData() || StaticMesh->GetRenderData()->LODResources.Num() == 0)
+	if (MeshSnapshot.GetNumLODs() == 0)
 	{
-		UE_LOG(LogPipelineGuardian, Warning, TEXT("Cannot set lightmap resolution for %s: No valid geometry"), *StaticMesh->GetName());
+		UE_LOG(LogPipelineGuardian, Warning, TEXT("Cannot set lightmap resolution for %s: No valid geometry"), *MeshSnapshot.AssetName);
 		return false;
 	}
 
 	// Check if mesh is not too complex for lightmap resolution adjustment
-	const FStaticMeshLODResources* LODResource = &StaticMesh->GetRenderData()->LODResources[0];
-	int32 TriangleCount = LODResource->GetNumTriangles();
-	
+	int32 TriangleCount = MeshSnapshot.GetNumTriangles();
+
 	// Don't auto-adjust for extremely complex meshes (more than 1M triangles)
 	if (TriangleCount > PipelineGuardianConstants::MAX_TRIANGLE_COUNT_FOR_LIGHTMAP_RESOLUTION)
 	{
-		UE_LOG(LogPipelineGuardian, Warning, TEXT("Cannot auto-adjust lightmap resolution for %s: Too complex (%d triangles)"), 
-			*StaticMesh->GetName(), TriangleCount);
+		UE_LOG(LogPipelineGuardian, Warning, TEXT("Cannot auto-adjust lightmap resolution for %s: Too complex (%d triangles)"),
+			*MeshSnapshot.AssetName, TriangleCount);
 		return false;
 	}
 
 	return true;
 }
 
-int32 FStaticMeshLightmapResolutionRule::CalculateOptimalLightmapResolution(const UStaticMesh* StaticMesh, int32 MinResolution, int32 MaxResolution) const
+int32 FStaticMeshLightmapResolutionRule::CalculateOptimalLightmapResolution(const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 MinResolution, int32 MaxResolution) const
 {
-	if (!StaticMesh || !StaticMesh->GetRenderData() || StaticMesh->GetRenderData()->LODResources.Num() == 0)
+	// Fallback for meshes without a usable lightmap UV layout
+	if (MeshSnapshot.GetNumLODs() == 0)
 	{
 		return MinResolution;
 	}
 
 	// Get mesh complexity metrics
-	const FStaticMeshLODResources* LODResource = &StaticMesh->GetRenderData()->LODResources[0];
-	int32 TriangleCount = LODResource->GetNumTriangles();
-	FVector BoundsSize = StaticMesh->GetBoundingBox().GetSize();
+	int32 TriangleCount = MeshSnapshot.GetNumTriangles();
+	FVector BoundsSize = MeshSnapshot.BoundingBox.GetSize();
 	float SurfaceArea = BoundsSize.X * BoundsSize.Y * 2.0f + BoundsSize.Y * BoundsSize.Z * 2.0f + BoundsSize.Z * BoundsSize.X * 2.0f;
 
 	// Calculate optimal resolution based on complexity
@@ -174,27 +277,27 @@ int32 FStaticMeshLightmapResolutionRule::CalculateOptimalLightmapResolution(cons
 	// Adjust based on triangle count
 	if (TriangleCount > 10000)
 	{
-		OptimalResolution = FMath::Max(OptimalResolution, 8);  // 256x256
+		OptimalResolution = FMath::Max(OptimalResolution, 256);
 	}
 	if (TriangleCount > 50000)
 	{
-		OptimalResolution = FMath::Max(OptimalResolution, 10); // 1024x1024
+		OptimalResolution = FMath::Max(OptimalResolution, 1024);
 	}
 	if (TriangleCount > 100000)
 	{
-		OptimalResolution = FMath::Max(OptimalResolution, 12); // 4096x4096
+		OptimalResolution = FMath::Max(OptimalResolution, 4096);
 	}
 
 	// Adjust based on surface area
 	if (SurfaceArea > 10000.0f)
 	{
-		OptimalResolution = FMath::Max(OptimalResolution, 8);
+		OptimalResolution = FMath::Max(OptimalResolution, 256);
 	}
 	if (SurfaceArea > 100000.0f)
 	{
-		OptimalResolution = FMath::Max(OptimalResolution, 10);
+		OptimalResolution = FMath::Max(OptimalResolution, 1024);
 	}
 
 	// Clamp to valid range
 	return FMath::Clamp(OptimalResolution, MinResolution, MaxResolution);
-} 
\ No newline at end of file
+}
\ No newline at end of file
@@ -4,20 +4,44 @@
 #include "Analysis/IAssetCheckRule.h"
 #include "Engine/StaticMesh.h"
 
+// Forward Declarations
+struct FStaticMeshAnalysisSnapshot;
+struct FLightmapEfficiencyStats;
+
+/**
+ * Checks lightmap resolution against the configured range and against the mesh's lightmap UV layout:
+ * the resolution the layout needs for the target texel density, and how much of the lightmap the charts use.
+ */
 class FStaticMeshLightmapResolutionRule : public IAssetCheckRule
 {
 public:
 	FStaticMeshLightmapResolutionRule();
 	virtual ~FStaticMeshLightmapResolutionRule() = default;
-	
+
 	virtual bool Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
 	virtual FName GetRuleID() const override;
 	virtual FText GetRuleDescription() const override;
+	virtual bool IsEnabled(const UPipelineGuardianProfile* Profile) const override;
+	virtual bool SupportsSnapshot() const override { return true; }
+	virtual bool CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
 
 private:
-	bool HasInappropriateLightmapResolution(const UStaticMesh* StaticMesh, int32 MinResolution, int32 MaxResolution, int32& OutCurrentResolution) const;
-	FString GenerateLightmapResolutionDescription(const UStaticMesh* StaticMesh, int32 CurrentResolution, int32 MinResolution, int32 MaxResolution) const;
-	bool SetOptimalLightmapResolution(UStaticMesh* StaticMesh, int32 MinResolution, int32 MaxResolution) const;
-	bool CanSafelySetLightmapResolution(const UStaticMesh* StaticMesh) const;
-	int32 CalculateOptimalLightmapResolution(const UStaticMesh* StaticMesh, int32 MinResolution, int32 MaxResolution) const;
-}; 
\ No newline at end of file
+	bool HasInappropriateLightmapResolution(int32 CurrentResolution, int32 MinResolution, int32 MaxResolution) const;
+	FString GenerateLightmapResolutionDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 MinResolution, int32 MaxResolution) const;
+	bool SetOptimalLightmapResolution(UStaticMesh* StaticMesh, int32 OptimalResolution) const;
+	bool CanSafelySetLightmapResolution(const FStaticMeshAnalysisSnapshot& MeshSnapshot) const;
+	int32 CalculateOptimalLightmapResolution(const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 MinResolution, int32 MaxResolution) const;
+
+	/**
+	 * Measures the lightmap UV layout of LOD 0 at the current lightmap resolution.
+	 * @param MeshSnapshot Snapshot of the mesh.
+	 * @param OutStats Chart area, coverage and density of the layout.
+	 * @return False if the mesh has no usable lightmap UV channel.
+	 */
+	bool AnalyzeLightmapEfficiency(const FStaticMeshAnalysisSnapshot& MeshSnapshot, FLightmapEfficiencyStats& OutStats) const;
+	FString GenerateLightmapDensityDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, const FLightmapEfficiencyStats& Stats, float TargetTexelDensity, int32 RecommendedResolution) const;
+	FString GenerateLightmapUtilizationDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, const FLightmapEfficiencyStats& Stats) const;
+
+	/** Adds the result to OutResults, with a fix action that sets the lightmap resolution if auto-fix is allowed */
+	void AddResult(const FStaticMeshAnalysisSnapshot& MeshSnapshot, const FString& Description, int32 FixResolution, TArray<FAssetAnalysisResult>& OutResults) const;
+};
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "FStaticMeshLightmapUVMissingRule.h"
 #include "Analysis/FAssetAnalysisResult.h"
 #include "Analysis/FPipelineGuardianProfile.h"
+#include "Analysis/Snapshots/FStaticMeshAnalysisSnapshot.h"
 #include "FPipelineGuardianSettings.h"
 #include "Engine/StaticMesh.h"
 #include "PipelineGuardian.h"
@@ -25,6 +26,18 @@ bool FStaticMeshLightmapUVMissingRule::Check(UObject* Asset, const UPipelineGuar
 		return false;
 	}
 
+	return CheckSnapshot(*FStaticMeshAnalysisSnapshot::Create(FAssetData(StaticMesh), StaticMesh), Profile, OutResults);
+}
+
+bool FStaticMeshLightmapUVMissingRule::CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	const FStaticMeshAnalysisSnapshot* MeshSnapshot = FStaticMeshAnalysisSnapshot::FromSnapshot(Snapshot);
+	if (!MeshSnapshot)
+	{
+		UE_LOG(LogPipelineGuardian, Warning, TEXT("FStaticMeshLightmapUVMissingRule: Snapshot is not from a UStaticMesh"));
+		return false;
+	}
+
 	if (!Profile)
 	{
 		UE_LOG(LogPipelineGuardian, Warning, TEXT("FStaticMeshLightmapUVMissingRule: No profile provided"));
@@ -73,21 +86,21 @@ bool FStaticMeshLightmapUVMissingRule::Check(UObject* Asset, const UPipelineGuar
 	FText IssueDescription;
 	
 	// First check if bGenerateLightmapUVs is enabled
-	if (StaticMesh->GetSourceModel(0).BuildSettings.bGenerateLightmapUVs)
+	if (MeshSnapshot->SourceModels.Num() > 0 && MeshSnapshot->SourceModels[0].BuildSettings.bGenerateLightmapUVs)
 	{
 		UE_LOG(LogPipelineGuardian, VeryVerbose, TEXT("FStaticMeshLightmapUVMissingRule: %s has bGenerateLightmapUVs enabled"), 
-			*StaticMesh->GetName());
+			*MeshSnapshot->AssetName);
 		
 		// If auto-generation is enabled, we're good
 		return false; // No issues found
 	}
 	
 	// bGenerateLightmapUVs is disabled, so we need to check for manual UV channel
-	int32 LightmapCoordinateIndex = GetLightmapCoordinateIndex(StaticMesh);
-	int32 UVChannelCount = GetUVChannelCount(StaticMesh);
+	int32 LightmapCoordinateIndex = GetLightmapCoordinateIndex(*MeshSnapshot);
+	int32 UVChannelCount = GetUVChannelCount(*MeshSnapshot);
 	
 	UE_LOG(LogPipelineGuardian, Warning, TEXT("FStaticMeshLightmapUVMissingRule DEBUG: %s - LightmapCoordIndex=%d, UVChannelCount=%d, bGenerateLightmapUVs=false"), 
-		*StaticMesh->GetName(), LightmapCoordinateIndex, UVChannelCount);
+		*MeshSnapshot->AssetName, LightmapCoordinateIndex, UVChannelCount);
 	
 	// Check for problematic configurations
 	if (LightmapCoordinateIndex >= UVChannelCount)
@@ -96,7 +109,7 @@ bool FStaticMeshLightmapUVMissingRule::Check(UObject* Asset, const UPipelineGuar
 		bHasLightmapIssue = true;
 		IssueDescription = FText::Format(
 			LOCTEXT("LightmapUVChannelMissing", "Static Mesh '{0}' has bGenerateLightmapUVs disabled but lightmap coordinate index ({1}) points to non-existent UV channel. Available UV channels: {2}"),
-			FText::FromString(StaticMesh->GetName()),
+			FText::FromString(MeshSnapshot->AssetName),
 			FText::AsNumber(LightmapCoordinateIndex),
 			FText::AsNumber(UVChannelCount)
 		);
@@ -107,16 +120,16 @@ bool FStaticMeshLightmapUVMissingRule::Check(UObject* Asset, const UPipelineGuar
 		bHasLightmapIssue = true;
 		IssueDescription = FText::Format(
 			LOCTEXT("LightmapUVUsingChannel0", "Static Mesh '{0}' has bGenerateLightmapUVs disabled and is using UV channel 0 for lightmapping. This can cause lighting artifacts. Consider enabling Generate Lightmap UVs or using a dedicated lightmap UV channel."),
-			FText::FromString(StaticMesh->GetName())
+			FText::FromString(MeshSnapshot->AssetName)
 		);
 	}
-	else if (LightmapCoordinateIndex > 0 && !IsUVChannelValid(StaticMesh, LightmapCoordinateIndex))
+	else if (LightmapCoordinateIndex > 0 && !IsUVChannelValid(*MeshSnapshot, LightmapCoordinateIndex))
 	{
 		// UV channel exists but has invalid UVs
 		bHasLightmapIssue = true;
 		IssueDescription = FText::Format(
 			LOCTEXT("LightmapUVChannelInvalid", "Static Mesh '{0}' has bGenerateLightmapUVs disabled but UV channel {1} (used for lightmapping) contains invalid or all-zero UVs"),
-			FText::FromString(StaticMesh->GetName()),
+			FText::FromString(MeshSnapshot->AssetName),
 			FText::AsNumber(LightmapCoordinateIndex)
 		);
 	}
@@ -124,17 +137,20 @@ bool FStaticMeshLightmapUVMissingRule::Check(UObject* Asset, const UPipelineGuar
 	if (bHasLightmapIssue)
 	{
 		FAssetAnalysisResult Result;
-		Result.Asset = FAssetData(StaticMesh);
+		Result.Asset = MeshSnapshot->AssetData;
 		Result.Severity = ConfiguredSeverity;
 		Result.RuleID = GetRuleID();
 		Result.Description = IssueDescription;
-		Result.FilePath = FText::FromString(StaticMesh->GetPackage()->GetName());
+		Result.FilePath = FText::FromString(MeshSnapshot->PackageName);
 		
 		// Create fix actions if allowed
 		if (bAllowAutoGeneration)
 		{
-			Result.FixAction.BindLambda([StaticMesh, ChannelStrategy, PreferredChannel]()
+			TSoftObjectPtr<UStaticMesh> SoftStaticMesh(MeshSnapshot->AssetData.GetSoftObjectPath());
+			Result.FixAction.BindLambda([SoftStaticMesh, ChannelStrategy, PreferredChannel]()
 			{
+				UStaticMesh* StaticMesh = SoftStaticMesh.LoadSynchronous();
+
 				// Determine the best UV channel to use
 				int32 DestinationChannel = DetermineOptimalLightmapUVChannel(StaticMesh, ChannelStrategy, PreferredChannel);
 				
@@ -146,13 +162,13 @@ bool FStaticMeshLightmapUVMissingRule::Check(UObject* Asset, const UPipelineGuar
 		OutResults.Add(Result);
 		
 		UE_LOG(LogPipelineGuardian, Log, TEXT("FStaticMeshLightmapUVMissingRule: Lightmap UV issue found for %s"), 
-			*StaticMesh->GetName());
+			*MeshSnapshot->AssetName);
 		return true; // Issue found
 	}
 	else
 	{
 		UE_LOG(LogPipelineGuardian, VeryVerbose, TEXT("FStaticMeshLightmapUVMissingRule: %s has proper lightmap UV configuration"), 
-			*StaticMesh->GetName());
+			*MeshSnapshot->AssetName);
 		return false; // No issues found
 	}
 }
@@ -167,68 +183,72 @@ FText FStaticMeshLightmapUVMissingRule::GetRuleDescription() const
 	return LOCTEXT("StaticMeshLightmapUVMissingRuleDescription", "Validates that Static Mesh assets have proper lightmap UV configuration - either bGenerateLightmapUVs enabled or valid UV channel for lightmapping.");
 }
 
-bool FStaticMeshLightmapUVMissingRule::HasValidLightmapUVChannel(UStaticMesh* StaticMesh) const
+bool FStaticMeshLightmapUVMissingRule::IsEnabled(const UPipelineGuardianProfile* Profile) const
 {
-	if (!StaticMesh)
-	{
-		return false;
-	}
-	
-	int32 LightmapCoordinateIndex = GetLightmapCoordinateIndex(StaticMesh);
-	int32 UVChannelCount = GetUVChannelCount(StaticMesh);
+	return Profile && Profile->IsRuleEnabled(GetRuleID());
+}
+
+bool FStaticMeshLightmapUVMissingRule::HasValidLightmapUVChannel(const FStaticMeshAnalysisSnapshot& MeshSnapshot) const
+{
+	int32 LightmapCoordinateIndex = GetLightmapCoordinateIndex(MeshSnapshot);
+	int32 UVChannelCount = GetUVChannelCount(MeshSnapshot);
 	
 	// Check if the lightmap coordinate index is within valid range
 	return LightmapCoordinateIndex < UVChannelCount;
 }
 
-int32 FStaticMeshLightmapUVMissingRule::GetUVChannelCount(UStaticMesh* StaticMesh) const
+int32 FStaticMeshLightmapUVMissingRule::GetUVChannelCount(const FStaticMeshAnalysisSnapshot& MeshSnapshot) const
 {
-	if (!StaticMesh || !StaticMesh->GetRenderData() || StaticMesh->GetRenderData()->LODResources.Num() == 0)
+	if (MeshSnapshot.GetNumLODs() == 0)
 	{
 		return 0;
 	}
 	
-	const FStaticMeshLODResources& LODResource = StaticMesh->GetRenderData()->LODResources[0];
-	return LODResource.GetNumTexCoords();
+	return MeshSnapshot.LODs[0].GetNumTexCoords();
 }
 
-bool FStaticMeshLightmapUVMissingRule::IsUVChannelValid(UStaticMesh* StaticMesh, int32 UVChannelIndex) const
+bool FStaticMeshLightmapUVMissingRule::IsUVChannelValid(const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 UVChannelIndex) const
 {
-	if (!StaticMesh || !StaticMesh->GetRenderData() || StaticMesh->GetRenderData()->LODResources.Num() == 0)
+	if (MeshSnapshot.GetNumLODs() == 0)
 	{
 		return false;
 	}
 	
-	const FStaticMeshLODResources& LODResource = StaticMesh->GetRenderData()->LODResources[0];
+	const FStaticMeshLODSnapshot& LODSnapshot = MeshSnapshot.LODs[0];
 	
 	// Check if UV channel index is valid
-	if (UVChannelIndex >= LODResource.GetNumTexCoords())
+	if (!LODSnapshot.UVChannels.IsValidIndex(UVChannelIndex))
 	{
 		return false;
 	}
 	
 	// Get vertex count
-	int32 NumVertices = LODResource.GetNumVertices();
+	int32 NumVertices = LODSnapshot.GetNumVertices();
 	if (NumVertices == 0)
 	{
 		return false;
 	}
 	
-	// Basic validation - check if UVs exist and are not all zero
-	const FStaticMeshVertexBuffer& VertexBuffer = LODResource.VertexBuffers.StaticMeshVertexBuffer;
-	
-	bool bHasNonZeroUVs = false;
-	for (int32 VertexIndex = 0; VertexIndex < FMath::Min(NumVertices, 100); ++VertexIndex) // Sample first 100 vertices
+	// The channel is usable if any triangle has an area in it; all-zero or collapsed UVs cannot receive lightmap texels
+	const TArray<FVector2f>& UVs = LODSnapshot.UVChannels[UVChannelIndex];
+	const TArray<uint32>& Indices = LODSnapshot.Indices;
+	for (int32 TriangleIndex = 0; TriangleIndex < LODSnapshot.GetNumTriangles(); ++TriangleIndex)
 	{
-		FVector2f UV = VertexBuffer.GetVertexUV(VertexIndex, UVChannelIndex);
-		if (!UV.IsZero())
+		const uint32 Index0 = Indices[TriangleIndex * 3];
+		const uint32 Index1 = Indices[TriangleIndex * 3 + 1];
+		const uint32 Index2 = Indices[TriangleIndex * 3 + 2];
+		if (!UVs.IsValidIndex(Index0) || !UVs.IsValidIndex(Index1) || !UVs.IsValidIndex(Index2))
+		{
+			continue;
+		}
+
+		if (FMath::Abs(FVector2f::CrossProduct(UVs[Index1] - UVs[Index0], UVs[Index2] - UVs[Index0])) > UE_SMALL_NUMBER)
 		{
-			bHasNonZeroUVs = true;
-			break;
+			return true;
 		}
 	}
 	
-	return bHasNonZeroUVs;
+	return false;
 }
 
 void FStaticMeshLightmapUVMissingRule::GenerateLightmapUVs(UStaticMesh* StaticMesh)
@@ -397,22 +417,10 @@ bool FStaticMeshLightmapUVMissingRule::HasValidUVData(UStaticMesh* StaticMesh, i
 	return bHasValidData;
 }
 
-bool FStaticMeshLightmapUVMissingRule::CanGenerateLightmapUVs(UStaticMesh* StaticMesh) const
+bool FStaticMeshLightmapUVMissingRule::CanGenerateLightmapUVs(const FStaticMeshAnalysisSnapshot& MeshSnapshot) const
 {
-	if (!StaticMesh)
-	{
-		return false;
-	}
-	
-	// Check if mesh has valid geometry
-	if (!StaticMesh->GetRenderData() || StaticMesh->GetRenderData()->LODResources.Num() == 0)
-	{
-		return false;
-	}
-	
-	// Check if base LOD has vertices
-	const FStaticMeshLODResources& BaseLOD = StaticMesh->GetRenderData()->LODResources[0];
-	if (BaseLOD.GetNumVertices() == 0)
+	// Check if mesh has valid geometry and the base LOD has vertices
+	if (MeshSnapshot.GetNumVertices(0) == 0)
 	{
 		return false;
 	}
@@ -421,14 +429,9 @@ bool FStaticMeshLightmapUVMissingRule::CanGenerateLightmapUVs(UStaticMesh* Stati
 	return true;
 }
 
-int32 FStaticMeshLightmapUVMissingRule::GetLightmapCoordinateIndex(UStaticMesh* StaticMesh) const
+int32 FStaticMeshLightmapUVMissingRule::GetLightmapCoordinateIndex(const FStaticMeshAnalysisSnapshot& MeshSnapshot) const
 {
-	if (!StaticMesh)
-	{
-		return 1; // Default to UV channel 1
-	}
-	
-	return StaticMesh->GetLightMapCoordinateIndex();
+	return MeshSnapshot.LightMapCoordinateIndex;
 }
 
 #undef LOCTEXT_NAMESPACE 
\ No newline at end of file
@@ -9,6 +9,7 @@
 class UStaticMesh;
 class UPipelineGuardianProfile;
 struct FAssetAnalysisResult;
+struct FStaticMeshAnalysisSnapshot;
 enum class ELightmapUVChannelStrategy : uint8;
 
 /**
@@ -26,16 +27,19 @@ public:
 	virtual bool Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
 	virtual FName GetRuleID() const override;
 	virtual FText GetRuleDescription() const override;
+	virtual bool IsEnabled(const UPipelineGuardianProfile* Profile) const override;
+	virtual bool SupportsSnapshot() const override { return true; }
+	virtual bool CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
 
 private:
 	/** Check if the static mesh has valid UV channel 1 for lightmapping */
-	bool HasValidLightmapUVChannel(UStaticMesh* StaticMesh) const;
+	bool HasValidLightmapUVChannel(const FStaticMeshAnalysisSnapshot& MeshSnapshot) const;
 	
 	/** Get the number of UV channels for LOD 0 */
-	int32 GetUVChannelCount(UStaticMesh* StaticMesh) const;
+	int32 GetUVChannelCount(const FStaticMeshAnalysisSnapshot& MeshSnapshot) const;
 	
 	/** Check if UV channel 1 has valid UVs (not overlapping/degenerate) */
-	bool IsUVChannelValid(UStaticMesh* StaticMesh, int32 UVChannelIndex) const;
+	bool IsUVChannelValid(const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 UVChannelIndex) const;
 	
 	/** Generate lightmap UVs for the static mesh */
 	static void GenerateLightmapUVs(UStaticMesh* StaticMesh);
@@ -53,8 +57,8 @@ private:
 	static bool HasValidUVData(UStaticMesh* StaticMesh, int32 UVChannel);
 	
 	/** Check if lightmap UV generation is possible for this mesh */
-	bool CanGenerateLightmapUVs(UStaticMesh* StaticMesh) const;
+	bool CanGenerateLightmapUVs(const FStaticMeshAnalysisSnapshot& MeshSnapshot) const;
 	
 	/** Get the lightmap coordinate index for the mesh */
-	int32 GetLightmapCoordinateIndex(UStaticMesh* StaticMesh) const;
+	int32 GetLightmapCoordinateIndex(const FStaticMeshAnalysisSnapshot& MeshSnapshot) const;
 }; 
\ No newline at end of file
@@ -74,15 +74,22 @@ bool FStaticMeshMaterialSlotRule::Check(UObject* Asset, const UPipelineGuardianP
 	// We don't want to auto-remove material slots as they might be important
 	if (Settings->bAllowMaterialSlotAutoFix && CanSafelyOptimizeMaterialSlots(StaticMesh) && EmptySlotIndices.Num() > 0)
 	{
-		Result.FixAction = FSimpleDelegate::CreateLambda([this, StaticMesh, EmptySlotIndices]()
+		TSoftObjectPtr<UStaticMesh> SoftStaticMesh(FSoftObjectPath(StaticMesh));
+		Result.FixAction = FSimpleDelegate::CreateLambda([this, SoftStaticMesh, EmptySlotIndices]()
 		{
-			if (OptimizeMaterialSlots(StaticMesh, EmptySlotIndices))
+			UStaticMesh* FixStaticMesh = SoftStaticMesh.LoadSynchronous();
+			if (!FixStaticMesh)
 			{
-				UE_LOG(LogPipelineGuardian, Log, TEXT("Successfully removed empty material slots for %s"), *StaticMesh->GetName());
+				return;
+			}
+
+			if (OptimizeMaterialSlots(FixStaticMesh, EmptySlotIndices))
+			{
+				UE_LOG(LogPipelineGuardian, Log, TEXT("Successfully removed empty material slots for %s"), *FixStaticMesh->GetName());
 			}
 			else
 			{
-				UE_LOG(LogPipelineGuardian, Warning, TEXT("Failed to remove empty material slots for %s"), *StaticMesh->GetName());
+				UE_LOG(LogPipelineGuardian, Warning, TEXT("Failed to remove empty material slots for %s"), *FixStaticMesh->GetName());
 			}
 		});
 	}
@@ -104,6 +111,12 @@ FText FStaticMeshMaterialSlotRule::GetRuleDescription() const
 	return FText::FromString(TEXT("Checks for material slot issues including excessive slot count and empty material slots."));
 }
 
+bool FStaticMeshMaterialSlotRule::IsEnabled(const UPipelineGuardianProfile* Profile) const
+{
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	return Settings && Settings->bEnableStaticMeshMaterialSlotRule;
+}
+
 bool FStaticMeshMaterialSlotRule::HasTooManyMaterialSlots(const UStaticMesh* StaticMesh, int32 WarningThreshold, int32 ErrorThreshold, int32& OutSlotCount) const
 {
 	if (!StaticMesh)
@@ -0,0 +1,138 @@
+#include "FStaticMeshMemoryBudgetRule.h"
+#include "Analysis/FAssetAnalysisResult.h"
+#include "Analysis/Snapshots/FStaticMeshAnalysisSnapshot.h"
+#include "FPipelineGuardianSettings.h"
+#include "PipelineGuardian.h"
+#include "Engine/StaticMesh.h"
+
+FStaticMeshMemoryBudgetRule::FStaticMeshMemoryBudgetRule()
+{
+}
+
+bool FStaticMeshMemoryBudgetRule::Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	UStaticMesh* StaticMesh = Cast<UStaticMesh>(Asset);
+	if (!StaticMesh)
+	{
+		return false;
+	}
+
+	return CheckSnapshot(*FStaticMeshAnalysisSnapshot::Create(FAssetData(StaticMesh), StaticMesh), Profile, OutResults);
+}
+
+bool FStaticMeshMemoryBudgetRule::CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	const FStaticMeshAnalysisSnapshot* MeshSnapshot = FStaticMeshAnalysisSnapshot::FromSnapshot(Snapshot);
+	if (!MeshSnapshot)
+	{
+		return false;
+	}
+
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	if (!Settings || !Settings->bEnableStaticMeshMemoryBudgetRule)
+	{
+		return false;
+	}
+
+	const FStaticMeshMemoryFootprint Footprint = FStaticMeshMemoryEstimator::Estimate(*MeshSnapshot);
+
+	UE_LOG(LogPipelineGuardian, Verbose, TEXT("%s memory: GPU %lld bytes, CPU %lld bytes, streamed %lld bytes"),
+		*MeshSnapshot->AssetName, Footprint.GetTotalGPUBytes(), Footprint.GetTotalCPUBytes(), Footprint.StreamedBytes);
+
+	const int64 GPUBudgetBytes = static_cast<int64>(FMath::Max(Settings->MemoryBudgetGPUKB, 0)) * 1024;
+	const int64 CPUBudgetBytes = static_cast<int64>(FMath::Max(Settings->MemoryBudgetCPUKB, 0)) * 1024;
+	if (Footprint.GetTotalGPUBytes() <= GPUBudgetBytes && Footprint.GetTotalCPUBytes() <= CPUBudgetBytes)
+	{
+		return false;
+	}
+
+	FAssetAnalysisResult Result;
+	Result.Asset = MeshSnapshot->AssetData;
+	Result.RuleID = GetRuleID();
+	Result.Severity = Settings->MemoryBudgetIssueSeverity;
+	Result.Description = FText::FromString(GenerateMemoryDescription(*MeshSnapshot, Footprint, GPUBudgetBytes, CPUBudgetBytes));
+	Result.FilePath = FText::FromString(MeshSnapshot->PackageName);
+	Result.MemoryBytes = Footprint.GetTotalBytes();
+
+	OutResults.Add(Result);
+	return true;
+}
+
+FName FStaticMeshMemoryBudgetRule::GetRuleID() const
+{
+	return TEXT("SM_MemoryBudget");
+}
+
+FText FStaticMeshMemoryBudgetRule::GetRuleDescription() const
+{
+	return FText::FromString(TEXT("Estimates the GPU and CPU memory of each static mesh (vertex and index buffers, distance field, Lumen cards, ray tracing, collision and Nanite) and reports meshes above the memory budgets."));
+}
+
+bool FStaticMeshMemoryBudgetRule::IsEnabled(const UPipelineGuardianProfile* Profile) const
+{
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	return Settings && Settings->bEnableStaticMeshMemoryBudgetRule;
+}
+
+FString FStaticMeshMemoryBudgetRule::GenerateMemoryDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, const FStaticMeshMemoryFootprint& Footprint, int64 GPUBudgetBytes, int64 CPUBudgetBytes) const
+{
+	FString Description = FString::Printf(TEXT("Static mesh %s takes an estimated %s of GPU memory (budget %s) and %s of CPU memory (budget %s):"),
+		*MeshSnapshot.AssetName, *FText::AsMemory(Footprint.GetTotalGPUBytes()).ToString(), *FText::AsMemory(GPUBudgetBytes).ToString(),
+		*FText::AsMemory(Footprint.GetTotalCPUBytes()).ToString(), *FText::AsMemory(CPUBudgetBytes).ToString());
+
+	for (int32 CategoryIndex = 0; CategoryIndex < static_cast<int32>(EStaticMeshMemoryCategory::Num); ++CategoryIndex)
+	{
+		const EStaticMeshMemoryCategory Category = static_cast<EStaticMeshMemoryCategory>(CategoryIndex);
+		const int64 GPUBytes = Footprint.GetGPUBytes(Category);
+		const int64 CPUBytes = Footprint.GetCPUBytes(Category);
+		if (GPUBytes == 0 && CPUBytes == 0)
+		{
+			continue;
+		}
+
+		Description += FString::Printf(TEXT("\n  %s:"), FStaticMeshMemoryFootprint::GetCategoryName(Category));
+		if (GPUBytes > 0)
+		{
+			Description += FString::Printf(TEXT(" GPU %s"), *FText::AsMemory(GPUBytes).ToString());
+		}
+		if (CPUBytes > 0)
+		{
+			Description += FString::Printf(TEXT("%s CPU %s"), GPUBytes > 0 ? TEXT(",") : TEXT(""), *FText::AsMemory(CPUBytes).ToString());
+		}
+		if (Category == EStaticMeshMemoryCategory::LumenCards)
+		{
+			Description += FString::Printf(TEXT(" (%d cards)"), MeshSnapshot.Resources.NumLumenCards);
+		}
+	}
+
+	if (Footprint.LODBytes.Num() > 0)
+	{
+		Description += TEXT("\n  Vertex and index buffers per LOD:");
+		for (int32 LODIndex = 0; LODIndex < Footprint.LODBytes.Num(); ++LODIndex)
+		{
+			Description += FString::Printf(TEXT("%s LOD%d %s"), LODIndex > 0 ? TEXT(",") : TEXT(""), LODIndex, *FText::AsMemory(Footprint.LODBytes[LODIndex]).ToString());
+		}
+	}
+
+	if (Footprint.StreamedBytes > 0)
+	{
+		Description += FString::Printf(TEXT("\n  Nanite streaming pages: %s, loaded on demand into the streaming pool and not counted above"), *FText::AsMemory(Footprint.StreamedBytes).ToString());
+	}
+
+	if (Footprint.FullPrecisionUVBytes > 0)
+	{
+		Description += FString::Printf(TEXT("\nFull precision UVs take %s more than 16-bit UVs; turn off Use Full Precision UVs unless the UVs tile far or need sub-texel precision."),
+			*FText::AsMemory(Footprint.FullPrecisionUVBytes).ToString());
+	}
+	if (Footprint.HighPrecisionTangentBytes > 0)
+	{
+		Description += FString::Printf(TEXT("\nHigh precision tangents take %s more than 8-bit ones; turn off Use High Precision Tangent Basis unless shading shows banding."),
+			*FText::AsMemory(Footprint.HighPrecisionTangentBytes).ToString());
+	}
+	if (MeshSnapshot.Resources.bAllowCPUAccess)
+	{
+		Description += TEXT("\nAllow CPU Access keeps a CPU copy of the vertex and index buffers.");
+	}
+
+	return Description;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Analysis/IAssetCheckRule.h"
+#include "Analysis/Snapshots/FStaticMeshMemoryEstimator.h"
+
+// Forward Declarations
+struct FStaticMeshAnalysisSnapshot;
+
+/**
+ * Estimates the GPU and CPU memory a static mesh takes once loaded: vertex and index buffers per LOD, distance field,
+ * Lumen mesh cards, ray tracing acceleration structures, collision and Nanite data. Meshes above the GPU or CPU byte
+ * budget are reported with the breakdown; results carry the resident total so the report can sort and sum them.
+ */
+class FStaticMeshMemoryBudgetRule : public IAssetCheckRule
+{
+public:
+	FStaticMeshMemoryBudgetRule();
+	virtual ~FStaticMeshMemoryBudgetRule() = default;
+
+	virtual bool Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
+	virtual FName GetRuleID() const override;
+	virtual FText GetRuleDescription() const override;
+	virtual bool IsEnabled(const UPipelineGuardianProfile* Profile) const override;
+	virtual bool SupportsSnapshot() const override { return true; }
+	virtual bool CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
+
+private:
+	FString GenerateMemoryDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, const FStaticMeshMemoryFootprint& Footprint, int64 GPUBudgetBytes, int64 CPUBudgetBytes) const;
+};
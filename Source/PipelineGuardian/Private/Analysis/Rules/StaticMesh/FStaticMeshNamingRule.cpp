@@ -26,6 +26,17 @@ bool FStaticMeshNamingRule::Check(UObject* Asset, const UPipelineGuardianProfile
 		return false;
 	}
 
+	return CheckAssetData(FAssetData(StaticMesh), Profile, OutResults);
+}
+
+bool FStaticMeshNamingRule::CanCheckAssetData(const FAssetData& AssetData) const
+{
+	// Only the asset name is inspected
+	return AssetData.IsValid();
+}
+
+bool FStaticMeshNamingRule::CheckAssetData(const FAssetData& AssetData, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
 	if (!Profile)
 	{
 		UE_LOG(LogPipelineGuardian, Warning, TEXT("FStaticMeshNamingRule: No profile provided"));
@@ -43,13 +54,13 @@ bool FStaticMeshNamingRule::Check(UObject* Asset, const UPipelineGuardianProfile
 	FString NamingPattern = Profile->GetRuleParameter(GetRuleID(), TEXT("NamingPattern"), TEXT("SM_*"));
 	
 	// Get the asset name
-	FString AssetName = StaticMesh->GetName();
+	FString AssetName = AssetData.AssetName.ToString();
 	
 	// Check if the name matches the pattern
 	if (!DoesNameMatchPattern(AssetName, NamingPattern))
 	{
 		FAssetAnalysisResult Result;
-		Result.Asset = FAssetData(StaticMesh);
+		Result.Asset = AssetData;
 		Result.Severity = EAssetIssueSeverity::Warning;
 		Result.RuleID = GetRuleID();
 		Result.Description = FText::Format(
@@ -57,13 +68,13 @@ bool FStaticMeshNamingRule::Check(UObject* Asset, const UPipelineGuardianProfile
 			FText::FromString(AssetName),
 			FText::FromString(NamingPattern)
 		);
-		Result.FilePath = FText::FromString(StaticMesh->GetPackage()->GetName());
+		Result.FilePath = FText::FromName(AssetData.PackageName);
 		
-		// Create fix action
+		// Create fix action. The asset may not have been loaded for analysis, so load it when the fix runs.
 		FString SuggestedName = GenerateSuggestedName(AssetName, NamingPattern);
-		Result.FixAction.BindLambda([StaticMesh, SuggestedName]()
+		Result.FixAction.BindLambda([AssetData, SuggestedName]()
 		{
-			FixAssetNaming(StaticMesh, SuggestedName);
+			FixAssetNaming(Cast<UStaticMesh>(AssetData.GetAsset()), SuggestedName);
 		});
 		
 		OutResults.Add(Result);
@@ -89,6 +100,11 @@ FText FStaticMeshNamingRule::GetRuleDescription() const
 	return LOCTEXT("StaticMeshNamingRuleDescription", "Validates that Static Mesh assets follow the configured naming convention pattern.");
 }
 
+bool FStaticMeshNamingRule::IsEnabled(const UPipelineGuardianProfile* Profile) const
+{
+	return Profile && Profile->IsRuleEnabled(GetRuleID());
+}
+
 bool FStaticMeshNamingRule::DoesNameMatchPattern(const FString& AssetName, const FString& Pattern) const
 {
 	// Convert simple pattern to regex
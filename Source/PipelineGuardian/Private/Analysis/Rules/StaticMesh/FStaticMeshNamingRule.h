@@ -9,6 +9,7 @@
 class UStaticMesh;
 class UPipelineGuardianProfile;
 struct FAssetAnalysisResult;
+struct FAssetData;
 
 /**
  * Rule to check Static Mesh naming conventions.
@@ -24,6 +25,9 @@ public:
 	virtual bool Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
 	virtual FName GetRuleID() const override;
 	virtual FText GetRuleDescription() const override;
+	virtual bool IsEnabled(const UPipelineGuardianProfile* Profile) const override;
+	virtual bool CanCheckAssetData(const FAssetData& AssetData) const override;
+	virtual bool CheckAssetData(const FAssetData& AssetData, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
 
 private:
 	/** Check if the asset name matches the expected pattern */
@@ -64,15 +64,22 @@ bool FStaticMeshNaniteSuitabilityRule::Check(UObject* Asset, const UPipelineGuar
 		// Add fix action if auto-fix is enabled
 		if (Settings->bAllowNaniteSuitabilityAutoFix && CanSafelyOptimizeNanite(StaticMesh))
 		{
-			Result.FixAction = FSimpleDelegate::CreateLambda([this, StaticMesh, ShouldUseNanite]()
+			TSoftObjectPtr<UStaticMesh> SoftStaticMesh(FSoftObjectPath(StaticMesh));
+			Result.FixAction = FSimpleDelegate::CreateLambda([this, SoftStaticMesh, ShouldUseNanite]()
 			{
-				if (OptimizeNaniteSettings(StaticMesh, ShouldUseNanite))
+				UStaticMesh* FixStaticMesh = SoftStaticMesh.LoadSynchronous();
+				if (!FixStaticMesh)
 				{
-					UE_LOG(LogPipelineGuardian, Log, TEXT("Successfully optimized Nanite settings for %s"), *StaticMesh->GetName());
+					return;
+				}
+
+				if (OptimizeNaniteSettings(FixStaticMesh, ShouldUseNanite))
+				{
+					UE_LOG(LogPipelineGuardian, Log, TEXT("Successfully optimized Nanite settings for %s"), *FixStaticMesh->GetName());
 				}
 				else
 				{
-					UE_LOG(LogPipelineGuardian, Warning, TEXT("Failed to optimize Nanite settings for %s"), *StaticMesh->GetName());
+					UE_LOG(LogPipelineGuardian, Warning, TEXT("Failed to optimize Nanite settings for %s"), *FixStaticMesh->GetName());
 				}
 			});
 		}
@@ -94,6 +101,12 @@ FText FStaticMeshNaniteSuitabilityRule::GetRuleDescription() const
 	return FText::FromString(TEXT("Checks if static meshes should use Nanite based on polygon count for optimal performance and quality."));
 }
 
+bool FStaticMeshNaniteSuitabilityRule::IsEnabled(const UPipelineGuardianProfile* Profile) const
+{
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	return Settings && Settings->bEnableStaticMeshNaniteSuitabilityRule;
+}
+
 bool FStaticMeshNaniteSuitabilityRule::ShouldUseNanite(const UStaticMesh* StaticMesh, int32 SuitabilityThreshold, int32 DisableThreshold) const
 {
 	if (!StaticMesh || !StaticMesh->GetRenderData() || StaticMesh->GetRenderData()->LODResources.Num() == 0)
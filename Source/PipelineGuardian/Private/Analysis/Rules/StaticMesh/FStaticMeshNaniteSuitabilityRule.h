@@ -13,6 +13,7 @@ public:
 	virtual bool Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
 	virtual FName GetRuleID() const override;
 	virtual FText GetRuleDescription() const override;
+	virtual bool IsEnabled(const UPipelineGuardianProfile* Profile) const override;
 
 private:
 	bool ShouldUseNanite(const UStaticMesh* StaticMesh, int32 SuitabilityThreshold, int32 DisableThreshold) const;
@@ -0,0 +1,160 @@
+#include "FStaticMeshNearDuplicateRule.h"
+#include "Analysis/FAssetAnalysisResult.h"
+#include "Analysis/Geometry/FMeshGeometryHasher.h"
+#include "Analysis/Geometry/FShapeDescriptorBuilder.h"
+#include "Analysis/Snapshots/FStaticMeshAnalysisSnapshot.h"
+#include "Analysis/Snapshots/FStaticMeshMemoryEstimator.h"
+#include "Core/FDuplicateGeometryIndex.h"
+#include "FPipelineGuardianSettings.h"
+#include "PipelineGuardian.h"
+#include "Engine/StaticMesh.h"
+
+namespace StaticMeshNearDuplicateRule
+{
+	/** @return True if every member has the representative's geometry up to translation and uniform scale, so the duplicate geometry rule reports them already. */
+	bool IsTransformedDuplicateGroup(const FNearDuplicateCluster& Cluster)
+	{
+		const FMeshGeometryHash& RepresentativeHash = Cluster.Members[0].Entry.Hash;
+		for (const FDuplicateGeometryGroup::FMember& Member : Cluster.Members)
+		{
+			const FMeshGeometryHash& Hash = Member.Entry.Hash;
+			if (!Hash.IsValid() || !RepresentativeHash.IsValid() || Hash.TopologyHash != RepresentativeHash.TopologyHash || !FMeshGeometryHasher::IsSameShape(RepresentativeHash, Hash))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+FStaticMeshNearDuplicateRule::FStaticMeshNearDuplicateRule()
+{
+}
+
+bool FStaticMeshNearDuplicateRule::Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	UStaticMesh* StaticMesh = Cast<UStaticMesh>(Asset);
+	if (!StaticMesh)
+	{
+		return false;
+	}
+
+	return CheckSnapshot(*FStaticMeshAnalysisSnapshot::Create(FAssetData(StaticMesh), StaticMesh), Profile, OutResults);
+}
+
+bool FStaticMeshNearDuplicateRule::CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	const FStaticMeshAnalysisSnapshot* MeshSnapshot = FStaticMeshAnalysisSnapshot::FromSnapshot(Snapshot);
+	if (!MeshSnapshot || MeshSnapshot->GetNumLODs() == 0)
+	{
+		return false;
+	}
+
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	if (!Settings || !Settings->bEnableStaticMeshNearDuplicateRule)
+	{
+		return false;
+	}
+
+	// Like exact duplicates, near-duplicates are only known once the whole run has been recorded
+	FDuplicateGeometryIndex& DuplicateGeometryIndex = FDuplicateGeometryIndex::Get();
+	if (!DuplicateGeometryIndex.IsCollecting())
+	{
+		return false;
+	}
+
+	const FStaticMeshLODSnapshot& LOD = MeshSnapshot->LODs[0];
+	DuplicateGeometryIndex.RecordShape(MeshSnapshot->AssetData.GetSoftObjectPath(), FShapeDescriptorBuilder::Build(LOD.Positions, LOD.Indices),
+		FStaticMeshMemoryEstimator::Estimate(*MeshSnapshot).GetTotalBytes());
+	return false;
+}
+
+FName FStaticMeshNearDuplicateRule::GetRuleID() const
+{
+	return TEXT("SM_NearDuplicateGeometry");
+}
+
+FText FStaticMeshNearDuplicateRule::GetRuleDescription() const
+{
+	return FText::FromString(TEXT("Builds a rotation and scale invariant shape descriptor of the LOD 0 surface of every static mesh and reports clusters of near-identical meshes with their similarity and combined memory, as candidates for merging."));
+}
+
+bool FStaticMeshNearDuplicateRule::IsEnabled(const UPipelineGuardianProfile* Profile) const
+{
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	return Settings && Settings->bEnableStaticMeshNearDuplicateRule;
+}
+
+int32 FStaticMeshNearDuplicateRule::AppendClusterResults(const TSet<FSoftObjectPath>& ScannedAssets, TArray<FAssetAnalysisResult>& OutResults)
+{
+	check(IsInGameThread());
+
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	if (!Settings || !Settings->bEnableStaticMeshNearDuplicateRule)
+	{
+		return 0;
+	}
+
+	const bool bTransformedDuplicatesReported = Settings->bEnableStaticMeshDuplicateGeometryRule && Settings->bDetectTransformedDuplicates;
+	const TArray<FNearDuplicateCluster> Clusters = FDuplicateGeometryIndex::Get().FindNearDuplicateClusters(Settings->NearDuplicateMinSimilarity);
+	int32 NumReported = 0;
+	for (const FNearDuplicateCluster& Cluster : Clusters)
+	{
+		if (bTransformedDuplicatesReported && StaticMeshNearDuplicateRule::IsTransformedDuplicateGroup(Cluster))
+		{
+			continue;
+		}
+
+		// The index spans the project; clusters made up only of meshes other scans recorded belong to those scans
+		const bool bHasScannedMember = Cluster.Members.ContainsByPredicate([&ScannedAssets](const FDuplicateGeometryGroup::FMember& Member)
+		{
+			return ScannedAssets.Contains(Member.AssetData.GetSoftObjectPath());
+		});
+		if (!bHasScannedMember)
+		{
+			continue;
+		}
+
+		int64 CombinedBytes = 0;
+		for (const FDuplicateGeometryGroup::FMember& Member : Cluster.Members)
+		{
+			CombinedBytes += Member.Entry.MemoryBytes;
+		}
+
+		const FDuplicateGeometryGroup::FMember& Representative = Cluster.Members[0];
+		FAssetAnalysisResult Result;
+		Result.Asset = Representative.AssetData;
+		Result.RuleID = TEXT("SM_NearDuplicateGeometry");
+		Result.Severity = Settings->NearDuplicateIssueSeverity;
+		Result.Description = FText::FromString(GenerateClusterDescription(Cluster, CombinedBytes));
+		Result.FilePath = FText::FromString(Representative.AssetData.PackageName.ToString());
+		Result.MemoryBytes = CombinedBytes;
+		OutResults.Add(Result);
+		++NumReported;
+	}
+
+	if (NumReported > 0)
+	{
+		UE_LOG(LogPipelineGuardian, Log, TEXT("Near-duplicate geometry: %d clusters at %.0f%% similarity or more"), NumReported, Settings->NearDuplicateMinSimilarity * 100.0f);
+	}
+	return NumReported;
+}
+
+FString FStaticMeshNearDuplicateRule::GenerateClusterDescription(const FNearDuplicateCluster& Cluster, int64 CombinedBytes)
+{
+	const FDuplicateGeometryGroup::FMember& Representative = Cluster.Members[0];
+
+	FString Description = FString::Printf(TEXT("Static mesh %s has nearly the same shape as %d other meshes, together using about %s of memory. Consider merging them into fewer meshes:"),
+		*Representative.AssetData.AssetName.ToString(), Cluster.Members.Num() - 1, *FText::AsMemory(CombinedBytes).ToString());
+
+	for (int32 MemberIndex = 0; MemberIndex < Cluster.Members.Num(); ++MemberIndex)
+	{
+		const FDuplicateGeometryGroup::FMember& Member = Cluster.Members[MemberIndex];
+		Description += FString::Printf(TEXT("\n  %s (%.1f%% similar, %s, %d referencing packages)"), *Member.AssetData.GetSoftObjectPath().ToString(),
+			Cluster.Similarities[MemberIndex] * 100.0f, *FText::AsMemory(Member.Entry.MemoryBytes).ToString(), Member.NumReferencers);
+	}
+
+	// Clusters link meshes pairwise, so the least similar member can be further from the first than the threshold
+	Description += TEXT("\nSimilarities are measured against the first mesh and ignore rotation, translation, scale and materials.");
+	return Description;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Analysis/IAssetCheckRule.h"
+
+// Forward Declarations
+struct FNearDuplicateCluster;
+
+/**
+ * Finds static meshes that are near-identical variants of each other, e.g. a rock re-exported with a few edits or a
+ * prop with a different bevel. Each analyzed mesh only has the shape descriptor of its LOD 0 recorded in the
+ * project-wide FDuplicateGeometryIndex; the clusters are reported by AppendClusterResults() once the whole run is done,
+ * one result per cluster with the similarity of every member and their combined memory, so artists can decide which
+ * variants to merge. Descriptors ignore rotation, translation and scale, and are clustered without comparing every pair.
+ */
+class FStaticMeshNearDuplicateRule : public IAssetCheckRule
+{
+public:
+	FStaticMeshNearDuplicateRule();
+	virtual ~FStaticMeshNearDuplicateRule() = default;
+
+	virtual bool Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
+	virtual FName GetRuleID() const override;
+	virtual FText GetRuleDescription() const override;
+	virtual bool IsEnabled(const UPipelineGuardianProfile* Profile) const override;
+	virtual bool SupportsSnapshot() const override { return true; }
+	virtual bool CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
+
+	/**
+	 * Reports the near-duplicate clusters of the index. Clusters the duplicate geometry rule already reports as
+	 * transformed duplicates are left out. Call on the game thread once the index has ended, after all assets of the
+	 * run were analyzed.
+	 * @param ScannedAssets Assets of the run; clusters without any of them are left out, since the index keeps the meshes of earlier scans.
+	 * @param OutResults Array to append one result per cluster to.
+	 * @return Number of clusters reported.
+	 */
+	static int32 AppendClusterResults(const TSet<FSoftObjectPath>& ScannedAssets, TArray<FAssetAnalysisResult>& OutResults);
+
+private:
+	static FString GenerateClusterDescription(const FNearDuplicateCluster& Cluster, int64 CombinedBytes);
+};
@@ -0,0 +1,284 @@
+#include "FStaticMeshOverdrawRule.h"
+#include "Analysis/FAssetAnalysisResult.h"
+#include "Analysis/Snapshots/FStaticMeshAnalysisSnapshot.h"
+#include "Analysis/Geometry/FMeshDescriptionReorderer.h"
+#include "FPipelineGuardianSettings.h"
+#include "PipelineGuardian.h"
+#include "Async/ParallelFor.h"
+#include "Engine/StaticMesh.h"
+#include "MeshDescription.h"
+#include "Misc/MessageDialog.h"
+
+namespace StaticMeshOverdrawRule
+{
+	/**
+	 * @param MeshSnapshot Snapshot of the mesh.
+	 * @param Section Section of the mesh.
+	 * @param bOutTwoSided Set to whether the section's material is two-sided.
+	 * @return False if the section's material does not write depth, so every layer is shaded whatever the order.
+	 */
+	bool IsDepthWritingSection(const FStaticMeshAnalysisSnapshot& MeshSnapshot, const FStaticMeshSectionSnapshot& Section, bool& bOutTwoSided)
+	{
+		bOutTwoSided = false;
+		if (!MeshSnapshot.MaterialSlots.IsValidIndex(Section.MaterialIndex))
+		{
+			return true;
+		}
+
+		const FStaticMeshMaterialSlotSnapshot& Slot = MeshSnapshot.MaterialSlots[Section.MaterialIndex];
+		bOutTwoSided = Slot.bTwoSided;
+		return Slot.BlendMode == BLEND_Opaque || Slot.BlendMode == BLEND_Masked;
+	}
+}
+
+FStaticMeshOverdrawRule::FStaticMeshOverdrawRule()
+{
+}
+
+bool FStaticMeshOverdrawRule::Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	UStaticMesh* StaticMesh = Cast<UStaticMesh>(Asset);
+	if (!StaticMesh)
+	{
+		return false;
+	}
+
+	return CheckSnapshot(*FStaticMeshAnalysisSnapshot::Create(FAssetData(StaticMesh), StaticMesh), Profile, OutResults);
+}
+
+bool FStaticMeshOverdrawRule::CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	const FStaticMeshAnalysisSnapshot* MeshSnapshot = FStaticMeshAnalysisSnapshot::FromSnapshot(Snapshot);
+	if (!MeshSnapshot)
+	{
+		return false;
+	}
+
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	if (!Settings || !Settings->bEnableStaticMeshOverdrawRule)
+	{
+		return false;
+	}
+
+	// Nanite meshes are rasterized from clusters into a visibility buffer, so their triangle order does not cause overdraw
+	if (MeshSnapshot->bNaniteEnabled || MeshSnapshot->GetNumLODs() == 0)
+	{
+		return false;
+	}
+
+	const float CacheThreshold = FMath::Max(Settings->OverdrawCacheThreshold, 1.0f);
+	const TArray<FSectionOverdrawStats> Sections = AnalyzeSections(*MeshSnapshot, Settings->OverdrawThreshold, CacheThreshold);
+	if (Sections.Num() == 0)
+	{
+		return false;
+	}
+
+	FAssetAnalysisResult Result;
+	Result.Asset = MeshSnapshot->AssetData;
+	Result.RuleID = GetRuleID();
+	Result.Severity = Settings->OverdrawIssueSeverity;
+	Result.Description = FText::FromString(GenerateOverdrawDescription(*MeshSnapshot, Sections));
+	Result.FilePath = FText::FromString(MeshSnapshot->PackageName);
+
+	// Only offer the reorder if it helps at least one of the reported sections and survives the rebuild
+	TArray<FSectionOverdrawStats> FixableSections = Sections.FilterByPredicate([](const FSectionOverdrawStats& Section) { return Section.CanFix(); });
+	if (Settings->bAllowOverdrawAutoFix && FixableSections.Num() > 0)
+	{
+		TSoftObjectPtr<UStaticMesh> SoftStaticMesh(MeshSnapshot->AssetData.GetSoftObjectPath());
+		Result.FixAction.BindLambda([SoftStaticMesh, CacheThreshold, FixableSections = MoveTemp(FixableSections), this]()
+		{
+			UStaticMesh* StaticMesh = SoftStaticMesh.LoadSynchronous();
+			if (!StaticMesh)
+			{
+				return;
+			}
+
+			if (OptimizeMeshDescription(StaticMesh, CacheThreshold))
+			{
+				const int32 NumImproved = CountImprovedSections(StaticMesh, FixableSections);
+				UE_LOG(LogPipelineGuardian, Log, TEXT("Optimized overdraw order of %s: %d of %d sections improved after the rebuild"), *StaticMesh->GetName(), NumImproved, FixableSections.Num());
+				if (NumImproved < FixableSections.Num())
+				{
+					FText WarningMessage = FText::FromString(FString::Printf(TEXT("'%s' was rebuilt, but only %d of %d reordered sections draw with less overdraw. The mesh build may have optimized their index buffers again."),
+						*StaticMesh->GetName(), NumImproved, FixableSections.Num()));
+					FMessageDialog::Open(EAppMsgType::Ok, WarningMessage, FText::FromString(TEXT("Overdraw Optimization")));
+				}
+			}
+			else
+			{
+				FText ErrorMessage = FText::FromString(FString::Printf(TEXT("'%s' has no LOD 0 source mesh description whose order the mesh build keeps."), *StaticMesh->GetName()));
+				FMessageDialog::Open(EAppMsgType::Ok, ErrorMessage, FText::FromString(TEXT("Overdraw Optimization Error")));
+			}
+		});
+	}
+
+	OutResults.Add(Result);
+	return true;
+}
+
+FName FStaticMeshOverdrawRule::GetRuleID() const
+{
+	return TEXT("SM_Overdraw");
+}
+
+FText FStaticMeshOverdrawRule::GetRuleDescription() const
+{
+	return FText::FromString(TEXT("Estimates the self-overdraw of LOD 0's opaque and masked sections from canonical view directions and reports sections an overdraw-optimized triangle order would improve."));
+}
+
+bool FStaticMeshOverdrawRule::IsEnabled(const UPipelineGuardianProfile* Profile) const
+{
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	return Settings && Settings->bEnableStaticMeshOverdrawRule;
+}
+
+TArray<FStaticMeshOverdrawRule::FSectionOverdrawStats> FStaticMeshOverdrawRule::AnalyzeSections(const FStaticMeshAnalysisSnapshot& MeshSnapshot, float Threshold, float CacheThreshold) const
+{
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	const int32 CacheSize = FMath::Clamp(Settings->VertexCacheSize, 1, 256);
+	const bool bLRU = Settings->bSimulateLRUVertexCache;
+
+	const FStaticMeshLODSnapshot& LODSnapshot = MeshSnapshot.LODs[0];
+	const TConstArrayView<uint32> Indices(LODSnapshot.Indices);
+
+	TArray<FSectionOverdrawStats> SectionStats;
+	SectionStats.SetNum(LODSnapshot.Sections.Num());
+	ParallelFor(LODSnapshot.Sections.Num(), [&](int32 SectionIndex)
+	{
+		const FStaticMeshSectionSnapshot& Section = LODSnapshot.Sections[SectionIndex];
+		const int64 NumIndices = static_cast<int64>(Section.NumTriangles) * 3;
+		if (NumIndices == 0 || Section.FirstIndex + NumIndices > Indices.Num())
+		{
+			return;
+		}
+
+		bool bTwoSided = false;
+		if (!StaticMeshOverdrawRule::IsDepthWritingSection(MeshSnapshot, Section, bTwoSided))
+		{
+			return;
+		}
+
+		const TConstArrayView<uint32> SectionIndices = Indices.Slice(Section.FirstIndex, static_cast<int32>(NumIndices));
+		FSectionOverdrawStats& Stats = SectionStats[SectionIndex];
+		Stats.Current = FOverdrawEstimator::Estimate(LODSnapshot.Positions, SectionIndices, !bTwoSided);
+		if (Stats.Current.GetOverdraw() <= Threshold)
+		{
+			return;
+		}
+
+		TArray<int32> TriangleOrder;
+		TArray<uint32> OptimizedIndices;
+		FOverdrawEstimator::OptimizeTriangleOrder(LODSnapshot.Positions, SectionIndices, CacheThreshold, TriangleOrder);
+		FVertexCacheOptimizer::ReorderTriangles(SectionIndices, TriangleOrder, OptimizedIndices);
+
+		Stats.SectionIndex = SectionIndex;
+		Stats.Optimized = FOverdrawEstimator::Estimate(LODSnapshot.Positions, OptimizedIndices, !bTwoSided);
+		Stats.CurrentCache = FVertexCacheOptimizer::Simulate(SectionIndices, CacheSize, bLRU);
+		Stats.OptimizedCache = FVertexCacheOptimizer::Simulate(OptimizedIndices, CacheSize, bLRU);
+		Stats.bOrderKeptByBuild = LODSnapshot.bOrderKeptByBuild;
+
+		UE_LOG(LogPipelineGuardian, Verbose, TEXT("%s section %d overdraw: %.3f -> %.3f"),
+			*MeshSnapshot.AssetName, SectionIndex, Stats.Current.GetOverdraw(), Stats.Optimized.GetOverdraw());
+	}, EParallelForFlags::Unbalanced);
+
+	SectionStats.RemoveAll([](const FSectionOverdrawStats& Stats) { return Stats.SectionIndex == INDEX_NONE; });
+	return SectionStats;
+}
+
+FString FStaticMeshOverdrawRule::GenerateOverdrawDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, TConstArrayView<FSectionOverdrawStats> Sections) const
+{
+	FString Description = FString::Printf(TEXT("Static mesh %s has LOD 0 sections that overdraw themselves (pixel shader invocations per covered pixel, averaged over %d view directions):"),
+		*MeshSnapshot.AssetName, FOverdrawEstimator::NumViews);
+
+	const FStaticMeshLODSnapshot& LODSnapshot = MeshSnapshot.LODs[0];
+	for (const FSectionOverdrawStats& Section : Sections)
+	{
+		const int32 MaterialIndex = LODSnapshot.Sections[Section.SectionIndex].MaterialIndex;
+		const FName SlotName = MeshSnapshot.MaterialSlots.IsValidIndex(MaterialIndex) ? MeshSnapshot.MaterialSlots[MaterialIndex].SlotName : NAME_None;
+		Description += FString::Printf(TEXT("\n  Section %d (%s): overdraw %.2f"), Section.SectionIndex, *SlotName.ToString(), Section.Current.GetOverdraw());
+		if (Section.Optimized.GetOverdraw() < Section.Current.GetOverdraw())
+		{
+			Description += FString::Printf(TEXT(", %.2f after reordering (ACMR %.2f -> %.2f)"),
+				Section.Optimized.GetOverdraw(), Section.CurrentCache.GetACMR(), Section.OptimizedCache.GetACMR());
+			if (!Section.bOrderKeptByBuild)
+			{
+				Description += FString::Printf(TEXT(", but the mesh build cache-optimizes LODs under %d vertex instances again and would discard that order; splitting off the overlapping layers is the lasting fix"),
+					FMeshDescriptionReorderer::MinBuildKeptVertexInstances);
+			}
+		}
+		else
+		{
+			Description += TEXT(", not improved by reordering; the overlapping layers may need to be separate sections or removed");
+		}
+	}
+
+	return Description;
+}
+
+bool FStaticMeshOverdrawRule::OptimizeMeshDescription(UStaticMesh* StaticMesh, float CacheThreshold) const
+{
+	check(IsInGameThread());
+
+	if (!StaticMesh || !StaticMesh->IsMeshDescriptionValid(0))
+	{
+		return false;
+	}
+
+	// The build would cache-optimize a smaller LOD again and discard the order
+	FMeshDescription* MeshDescription = StaticMesh->GetMeshDescription(0);
+	if (!MeshDescription || !FMeshDescriptionReorderer::IsOrderKeptByBuild(*MeshDescription))
+	{
+		return false;
+	}
+
+	const bool bReordered = FMeshDescriptionReorderer::Reorder(*MeshDescription, [CacheThreshold](TConstArrayView<FVector3f> Positions, TConstArrayView<uint32> Indices, TArray<int32>& OutTriangleOrder)
+	{
+		FOverdrawEstimator::OptimizeTriangleOrder(Positions, Indices, CacheThreshold, OutTriangleOrder);
+	});
+	if (!bReordered)
+	{
+		return false;
+	}
+
+	StaticMesh->CommitMeshDescription(0);
+	StaticMesh->Build(false);
+	StaticMesh->MarkPackageDirty();
+	StaticMesh->PostEditChange();
+	return true;
+}
+
+int32 FStaticMeshOverdrawRule::CountImprovedSections(UStaticMesh* StaticMesh, TConstArrayView<FSectionOverdrawStats> Sections) const
+{
+	check(IsInGameThread());
+
+	const TSharedRef<const FStaticMeshAnalysisSnapshot> MeshSnapshot = FStaticMeshAnalysisSnapshot::Create(FAssetData(StaticMesh), StaticMesh);
+	if (MeshSnapshot->GetNumLODs() == 0)
+	{
+		return 0;
+	}
+
+	// Reordering keeps the polygon groups, so the rebuilt mesh has the same sections
+	const FStaticMeshLODSnapshot& LODSnapshot = MeshSnapshot->LODs[0];
+	const TConstArrayView<uint32> Indices(LODSnapshot.Indices);
+	int32 NumImproved = 0;
+	for (const FSectionOverdrawStats& Stats : Sections)
+	{
+		if (!LODSnapshot.Sections.IsValidIndex(Stats.SectionIndex))
+		{
+			continue;
+		}
+
+		const FStaticMeshSectionSnapshot& Section = LODSnapshot.Sections[Stats.SectionIndex];
+		const int64 NumIndices = static_cast<int64>(Section.NumTriangles) * 3;
+		bool bTwoSided = false;
+		if (NumIndices == 0 || Section.FirstIndex + NumIndices > Indices.Num() || !StaticMeshOverdrawRule::IsDepthWritingSection(*MeshSnapshot, Section, bTwoSided))
+		{
+			continue;
+		}
+
+		const FOverdrawStats Rebuilt = FOverdrawEstimator::Estimate(LODSnapshot.Positions, Indices.Slice(Section.FirstIndex, static_cast<int32>(NumIndices)), !bTwoSided);
+		UE_LOG(LogPipelineGuardian, Verbose, TEXT("%s section %d overdraw after rebuild: %.3f -> %.3f"), *MeshSnapshot->AssetName, Stats.SectionIndex, Stats.Current.GetOverdraw(), Rebuilt.GetOverdraw());
+		NumImproved += Rebuilt.GetOverdraw() < Stats.Current.GetOverdraw() ? 1 : 0;
+	}
+	return NumImproved;
+}
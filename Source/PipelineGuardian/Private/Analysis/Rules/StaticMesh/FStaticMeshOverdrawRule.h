@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Analysis/IAssetCheckRule.h"
+#include "Analysis/Geometry/FOverdrawEstimator.h"
+#include "Analysis/Geometry/FVertexCacheOptimizer.h"
+
+// Forward Declarations
+class UStaticMesh;
+struct FStaticMeshAnalysisSnapshot;
+
+/**
+ * Estimates how much the opaque and masked sections of LOD 0 overdraw themselves in their current triangle order,
+ * by depth-rasterizing them from a set of canonical view directions. Sections above the threshold are compared with
+ * an overdraw-optimized order that keeps most of the vertex cache reuse; the fix applies that order to the source
+ * mesh description and rebuilds the mesh. The build cache-optimizes smaller LODs again, so the fix is only offered
+ * when LOD 0 is large enough to keep its order.
+ */
+class FStaticMeshOverdrawRule : public IAssetCheckRule
+{
+public:
+	FStaticMeshOverdrawRule();
+	virtual ~FStaticMeshOverdrawRule() = default;
+
+	virtual bool Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
+	virtual FName GetRuleID() const override;
+	virtual FText GetRuleDescription() const override;
+	virtual bool IsEnabled(const UPipelineGuardianProfile* Profile) const override;
+	virtual bool SupportsSnapshot() const override { return true; }
+	virtual bool CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
+
+private:
+	/** Overdraw and cache behavior of one section as built and after reordering */
+	struct FSectionOverdrawStats
+	{
+		int32 SectionIndex = INDEX_NONE;
+		FOverdrawStats Current;
+		FOverdrawStats Optimized;
+		FVertexCacheStats CurrentCache;
+		FVertexCacheStats OptimizedCache;
+
+		/** Whether a rebuild keeps LOD 0's triangle order, see FMeshDescriptionReorderer::IsOrderKeptByBuild() */
+		bool bOrderKeptByBuild = false;
+
+		/** @return True if the fix can lower the section's overdraw. */
+		bool CanFix() const { return bOrderKeptByBuild && Optimized.GetOverdraw() < Current.GetOverdraw(); }
+	};
+
+	/**
+	 * Estimates overdraw of every LOD 0 section drawn with an opaque or masked material; other sections are skipped.
+	 * @param MeshSnapshot Snapshot of the mesh.
+	 * @param Threshold Sections at or below this overdraw are not reordered to compare.
+	 * @param CacheThreshold ACMR the reordering may give up, as for FOverdrawEstimator::OptimizeTriangleOrder().
+	 * @return Stats of the sections above Threshold.
+	 */
+	TArray<FSectionOverdrawStats> AnalyzeSections(const FStaticMeshAnalysisSnapshot& MeshSnapshot, float Threshold, float CacheThreshold) const;
+
+	FString GenerateOverdrawDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, TConstArrayView<FSectionOverdrawStats> Sections) const;
+
+	/**
+	 * Reorders the triangles of LOD 0's source mesh description for low overdraw, then rebuilds the mesh. Game thread only.
+	 * @return True if the mesh description was changed; false if it is missing or the build would cache-optimize it again.
+	 */
+	bool OptimizeMeshDescription(UStaticMesh* StaticMesh, float CacheThreshold) const;
+
+	/**
+	 * Estimates the overdraw of the given LOD 0 sections again once the mesh has been rebuilt. Game thread only.
+	 * @param StaticMesh The rebuilt mesh.
+	 * @param Sections Stats of the sections before the fix.
+	 * @return Number of sections whose overdraw went down.
+	 */
+	int32 CountImprovedSections(UStaticMesh* StaticMesh, TConstArrayView<FSectionOverdrawStats> Sections) const;
+};
@@ -58,14 +58,22 @@ bool FStaticMeshScalingRule::Check(UObject* Asset, const UPipelineGuardianProfil
 			// Only provide fix action if it's safe
 			if (CanSafelyFixScaling(StaticMesh))
 			{
-				Result.FixAction = FSimpleDelegate::CreateLambda([this, StaticMesh, ZeroScaleAxes]() {
-					if (FixZeroScale(const_cast<UStaticMesh*>(StaticMesh), ZeroScaleAxes)) 
+				TSoftObjectPtr<UStaticMesh> SoftStaticMesh(FSoftObjectPath(StaticMesh));
+				Result.FixAction = FSimpleDelegate::CreateLambda([this, SoftStaticMesh, ZeroScaleAxes]()
+				{
+					UStaticMesh* FixStaticMesh = SoftStaticMesh.LoadSynchronous();
+					if (!FixStaticMesh)
+					{
+						return;
+					}
+
+					if (FixZeroScale(FixStaticMesh, ZeroScaleAxes)) 
 					{ 
-						UE_LOG(LogPipelineGuardian, Log, TEXT("Successfully fixed zero scale for %s"), *StaticMesh->GetName()); 
+						UE_LOG(LogPipelineGuardian, Log, TEXT("Successfully fixed zero scale for %s"), *FixStaticMesh->GetName()); 
 					} 
 					else 
 					{ 
-						UE_LOG(LogPipelineGuardian, Warning, TEXT("Failed to fix zero scale for %s"), *StaticMesh->GetName()); 
+						UE_LOG(LogPipelineGuardian, Warning, TEXT("Failed to fix zero scale for %s"), *FixStaticMesh->GetName()); 
 					}
 				});
 			}
@@ -105,6 +113,12 @@ FText FStaticMeshScalingRule::GetRuleDescription() const
 	return FText::FromString(TEXT("Checks for scaling issues in static meshes including non-uniform scaling, zero scale, and extreme values."));
 }
 
+bool FStaticMeshScalingRule::IsEnabled(const UPipelineGuardianProfile* Profile) const
+{
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	return Settings && (Settings->bEnableNonUniformScaleDetection || Settings->bEnableZeroScaleDetection || Settings->bEnableAssetTypeSpecificPivotRules);
+}
+
 bool FStaticMeshScalingRule::HasNonUniformScale(const UStaticMesh* StaticMesh, float WarningRatio, FVector& OutScale) const
 {
 	if (!StaticMesh)
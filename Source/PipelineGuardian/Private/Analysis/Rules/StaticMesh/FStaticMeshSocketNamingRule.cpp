@@ -1,5 +1,6 @@
 #include "FStaticMeshSocketNamingRule.h"
 #include "Analysis/FAssetAnalysisResult.h"
+#include "Analysis/Snapshots/FStaticMeshAnalysisSnapshot.h"
 #include "FPipelineGuardianSettings.h"
 #include "PipelineGuardian.h"
 #include "Engine/StaticMesh.h"
@@ -20,6 +21,17 @@ bool FStaticMeshSocketNamingRule::Check(UObject* Asset, const UPipelineGuardianP
 		return false;
 	}
 
+	return CheckSnapshot(*FStaticMeshAnalysisSnapshot::Create(FAssetData(StaticMesh), StaticMesh), Profile, OutResults);
+}
+
+bool FStaticMeshSocketNamingRule::CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	const FStaticMeshAnalysisSnapshot* MeshSnapshot = FStaticMeshAnalysisSnapshot::FromSnapshot(Snapshot);
+	if (!MeshSnapshot)
+	{
+		return false;
+	}
+
 	// Get settings
 	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
 	if (!Settings || !Settings->bEnableStaticMeshSocketNamingRule)
@@ -33,10 +45,10 @@ bool FStaticMeshSocketNamingRule::Check(UObject* Asset, const UPipelineGuardianP
 	TArray<FString> InvalidTransformSockets;
 
 	// Check socket naming conventions
-	bool HasInvalidNaming = HasInvalidSocketNaming(StaticMesh, Settings->SocketNamingPrefix, InvalidNamingSockets);
+	bool HasInvalidNaming = HasInvalidSocketNaming(*MeshSnapshot, Settings->SocketNamingPrefix, InvalidNamingSockets);
 	
 	// Check socket transforms
-	bool HasInvalidTransforms = HasInvalidSocketTransforms(StaticMesh, Settings->SocketTransformWarningDistance, InvalidTransformSockets);
+	bool HasInvalidTransforms = HasInvalidSocketTransforms(*MeshSnapshot, Settings->SocketTransformWarningDistance, InvalidTransformSockets);
 
 	// Determine if there are issues
 	if (HasInvalidNaming || HasInvalidTransforms)
@@ -47,23 +59,30 @@ bool FStaticMeshSocketNamingRule::Check(UObject* Asset, const UPipelineGuardianP
 	if (HasIssue)
 	{
 		FAssetAnalysisResult Result;
-		Result.Asset = FAssetData(StaticMesh);
+		Result.Asset = MeshSnapshot->AssetData;
 		Result.RuleID = GetRuleID();
 		Result.Severity = Severity;
-		Result.Description = FText::FromString(GenerateSocketNamingDescription(StaticMesh, InvalidNamingSockets, InvalidTransformSockets, Settings->SocketNamingPrefix));
+		Result.Description = FText::FromString(GenerateSocketNamingDescription(*MeshSnapshot, InvalidNamingSockets, InvalidTransformSockets, Settings->SocketNamingPrefix));
 
 		// Add fix action if auto-fix is enabled
-		if (Settings->bAllowSocketNamingAutoFix && CanSafelyFixSocketIssues(StaticMesh))
+		if (Settings->bAllowSocketNamingAutoFix && CanSafelyFixSocketIssues(*MeshSnapshot))
 		{
-			Result.FixAction = FSimpleDelegate::CreateLambda([this, StaticMesh, Settings]()
+			TSoftObjectPtr<UStaticMesh> SoftStaticMesh(MeshSnapshot->AssetData.GetSoftObjectPath());
+			Result.FixAction = FSimpleDelegate::CreateLambda([this, SoftStaticMesh, Settings]()
 			{
-				if (FixSocketIssues(StaticMesh, Settings->SocketNamingPrefix))
+				UStaticMesh* FixStaticMesh = SoftStaticMesh.LoadSynchronous();
+				if (!FixStaticMesh)
 				{
-					UE_LOG(LogPipelineGuardian, Log, TEXT("Successfully fixed socket issues for %s"), *StaticMesh->GetName());
+					return;
+				}
+
+				if (FixSocketIssues(FixStaticMesh, Settings->SocketNamingPrefix))
+				{
+					UE_LOG(LogPipelineGuardian, Log, TEXT("Successfully fixed socket issues for %s"), *FixStaticMesh->GetName());
 				}
 				else
 				{
-					UE_LOG(LogPipelineGuardian, Warning, TEXT("Failed to fix socket issues for %s"), *StaticMesh->GetName());
+					UE_LOG(LogPipelineGuardian, Warning, TEXT("Failed to fix socket issues for %s"), *FixStaticMesh->GetName());
 				}
 			});
 		}
@@ -85,13 +104,14 @@ FText FStaticMeshSocketNamingRule::GetRuleDescription() const
 	return FText::FromString(TEXT("Checks for proper socket naming conventions and reasonable transform positions."));
 }
 
-bool FStaticMeshSocketNamingRule::HasInvalidSocketNaming(const UStaticMesh* StaticMesh, const FString& RequiredPrefix, TArray<FString>& OutInvalidSocketNames) const
+bool FStaticMeshSocketNamingRule::IsEnabled(const UPipelineGuardianProfile* Profile) const
 {
-	if (!StaticMesh)
-	{
-		return false;
-	}
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	return Settings && Settings->bEnableStaticMeshSocketNamingRule;
+}
 
+bool FStaticMeshSocketNamingRule::HasInvalidSocketNaming(const FStaticMeshAnalysisSnapshot& MeshSnapshot, const FString& RequiredPrefix, TArray<FString>& OutInvalidSocketNames) const
+{
 	OutInvalidSocketNames.Empty();
 
 	// If no prefix is required, all names are valid
@@ -101,53 +121,45 @@ bool FStaticMeshSocketNamingRule::HasInvalidSocketNaming(const UStaticMesh* Stat
 	}
 
 	// Check all sockets for proper naming
-	for (const UStaticMeshSocket* Socket : StaticMesh->Sockets)
+	for (const FStaticMeshSocketSnapshot& Socket : MeshSnapshot.Sockets)
 	{
-		if (Socket && !Socket->SocketName.ToString().StartsWith(RequiredPrefix))
+		if (!Socket.SocketName.ToString().StartsWith(RequiredPrefix))
 		{
-			OutInvalidSocketNames.Add(Socket->SocketName.ToString());
+			OutInvalidSocketNames.Add(Socket.SocketName.ToString());
 		}
 	}
 
 	return OutInvalidSocketNames.Num() > 0;
 }
 
-bool FStaticMeshSocketNamingRule::HasInvalidSocketTransforms(const UStaticMesh* StaticMesh, float WarningDistance, TArray<FString>& OutInvalidSocketNames) const
+bool FStaticMeshSocketNamingRule::HasInvalidSocketTransforms(const FStaticMeshAnalysisSnapshot& MeshSnapshot, float WarningDistance, TArray<FString>& OutInvalidSocketNames) const
 {
-	if (!StaticMesh)
-	{
-		return false;
-	}
-
 	OutInvalidSocketNames.Empty();
 
 	// Get mesh bounds for distance checking
-	FBoxSphereBounds MeshBounds = StaticMesh->GetBounds();
+	FBoxSphereBounds MeshBounds = MeshSnapshot.Bounds;
 	FVector MeshCenter = MeshBounds.Origin;
 	float MeshRadius = MeshBounds.SphereRadius;
 
 	// Check all sockets for reasonable transforms
-	for (const UStaticMeshSocket* Socket : StaticMesh->Sockets)
+	for (const FStaticMeshSocketSnapshot& Socket : MeshSnapshot.Sockets)
 	{
-		if (Socket)
+		FVector SocketLocation = Socket.RelativeLocation;
+		float DistanceFromCenter = FVector::Dist(SocketLocation, MeshCenter);
+		
+		// Check if socket is too far from mesh bounds
+		if (DistanceFromCenter > MeshRadius + WarningDistance)
 		{
-			FVector SocketLocation = Socket->RelativeLocation;
-			float DistanceFromCenter = FVector::Dist(SocketLocation, MeshCenter);
-			
-			// Check if socket is too far from mesh bounds
-			if (DistanceFromCenter > MeshRadius + WarningDistance)
-			{
-				OutInvalidSocketNames.Add(Socket->SocketName.ToString());
-			}
+			OutInvalidSocketNames.Add(Socket.SocketName.ToString());
 		}
 	}
 
 	return OutInvalidSocketNames.Num() > 0;
 }
 
-FString FStaticMeshSocketNamingRule::GenerateSocketNamingDescription(const UStaticMesh* StaticMesh, const TArray<FString>& InvalidNamingSockets, const TArray<FString>& InvalidTransformSockets, const FString& RequiredPrefix) const
+FString FStaticMeshSocketNamingRule::GenerateSocketNamingDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, const TArray<FString>& InvalidNamingSockets, const TArray<FString>& InvalidTransformSockets, const FString& RequiredPrefix) const
 {
-	FString Description = FString::Printf(TEXT("Socket issues detected for %s: "), *StaticMesh->GetName());
+	FString Description = FString::Printf(TEXT("Socket issues detected for %s: "), *MeshSnapshot.AssetName);
 
 	bool HasIssues = false;
 
@@ -185,7 +197,7 @@ FString FStaticMeshSocketNamingRule::GenerateSocketNamingDescription(const UStat
 
 	if (!HasIssues)
 	{
-		Description = FString::Printf(TEXT("Socket naming check failed for %s"), *StaticMesh->GetName());
+		Description = FString::Printf(TEXT("Socket naming check failed for %s"), *MeshSnapshot.AssetName);
 	}
 
 	return Description;
@@ -252,24 +264,19 @@ bool FStaticMeshSocketNamingRule::FixSocketIssues(UStaticMesh* StaticMesh, const
 	return true;
 }
 
-bool FStaticMeshSocketNamingRule::CanSafelyFixSocketIssues(const UStaticMesh* StaticMesh) const
+bool FStaticMeshSocketNamingRule::CanSafelyFixSocketIssues(const FStaticMeshAnalysisSnapshot& MeshSnapshot) const
 {
-	if (!StaticMesh)
-	{
-		return false;
-	}
-
 	// Check if mesh has valid geometry
-	if (!StaticMesh->GetRenderData() || StaticMesh->GetRenderData()->LODResources.Num() == 0)
+	if (MeshSnapshot.GetNumLODs() == 0)
 	{
-		UE_LOG(LogPipelineGuardian, Warning, TEXT("Cannot fix socket issues for %s: No valid geometry"), *StaticMesh->GetName());
+		UE_LOG(LogPipelineGuardian, Warning, TEXT("Cannot fix socket issues for %s: No valid geometry"), *MeshSnapshot.AssetName);
 		return false;
 	}
 
 	// Check if mesh has sockets to work with
-	if (StaticMesh->Sockets.Num() == 0)
+	if (MeshSnapshot.Sockets.Num() == 0)
 	{
-		UE_LOG(LogPipelineGuardian, Warning, TEXT("Cannot fix socket issues for %s: No sockets to fix"), *StaticMesh->GetName());
+		UE_LOG(LogPipelineGuardian, Warning, TEXT("Cannot fix socket issues for %s: No sockets to fix"), *MeshSnapshot.AssetName);
 		return false;
 	}
 
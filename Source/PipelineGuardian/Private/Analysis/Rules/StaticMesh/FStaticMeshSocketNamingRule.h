@@ -2,7 +2,10 @@
 
 #include "CoreMinimal.h"
 #include "Analysis/IAssetCheckRule.h"
-#include "Engine/StaticMesh.h"
+
+// Forward Declarations
+class UStaticMesh;
+struct FStaticMeshAnalysisSnapshot;
 
 class FStaticMeshSocketNamingRule : public IAssetCheckRule
 {
@@ -13,11 +16,14 @@ public:
 	virtual bool Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
 	virtual FName GetRuleID() const override;
 	virtual FText GetRuleDescription() const override;
+	virtual bool IsEnabled(const UPipelineGuardianProfile* Profile) const override;
+	virtual bool SupportsSnapshot() const override { return true; }
+	virtual bool CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
 
 private:
-	bool HasInvalidSocketNaming(const UStaticMesh* StaticMesh, const FString& RequiredPrefix, TArray<FString>& OutInvalidSocketNames) const;
-	bool HasInvalidSocketTransforms(const UStaticMesh* StaticMesh, float WarningDistance, TArray<FString>& OutInvalidSocketNames) const;
-	FString GenerateSocketNamingDescription(const UStaticMesh* StaticMesh, const TArray<FString>& InvalidNamingSockets, const TArray<FString>& InvalidTransformSockets, const FString& RequiredPrefix) const;
+	bool HasInvalidSocketNaming(const FStaticMeshAnalysisSnapshot& MeshSnapshot, const FString& RequiredPrefix, TArray<FString>& OutInvalidSocketNames) const;
+	bool HasInvalidSocketTransforms(const FStaticMeshAnalysisSnapshot& MeshSnapshot, float WarningDistance, TArray<FString>& OutInvalidSocketNames) const;
+	FString GenerateSocketNamingDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, const TArray<FString>& InvalidNamingSockets, const TArray<FString>& InvalidTransformSockets, const FString& RequiredPrefix) const;
 	bool FixSocketIssues(UStaticMesh* StaticMesh, const FString& RequiredPrefix) const;
-	bool CanSafelyFixSocketIssues(const UStaticMesh* StaticMesh) const;
+	bool CanSafelyFixSocketIssues(const FStaticMeshAnalysisSnapshot& MeshSnapshot) const;
 }; 
\ No newline at end of file
@@ -0,0 +1,173 @@
+#include "FStaticMeshTexelDensityRule.h"
+#include "Analysis/FAssetAnalysisResult.h"
+#include "Analysis/Snapshots/FStaticMeshAnalysisSnapshot.h"
+#include "Core/FTexelDensityHistogram.h"
+#include "FPipelineGuardianSettings.h"
+#include "PipelineGuardian.h"
+#include "Engine/StaticMesh.h"
+
+namespace TexelDensityRule
+{
+	/** Sections covering less of the mesh's measured surface than this are recorded but never reported; they are too small to be seen */
+	constexpr double MinReportedAreaShare = 0.01;
+}
+
+FStaticMeshTexelDensityRule::FStaticMeshTexelDensityRule()
+{
+}
+
+bool FStaticMeshTexelDensityRule::Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	UStaticMesh* StaticMesh = Cast<UStaticMesh>(Asset);
+	if (!StaticMesh)
+	{
+		return false;
+	}
+
+	return CheckSnapshot(*FStaticMeshAnalysisSnapshot::Create(FAssetData(StaticMesh), StaticMesh), Profile, OutResults);
+}
+
+bool FStaticMeshTexelDensityRule::CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	const FStaticMeshAnalysisSnapshot* MeshSnapshot = FStaticMeshAnalysisSnapshot::FromSnapshot(Snapshot);
+	if (!MeshSnapshot)
+	{
+		return false;
+	}
+
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	if (!Settings || !Settings->bEnableStaticMeshTexelDensityRule)
+	{
+		return false;
+	}
+
+	// A mesh without measurable sections is recorded at no density, which drops what an earlier run recorded for it
+	const FSoftObjectPath AssetPath = MeshSnapshot->AssetData.GetSoftObjectPath();
+	TArray<FSectionTexelDensity> Sections;
+	if (!AnalyzeSectionTexelDensities(*MeshSnapshot, Settings->TexelDensityUVChannel, Sections) || Sections.Num() == 0)
+	{
+		FTexelDensityHistogram::Get().Record(AssetPath, 0.0f, 0.0);
+		return false;
+	}
+
+	// The mesh goes into the histogram at its surface-weighted density
+	double TotalWorldArea = 0.0;
+	double WeightedDensity = 0.0;
+	for (const FSectionTexelDensity& Section : Sections)
+	{
+		TotalWorldArea += Section.Stats.WorldArea;
+		WeightedDensity += Section.GetTexelDensity() * Section.Stats.WorldArea;
+	}
+	const float MeshTexelDensity = TotalWorldArea > 0.0 ? static_cast<float>(WeightedDensity / TotalWorldArea) : 0.0f;
+	FTexelDensityHistogram::Get().Record(AssetPath, MeshTexelDensity, TotalWorldArea);
+
+	UE_LOG(LogPipelineGuardian, Verbose, TEXT("%s texel density: %.3f texels/unit over %d sections, %.1f units squared"),
+		*MeshSnapshot->AssetName, MeshTexelDensity, Sections.Num(), TotalWorldArea);
+
+	const float TargetTexelDensity = Settings->TargetTexelDensity;
+	if (TargetTexelDensity <= 0.0f)
+	{
+		return false;
+	}
+
+	const float Tolerance = FMath::Max(Settings->TexelDensityTolerance, 1.0f);
+	TArray<FSectionTexelDensity> OffTargetSections;
+	for (const FSectionTexelDensity& Section : Sections)
+	{
+		const float TexelDensity = Section.GetTexelDensity();
+		if (Section.Stats.WorldArea >= TotalWorldArea * TexelDensityRule::MinReportedAreaShare
+			&& (TexelDensity > TargetTexelDensity * Tolerance || TexelDensity * Tolerance < TargetTexelDensity))
+		{
+			OffTargetSections.Add(Section);
+		}
+	}
+
+	if (OffTargetSections.Num() == 0)
+	{
+		return false;
+	}
+
+	FAssetAnalysisResult Result;
+	Result.Asset = MeshSnapshot->AssetData;
+	Result.RuleID = GetRuleID();
+	Result.Severity = Settings->TexelDensityIssueSeverity;
+	Result.Description = FText::FromString(GenerateTexelDensityDescription(*MeshSnapshot, OffTargetSections, TargetTexelDensity));
+	Result.FilePath = FText::FromString(MeshSnapshot->PackageName);
+	OutResults.Add(Result);
+
+	return true;
+}
+
+FName FStaticMeshTexelDensityRule::GetRuleID() const
+{
+	return TEXT("SM_TexelDensity");
+}
+
+FText FStaticMeshTexelDensityRule::GetRuleDescription() const
+{
+	return FText::FromString(TEXT("Checks that each section of a static mesh gets the project's target texel density from the largest texture of its material, and collects a project-wide texel density histogram."));
+}
+
+bool FStaticMeshTexelDensityRule::IsEnabled(const UPipelineGuardianProfile* Profile) const
+{
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	return Settings && Settings->bEnableStaticMeshTexelDensityRule;
+}
+
+bool FStaticMeshTexelDensityRule::AnalyzeSectionTexelDensities(const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 UVChannel, TArray<FSectionTexelDensity>& OutSections) const
+{
+	OutSections.Reset();
+
+	if (MeshSnapshot.GetNumLODs() == 0)
+	{
+		return false;
+	}
+
+	const FStaticMeshLODSnapshot& LODSnapshot = MeshSnapshot.LODs[0];
+	if (!LODSnapshot.UVChannels.IsValidIndex(UVChannel))
+	{
+		return false;
+	}
+
+	const TConstArrayView<uint32> Indices(LODSnapshot.Indices);
+	for (int32 SectionIndex = 0; SectionIndex < LODSnapshot.Sections.Num(); ++SectionIndex)
+	{
+		const FStaticMeshSectionSnapshot& Section = LODSnapshot.Sections[SectionIndex];
+
+		// Untextured materials have no density to compare
+		const int32 TextureSize = MeshSnapshot.MaterialSlots.IsValidIndex(Section.MaterialIndex) ? MeshSnapshot.MaterialSlots[Section.MaterialIndex].MaxTextureSize : 0;
+		const int64 NumIndices = static_cast<int64>(Section.NumTriangles) * 3;
+		if (TextureSize <= 0 || NumIndices == 0 || Section.FirstIndex + NumIndices > Indices.Num())
+		{
+			continue;
+		}
+
+		FSectionTexelDensity SectionDensity;
+		SectionDensity.SectionIndex = SectionIndex;
+		SectionDensity.MaterialIndex = Section.MaterialIndex;
+		SectionDensity.TextureSize = TextureSize;
+		SectionDensity.Stats = FTexelDensityEstimator::Measure(LODSnapshot.Positions, LODSnapshot.UVChannels[UVChannel], Indices.Slice(Section.FirstIndex, static_cast<int32>(NumIndices)));
+		if (SectionDensity.Stats.WorldArea > 0.0 && SectionDensity.Stats.UVArea > 0.0)
+		{
+			OutSections.Add(SectionDensity);
+		}
+	}
+
+	return true;
+}
+
+FString FStaticMeshTexelDensityRule::GenerateTexelDensityDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, TConstArrayView<FSectionTexelDensity> OffTargetSections, float TargetTexelDensity) const
+{
+	FString Description = FString::Printf(TEXT("Static mesh %s has %d section(s) off the target texel density of %.2f texels per unit:"),
+		*MeshSnapshot.AssetName, OffTargetSections.Num(), TargetTexelDensity);
+
+	for (const FSectionTexelDensity& Section : OffTargetSections)
+	{
+		const float TexelDensity = Section.GetTexelDensity();
+		Description += FString::Printf(TEXT("\n  Section %d (%s, %dpx): %.2f texels per unit, %.2fx the target"),
+			Section.SectionIndex, *MeshSnapshot.MaterialSlots[Section.MaterialIndex].MaterialPath.GetAssetName(), Section.TextureSize, TexelDensity, TexelDensity / TargetTexelDensity);
+	}
+
+	Description += TEXT("\nRescale the UVs or change the texture resolution so that surfaces of similar importance share one density.");
+	return Description;
+}
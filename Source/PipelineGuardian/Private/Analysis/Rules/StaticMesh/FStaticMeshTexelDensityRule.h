@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Analysis/IAssetCheckRule.h"
+#include "Analysis/Geometry/FTexelDensityEstimator.h"
+
+// Forward Declarations
+struct FStaticMeshAnalysisSnapshot;
+
+/**
+ * Checks the texel density of every section of a static mesh against the project target: the texels per world unit
+ * that the largest texture of the section's material gets along the surface. Also records each mesh in the
+ * project-wide FTexelDensityHistogram.
+ */
+class FStaticMeshTexelDensityRule : public IAssetCheckRule
+{
+public:
+	FStaticMeshTexelDensityRule();
+	virtual ~FStaticMeshTexelDensityRule() = default;
+
+	virtual bool Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
+	virtual FName GetRuleID() const override;
+	virtual FText GetRuleDescription() const override;
+	virtual bool IsEnabled(const UPipelineGuardianProfile* Profile) const override;
+	virtual bool SupportsSnapshot() const override { return true; }
+	virtual bool CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
+
+private:
+	/** Areas and density of one render section of LOD 0 */
+	struct FSectionTexelDensity
+	{
+		int32 SectionIndex = INDEX_NONE;
+		int32 MaterialIndex = INDEX_NONE;
+		int32 TextureSize = 0;
+		FTexelDensityStats Stats;
+
+		float GetTexelDensity() const { return Stats.GetTexelDensity(TextureSize); }
+	};
+
+	/**
+	 * Measures the sections of LOD 0 whose material samples textures.
+	 * @param MeshSnapshot Snapshot of the mesh.
+	 * @param UVChannel UV channel the materials are mapped through.
+	 * @param OutSections One entry per measured section with surface area.
+	 * @return False if LOD 0 has no such UV channel.
+	 */
+	bool AnalyzeSectionTexelDensities(const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 UVChannel, TArray<FSectionTexelDensity>& OutSections) const;
+
+	FString GenerateTexelDensityDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, TConstArrayView<FSectionTexelDensity> OffTargetSections, float TargetTexelDensity) const;
+};
@@ -78,6 +78,12 @@ FText FStaticMeshTransformRule::GetRuleDescription() const
 	return FText::FromString(TEXT("Checks for transform and pivot issues in static meshes including off-origin pivots and unapplied DCC transformations."));
 }
 
+bool FStaticMeshTransformRule::IsEnabled(const UPipelineGuardianProfile* Profile) const
+{
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	return Settings && (Settings->bEnableStaticMeshTransformPivotRule || Settings->bEnableAssetTypeSpecificPivotRules);
+}
+
 bool FStaticMeshTransformRule::HasProblematicPivot(const UStaticMesh* StaticMesh, float WarningDistance, float ErrorDistance, FVector& OutPivotOffset) const
 {
 	if (!StaticMesh)
@@ -1,6 +1,7 @@
 #include "FStaticMeshTriangleCountRule.h"
 #include "Analysis/FAssetAnalysisResult.h"
 #include "Analysis/FPipelineGuardianProfile.h"
+#include "Analysis/Snapshots/FStaticMeshAnalysisSnapshot.h"
 #include "FPipelineGuardianSettings.h"
 #include "Engine/StaticMesh.h"
 #include "PipelineGuardian.h"
@@ -19,6 +20,9 @@
 
 #define LOCTEXT_NAMESPACE "PipelineGuardian"
 
+/** Asset registry tag UStaticMesh writes with the LOD0 triangle count */
+static const FName TrianglesTagName(TEXT("Triangles"));
+
 FStaticMeshTriangleCountRule::FStaticMeshTriangleCountRule()
 {
 	// Constructor - rule ready for use
@@ -32,6 +36,38 @@ bool FStaticMeshTriangleCountRule::Check(UObject* Asset, const UPipelineGuardian
 		return false;
 	}
 
+	return CheckSnapshot(*FStaticMeshAnalysisSnapshot::Create(FAssetData(StaticMesh), StaticMesh), Profile, OutResults);
+}
+
+bool FStaticMeshTriangleCountRule::CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	const FStaticMeshAnalysisSnapshot* MeshSnapshot = FStaticMeshAnalysisSnapshot::FromSnapshot(Snapshot);
+	if (!MeshSnapshot || !Profile)
+	{
+		return false;
+	}
+
+	return CheckTriangleCount(MeshSnapshot->AssetData, MeshSnapshot->GetNumTriangles(0), Profile, OutResults);
+}
+
+bool FStaticMeshTriangleCountRule::CanCheckAssetData(const FAssetData& AssetData) const
+{
+	return AssetData.FindTag(TrianglesTagName);
+}
+
+bool FStaticMeshTriangleCountRule::CheckAssetData(const FAssetData& AssetData, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	int32 TriangleCount = 0;
+	if (!Profile || !AssetData.GetTagValue(TrianglesTagName, TriangleCount))
+	{
+		return false;
+	}
+
+	return CheckTriangleCount(AssetData, TriangleCount, Profile, OutResults);
+}
+
+bool FStaticMeshTriangleCountRule::CheckTriangleCount(const FAssetData& AssetData, int32 CurrentTriangleCount, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) const
+{
 	// Get rule configuration from profile
 	const FPipelineGuardianRuleConfig* RuleConfig = Profile->GetRuleConfigPtr(GetRuleID());
 	if (!RuleConfig || !RuleConfig->bEnabled)
@@ -51,10 +87,9 @@ bool FStaticMeshTriangleCountRule::Check(UObject* Asset, const UPipelineGuardian
 		return false;
 	}
 	
-	int32 CurrentTriangleCount = GetTriangleCount(StaticMesh, 0);
 	if (CurrentTriangleCount == 0)
 	{
-		UE_LOG(LogPipelineGuardian, Warning, TEXT("FStaticMeshTriangleCountRule: %s has zero triangles in LOD0"), *StaticMesh->GetName());
+		UE_LOG(LogPipelineGuardian, Warning, TEXT("FStaticMeshTriangleCountRule: %s has zero triangles in LOD0"), *AssetData.AssetName.ToString());
 		return false;
 	}
 	
@@ -71,11 +106,11 @@ bool FStaticMeshTriangleCountRule::Check(UObject* Asset, const UPipelineGuardian
 	{
 		FAssetAnalysisResult Result;
 		Result.RuleID = GetRuleID();
-		Result.Asset = FAssetData(StaticMesh);
+		Result.Asset = AssetData;
 		Result.Severity = Severity;
-		Result.Description = FText::FromString(GenerateTriangleCountDescription(StaticMesh, CurrentTriangleCount, 
+		Result.Description = FText::FromString(GenerateTriangleCountDescription(CurrentTriangleCount, 
 			BaseThreshold, (Severity == EAssetIssueSeverity::Warning) ? WarningPercentage : ErrorPercentage, Severity));
-		Result.FilePath = FText::FromString(StaticMesh->GetPackage()->GetName());
+		Result.FilePath = FText::FromName(AssetData.PackageName);
 
 		// Note: No fix action - Triangle count reduction should be done in external 3D tools
 		// to preserve mesh quality, UVs, and shape integrity
@@ -83,7 +118,7 @@ bool FStaticMeshTriangleCountRule::Check(UObject* Asset, const UPipelineGuardian
 		OutResults.Add(Result);
 		
 		UE_LOG(LogPipelineGuardian, Log, TEXT("FStaticMeshTriangleCountRule::Check: Triangle count issue for %s - %d triangles (thresholds: %d/%d, percentages: %.1f%%/%.1f%%)"), 
-			*StaticMesh->GetName(), CurrentTriangleCount, WarningThreshold, ErrorThreshold, WarningPercentage, ErrorPercentage);
+			*AssetData.AssetName.ToString(), CurrentTriangleCount, WarningThreshold, ErrorThreshold, WarningPercentage, ErrorPercentage);
 
 		return true;
 	}
@@ -103,15 +138,11 @@ FText FStaticMeshTriangleCountRule::GetRuleDescription() const
 		"High triangle counts can impact rendering performance, especially on lower-end devices.");
 }
 
-int32 FStaticMeshTriangleCountRule::GetTriangleCount(const UStaticMesh* StaticMesh, int32 LODIndex) const
+bool FStaticMeshTriangleCountRule::IsEnabled(const UPipelineGuardianProfile* Profile) const
 {
-	if (!StaticMesh || !StaticMesh->GetRenderData() || LODIndex >= StaticMesh->GetNumLODs())
-	{
-		return 0;
-	}
-
-	const FStaticMeshLODResources& LODResource = StaticMesh->GetRenderData()->LODResources[LODIndex];
-	return LODResource.GetNumTriangles();
+	const FPipelineGuardianRuleConfig* RuleConfig = Profile ? Profile->GetRuleConfigPtr(GetRuleID()) : nullptr;
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	return RuleConfig && RuleConfig->bEnabled && Settings && Settings->bEnableStaticMeshTriangleCountRule;
 }
 
 EAssetIssueSeverity FStaticMeshTriangleCountRule::DetermineSeverity(int32 TriangleCount, int32 WarningThreshold, int32 ErrorThreshold) const
@@ -131,7 +162,7 @@ EAssetIssueSeverity FStaticMeshTriangleCountRule::DetermineSeverity(int32 Triang
 // Note: Auto-fix methods removed - Triangle count reduction should be done in external 3D tools
 // to preserve mesh quality, UVs, and shape integrity
 
-FString FStaticMeshTriangleCountRule::GenerateTriangleCountDescription(const UStaticMesh* StaticMesh, int32 TriangleCount, int32 BaseThreshold, float PercentageThreshold, EAssetIssueSeverity Severity) const
+FString FStaticMeshTriangleCountRule::GenerateTriangleCountDescription(int32 TriangleCount, int32 BaseThreshold, float PercentageThreshold, EAssetIssueSeverity Severity) const
 {
 	// Calculate how much the mesh exceeds the base threshold
 	float ExcessPercentage = ((float)(TriangleCount - BaseThreshold) / (float)BaseThreshold) * 100.0f;
@@ -7,6 +7,8 @@
 class UStaticMesh;
 class UPipelineGuardianProfile;
 struct FAssetAnalysisResult;
+struct FAssetData;
+struct FStaticMeshAnalysisSnapshot;
 enum class EAssetIssueSeverity : uint8;
 
 /**
@@ -24,15 +26,22 @@ public:
 	virtual bool Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
 	virtual FName GetRuleID() const override;
 	virtual FText GetRuleDescription() const override;
+	virtual bool IsEnabled(const UPipelineGuardianProfile* Profile) const override;
+	virtual bool SupportsSnapshot() const override { return true; }
+	virtual bool CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
+	virtual bool CanCheckAssetData(const FAssetData& AssetData) const override;
+	virtual bool CheckAssetData(const FAssetData& AssetData, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
 
 private:
 	/**
-	 * Get triangle count for a specific LOD level
-	 * @param StaticMesh The mesh to analyze
-	 * @param LODIndex The LOD level to check (0 = highest detail)
-	 * @return Number of triangles in the specified LOD
+	 * Shared by the snapshot and asset registry paths once the LOD0 triangle count is known
+	 * @param AssetData The asset being checked
+	 * @param CurrentTriangleCount LOD0 triangle count
+	 * @param Profile The current pipeline guardian profile
+	 * @param OutResults Array to populate with any issues found
+	 * @return True if an issue was found
 	 */
-	int32 GetTriangleCount(const UStaticMesh* StaticMesh, int32 LODIndex = 0) const;
+	bool CheckTriangleCount(const FAssetData& AssetData, int32 CurrentTriangleCount, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) const;
 
 	/**
 	 * Determine severity based on triangle count and thresholds
@@ -50,12 +59,11 @@ private:
 
 	/**
 	 * Generate detailed description of triangle count issues
-	 * @param StaticMesh The mesh being analyzed
 	 * @param TriangleCount Current triangle count
 	 * @param BaseThreshold Base triangle count threshold
 	 * @param PercentageThreshold Percentage threshold that was exceeded
 	 * @param Severity Issue severity
 	 * @return Formatted description string
 	 */
-	FString GenerateTriangleCountDescription(const UStaticMesh* StaticMesh, int32 TriangleCount, int32 BaseThreshold, float PercentageThreshold, EAssetIssueSeverity Severity) const;
+	FString GenerateTriangleCountDescription(int32 TriangleCount, int32 BaseThreshold, float PercentageThreshold, EAssetIssueSeverity Severity) const;
 }; 
\ No newline at end of file
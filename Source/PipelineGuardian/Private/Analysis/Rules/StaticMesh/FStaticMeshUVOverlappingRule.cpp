@@ -1,6 +1,8 @@
 #include "Analysis/Rules/StaticMesh/FStaticMeshUVOverlappingRule.h"
 #include "Analysis/FAssetAnalysisResult.h"
 #include "Analysis/FPipelineGuardianProfile.h"
+#include "Analysis/Snapshots/FStaticMeshAnalysisSnapshot.h"
+#include "Analysis/Geometry/FUVOverlapDetector.h"
 #include "PipelineGuardian.h"
 
 // Engine includes
@@ -19,16 +21,35 @@
 
 DEFINE_LOG_CATEGORY_STATIC(LogUVOverlappingRule, Log, All);
 
+namespace UVOverlappingRule
+{
+	/** Gutter kept around lightmap charts, in texels, when reporting texels lost to padding */
+	constexpr int32 LightmapPaddingTexels = 1;
+}
+
 FStaticMeshUVOverlappingRule::FStaticMeshUVOverlappingRule()
 {
 	UE_LOG(LogUVOverlappingRule, Log, TEXT("FStaticMeshUVOverlappingRule: Initialized UV Overlapping Rule"));
 }
 
 bool FStaticMeshUVOverlappingRule::Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	// Cast to static mesh
+	UStaticMesh* StaticMesh = Cast<UStaticMesh>(Asset);
+	if (!StaticMesh)
+	{
+		UE_LOG(LogUVOverlappingRule, Warning, TEXT("FStaticMeshUVOverlappingRule::Check: Not a StaticMesh asset"));
+		return false;
+	}
+
+	return CheckSnapshot(*FStaticMeshAnalysisSnapshot::Create(FAssetData(StaticMesh), StaticMesh), Profile, OutResults);
+}
+
+bool FStaticMeshUVOverlappingRule::CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
 {
 	if (!Profile)
 	{
-		UE_LOG(LogUVOverlappingRule, Warning, TEXT("FStaticMeshUVOverlappingRule::Check: No profile provided"));
+		UE_LOG(LogUVOverlappingRule, Warning, TEXT("FStaticMeshUVOverlappingRule::CheckSnapshot: No profile provided"));
 		return false;
 	}
 
@@ -38,21 +59,20 @@ bool FStaticMeshUVOverlappingRule::Check(UObject* Asset, const UPipelineGuardian
 		return true;
 	}
 
-	// Cast to static mesh
-	UStaticMesh* StaticMesh = Cast<UStaticMesh>(Asset);
-	if (!StaticMesh)
+	const FStaticMeshAnalysisSnapshot* MeshSnapshot = FStaticMeshAnalysisSnapshot::FromSnapshot(Snapshot);
+	if (!MeshSnapshot)
 	{
-		UE_LOG(LogUVOverlappingRule, Warning, TEXT("FStaticMeshUVOverlappingRule::Check: Not a StaticMesh asset"));
+		UE_LOG(LogUVOverlappingRule, Warning, TEXT("FStaticMeshUVOverlappingRule::CheckSnapshot: Not a StaticMesh snapshot"));
 		return false;
 	}
 
-	UE_LOG(LogUVOverlappingRule, Verbose, TEXT("FStaticMeshUVOverlappingRule::Check: Analyzing UV overlaps for: %s"), *StaticMesh->GetName());
+	UE_LOG(LogUVOverlappingRule, Verbose, TEXT("FStaticMeshUVOverlappingRule::CheckSnapshot: Analyzing UV overlaps for: %s"), *MeshSnapshot->AssetName);
 
 	// Analyze UV overlaps
 	TArray<FUVOverlapInfo> OverlapInfos;
-	if (!AnalyzeStaticMeshUVOverlaps(StaticMesh, Profile, OverlapInfos))
+	if (!AnalyzeStaticMeshUVOverlaps(*MeshSnapshot, Profile, OverlapInfos))
 	{
-		UE_LOG(LogUVOverlappingRule, Warning, TEXT("FStaticMeshUVOverlappingRule::Check: Failed to analyze UV overlaps for: %s"), *StaticMesh->GetName());
+		UE_LOG(LogUVOverlappingRule, Warning, TEXT("FStaticMeshUVOverlappingRule::CheckSnapshot: Failed to analyze UV overlaps for: %s"), *MeshSnapshot->AssetName);
 		return false;
 	}
 
@@ -62,20 +82,18 @@ bool FStaticMeshUVOverlappingRule::Check(UObject* Asset, const UPipelineGuardian
 		if (OverlapInfo.OverlappingTriangleCount > 0)
 		{
 			FAssetAnalysisResult Result;
-			// Create a temporary FAssetData for the result
-			FAssetData AssetData(StaticMesh);
-			Result.Asset = AssetData;
+			Result.Asset = MeshSnapshot->AssetData;
 			Result.RuleID = GetRuleID();
-			Result.Severity = DetermineOverlapSeverity(OverlapInfo, Profile);
-			Result.Description = FText::FromString(GenerateOverlapDescription(OverlapInfo, StaticMesh));
+			Result.Severity = DetermineOverlapSeverity(OverlapInfo, *MeshSnapshot, Profile);
+			Result.Description = FText::FromString(GenerateOverlapDescription(OverlapInfo, *MeshSnapshot));
 
 			// Note: Auto-fix not provided for UV overlaps - use external tools like Blender for proper UV unwrapping
 			// This ensures artist maintains full control over UV layout and quality
 
 			OutResults.Add(Result);
 			
-			UE_LOG(LogUVOverlappingRule, Log, TEXT("FStaticMeshUVOverlappingRule::Check: Found UV overlaps in channel %d for %s - %d triangles (%.1f%% overlap)"), 
-				OverlapInfo.UVChannel, *StaticMesh->GetName(), OverlapInfo.OverlappingTriangleCount, OverlapInfo.OverlapPercentage);
+			UE_LOG(LogUVOverlappingRule, Log, TEXT("FStaticMeshUVOverlappingRule::CheckSnapshot: Found UV overlaps in channel %d for %s - %d triangles (%.1f%% overlap)"), 
+				OverlapInfo.UVChannel, *MeshSnapshot->AssetName, OverlapInfo.OverlappingTriangleCount, OverlapInfo.OverlapPercentage);
 		}
 	}
 
@@ -92,20 +110,25 @@ FText FStaticMeshUVOverlappingRule::GetRuleDescription() const
 	return LOCTEXT("UVOverlappingRuleDescription", "Detects overlapping UV coordinates in Static Mesh assets that can cause lightmap baking issues and texture artifacts.");
 }
 
-bool FStaticMeshUVOverlappingRule::AnalyzeStaticMeshUVOverlaps(UStaticMesh* StaticMesh, const UPipelineGuardianProfile* Profile, TArray<FUVOverlapInfo>& OutOverlaps) const
+bool FStaticMeshUVOverlappingRule::IsEnabled(const UPipelineGuardianProfile* Profile) const
+{
+	return Profile && Profile->IsRuleEnabled(GetRuleID());
+}
+
+bool FStaticMeshUVOverlappingRule::AnalyzeStaticMeshUVOverlaps(const FStaticMeshAnalysisSnapshot& MeshSnapshot, const UPipelineGuardianProfile* Profile, TArray<FUVOverlapInfo>& OutOverlaps) const
 {
-	if (!StaticMesh || !Profile)
+	if (!Profile)
 	{
 		return false;
 	}
 
-	// Get the mesh description for LOD 0
-	const FMeshDescription* MeshDescription = StaticMesh->GetMeshDescription(0);
-	if (!MeshDescription)
+	// Analyze the render data of LOD 0
+	if (MeshSnapshot.GetNumLODs() == 0)
 	{
-		UE_LOG(LogUVOverlappingRule, Warning, TEXT("FStaticMeshUVOverlappingRule::AnalyzeStaticMeshUVOverlaps: No mesh description available for %s"), *StaticMesh->GetName());
+		UE_LOG(LogUVOverlappingRule, Warning, TEXT("FStaticMeshUVOverlappingRule::AnalyzeStaticMeshUVOverlaps: No render data available for %s"), *MeshSnapshot.AssetName);
 		return false;
 	}
+	const FStaticMeshLODSnapshot& LODSnapshot = MeshSnapshot.LODs[0];
 
 	// Check which UV channels to analyze
 	for (int32 UVChannel = 0; UVChannel < 8; ++UVChannel)
@@ -115,7 +138,7 @@ bool FStaticMeshUVOverlappingRule::AnalyzeStaticMeshUVOverlaps(UStaticMesh* Stat
 			continue;
 		}
 
-		if (!IsValidUVChannel(MeshDescription, UVChannel))
+		if (!IsValidUVChannel(LODSnapshot, UVChannel))
 		{
 			continue;
 		}
@@ -124,8 +147,9 @@ bool FStaticMeshUVOverlappingRule::AnalyzeStaticMeshUVOverlaps(UStaticMesh* Stat
 		FUVOverlapInfo OverlapInfo;
 		OverlapInfo.UVChannel = UVChannel;
 		
-		float OverlapTolerance = GetOverlapToleranceForChannel(Profile, UVChannel);
-		if (AnalyzeUVChannelOverlaps(MeshDescription, UVChannel, OverlapTolerance, OverlapInfo))
+		float OverlapTolerance = GetOverlapToleranceForChannel(Profile, MeshSnapshot, UVChannel);
+		int32 RasterResolution = GetRasterResolutionForChannel(Profile, MeshSnapshot, UVChannel);
+		if (AnalyzeUVChannelOverlaps(LODSnapshot, UVChannel, OverlapTolerance, RasterResolution, OverlapInfo))
 		{
 			OutOverlaps.Add(OverlapInfo);
 		}
@@ -134,243 +158,61 @@ bool FStaticMeshUVOverlappingRule::AnalyzeStaticMeshUVOverlaps(UStaticMesh* Stat
 	return true;
 }
 
-bool FStaticMeshUVOverlappingRule::AnalyzeUVChannelOverlaps(const FMeshDescription* MeshDescription, int32 UVChannel, float OverlapTolerance, FUVOverlapInfo& OutOverlapInfo) const
+bool FStaticMeshUVOverlappingRule::AnalyzeUVChannelOverlaps(const FStaticMeshLODSnapshot& LODSnapshot, int32 UVChannel, float OverlapTolerance, int32 RasterResolution, FUVOverlapInfo& OutOverlapInfo) const
 {
-	if (!MeshDescription || UVChannel < 0)
-	{
-		return false;
-	}
-
-	// Build triangle UV bounds for this channel
-	TArray<FTriangleUVBounds> TriangleBounds = BuildTriangleUVBounds(MeshDescription, UVChannel);
-	if (TriangleBounds.Num() == 0)
+	if (!IsValidUVChannel(LODSnapshot, UVChannel))
 	{
 		return false;
 	}
 
-	// Detect overlapping triangles
-	TArray<FTriangleID> OverlappingTriangles;
-	DetectOverlappingTriangles(TriangleBounds, OverlapTolerance, OverlappingTriangles);
-	
-	// Debug logging to help diagnose false positives
-	UE_LOG(LogUVOverlappingRule, Log, TEXT("UV Channel %d: %d triangles, tolerance %.4f, found %d overlapping"), 
-		UVChannel, TriangleBounds.Num(), OverlapTolerance, OverlappingTriangles.Num());
-	
-	// Use simplified heuristic approach until we implement proper UV space intersection detection
-	// Focus on common issues rather than perfect geometric analysis
-	
-	// Check for obviously problematic cases:
-	// 1. All triangles have identical UV coordinates (common import issue)
-	// 2. UVs are outside 0-1 range (tiling/clamping issues)  
-	// 3. Extremely small UV area relative to 3D area (compression artifacts)
-	
-	bool bFoundIssue = false;
-	FString IssueDescription;
-	
-	// Simple heuristic: Check if all triangles have very similar UV bounds
-	if (TriangleBounds.Num() > 4)
-	{
-		int32 SimilarBoundsCount = 0;
-		FVector2D FirstBoundSize = TriangleBounds[0].MaxUV - TriangleBounds[0].MinUV;
-		
-		for (int32 i = 1; i < TriangleBounds.Num(); ++i)
-		{
-			FVector2D BoundSize = TriangleBounds[i].MaxUV - TriangleBounds[i].MinUV;
-			if ((BoundSize - FirstBoundSize).SizeSquared() < 0.0001f)
-			{
-				SimilarBoundsCount++;
-			}
-		}
-		
-		// If more than 80% of triangles have identical UV bounds, flag as potential issue
-		float SimilarityRatio = (float)SimilarBoundsCount / (float)TriangleBounds.Num();
-		if (SimilarityRatio > 0.8f)
-		{
-			bFoundIssue = true;
-			IssueDescription = FString::Printf(
-				TEXT("UV Channel %d: %.1f%% of triangles have identical UV bounds - possible unwrapping issue"),
-				UVChannel, SimilarityRatio * 100.0f
-			);
-			OutOverlapInfo.OverlappingTriangleCount = FMath::RoundToInt(SimilarityRatio * TriangleBounds.Num());
-			OutOverlapInfo.OverlapPercentage = SimilarityRatio * 100.0f;
-			OutOverlapInfo.DetailedDescription = IssueDescription;
-		}
-	}
-	
-	return bFoundIssue;
-}
-
-TArray<FStaticMeshUVOverlappingRule::FTriangleUVBounds> FStaticMeshUVOverlappingRule::BuildTriangleUVBounds(const FMeshDescription* MeshDescription, int32 UVChannel) const
-{
-	TArray<FTriangleUVBounds> TriangleBounds;
-
-	if (!MeshDescription)
-	{
-		return TriangleBounds;
-	}
-
-	// Get UV attribute data
-	FStaticMeshConstAttributes Attributes(*MeshDescription);
-	auto UVs = Attributes.GetVertexInstanceUVs();
-	
-	if (!UVs.IsValid() || UVChannel >= UVs.GetNumChannels())
-	{
-		return TriangleBounds;
-	}
-
-	// Iterate through all triangles
-	for (FTriangleID TriangleID : MeshDescription->Triangles().GetElementIDs())
-	{
-		FTriangleUVBounds Bounds;
-		GetTriangleUVBounds(MeshDescription, TriangleID, UVChannel, Bounds);
-		
-		if (Bounds.GetArea() > 0.0f) // Only add triangles with valid UV area
-		{
-			TriangleBounds.Add(Bounds);
-		}
-	}
-
-	return TriangleBounds;
-}
-
-void FStaticMeshUVOverlappingRule::GetTriangleUVBounds(const FMeshDescription* MeshDescription, FTriangleID TriangleID, int32 UVChannel, FTriangleUVBounds& OutBounds) const
-{
-	if (!MeshDescription)
-	{
-		return;
-	}
-
-	FStaticMeshConstAttributes Attributes(*MeshDescription);
-	auto UVs = Attributes.GetVertexInstanceUVs();
-	
-	if (!UVs.IsValid() || UVChannel >= UVs.GetNumChannels())
-	{
-		return;
-	}
-
-	OutBounds.TriangleID = TriangleID;
-	OutBounds.MinUV = FVector2D(MAX_flt, MAX_flt);
-	OutBounds.MaxUV = FVector2D(-MAX_flt, -MAX_flt);
-
-	// Get vertex instances for this triangle
-	TArrayView<const FVertexInstanceID> VertexInstancesView = MeshDescription->GetTriangleVertexInstances(TriangleID);
-	TArray<FVertexInstanceID> VertexInstances(VertexInstancesView.GetData(), VertexInstancesView.Num());
-	
-	for (FVertexInstanceID VertexInstanceID : VertexInstances)
-	{
-		FVector2f UVf = UVs.Get(VertexInstanceID, UVChannel);
-		FVector2D UV(UVf.X, UVf.Y);
-		
-		// Debug: Log UV coordinates to see what we're actually getting
-		UE_LOG(LogUVOverlappingRule, VeryVerbose, TEXT("Triangle %d, Vertex %d, UV: (%.4f, %.4f)"), 
-			TriangleID.GetValue(), VertexInstanceID.GetValue(), UV.X, UV.Y);
-		
-		OutBounds.MinUV.X = FMath::Min(OutBounds.MinUV.X, UV.X);
-		OutBounds.MinUV.Y = FMath::Min(OutBounds.MinUV.Y, UV.Y);
-		OutBounds.MaxUV.X = FMath::Max(OutBounds.MaxUV.X, UV.X);
-		OutBounds.MaxUV.Y = FMath::Max(OutBounds.MaxUV.Y, UV.Y);
-	}
-	
-	// Debug: Log final bounding box for this triangle
-	UE_LOG(LogUVOverlappingRule, Verbose, TEXT("Triangle %d bounds: Min(%.4f, %.4f) Max(%.4f, %.4f) Area=%.6f"), 
-		TriangleID.GetValue(), OutBounds.MinUV.X, OutBounds.MinUV.Y, 
-		OutBounds.MaxUV.X, OutBounds.MaxUV.Y, OutBounds.GetArea());
-}
+	FUVOverlapStats OverlapStats = FUVOverlapDetector::Detect(LODSnapshot.UVChannels[UVChannel], LODSnapshot.Indices, OverlapTolerance);
 
-void FStaticMeshUVOverlappingRule::DetectOverlappingTriangles(const TArray<FTriangleUVBounds>& TriangleBounds, float Tolerance, TArray<FTriangleID>& OutOverlappingTriangles) const
-{
-	OutOverlappingTriangles.Empty();
+	UE_LOG(LogUVOverlappingRule, Verbose, TEXT("UV Channel %d: %d triangles, tolerance %.4f, found %d overlapping (%.1f%% of UV area)"), 
+		UVChannel, OverlapStats.NumTriangles, OverlapTolerance, OverlapStats.GetNumOverlappingTriangles(), OverlapStats.GetOverlapPercentage());
 
-	// Simple brute force overlap detection (can be optimized with spatial partitioning if needed)
-	for (int32 i = 0; i < TriangleBounds.Num(); ++i)
+	if (OverlapStats.GetNumOverlappingTriangles() == 0)
 	{
-		bool bFoundOverlap = false;
-		
-		for (int32 j = i + 1; j < TriangleBounds.Num(); ++j)
-		{
-			if (TriangleBounds[i].Overlaps(TriangleBounds[j], Tolerance))
-			{
-				if (!bFoundOverlap)
-				{
-					OutOverlappingTriangles.AddUnique(TriangleBounds[i].TriangleID);
-					bFoundOverlap = true;
-				}
-				OutOverlappingTriangles.AddUnique(TriangleBounds[j].TriangleID);
-			}
-		}
+		return false;
 	}
-}
 
-bool FStaticMeshUVOverlappingRule::FTriangleUVBounds::Overlaps(const FTriangleUVBounds& Other, float Tolerance) const
-{
-	// Calculate the overlap area between two bounding boxes
-	float OverlapWidth = FMath::Max(0.0f, FMath::Min(MaxUV.X, Other.MaxUV.X) - FMath::Max(MinUV.X, Other.MinUV.X));
-	float OverlapHeight = FMath::Max(0.0f, FMath::Min(MaxUV.Y, Other.MaxUV.Y) - FMath::Max(MinUV.Y, Other.MinUV.Y));
-	float OverlapArea = OverlapWidth * OverlapHeight;
-	
-	// Only consider it an overlap if the area is significant (more than just edge touching)
-	float MinArea = FMath::Min(GetArea(), Other.GetArea());
-	float OverlapThreshold = MinArea * Tolerance; // Tolerance as percentage of smaller triangle
-	
-	return OverlapArea > OverlapThreshold;
-}
+	OutOverlapInfo.OverlappingTriangleCount = OverlapStats.GetNumOverlappingTriangles();
+	OutOverlapInfo.OverlapPercentage = OverlapStats.GetOverlapPercentage();
+	OutOverlapInfo.OverlappingTriangles = MoveTemp(OverlapStats.OverlappingTriangles);
 
-float FStaticMeshUVOverlappingRule::CalculateOverlapPercentage(const TArray<FTriangleUVBounds>& AllBounds, const TArray<FTriangleID>& OverlappingTriangles) const
-{
-	if (AllBounds.Num() == 0)
+	// Measure the overlaps in texels, as the baker or sampler sees them. Overlaps thinner than a texel do not show up.
+	if (RasterResolution > 0)
 	{
-		return 0.0f;
-	}
+		OutOverlapInfo.Coverage = FUVCoverageRasterizer::Rasterize(LODSnapshot.UVChannels[UVChannel], LODSnapshot.Indices, RasterResolution, UVOverlappingRule::LightmapPaddingTexels);
 
-	float TotalArea = 0.0f;
-	float OverlappingArea = 0.0f;
+		UE_LOG(LogUVOverlappingRule, Verbose, TEXT("UV Channel %d: rasterized at %dx%d, %lld covered texels, %lld overlapped (%.1f%%), %lld padding"),
+			UVChannel, OutOverlapInfo.Coverage.Resolution, OutOverlapInfo.Coverage.Resolution, OutOverlapInfo.Coverage.NumCoveredTexels,
+			OutOverlapInfo.Coverage.NumOverlappedTexels, OutOverlapInfo.Coverage.GetOverlapPercentage(), OutOverlapInfo.Coverage.NumPaddingTexels);
 
-	// Calculate total surface area
-	for (const FTriangleUVBounds& Bounds : AllBounds)
-	{
-		TotalArea += Bounds.GetArea();
-	}
-
-	// Calculate overlapping area
-	for (const FTriangleUVBounds& Bounds : AllBounds)
-	{
-		if (OverlappingTriangles.Contains(Bounds.TriangleID))
+		if (OutOverlapInfo.Coverage.NumOverlappedTexels == 0)
 		{
-			OverlappingArea += Bounds.GetArea();
+			return false;
 		}
+		OutOverlapInfo.OverlapPercentage = OutOverlapInfo.Coverage.GetOverlapPercentage();
 	}
 
-	return TotalArea > 0.0f ? (OverlappingArea / TotalArea) * 100.0f : 0.0f;
+	return true;
 }
 
-bool FStaticMeshUVOverlappingRule::IsValidUVChannel(const FMeshDescription* MeshDescription, int32 UVChannel) const
+bool FStaticMeshUVOverlappingRule::IsValidUVChannel(const FStaticMeshLODSnapshot& LODSnapshot, int32 UVChannel) const
 {
-	if (!MeshDescription || UVChannel < 0)
-	{
-		return false;
-	}
-
-	FStaticMeshConstAttributes Attributes(*MeshDescription);
-	auto UVs = Attributes.GetVertexInstanceUVs();
-	
-	return UVs.IsValid() && UVChannel < UVs.GetNumChannels();
+	return LODSnapshot.UVChannels.IsValidIndex(UVChannel);
 }
 
-bool FStaticMeshUVOverlappingRule::HasValidUVCoordinates(const FMeshDescription* MeshDescription, int32 UVChannel) const
+bool FStaticMeshUVOverlappingRule::HasValidUVCoordinates(const FStaticMeshLODSnapshot& LODSnapshot, int32 UVChannel) const
 {
-	if (!IsValidUVChannel(MeshDescription, UVChannel))
+	if (!IsValidUVChannel(LODSnapshot, UVChannel))
 	{
 		return false;
 	}
 
-	FStaticMeshConstAttributes Attributes(*MeshDescription);
-	auto UVs = Attributes.GetVertexInstanceUVs();
-
 	// Check if any UV coordinates are non-zero
-	for (FVertexInstanceID VertexInstanceID : MeshDescription->VertexInstances().GetElementIDs())
+	for (const FVector2f& UV : LODSnapshot.UVChannels[UVChannel])
 	{
-		FVector2f UVf = UVs.Get(VertexInstanceID, UVChannel);
-		FVector2D UV(UVf.X, UVf.Y);
 		if (!UV.IsNearlyZero())
 		{
 			return true;
@@ -380,15 +222,15 @@ bool FStaticMeshUVOverlappingRule::HasValidUVCoordinates(const FMeshDescription*
 	return false;
 }
 
-EAssetIssueSeverity FStaticMeshUVOverlappingRule::DetermineOverlapSeverity(const FUVOverlapInfo& OverlapInfo, const UPipelineGuardianProfile* Profile) const
+EAssetIssueSeverity FStaticMeshUVOverlappingRule::DetermineOverlapSeverity(const FUVOverlapInfo& OverlapInfo, const FStaticMeshAnalysisSnapshot& MeshSnapshot, const UPipelineGuardianProfile* Profile) const
 {
 	if (!Profile)
 	{
 		return EAssetIssueSeverity::Warning;
 	}
 
-	// Check if this is a lightmap channel (more critical)
-	bool bIsLightmapChannel = false; // We'll implement this check when we have StaticMesh context
+	// Lightmap channels use the stricter thresholds
+	bool bIsLightmapChannel = IsLightmapChannel(MeshSnapshot, OverlapInfo.UVChannel);
 	
 	return GetSeverityForOverlapPercentage(Profile, OverlapInfo.OverlapPercentage, bIsLightmapChannel);
 }
@@ -462,27 +304,45 @@ void FStaticMeshUVOverlappingRule::PerformAutoUnwrap(UStaticMesh* StaticMesh, in
 	RegenerateUVChannel(StaticMesh, UVChannel);
 }
 
-FString FStaticMeshUVOverlappingRule::GenerateOverlapDescription(const FUVOverlapInfo& OverlapInfo, UStaticMesh* StaticMesh) const
+FString FStaticMeshUVOverlappingRule::GenerateOverlapDescription(const FUVOverlapInfo& OverlapInfo, const FStaticMeshAnalysisSnapshot& MeshSnapshot) const
 {
-	FString ChannelName = GetUVChannelUsageName(OverlapInfo.UVChannel, StaticMesh);
-	
-	return FString::Printf(
-		TEXT("UV Overlaps detected in %s: %d triangles (%.1f%% of surface area) have overlapping UV coordinates. This may cause texture artifacts and lightmap baking issues."),
+	FString ChannelName = GetUVChannelUsageName(OverlapInfo.UVChannel, MeshSnapshot);
+	const FUVCoverageStats& Coverage = OverlapInfo.Coverage;
+
+	if (Coverage.Resolution == 0)
+	{
+		return FString::Printf(
+			TEXT("UV Overlaps detected in %s: %d triangles overlap each other on %.1f%% of the UV area. This may cause texture artifacts and lightmap baking issues."),
+			*ChannelName,
+			OverlapInfo.OverlappingTriangleCount,
+			OverlapInfo.OverlapPercentage
+		);
+	}
+
+	FString Description = FString::Printf(
+		TEXT("UV Overlaps detected in %s: %d triangles overlap, covering %lld of %lld used texels (%.1f%%) at %dx%d. This may cause texture artifacts and lightmap baking issues."),
 		*ChannelName,
 		OverlapInfo.OverlappingTriangleCount,
-		OverlapInfo.OverlapPercentage
+		Coverage.NumOverlappedTexels,
+		Coverage.NumCoveredTexels,
+		OverlapInfo.OverlapPercentage,
+		Coverage.Resolution,
+		Coverage.Resolution
 	);
-}
 
-FString FStaticMeshUVOverlappingRule::GetUVChannelUsageName(int32 UVChannel, UStaticMesh* StaticMesh) const
-{
-	if (!StaticMesh)
+	if (IsLightmapChannel(MeshSnapshot, OverlapInfo.UVChannel))
 	{
-		return FString::Printf(TEXT("UV Channel %d"), UVChannel);
+		Description += FString::Printf(TEXT(" The layout occupies %.1f%% of the lightmap and %.1f%% is lost to padding."),
+			Coverage.GetOccupiedFraction() * 100.0f, Coverage.GetPaddingFraction() * 100.0f);
 	}
 
+	return Description;
+}
+
+FString FStaticMeshUVOverlappingRule::GetUVChannelUsageName(int32 UVChannel, const FStaticMeshAnalysisSnapshot& MeshSnapshot) const
+{
 	// Check if this is the lightmap channel
-	if (IsLightmapChannel(StaticMesh, UVChannel))
+	if (IsLightmapChannel(MeshSnapshot, UVChannel))
 	{
 		return FString::Printf(TEXT("UV Channel %d (Lightmap)"), UVChannel);
 	}
@@ -496,36 +356,48 @@ FString FStaticMeshUVOverlappingRule::GetUVChannelUsageName(int32 UVChannel, USt
 	}
 }
 
-bool FStaticMeshUVOverlappingRule::IsLightmapChannel(UStaticMesh* StaticMesh, int32 UVChannel) const
+bool FStaticMeshUVOverlappingRule::IsLightmapChannel(const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 UVChannel) const
 {
-	if (!StaticMesh)
-	{
-		return false;
-	}
-
-	return StaticMesh->GetLightMapCoordinateIndex() == UVChannel;
+	return MeshSnapshot.LightMapCoordinateIndex == UVChannel;
 }
 
 // Configuration parameter helpers - these read from the profile configuration
-float FStaticMeshUVOverlappingRule::GetOverlapToleranceForChannel(const UPipelineGuardianProfile* Profile, int32 UVChannel) const
+float FStaticMeshUVOverlappingRule::GetOverlapToleranceForChannel(const UPipelineGuardianProfile* Profile, const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 UVChannel) const
 {
+	const bool bIsLightmapChannel = IsLightmapChannel(MeshSnapshot, UVChannel);
 	if (!Profile)
 	{
 		// Default tolerance values
+		if (bIsLightmapChannel) return 0.0005f; // Very strict for the lightmap channel
 		if (UVChannel == 0) return PipelineGuardianConstants::PRIMARY_UV_TOLERANCE;
-		if (UVChannel == 1) return 0.0005f; // Very strict for lightmap channel typically
 		return 0.002f; // More lenient for other channels
 	}
 
-	// Check if this is likely a lightmap channel and use appropriate tolerance
+	// Tolerance is the depth in UV units by which two triangles must interpenetrate to count as overlapping
 	FString TextureToleranceStr = Profile->GetRuleParameter(GetRuleID(), TEXT("TextureUVTolerance"), TEXT("0.001"));
 	FString LightmapToleranceStr = Profile->GetRuleParameter(GetRuleID(), TEXT("LightmapUVTolerance"), TEXT("0.0005"));
 	
-	// For now, assume channel 1 is lightmap (could be improved to check actual lightmap channel index)
-	float Tolerance = (UVChannel == 1) ? FCString::Atof(*LightmapToleranceStr) : FCString::Atof(*TextureToleranceStr);
+	float Tolerance = bIsLightmapChannel ? FCString::Atof(*LightmapToleranceStr) : FCString::Atof(*TextureToleranceStr);
 	return FMath::Clamp(Tolerance, 0.0001f, 0.01f);
 }
 
+int32 FStaticMeshUVOverlappingRule::GetRasterResolutionForChannel(const UPipelineGuardianProfile* Profile, const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 UVChannel) const
+{
+	if (!Profile || Profile->GetRuleParameter(GetRuleID(), TEXT("RasterizeOverlaps"), TEXT("true")) != TEXT("true"))
+	{
+		return 0;
+	}
+
+	// Lightmap channels are measured at the resolution they are baked at
+	if (IsLightmapChannel(MeshSnapshot, UVChannel) && MeshSnapshot.LightMapResolution > 0)
+	{
+		return FMath::Min(MeshSnapshot.LightMapResolution, FUVCoverageRasterizer::MaxResolution);
+	}
+
+	int32 Resolution = FCString::Atoi(*Profile->GetRuleParameter(GetRuleID(), TEXT("TextureRasterResolution"), TEXT("1024")));
+	return FMath::Clamp(Resolution, 0, FUVCoverageRasterizer::MaxResolution);
+}
+
 bool FStaticMeshUVOverlappingRule::ShouldCheckUVChannel(const UPipelineGuardianProfile* Profile, int32 UVChannel) const
 {
 	if (!Profile)
@@ -2,14 +2,15 @@
 
 #include "CoreMinimal.h"
 #include "Analysis/IAssetCheckRule.h"
+#include "Analysis/Geometry/FUVCoverageRasterizer.h"
 #include "Engine/StaticMesh.h"
 
 // Forward declarations
 enum class EAssetIssueSeverity : uint8;
 class UPipelineGuardianProfile;
 struct FAssetAnalysisResult;
-struct FVertexInstanceID;
-struct FTriangleID;
+struct FStaticMeshAnalysisSnapshot;
+struct FStaticMeshLODSnapshot;
 
 /**
  * UV Overlapping Detection and Analysis Rule for Static Meshes
@@ -24,6 +25,7 @@ struct FTriangleID;
  * - Multi-channel UV analysis (UV0-UV7)
  * - Configurable overlap tolerance
  * - Triangle-level overlap detection
+ * - Texel-level overlap measurement at lightmap (or configured texture) resolution
  * - Automatic unwrapping fix capabilities
  * - Lightmap-specific validation
  */
@@ -37,6 +39,9 @@ public:
 	virtual bool Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
 	virtual FName GetRuleID() const override;
 	virtual FText GetRuleDescription() const override;
+	virtual bool IsEnabled(const UPipelineGuardianProfile* Profile) const override;
+	virtual bool SupportsSnapshot() const override { return true; }
+	virtual bool CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
 
 private:
 	/**
@@ -47,8 +52,11 @@ private:
 		int32 UVChannel;
 		int32 OverlappingTriangleCount;
 		float OverlapPercentage;
-		TArray<FTriangleID> OverlappingTriangles;
+		TArray<int32> OverlappingTriangles;
 		FString DetailedDescription;
+
+		/** Rasterized coverage; Resolution is 0 when the channel was not rasterized */
+		FUVCoverageStats Coverage;
 		
 		FUVOverlapInfo()
 			: UVChannel(0)
@@ -57,41 +65,17 @@ private:
 		{}
 	};
 
-	/**
-	 * Triangle UV bounds for overlap testing
-	 */
-	struct FTriangleUVBounds
-	{
-		FVector2D MinUV;
-		FVector2D MaxUV;
-		FTriangleID TriangleID;
-		
-		FTriangleUVBounds() : MinUV(FVector2D::ZeroVector), MaxUV(FVector2D::ZeroVector) {}
-		FTriangleUVBounds(const FVector2D& InMinUV, const FVector2D& InMaxUV, FTriangleID InTriangleID)
-			: MinUV(InMinUV), MaxUV(InMaxUV), TriangleID(InTriangleID) {}
-			
-		bool Overlaps(const FTriangleUVBounds& Other, float Tolerance = 0.001f) const;
-		float GetArea() const { return (MaxUV.X - MinUV.X) * (MaxUV.Y - MinUV.Y); }
-	};
-
-	// Core analysis functions
-	bool AnalyzeStaticMeshUVOverlaps(UStaticMesh* StaticMesh, const UPipelineGuardianProfile* Profile, TArray<FUVOverlapInfo>& OutOverlaps) const;
-	bool AnalyzeUVChannelOverlaps(const FMeshDescription* MeshDescription, int32 UVChannel, float OverlapTolerance, FUVOverlapInfo& OutOverlapInfo) const;
-	void GetTriangleUVBounds(const FMeshDescription* MeshDescription, FTriangleID TriangleID, int32 UVChannel, FTriangleUVBounds& OutBounds) const;
+	// Core analysis functions (LOD0 render data of the snapshot)
+	bool AnalyzeStaticMeshUVOverlaps(const FStaticMeshAnalysisSnapshot& MeshSnapshot, const UPipelineGuardianProfile* Profile, TArray<FUVOverlapInfo>& OutOverlaps) const;
+	bool AnalyzeUVChannelOverlaps(const FStaticMeshLODSnapshot& LODSnapshot, int32 UVChannel, float OverlapTolerance, int32 RasterResolution, FUVOverlapInfo& OutOverlapInfo) const;
 	
 	// UV validation utilities
-	bool IsValidUVChannel(const FMeshDescription* MeshDescription, int32 UVChannel) const;
-	bool HasValidUVCoordinates(const FMeshDescription* MeshDescription, int32 UVChannel) const;
-	float CalculateUVUtilization(const FMeshDescription* MeshDescription, int32 UVChannel) const;
-	
-	// Overlap detection algorithms
-	TArray<FTriangleUVBounds> BuildTriangleUVBounds(const FMeshDescription* MeshDescription, int32 UVChannel) const;
-	void DetectOverlappingTriangles(const TArray<FTriangleUVBounds>& TriangleBounds, float Tolerance, TArray<FTriangleID>& OutOverlappingTriangles) const;
-	float CalculateOverlapPercentage(const TArray<FTriangleUVBounds>& AllBounds, const TArray<FTriangleID>& OverlappingTriangles) const;
+	bool IsValidUVChannel(const FStaticMeshLODSnapshot& LODSnapshot, int32 UVChannel) const;
+	bool HasValidUVCoordinates(const FStaticMeshLODSnapshot& LODSnapshot, int32 UVChannel) const;
 	
 	// Severity assessment
-	EAssetIssueSeverity DetermineOverlapSeverity(const FUVOverlapInfo& OverlapInfo, const UPipelineGuardianProfile* Profile) const;
-	bool IsLightmapChannel(UStaticMesh* StaticMesh, int32 UVChannel) const;
+	EAssetIssueSeverity DetermineOverlapSeverity(const FUVOverlapInfo& OverlapInfo, const FStaticMeshAnalysisSnapshot& MeshSnapshot, const UPipelineGuardianProfile* Profile) const;
+	bool IsLightmapChannel(const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 UVChannel) const;
 	
 	// Fix functionality
 	bool CanFixUVOverlaps(UStaticMesh* StaticMesh, const FUVOverlapInfo& OverlapInfo) const;
@@ -100,11 +84,12 @@ private:
 	void PerformAutoUnwrap(UStaticMesh* StaticMesh, int32 UVChannel, float MinChartSize = 0.01f) const;
 	
 	// Helper functions for detailed reporting
-	FString GenerateOverlapDescription(const FUVOverlapInfo& OverlapInfo, UStaticMesh* StaticMesh) const;
-	FString GetUVChannelUsageName(int32 UVChannel, UStaticMesh* StaticMesh) const;
+	FString GenerateOverlapDescription(const FUVOverlapInfo& OverlapInfo, const FStaticMeshAnalysisSnapshot& MeshSnapshot) const;
+	FString GetUVChannelUsageName(int32 UVChannel, const FStaticMeshAnalysisSnapshot& MeshSnapshot) const;
 	
 	// Configuration parameter helpers
-	float GetOverlapToleranceForChannel(const UPipelineGuardianProfile* Profile, int32 UVChannel) const;
+	float GetOverlapToleranceForChannel(const UPipelineGuardianProfile* Profile, const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 UVChannel) const;
 	bool ShouldCheckUVChannel(const UPipelineGuardianProfile* Profile, int32 UVChannel) const;
+	int32 GetRasterResolutionForChannel(const UPipelineGuardianProfile* Profile, const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 UVChannel) const;
 	EAssetIssueSeverity GetSeverityForOverlapPercentage(const UPipelineGuardianProfile* Profile, float OverlapPercentage, bool bIsLightmapChannel) const;
 }; 
\ No newline at end of file
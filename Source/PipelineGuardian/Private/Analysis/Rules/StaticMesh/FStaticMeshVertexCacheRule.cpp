@@ -0,0 +1,260 @@
+#include "FStaticMeshVertexCacheRule.h"
+#include "Analysis/FAssetAnalysisResult.h"
+#include "Analysis/Snapshots/FStaticMeshAnalysisSnapshot.h"
+#include "Analysis/Geometry/FMeshDescriptionReorderer.h"
+#include "FPipelineGuardianSettings.h"
+#include "PipelineGuardian.h"
+#include "Async/ParallelFor.h"
+#include "Engine/StaticMesh.h"
+#include "MeshDescription.h"
+#include "Misc/MessageDialog.h"
+
+FStaticMeshVertexCacheRule::FStaticMeshVertexCacheRule()
+{
+}
+
+bool FStaticMeshVertexCacheRule::Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	UStaticMesh* StaticMesh = Cast<UStaticMesh>(Asset);
+	if (!StaticMesh)
+	{
+		return false;
+	}
+
+	return CheckSnapshot(*FStaticMeshAnalysisSnapshot::Create(FAssetData(StaticMesh), StaticMesh), Profile, OutResults);
+}
+
+bool FStaticMeshVertexCacheRule::CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	const FStaticMeshAnalysisSnapshot* MeshSnapshot = FStaticMeshAnalysisSnapshot::FromSnapshot(Snapshot);
+	if (!MeshSnapshot)
+	{
+		return false;
+	}
+
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	if (!Settings || !Settings->bEnableStaticMeshVertexCacheRule)
+	{
+		return false;
+	}
+
+	// Nanite meshes are rendered from clusters, not from these index buffers
+	if (MeshSnapshot->bNaniteEnabled)
+	{
+		return false;
+	}
+
+	const int32 CacheSize = FMath::Clamp(Settings->VertexCacheSize, 1, 256);
+	const bool bLRU = Settings->bSimulateLRUVertexCache;
+
+	TArray<FLODVertexCacheStats> PoorLODs;
+	for (int32 LODIndex = 0; LODIndex < MeshSnapshot->GetNumLODs(); ++LODIndex)
+	{
+		FLODVertexCacheStats LODStats;
+		LODStats.LODIndex = LODIndex;
+		LODStats.Current = SimulateLOD(*MeshSnapshot, LODIndex, CacheSize, bLRU, false);
+
+		UE_LOG(LogPipelineGuardian, Verbose, TEXT("%s LOD%d vertex cache: ACMR %.3f, ATVR %.3f"),
+			*MeshSnapshot->AssetName, LODIndex, LODStats.Current.GetACMR(), LODStats.Current.GetATVR());
+
+		// Reordering is far more expensive than simulating, so only LODs that look poor are optimized to compare
+		if (LODStats.Current.GetATVR() <= Settings->VertexCacheMaxATVR)
+		{
+			continue;
+		}
+
+		// The build cache-optimizes smaller LODs itself, so a poor order there is not something a reorder can change
+		if (!MeshSnapshot->LODs[LODIndex].bOrderKeptByBuild)
+		{
+			continue;
+		}
+
+		LODStats.Optimized = SimulateLOD(*MeshSnapshot, LODIndex, CacheSize, bLRU, true);
+		if (LODStats.GetImprovementPercentage() >= Settings->VertexCacheMinImprovement)
+		{
+			PoorLODs.Add(LODStats);
+		}
+	}
+
+	if (PoorLODs.Num() == 0)
+	{
+		return false;
+	}
+
+	FAssetAnalysisResult Result;
+	Result.Asset = MeshSnapshot->AssetData;
+	Result.RuleID = GetRuleID();
+	Result.Severity = Settings->VertexCacheIssueSeverity;
+	Result.Description = FText::FromString(GenerateVertexCacheDescription(*MeshSnapshot, PoorLODs, CacheSize, bLRU));
+	Result.FilePath = FText::FromString(MeshSnapshot->PackageName);
+
+	if (Settings->bAllowVertexCacheAutoFix)
+	{
+		TSoftObjectPtr<UStaticMesh> SoftStaticMesh(MeshSnapshot->AssetData.GetSoftObjectPath());
+		Result.FixAction.BindLambda([SoftStaticMesh, PoorLODs, CacheSize, bLRU, this]()
+		{
+			UStaticMesh* StaticMesh = SoftStaticMesh.LoadSynchronous();
+			if (!StaticMesh)
+			{
+				return;
+			}
+
+			if (OptimizeMeshDescriptions(StaticMesh))
+			{
+				const int32 NumImproved = CountImprovedLODs(StaticMesh, PoorLODs, CacheSize, bLRU);
+				UE_LOG(LogPipelineGuardian, Log, TEXT("Optimized vertex cache order of %s: %d of %d LODs improved after the rebuild"), *StaticMesh->GetName(), NumImproved, PoorLODs.Num());
+				if (NumImproved < PoorLODs.Num())
+				{
+					FText WarningMessage = FText::FromString(FString::Printf(TEXT("'%s' was rebuilt, but only %d of %d reordered LODs reuse the vertex cache better. The mesh build may have optimized their index buffers again."),
+						*StaticMesh->GetName(), NumImproved, PoorLODs.Num()));
+					FMessageDialog::Open(EAppMsgType::Ok, WarningMessage, FText::FromString(TEXT("Vertex Cache Optimization")));
+				}
+			}
+			else
+			{
+				FText ErrorMessage = FText::FromString(FString::Printf(TEXT("'%s' has no source mesh description whose order the mesh build keeps. Its LODs may all be generated by reduction, or be small enough for the build to cache-optimize them itself."), *StaticMesh->GetName()));
+				FMessageDialog::Open(EAppMsgType::Ok, ErrorMessage, FText::FromString(TEXT("Vertex Cache Optimization Error")));
+			}
+		});
+	}
+
+	OutResults.Add(Result);
+	return true;
+}
+
+FName FStaticMeshVertexCacheRule::GetRuleID() const
+{
+	return TEXT("SM_VertexCache");
+}
+
+FText FStaticMeshVertexCacheRule::GetRuleDescription() const
+{
+	return FText::FromString(TEXT("Simulates the post-transform vertex cache over each LOD's index buffer and reports LODs the mesh build does not optimize itself whose ACMR/ATVR a cache-optimized triangle order would clearly improve."));
+}
+
+bool FStaticMeshVertexCacheRule::IsEnabled(const UPipelineGuardianProfile* Profile) const
+{
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	return Settings && Settings->bEnableStaticMeshVertexCacheRule;
+}
+
+FVertexCacheStats FStaticMeshVertexCacheRule::SimulateLOD(const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 LODIndex, int32 CacheSize, bool bLRU, bool bOptimize) const
+{
+	const FStaticMeshLODSnapshot& LODSnapshot = MeshSnapshot.LODs[LODIndex];
+	const TConstArrayView<uint32> Indices(LODSnapshot.Indices);
+
+	TArray<FVertexCacheStats> SectionStats;
+	SectionStats.SetNum(LODSnapshot.Sections.Num());
+	ParallelFor(LODSnapshot.Sections.Num(), [&](int32 SectionIndex)
+	{
+		const FStaticMeshSectionSnapshot& Section = LODSnapshot.Sections[SectionIndex];
+		const int64 NumIndices = static_cast<int64>(Section.NumTriangles) * 3;
+		if (NumIndices == 0 || Section.FirstIndex + NumIndices > Indices.Num())
+		{
+			return;
+		}
+
+		const TConstArrayView<uint32> SectionIndices = Indices.Slice(Section.FirstIndex, static_cast<int32>(NumIndices));
+		if (!bOptimize)
+		{
+			SectionStats[SectionIndex] = FVertexCacheOptimizer::Simulate(SectionIndices, CacheSize, bLRU);
+			return;
+		}
+
+		TArray<int32> TriangleOrder;
+		TArray<uint32> OptimizedIndices;
+		FVertexCacheOptimizer::OptimizeTriangleOrder(SectionIndices, TriangleOrder);
+		FVertexCacheOptimizer::ReorderTriangles(SectionIndices, TriangleOrder, OptimizedIndices);
+		SectionStats[SectionIndex] = FVertexCacheOptimizer::Simulate(OptimizedIndices, CacheSize, bLRU);
+	}, bOptimize ? EParallelForFlags::Unbalanced : EParallelForFlags::ForceSingleThread);
+
+	FVertexCacheStats Stats;
+	for (const FVertexCacheStats& Section : SectionStats)
+	{
+		Stats += Section;
+	}
+	return Stats;
+}
+
+FString FStaticMeshVertexCacheRule::GenerateVertexCacheDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, TConstArrayView<FLODVertexCacheStats> PoorLODs, int32 CacheSize, bool bLRU) const
+{
+	FString Description = FString::Printf(TEXT("Static mesh %s has poor vertex cache reuse (simulated %d-entry %s cache). Reordering its triangles would give:"),
+		*MeshSnapshot.AssetName, CacheSize, bLRU ? TEXT("LRU") : TEXT("FIFO"));
+
+	for (const FLODVertexCacheStats& LODStats : PoorLODs)
+	{
+		Description += FString::Printf(TEXT("\n  LOD%d: ACMR %.2f -> %.2f, ATVR %.2f -> %.2f (%.0f%% fewer vertex shader invocations)"),
+			LODStats.LODIndex, LODStats.Current.GetACMR(), LODStats.Optimized.GetACMR(), LODStats.Current.GetATVR(), LODStats.Optimized.GetATVR(),
+			LODStats.GetImprovementPercentage());
+	}
+
+	return Description;
+}
+
+bool FStaticMeshVertexCacheRule::OptimizeMeshDescriptions(UStaticMesh* StaticMesh) const
+{
+	check(IsInGameThread());
+
+	if (!StaticMesh)
+	{
+		return false;
+	}
+
+	bool bChanged = false;
+	for (int32 LODIndex = 0; LODIndex < StaticMesh->GetNumSourceModels(); ++LODIndex)
+	{
+		// Reduced LODs are rebuilt from their base LOD, so their order comes from the reduction
+		if (!StaticMesh->IsMeshDescriptionValid(LODIndex) || StaticMesh->IsReductionActive(LODIndex))
+		{
+			continue;
+		}
+
+		// The build orders smaller LODs for the vertex cache itself
+		FMeshDescription* MeshDescription = StaticMesh->GetMeshDescription(LODIndex);
+		if (!MeshDescription || !FMeshDescriptionReorderer::IsOrderKeptByBuild(*MeshDescription))
+		{
+			continue;
+		}
+
+		const bool bReordered = FMeshDescriptionReorderer::Reorder(*MeshDescription, [](TConstArrayView<FVector3f> Positions, TConstArrayView<uint32> Indices, TArray<int32>& OutTriangleOrder)
+		{
+			FVertexCacheOptimizer::OptimizeTriangleOrder(Indices, OutTriangleOrder);
+		});
+		if (!bReordered)
+		{
+			continue;
+		}
+
+		StaticMesh->CommitMeshDescription(LODIndex);
+		bChanged = true;
+	}
+
+	if (bChanged)
+	{
+		StaticMesh->Build(false);
+		StaticMesh->MarkPackageDirty();
+		StaticMesh->PostEditChange();
+	}
+
+	return bChanged;
+}
+
+int32 FStaticMeshVertexCacheRule::CountImprovedLODs(UStaticMesh* StaticMesh, TConstArrayView<FLODVertexCacheStats> LODs, int32 CacheSize, bool bLRU) const
+{
+	check(IsInGameThread());
+
+	const TSharedRef<const FStaticMeshAnalysisSnapshot> MeshSnapshot = FStaticMeshAnalysisSnapshot::Create(FAssetData(StaticMesh), StaticMesh);
+	int32 NumImproved = 0;
+	for (const FLODVertexCacheStats& LODStats : LODs)
+	{
+		if (!MeshSnapshot->LODs.IsValidIndex(LODStats.LODIndex))
+		{
+			continue;
+		}
+
+		const FVertexCacheStats Rebuilt = SimulateLOD(*MeshSnapshot, LODStats.LODIndex, CacheSize, bLRU, false);
+		UE_LOG(LogPipelineGuardian, Verbose, TEXT("%s LOD%d ACMR after rebuild: %.3f -> %.3f"), *MeshSnapshot->AssetName, LODStats.LODIndex, LODStats.Current.GetACMR(), Rebuilt.GetACMR());
+		NumImproved += Rebuilt.GetACMR() < LODStats.Current.GetACMR() ? 1 : 0;
+	}
+	return NumImproved;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Analysis/IAssetCheckRule.h"
+#include "Analysis/Geometry/FVertexCacheOptimizer.h"
+
+// Forward Declarations
+class UStaticMesh;
+struct FStaticMeshAnalysisSnapshot;
+
+/**
+ * Checks how well the index buffer of each render LOD reuses the post-transform vertex cache (ACMR/ATVR) and
+ * compares it with the triangle order a cache optimization would give. The mesh build already cache-optimizes LODs
+ * under FMeshDescriptionReorderer::MinBuildKeptVertexInstances and would discard any other order, so only LODs whose
+ * order the build keeps are compared. The fix reorders the triangles, vertex instances and vertices of those LODs in
+ * the source mesh descriptions and rebuilds the mesh.
+ */
+class FStaticMeshVertexCacheRule : public IAssetCheckRule
+{
+public:
+	FStaticMeshVertexCacheRule();
+	virtual ~FStaticMeshVertexCacheRule() = default;
+
+	virtual bool Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
+	virtual FName GetRuleID() const override;
+	virtual FText GetRuleDescription() const override;
+	virtual bool IsEnabled(const UPipelineGuardianProfile* Profile) const override;
+	virtual bool SupportsSnapshot() const override { return true; }
+	virtual bool CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
+
+private:
+	/** Cache behavior of one LOD as built and after optimization */
+	struct FLODVertexCacheStats
+	{
+		int32 LODIndex = INDEX_NONE;
+		FVertexCacheStats Current;
+		FVertexCacheStats Optimized;
+
+		/** @return Share of the current vertex transforms the optimized order saves, 0-100. */
+		float GetImprovementPercentage() const
+		{
+			return Current.NumCacheMisses > 0 ? static_cast<float>(100.0 * (Current.NumCacheMisses - Optimized.NumCacheMisses) / Current.NumCacheMisses) : 0.0f;
+		}
+	};
+
+	/**
+	 * Simulates the cache over every section of one LOD; each section is its own draw call, so the cache starts empty.
+	 * @param MeshSnapshot Snapshot of the mesh.
+	 * @param LODIndex Render LOD to simulate.
+	 * @param CacheSize Entries in the simulated cache.
+	 * @param bLRU Simulate an LRU cache instead of FIFO.
+	 * @param bOptimize Simulate the sections after reordering their triangles, instead of as built.
+	 * @return Summed cache behavior of the sections.
+	 */
+	FVertexCacheStats SimulateLOD(const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 LODIndex, int32 CacheSize, bool bLRU, bool bOptimize) const;
+
+	FString GenerateVertexCacheDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, TConstArrayView<FLODVertexCacheStats> PoorLODs, int32 CacheSize, bool bLRU) const;
+
+	/**
+	 * Reorders the source mesh descriptions of all LODs that are not generated by reduction for vertex cache reuse and
+	 * vertex fetch locality, then rebuilds the mesh. LODs the build would cache-optimize again are left alone.
+	 * Game thread only.
+	 * @return True if a mesh description was changed.
+	 */
+	bool OptimizeMeshDescriptions(UStaticMesh* StaticMesh) const;
+
+	/**
+	 * Simulates the cache over the given LODs again once the mesh has been rebuilt. Game thread only.
+	 * @param StaticMesh The rebuilt mesh.
+	 * @param LODs Stats of the LODs before the fix.
+	 * @param CacheSize Entries in the simulated cache.
+	 * @param bLRU Simulate an LRU cache instead of FIFO.
+	 * @return Number of LODs whose ACMR went down.
+	 */
+	int32 CountImprovedLODs(UStaticMesh* StaticMesh, TConstArrayView<FLODVertexCacheStats> LODs, int32 CacheSize, bool bLRU) const;
+};
@@ -1,5 +1,6 @@
 #include "FStaticMeshVertexColorMissingRule.h"
 #include "Analysis/FAssetAnalysisResult.h"
+#include "Analysis/Snapshots/FStaticMeshAnalysisSnapshot.h"
 #include "FPipelineGuardianSettings.h"
 #include "PipelineGuardian.h"
 #include "Engine/StaticMesh.h"
@@ -21,6 +22,17 @@ bool FStaticMeshVertexColorMissingRule::Check(UObject* Asset, const UPipelineGua
 		return false;
 	}
 
+	return CheckSnapshot(*FStaticMeshAnalysisSnapshot::Create(FAssetData(StaticMesh), StaticMesh), Profile, OutResults);
+}
+
+bool FStaticMeshVertexColorMissingRule::CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	const FStaticMeshAnalysisSnapshot* MeshSnapshot = FStaticMeshAnalysisSnapshot::FromSnapshot(Snapshot);
+	if (!MeshSnapshot)
+	{
+		return false;
+	}
+
 	// Get settings
 	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
 	if (!Settings)
@@ -34,28 +46,31 @@ bool FStaticMeshVertexColorMissingRule::Check(UObject* Asset, const UPipelineGua
 	if (Settings->bEnableStaticMeshVertexColorMissingRule)
 	{
 		// Get triangle count
-		int32 TriangleCount = 0;
-		if (StaticMesh->GetRenderData() && StaticMesh->GetRenderData()->LODResources.Num() > 0)
-		{
-			TriangleCount = StaticMesh->GetRenderData()->LODResources[0].GetNumTriangles();
-		}
+		int32 TriangleCount = MeshSnapshot->GetNumTriangles(0);
 
 		// Check if vertex colors are missing
-		bool HasMissingVertexColors = this->HasMissingVertexColors(StaticMesh, Settings->VertexColorRequiredThreshold);
+		bool HasMissingVertexColors = this->HasMissingVertexColors(*MeshSnapshot, Settings->VertexColorRequiredThreshold);
 
 		if (HasMissingVertexColors)
 		{
 			FAssetAnalysisResult Result;
-			Result.Asset = FAssetData(StaticMesh);
+			Result.Asset = MeshSnapshot->AssetData;
 			Result.RuleID = GetRuleID();
 			Result.Severity = Settings->VertexColorMissingIssueSeverity;
-			Result.Description = FText::FromString(GenerateVertexColorMissingDescription(StaticMesh, TriangleCount, Settings->VertexColorRequiredThreshold));
+			Result.Description = FText::FromString(GenerateVertexColorMissingDescription(*MeshSnapshot, TriangleCount, Settings->VertexColorRequiredThreshold));
 
 			// Add fix action if auto-fix is enabled
-			if (Settings->bAllowVertexColorMissingAutoFix && CanSafelyGenerateVertexColors(StaticMesh))
+			if (Settings->bAllowVertexColorMissingAutoFix && CanSafelyGenerateVertexColors(*MeshSnapshot))
 			{
-				Result.FixAction = FSimpleDelegate::CreateLambda([this, StaticMesh]()
+				TSoftObjectPtr<UStaticMesh> SoftStaticMesh(MeshSnapshot->AssetData.GetSoftObjectPath());
+				Result.FixAction = FSimpleDelegate::CreateLambda([this, SoftStaticMesh]()
 				{
+					UStaticMesh* StaticMesh = SoftStaticMesh.LoadSynchronous();
+					if (!StaticMesh)
+					{
+						return;
+					}
+
 					if (GenerateVertexColors(StaticMesh))
 					{
 						UE_LOG(LogPipelineGuardian, Log, TEXT("Successfully generated vertex colors for %s"), *StaticMesh->GetName());
@@ -76,15 +91,15 @@ bool FStaticMeshVertexColorMissingRule::Check(UObject* Asset, const UPipelineGua
 	if (Settings->bEnableVertexColorUnusedChannelRule)
 	{
 		TArray<FString> UnusedChannels;
-		bool HasUnusedChannels = this->HasUnusedVertexColorChannels(StaticMesh, UnusedChannels);
+		bool HasUnusedChannels = this->HasUnusedVertexColorChannels(*MeshSnapshot, UnusedChannels);
 
 		if (HasUnusedChannels)
 		{
 			FAssetAnalysisResult Result;
-			Result.Asset = FAssetData(StaticMesh);
+			Result.Asset = MeshSnapshot->AssetData;
 			Result.RuleID = FName(TEXT("SM_VertexColorUnusedChannels"));
 			Result.Severity = Settings->VertexColorUnusedChannelIssueSeverity;
-			Result.Description = FText::FromString(GenerateUnusedChannelDescription(StaticMesh, UnusedChannels));
+			Result.Description = FText::FromString(GenerateUnusedChannelDescription(*MeshSnapshot, UnusedChannels));
 
 			// No auto-fix for unused channel detection - this is informational only
 			// Result.FixAction = FSimpleDelegate::CreateLambda([this, StaticMesh, UnusedChannels]()
@@ -108,15 +123,15 @@ bool FStaticMeshVertexColorMissingRule::Check(UObject* Asset, const UPipelineGua
 	if (Settings->bEnableVertexColorChannelValidation && !Settings->RequiredVertexColorChannels.IsEmpty())
 	{
 		TArray<FString> MissingChannels;
-		bool HasMissingChannels = this->HasMissingRequiredChannels(StaticMesh, Settings->RequiredVertexColorChannels, MissingChannels);
+		bool HasMissingChannels = this->HasMissingRequiredChannels(*MeshSnapshot, Settings->RequiredVertexColorChannels, MissingChannels);
 
 		if (HasMissingChannels)
 		{
 			FAssetAnalysisResult Result;
-			Result.Asset = FAssetData(StaticMesh);
+			Result.Asset = MeshSnapshot->AssetData;
 			Result.RuleID = FName(TEXT("SM_VertexColorMissingChannels"));
 			Result.Severity = Settings->VertexColorMissingIssueSeverity;
-			Result.Description = FText::FromString(GenerateMissingChannelDescription(StaticMesh, MissingChannels));
+			Result.Description = FText::FromString(GenerateMissingChannelDescription(*MeshSnapshot, MissingChannels));
 
 			OutResults.Add(Result);
 			HasIssues = true;
@@ -136,15 +151,23 @@ FText FStaticMeshVertexColorMissingRule::GetRuleDescription() const
 	return FText::FromString(TEXT("Checks if static meshes are missing required vertex color channels based on polygon count."));
 }
 
-bool FStaticMeshVertexColorMissingRule::HasMissingVertexColors(const UStaticMesh* StaticMesh, int32 RequiredThreshold) const
+bool FStaticMeshVertexColorMissingRule::IsEnabled(const UPipelineGuardianProfile* Profile) const
+{
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	return Settings && (Settings->bEnableStaticMeshVertexColorMissingRule
+		|| Settings->bEnableVertexColorUnusedChannelRule
+		|| (Settings->bEnableVertexColorChannelValidation && !Settings->RequiredVertexColorChannels.IsEmpty()));
+}
+
+bool FStaticMeshVertexColorMissingRule::HasMissingVertexColors(const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 RequiredThreshold) const
 {
-	if (!StaticMesh || !StaticMesh->GetRenderData() || StaticMesh->GetRenderData()->LODResources.Num() == 0)
+	if (MeshSnapshot.GetNumLODs() == 0)
 	{
 		return false;
 	}
 
 	// Get triangle count
-	int32 TriangleCount = StaticMesh->GetRenderData()->LODResources[0].GetNumTriangles();
+	int32 TriangleCount = MeshSnapshot.GetNumTriangles(0);
 	
 
 	if (TriangleCount < RequiredThreshold)
@@ -152,26 +175,14 @@ bool FStaticMeshVertexColorMissingRule::HasMissingVertexColors(const UStaticMesh
 		return false;
 	}
 
-	// Check if vertex colors exist in the mesh description
-	if (StaticMesh->GetMeshDescription(0))
-	{
-		const FMeshDescription* MeshDesc = StaticMesh->GetMeshDescription(0);
-		const FStaticMeshConstAttributes Attributes(*MeshDesc);
-		
-		// Check if vertex color attributes exist
-		if (Attributes.GetVertexInstanceColors().IsValid())
-		{
-			return false; // Vertex colors exist
-		}
-	}
-
-	return true; // Vertex colors are missing
+	// Check if the built LOD carries a color buffer
+	return !MeshSnapshot.LODs[0].HasVertexColors();
 }
 
-FString FStaticMeshVertexColorMissingRule::GenerateVertexColorMissingDescription(const UStaticMesh* StaticMesh, int32 TriangleCount, int32 RequiredThreshold) const
+FString FStaticMeshVertexColorMissingRule::GenerateVertexColorMissingDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 TriangleCount, int32 RequiredThreshold) const
 {
 	return FString::Printf(TEXT("Static mesh %s (%d triangles) is missing vertex colors. Required for meshes with %d+ triangles. Vertex colors improve visual quality and support advanced shading."), 
-		*StaticMesh->GetName(), TriangleCount, RequiredThreshold);
+		*MeshSnapshot.AssetName, TriangleCount, RequiredThreshold);
 }
 
 bool FStaticMeshVertexColorMissingRule::GenerateVertexColors(UStaticMesh* StaticMesh) const
@@ -235,107 +246,81 @@ bool FStaticMeshVertexColorMissingRule::GenerateVertexColors(UStaticMesh* Static
 	return true;
 }
 
-bool FStaticMeshVertexColorMissingRule::CanSafelyGenerateVertexColors(const UStaticMesh* StaticMesh) const
+bool FStaticMeshVertexColorMissingRule::CanSafelyGenerateVertexColors(const FStaticMeshAnalysisSnapshot& MeshSnapshot) const
 {
-	if (!StaticMesh)
-	{
-		return false;
-	}
-
 	// Check if mesh has valid geometry
-	if (!StaticMesh->GetRenderData() || StaticMesh->GetRenderData()->LODResources.Num() == 0)
+	if (MeshSnapshot.GetNumLODs() == 0)
 	{
-		UE_LOG(LogPipelineGuardian, Warning, TEXT("Cannot generate vertex colors for %s: No valid geometry"), *StaticMesh->GetName());
+		UE_LOG(LogPipelineGuardian, Warning, TEXT("Cannot generate vertex colors for %s: No valid geometry"), *MeshSnapshot.AssetName);
 		return false;
 	}
 
 	// Check if mesh is not too complex for vertex color generation
-	const FStaticMeshLODResources* LODResource = &StaticMesh->GetRenderData()->LODResources[0];
-	int32 TriangleCount = LODResource->GetNumTriangles();
+	int32 TriangleCount = MeshSnapshot.GetNumTriangles(0);
 	
 	// Don't auto-generate for extremely complex meshes (more than 100k triangles)
 	if (TriangleCount > PipelineGuardianConstants::MAX_TRIANGLE_COUNT_FOR_VERTEX_COLOR_CHECK)
 	{
 		UE_LOG(LogPipelineGuardian, Warning, TEXT("Cannot auto-generate vertex colors for %s: Too complex (%d triangles)"), 
-			*StaticMesh->GetName(), TriangleCount);
-		return false;
-	}
-
-	// Check if mesh description exists
-	if (!StaticMesh->GetMeshDescription(0))
-	{
-		UE_LOG(LogPipelineGuardian, Warning, TEXT("Cannot generate vertex colors for %s: No mesh description"), *StaticMesh->GetName());
+			*MeshSnapshot.AssetName, TriangleCount);
 		return false;
 	}
 
+	// Mesh description availability is checked by GenerateVertexColors() on the game thread
 	return true;
 } 
 
-bool FStaticMeshVertexColorMissingRule::HasUnusedVertexColorChannels(const UStaticMesh* StaticMesh, TArray<FString>& OutUnusedChannels) const
+bool FStaticMeshVertexColorMissingRule::HasUnusedVertexColorChannels(const FStaticMeshAnalysisSnapshot& MeshSnapshot, TArray<FString>& OutUnusedChannels) const
 {
-	if (!StaticMesh || !StaticMesh->GetRenderData() || StaticMesh->GetRenderData()->LODResources.Num() == 0)
+	if (MeshSnapshot.GetNumLODs() == 0 || !MeshSnapshot.LODs[0].HasVertexColors())
 	{
 		return false;
 	}
 
-	// Get mesh description to analyze vertex color usage
-	if (StaticMesh->GetMeshDescription(0))
+	// Analyze vertex color usage patterns of the built LOD
+	const TArray<FColor>& VertexColors = MeshSnapshot.LODs[0].Colors;
+	bool HasNonZeroColors = false;
+	bool HasVaryingColors = false;
+	const FColor FirstColor = VertexColors[0];
+	
+	for (const FColor& Color : VertexColors)
 	{
-		const FMeshDescription* MeshDesc = StaticMesh->GetMeshDescription(0);
-		const FStaticMeshConstAttributes Attributes(*MeshDesc);
+		// Check if any color component is non-zero
+		if (Color.DWColor() != 0)
+		{
+			HasNonZeroColors = true;
+		}
 		
-		if (Attributes.GetVertexInstanceColors().IsValid())
+		// Check for color variation
+		if (Color != FirstColor)
 		{
-			TVertexInstanceAttributesConstRef<FVector4f> VertexColors = Attributes.GetVertexInstanceColors();
-			
-			// Analyze vertex color usage patterns
-			bool HasNonZeroColors = false;
-			bool HasVaryingColors = false;
-			FVector4f FirstColor = FVector4f::Zero();
-			bool FirstColorSet = false;
-			
-			for (FVertexInstanceID VertexInstanceID : MeshDesc->VertexInstances().GetElementIDs())
-			{
-				FVector4f Color = VertexColors[VertexInstanceID];
-				
-				// Check if any color component is non-zero
-				if (Color.X > 0.0f || Color.Y > 0.0f || Color.Z > 0.0f || Color.W > 0.0f)
-				{
-					HasNonZeroColors = true;
-				}
-				
-				// Check for color variation
-				if (!FirstColorSet)
-				{
-					FirstColor = Color;
-					FirstColorSet = true;
-				}
-				else if ((FirstColor - Color).SizeSquared() > 0.0001f)
-				{
-					HasVaryingColors = true;
-				}
-			}
-			
-			// Determine if channels are unused
-			if (!HasNonZeroColors)
-			{
-				OutUnusedChannels.Add(TEXT("All"));
-				return true;
-			}
-			else if (!HasVaryingColors)
-			{
-				OutUnusedChannels.Add(TEXT("Variation"));
-				return true;
-			}
+			HasVaryingColors = true;
 		}
+
+		if (HasNonZeroColors && HasVaryingColors)
+		{
+			break;
+		}
+	}
+	
+	// Determine if channels are unused
+	if (!HasNonZeroColors)
+	{
+		OutUnusedChannels.Add(TEXT("All"));
+		return true;
+	}
+	else if (!HasVaryingColors)
+	{
+		OutUnusedChannels.Add(TEXT("Variation"));
+		return true;
 	}
 
 	return false;
 }
 
-bool FStaticMeshVertexColorMissingRule::HasMissingRequiredChannels(const UStaticMesh* StaticMesh, const FString& RequiredChannels, TArray<FString>& OutMissingChannels) const
+bool FStaticMeshVertexColorMissingRule::HasMissingRequiredChannels(const FStaticMeshAnalysisSnapshot& MeshSnapshot, const FString& RequiredChannels, TArray<FString>& OutMissingChannels) const
 {
-	if (!StaticMesh || RequiredChannels.IsEmpty())
+	if (RequiredChannels.IsEmpty())
 	{
 		return false;
 	}
@@ -346,21 +331,9 @@ bool FStaticMeshVertexColorMissingRule::HasMissingRequiredChannels(const UStatic
 	
 	// For now, we'll check if vertex colors exist at all
 	// In a more advanced implementation, you could check for specific channel names
-	if (StaticMesh->GetMeshDescription(0))
-	{
-		const FMeshDescription* MeshDesc = StaticMesh->GetMeshDescription(0);
-		const FStaticMeshConstAttributes Attributes(*MeshDesc);
-		
-		if (!Attributes.GetVertexInstanceColors().IsValid())
-		{
-			// If no vertex colors exist, all required channels are missing
-			OutMissingChannels = RequiredChannelList;
-			return true;
-		}
-	}
-	else
+	if (MeshSnapshot.GetNumLODs() == 0 || !MeshSnapshot.LODs[0].HasVertexColors())
 	{
-		// No mesh description means no vertex colors
+		// If no vertex colors exist, all required channels are missing
 		OutMissingChannels = RequiredChannelList;
 		return true;
 	}
@@ -368,7 +341,7 @@ bool FStaticMeshVertexColorMissingRule::HasMissingRequiredChannels(const UStatic
 	return false;
 }
 
-FString FStaticMeshVertexColorMissingRule::GenerateUnusedChannelDescription(const UStaticMesh* StaticMesh, const TArray<FString>& UnusedChannels) const
+FString FStaticMeshVertexColorMissingRule::GenerateUnusedChannelDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, const TArray<FString>& UnusedChannels) const
 {
 	FString ChannelList = TEXT("");
 	for (int32 i = 0; i < UnusedChannels.Num(); ++i)
@@ -378,10 +351,10 @@ FString FStaticMeshVertexColorMissingRule::GenerateUnusedChannelDescription(cons
 	}
 	
 	return FString::Printf(TEXT("Static mesh %s has unused vertex color channels: %s. This bloats data and should be optimized."), 
-		*StaticMesh->GetName(), *ChannelList);
+		*MeshSnapshot.AssetName, *ChannelList);
 }
 
-FString FStaticMeshVertexColorMissingRule::GenerateMissingChannelDescription(const UStaticMesh* StaticMesh, const TArray<FString>& MissingChannels) const
+FString FStaticMeshVertexColorMissingRule::GenerateMissingChannelDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, const TArray<FString>& MissingChannels) const
 {
 	FString ChannelList = TEXT("");
 	for (int32 i = 0; i < MissingChannels.Num(); ++i)
@@ -391,7 +364,7 @@ FString FStaticMeshVertexColorMissingRule::GenerateMissingChannelDescription(con
 	}
 	
 	return FString::Printf(TEXT("Static mesh %s is missing required vertex color channels: %s. These channels are needed for proper shading."), 
-		*StaticMesh->GetName(), *ChannelList);
+		*MeshSnapshot.AssetName, *ChannelList);
 }
 
 bool FStaticMeshVertexColorMissingRule::OptimizeVertexColors(UStaticMesh* StaticMesh, const TArray<FString>& ChannelsToRemove) const
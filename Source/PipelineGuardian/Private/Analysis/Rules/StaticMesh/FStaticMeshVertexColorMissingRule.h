@@ -4,6 +4,9 @@
 #include "Analysis/IAssetCheckRule.h"
 #include "Engine/StaticMesh.h"
 
+// Forward Declarations
+struct FStaticMeshAnalysisSnapshot;
+
 class FStaticMeshVertexColorMissingRule : public IAssetCheckRule
 {
 public:
@@ -13,15 +16,18 @@ public:
 	virtual bool Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
 	virtual FName GetRuleID() const override;
 	virtual FText GetRuleDescription() const override;
+	virtual bool IsEnabled(const UPipelineGuardianProfile* Profile) const override;
+	virtual bool SupportsSnapshot() const override { return true; }
+	virtual bool CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
 
 private:
-	bool HasMissingVertexColors(const UStaticMesh* StaticMesh, int32 RequiredThreshold) const;
-	bool HasUnusedVertexColorChannels(const UStaticMesh* StaticMesh, TArray<FString>& OutUnusedChannels) const;
-	bool HasMissingRequiredChannels(const UStaticMesh* StaticMesh, const FString& RequiredChannels, TArray<FString>& OutMissingChannels) const;
-	FString GenerateVertexColorMissingDescription(const UStaticMesh* StaticMesh, int32 TriangleCount, int32 RequiredThreshold) const;
-	FString GenerateUnusedChannelDescription(const UStaticMesh* StaticMesh, const TArray<FString>& UnusedChannels) const;
-	FString GenerateMissingChannelDescription(const UStaticMesh* StaticMesh, const TArray<FString>& MissingChannels) const;
+	bool HasMissingVertexColors(const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 RequiredThreshold) const;
+	bool HasUnusedVertexColorChannels(const FStaticMeshAnalysisSnapshot& MeshSnapshot, TArray<FString>& OutUnusedChannels) const;
+	bool HasMissingRequiredChannels(const FStaticMeshAnalysisSnapshot& MeshSnapshot, const FString& RequiredChannels, TArray<FString>& OutMissingChannels) const;
+	FString GenerateVertexColorMissingDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 TriangleCount, int32 RequiredThreshold) const;
+	FString GenerateUnusedChannelDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, const TArray<FString>& UnusedChannels) const;
+	FString GenerateMissingChannelDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, const TArray<FString>& MissingChannels) const;
 	bool GenerateVertexColors(UStaticMesh* StaticMesh) const;
-	bool CanSafelyGenerateVertexColors(const UStaticMesh* StaticMesh) const;
+	bool CanSafelyGenerateVertexColors(const FStaticMeshAnalysisSnapshot& MeshSnapshot) const;
 	bool OptimizeVertexColors(UStaticMesh* StaticMesh, const TArray<FString>& ChannelsToRemove) const;
 }; 
\ No newline at end of file
@@ -0,0 +1,218 @@
+#include "FStaticMeshVertexSplitRule.h"
+#include "Analysis/FAssetAnalysisResult.h"
+#include "Analysis/Snapshots/FStaticMeshAnalysisSnapshot.h"
+#include "FPipelineGuardianSettings.h"
+#include "PipelineGuardian.h"
+#include "Engine/StaticMesh.h"
+
+namespace StaticMeshVertexSplitRule
+{
+	/** Causes that split fewer vertices than this share of the total get no suggested fix */
+	constexpr float MinCauseShare = 0.1f;
+}
+
+FStaticMeshVertexSplitRule::FStaticMeshVertexSplitRule()
+{
+}
+
+bool FStaticMeshVertexSplitRule::Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	UStaticMesh* StaticMesh = Cast<UStaticMesh>(Asset);
+	if (!StaticMesh)
+	{
+		return false;
+	}
+
+	return CheckSnapshot(*FStaticMeshAnalysisSnapshot::Create(FAssetData(StaticMesh), StaticMesh), Profile, OutResults);
+}
+
+bool FStaticMeshVertexSplitRule::CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	const FStaticMeshAnalysisSnapshot* MeshSnapshot = FStaticMeshAnalysisSnapshot::FromSnapshot(Snapshot);
+	if (!MeshSnapshot)
+	{
+		return false;
+	}
+
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	if (!Settings || !Settings->bEnableStaticMeshVertexSplitRule)
+	{
+		return false;
+	}
+
+	const int64 MinWastedBytes = static_cast<int64>(FMath::Max(Settings->VertexSplitMinWastedKB, 0)) * 1024;
+
+	TArray<FLODVertexSplitStats> SplitLODs;
+	for (int32 LODIndex = 0; LODIndex < MeshSnapshot->GetNumLODs(); ++LODIndex)
+	{
+		const FLODVertexSplitStats LODStats = AnalyzeLOD(*MeshSnapshot, LODIndex);
+
+		UE_LOG(LogPipelineGuardian, Verbose, TEXT("%s LOD%d vertex splits: %d render vertices, %d positions (%.2fx)"),
+			*MeshSnapshot->AssetName, LODIndex, LODStats.Splits.NumVertices, LODStats.Splits.NumPositions, LODStats.Splits.GetSplitRatio());
+
+		if (LODStats.Splits.GetSplitRatio() > Settings->VertexSplitMaxRatio && LODStats.GetWastedBytes() >= MinWastedBytes)
+		{
+			SplitLODs.Add(LODStats);
+		}
+	}
+
+	if (SplitLODs.Num() == 0)
+	{
+		return false;
+	}
+
+	FAssetAnalysisResult Result;
+	Result.Asset = MeshSnapshot->AssetData;
+	Result.RuleID = GetRuleID();
+	Result.Severity = Settings->VertexSplitIssueSeverity;
+	Result.Description = FText::FromString(GenerateVertexSplitDescription(*MeshSnapshot, SplitLODs));
+	Result.FilePath = FText::FromString(MeshSnapshot->PackageName);
+
+	OutResults.Add(Result);
+	return true;
+}
+
+FName FStaticMeshVertexSplitRule::GetRuleID() const
+{
+	return TEXT("SM_VertexSplit");
+}
+
+FText FStaticMeshVertexSplitRule::GetRuleDescription() const
+{
+	return FText::FromString(TEXT("Compares each LOD's render vertex count with its distinct positions, attributes the split vertices to UV seams, hard normals, tangents, vertex colors and sections, and reports LODs whose splits waste vertex buffer memory."));
+}
+
+bool FStaticMeshVertexSplitRule::IsEnabled(const UPipelineGuardianProfile* Profile) const
+{
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	return Settings && Settings->bEnableStaticMeshVertexSplitRule;
+}
+
+FStaticMeshVertexSplitRule::FLODVertexSplitStats FStaticMeshVertexSplitRule::AnalyzeLOD(const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 LODIndex) const
+{
+	const FStaticMeshLODSnapshot& LODSnapshot = MeshSnapshot.LODs[LODIndex];
+
+	// Sections draw from their own vertex ranges, so a vertex's section is the one whose range holds it
+	TArray<int32> VertexSections;
+	VertexSections.Init(INDEX_NONE, LODSnapshot.GetNumVertices());
+	for (int32 SectionIndex = 0; SectionIndex < LODSnapshot.Sections.Num(); ++SectionIndex)
+	{
+		const FStaticMeshSectionSnapshot& Section = LODSnapshot.Sections[SectionIndex];
+		const int32 LastVertex = FMath::Min(static_cast<int32>(Section.MaxVertexIndex), LODSnapshot.GetNumVertices() - 1);
+		for (int32 VertexIndex = static_cast<int32>(Section.MinVertexIndex); VertexIndex <= LastVertex; ++VertexIndex)
+		{
+			VertexSections[VertexIndex] = SectionIndex;
+		}
+	}
+
+	FVertexSplitStreams Streams;
+	Streams.Positions = LODSnapshot.Positions;
+	Streams.Normals = LODSnapshot.TangentZ;
+	Streams.Tangents = LODSnapshot.TangentX;
+	for (const TArray<FVector2f>& UVChannel : LODSnapshot.UVChannels)
+	{
+		Streams.UVChannels.Add(UVChannel);
+	}
+	if (LODSnapshot.HasVertexColors())
+	{
+		Streams.Colors = LODSnapshot.Colors;
+	}
+	Streams.Sections = VertexSections;
+
+	FLODVertexSplitStats LODStats;
+	LODStats.LODIndex = LODIndex;
+	LODStats.Splits = FVertexSplitAnalyzer::Analyze(Streams);
+	LODStats.VertexStride = GetVertexStride(MeshSnapshot, LODIndex);
+	if (MeshSnapshot.SourceModels.IsValidIndex(LODIndex))
+	{
+		LODStats.NumDescriptionVertices = MeshSnapshot.SourceModels[LODIndex].NumDescriptionVertices;
+	}
+	return LODStats;
+}
+
+int32 FStaticMeshVertexSplitRule::GetVertexStride(const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 LODIndex) const
+{
+	const FStaticMeshLODSnapshot& LODSnapshot = MeshSnapshot.LODs[LODIndex];
+
+	// Position, packed tangent and normal, packed UVs, and color
+	const int32 PositionBytes = sizeof(FVector3f);
+	const int32 TangentBytes = LODSnapshot.bUseHighPrecisionTangentBasis ? 16 : 8;
+	const int32 UVBytes = LODSnapshot.GetNumTexCoords() * (LODSnapshot.bUseFullPrecisionUVs ? 8 : 4);
+	const int32 ColorBytes = LODSnapshot.HasVertexColors() ? sizeof(FColor) : 0;
+	return PositionBytes + TangentBytes + UVBytes + ColorBytes;
+}
+
+FString FStaticMeshVertexSplitRule::GenerateVertexSplitDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, TConstArrayView<FLODVertexSplitStats> SplitLODs) const
+{
+	using namespace StaticMeshVertexSplitRule;
+
+	FString Description = FString::Printf(TEXT("Static mesh %s has many more render vertices than positions:"), *MeshSnapshot.AssetName);
+
+	// Bit per cause that gets a suggested fix
+	uint32 FixCauseMask = 0;
+	for (const FLODVertexSplitStats& LODStats : SplitLODs)
+	{
+		const FVertexSplitStats& Splits = LODStats.Splits;
+		Description += FString::Printf(TEXT("\n  LOD%d: %d render vertices for %d positions (%.2fx"),
+			LODStats.LODIndex, Splits.NumVertices, Splits.NumPositions, Splits.GetSplitRatio());
+		if (LODStats.NumDescriptionVertices > 0)
+		{
+			Description += FString::Printf(TEXT(", %.2fx the %d mesh description vertices"),
+				static_cast<float>(Splits.NumVertices) / LODStats.NumDescriptionVertices, LODStats.NumDescriptionVertices);
+		}
+		Description += FString::Printf(TEXT("), %.1f KB in split vertices. Split by"), LODStats.GetWastedBytes() / 1024.0f);
+
+		bool bFirstCause = true;
+		for (int32 CauseIndex = 0; CauseIndex < static_cast<int32>(EVertexSplitCause::Num); ++CauseIndex)
+		{
+			const EVertexSplitCause Cause = static_cast<EVertexSplitCause>(CauseIndex);
+			const int32 NumSplits = Splits.GetNumSplits(Cause);
+			if (NumSplits == 0)
+			{
+				continue;
+			}
+
+			Description += FString::Printf(TEXT("%s %s: %d"), bFirstCause ? TEXT("") : TEXT(","), FVertexSplitStats::GetCauseName(Cause), NumSplits);
+			bFirstCause = false;
+			if (NumSplits >= MinCauseShare * Splits.GetNumSplitVertices())
+			{
+				FixCauseMask |= 1u << CauseIndex;
+			}
+		}
+	}
+
+	if (FixCauseMask != 0)
+	{
+		Description += TEXT("\nSuggested fixes:");
+		for (int32 CauseIndex = 0; CauseIndex < static_cast<int32>(EVertexSplitCause::Num); ++CauseIndex)
+		{
+			if (FixCauseMask & (1u << CauseIndex))
+			{
+				Description += FString::Printf(TEXT("\n  - %s"), GetSuggestedFix(static_cast<EVertexSplitCause>(CauseIndex)));
+			}
+		}
+	}
+
+	return Description;
+}
+
+const TCHAR* FStaticMeshVertexSplitRule::GetSuggestedFix(EVertexSplitCause Cause) const
+{
+	switch (Cause)
+	{
+	case EVertexSplitCause::Section:
+		return TEXT("Section boundaries: merge material slots that use the same material, or combine materials into one with a mask or atlas.");
+	case EVertexSplitCause::UVSeam:
+		return TEXT("UV seams: place seams along hard edges so both split the same vertices, stitch small UV islands together, and weld UVs closer than 1/1024.");
+	case EVertexSplitCause::Normal:
+		return TEXT("Hard normals: unify normals across edges that do not need to look hard (soften them or import smoothing groups), or let a normal map carry the detail.");
+	case EVertexSplitCause::Tangent:
+		return TEXT("Tangent splits: mirrored or flipped UV islands need their own tangents; avoid mirroring, or keep mirrored islands along existing seams, and build with MikkTSpace tangents.");
+	case EVertexSplitCause::Color:
+		return TEXT("Vertex colors: colors differ between the corners of faces sharing a vertex; paint per vertex rather than per face corner.");
+	case EVertexSplitCause::Duplicate:
+		return TEXT("Unwelded duplicates: weld coincident vertices in the source file (e.g. with a weld threshold of 0.01 units) and reimport.");
+	default:
+		return TEXT("");
+	}
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Analysis/IAssetCheckRule.h"
+#include "Analysis/Geometry/FVertexSplitAnalyzer.h"
+
+// Forward Declarations
+struct FStaticMeshAnalysisSnapshot;
+
+/**
+ * Compares the render vertex count of each LOD with its distinct positions and with the vertex count of its mesh
+ * description, attributes the split vertices to UV seams, hard normals, tangents, vertex colors and section
+ * boundaries, and reports LODs whose splits waste vertex buffer memory, with fixes for the dominant causes.
+ */
+class FStaticMeshVertexSplitRule : public IAssetCheckRule
+{
+public:
+	FStaticMeshVertexSplitRule();
+	virtual ~FStaticMeshVertexSplitRule() = default;
+
+	virtual bool Check(UObject* Asset, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
+	virtual FName GetRuleID() const override;
+	virtual FText GetRuleDescription() const override;
+	virtual bool IsEnabled(const UPipelineGuardianProfile* Profile) const override;
+	virtual bool SupportsSnapshot() const override { return true; }
+	virtual bool CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) override;
+
+private:
+	/** Split analysis of one render LOD */
+	struct FLODVertexSplitStats
+	{
+		int32 LODIndex = INDEX_NONE;
+		FVertexSplitStats Splits;
+
+		/** Bytes of vertex buffer per render vertex */
+		int32 VertexStride = 0;
+
+		/** Vertices of the LOD's mesh description; INDEX_NONE when unknown, e.g. for LODs generated by reduction or descriptions that are not loaded */
+		int32 NumDescriptionVertices = INDEX_NONE;
+
+		int64 GetWastedBytes() const { return static_cast<int64>(Splits.GetNumSplitVertices()) * VertexStride; }
+	};
+
+	/** Analyzes one render LOD */
+	FLODVertexSplitStats AnalyzeLOD(const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 LODIndex) const;
+
+	/** @return Bytes per vertex across the position, tangent, UV and color streams of a render LOD. */
+	int32 GetVertexStride(const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 LODIndex) const;
+
+	FString GenerateVertexSplitDescription(const FStaticMeshAnalysisSnapshot& MeshSnapshot, TConstArrayView<FLODVertexSplitStats> SplitLODs) const;
+
+	/** @return How to avoid splits of a cause. */
+	const TCHAR* GetSuggestedFix(EVertexSplitCause Cause) const;
+};
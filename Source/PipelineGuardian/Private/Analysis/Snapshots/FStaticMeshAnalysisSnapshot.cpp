@@ -0,0 +1,277 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Analysis/Snapshots/FStaticMeshAnalysisSnapshot.h"
+#include "Analysis/Geometry/FMeshDescriptionReorderer.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshSocket.h"
+#include "StaticMeshResources.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "Materials/MaterialInterface.h"
+#include "Engine/Texture.h"
+#include "RHI.h"
+#include "MeshDescription.h"
+#include "DistanceFieldAtlas.h"
+#include "MeshCardRepresentation.h"
+#include "Rendering/NaniteResources.h"
+#include "FPipelineGuardianSettings.h"
+#include "PipelineGuardian.h"
+
+namespace StaticMeshSnapshotUtils
+{
+	/** Copies the render data of one LOD into SoA streams */
+	void CopyLODResources(const FStaticMeshLODResources& LODResource, FStaticMeshLODSnapshot& OutLOD)
+	{
+		const FPositionVertexBuffer& PositionBuffer = LODResource.VertexBuffers.PositionVertexBuffer;
+		const FStaticMeshVertexBuffer& VertexBuffer = LODResource.VertexBuffers.StaticMeshVertexBuffer;
+		const FColorVertexBuffer& ColorBuffer = LODResource.VertexBuffers.ColorVertexBuffer;
+
+		const int32 NumVertices = static_cast<int32>(PositionBuffer.GetNumVertices());
+		const int32 NumTexCoords = static_cast<int32>(VertexBuffer.GetNumTexCoords());
+
+		OutLOD.Positions.SetNumUninitialized(NumVertices);
+		OutLOD.TangentX.SetNumUninitialized(NumVertices);
+		OutLOD.TangentZ.SetNumUninitialized(NumVertices);
+		OutLOD.UVChannels.SetNum(NumTexCoords);
+		for (TArray<FVector2f>& UVChannel : OutLOD.UVChannels)
+		{
+			UVChannel.SetNumUninitialized(NumVertices);
+		}
+
+		for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+		{
+			OutLOD.Positions[VertexIndex] = PositionBuffer.VertexPosition(VertexIndex);
+			OutLOD.TangentX[VertexIndex] = FVector3f(VertexBuffer.VertexTangentX(VertexIndex));
+			OutLOD.TangentZ[VertexIndex] = FVector3f(VertexBuffer.VertexTangentZ(VertexIndex));
+			for (int32 UVIndex = 0; UVIndex < NumTexCoords; ++UVIndex)
+			{
+				OutLOD.UVChannels[UVIndex][VertexIndex] = VertexBuffer.GetVertexUV(VertexIndex, UVIndex);
+			}
+		}
+
+		if (static_cast<int32>(ColorBuffer.GetNumVertices()) == NumVertices)
+		{
+			OutLOD.Colors.SetNumUninitialized(NumVertices);
+			for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+			{
+				OutLOD.Colors[VertexIndex] = ColorBuffer.VertexColor(VertexIndex);
+			}
+		}
+
+		LODResource.IndexBuffer.GetCopy(OutLOD.Indices);
+
+		OutLOD.Sections.Reserve(LODResource.Sections.Num());
+		for (const FStaticMeshSection& Section : LODResource.Sections)
+		{
+			FStaticMeshSectionSnapshot& SectionSnapshot = OutLOD.Sections.AddDefaulted_GetRef();
+			SectionSnapshot.MaterialIndex = Section.MaterialIndex;
+			SectionSnapshot.FirstIndex = Section.FirstIndex;
+			SectionSnapshot.NumTriangles = Section.NumTriangles;
+			SectionSnapshot.MinVertexIndex = Section.MinVertexIndex;
+			SectionSnapshot.MaxVertexIndex = Section.MaxVertexIndex;
+			SectionSnapshot.bEnableCollision = Section.bEnableCollision;
+			SectionSnapshot.bCastShadow = Section.bCastShadow;
+		}
+
+		OutLOD.bUseFullPrecisionUVs = VertexBuffer.GetUseFullPrecisionUVs();
+		OutLOD.bUseHighPrecisionTangentBasis = VertexBuffer.GetUseHighPrecisionTangentBasis();
+
+		OutLOD.bUse32BitIndices = LODResource.IndexBuffer.Is32Bit();
+		OutLOD.AdditionalIndexBytes = LODResource.DepthOnlyIndexBuffer.GetIndexDataSize();
+		if (LODResource.AdditionalIndexBuffers)
+		{
+			OutLOD.AdditionalIndexBytes += LODResource.AdditionalIndexBuffers->ReversedIndexBuffer.GetIndexDataSize();
+			OutLOD.AdditionalIndexBytes += LODResource.AdditionalIndexBuffers->ReversedDepthOnlyIndexBuffer.GetIndexDataSize();
+		}
+	}
+
+	/** Summarizes the simple collision of a body setup */
+	void CopyCollision(const UBodySetup* BodySetup, FStaticMeshCollisionSnapshot& OutCollision)
+	{
+		OutCollision.bHasBodySetup = (BodySetup != nullptr);
+		if (!BodySetup)
+		{
+			return;
+		}
+
+		const FKAggregateGeom& AggGeom = BodySetup->AggGeom;
+		OutCollision.NumBoxes = AggGeom.BoxElems.Num();
+		OutCollision.NumSpheres = AggGeom.SphereElems.Num();
+		OutCollision.NumCapsules = AggGeom.SphylElems.Num();
+		OutCollision.NumTaperedCapsules = AggGeom.TaperedCapsuleElems.Num();
+		OutCollision.NumConvexElements = AggGeom.ConvexElems.Num();
+		for (const FKConvexElem& ConvexElem : AggGeom.ConvexElems)
+		{
+			OutCollision.NumConvexVertices += ConvexElem.VertexData.Num();
+		}
+
+		OutCollision.CollisionTraceFlag = BodySetup->CollisionTraceFlag;
+		OutCollision.CollisionProfileName = BodySetup->DefaultInstance.GetCollisionProfileName();
+	}
+
+	/** Reads the sizes of the distance field, mesh cards and Nanite data built with the render data */
+	void CopyResourceSizes(const FStaticMeshRenderData& RenderData, FStaticMeshResourceSnapshot& OutResources)
+	{
+		if (RenderData.LODResources.Num() > 0)
+		{
+			const FStaticMeshLODResources& BaseLOD = RenderData.LODResources[0];
+			if (BaseLOD.DistanceFieldData)
+			{
+				OutResources.DistanceFieldBytes = BaseLOD.DistanceFieldData->GetResourceSizeBytes();
+			}
+			if (BaseLOD.CardRepresentationData)
+			{
+				OutResources.NumLumenCards = BaseLOD.CardRepresentationData->MeshCardsBuildData.CardBuildData.Num();
+				OutResources.LumenCardBytes = BaseLOD.CardRepresentationData->GetResourceSizeBytes();
+			}
+		}
+
+		if (RenderData.HasValidNaniteData())
+		{
+			const Nanite::FResources& NaniteResources = *RenderData.NaniteResourcesPtr;
+			OutResources.NaniteResidentBytes = NaniteResources.RootData.Num()
+				+ NaniteResources.HierarchyNodes.Num() * sizeof(Nanite::FPackedHierarchyNode)
+				+ NaniteResources.ImposterAtlas.Num() * sizeof(uint16);
+			OutResources.NaniteStreamingBytes = NaniteResources.StreamablePages.GetBulkDataSize();
+		}
+	}
+
+	/** @return Largest dimension of the textures a material samples at any quality level, 0 if it samples none. */
+	int32 GetMaxTextureSize(const UMaterialInterface* Material)
+	{
+		if (!Material)
+		{
+			return 0;
+		}
+
+		TArray<UTexture*> Textures;
+		Material->GetUsedTextures(Textures, EMaterialQualityLevel::Num, true, GMaxRHIFeatureLevel, true);
+
+		int32 MaxTextureSize = 0;
+		for (const UTexture* Texture : Textures)
+		{
+			if (Texture)
+			{
+				MaxTextureSize = FMath::Max(MaxTextureSize, FMath::TruncToInt(FMath::Max(Texture->GetSurfaceWidth(), Texture->GetSurfaceHeight())));
+			}
+		}
+		return MaxTextureSize;
+	}
+}
+
+TSharedRef<FStaticMeshAnalysisSnapshot> FStaticMeshAnalysisSnapshot::Create(const FAssetData& InAssetData, const UStaticMesh* InStaticMesh)
+{
+	check(IsInGameThread());
+
+	TSharedRef<FStaticMeshAnalysisSnapshot> Snapshot = MakeShared<FStaticMeshAnalysisSnapshot>();
+	Snapshot->AssetData = InAssetData;
+	if (!InStaticMesh)
+	{
+		return Snapshot;
+	}
+
+	Snapshot->AssetName = InStaticMesh->GetName();
+	Snapshot->PackageName = InStaticMesh->GetPackage()->GetName();
+	Snapshot->AssetClass = InStaticMesh->GetClass();
+
+	if (const FStaticMeshRenderData* RenderData = InStaticMesh->GetRenderData())
+	{
+		Snapshot->LODs.SetNum(RenderData->LODResources.Num());
+		for (int32 LODIndex = 0; LODIndex < RenderData->LODResources.Num(); ++LODIndex)
+		{
+			StaticMeshSnapshotUtils::CopyLODResources(RenderData->LODResources[LODIndex], Snapshot->LODs[LODIndex]);
+			Snapshot->LODs[LODIndex].ScreenSize = RenderData->ScreenSize[LODIndex].Default;
+		}
+
+		StaticMeshSnapshotUtils::CopyResourceSizes(*RenderData, Snapshot->Resources);
+	}
+
+	// Texture sizes walk every texture a material samples, so like the mesh description counts they are only read while
+	// the rule that needs them is enabled
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	const bool bReadMeshDescriptions = Settings && (Settings->bEnableStaticMeshVertexSplitRule || Settings->bEnableStaticMeshVertexCacheRule || Settings->bEnableStaticMeshOverdrawRule);
+	const bool bReadTextureSizes = Settings && Settings->bEnableStaticMeshTexelDensityRule;
+	const int32 NumSourceModels = InStaticMesh->GetNumSourceModels();
+	Snapshot->SourceModels.Reserve(NumSourceModels);
+	for (int32 SourceModelIndex = 0; SourceModelIndex < NumSourceModels; ++SourceModelIndex)
+	{
+		const FStaticMeshSourceModel& SourceModel = InStaticMesh->GetSourceModel(SourceModelIndex);
+		FStaticMeshSourceModelSnapshot& SourceModelSnapshot = Snapshot->SourceModels.AddDefaulted_GetRef();
+		SourceModelSnapshot.BuildSettings = SourceModel.BuildSettings;
+		SourceModelSnapshot.ReductionSettings = SourceModel.ReductionSettings;
+		SourceModelSnapshot.ScreenSize = SourceModel.ScreenSize.Default;
+
+		// Only descriptions something else already loaded, e.g. an open editor; loading one would decompress its bulk data
+		// for every mesh of every scan just for two counts
+		if (bReadMeshDescriptions)
+		{
+			if (const FMeshDescription* MeshDescription = SourceModel.GetCachedMeshDescription())
+			{
+				SourceModelSnapshot.NumDescriptionVertices = MeshDescription->Vertices().Num();
+				SourceModelSnapshot.NumDescriptionVertexInstances = MeshDescription->VertexInstances().Num();
+			}
+		}
+	}
+
+	// Importers give every triangle corner its own vertex instance, so that stands in for descriptions that are not loaded
+	for (int32 LODIndex = 0; LODIndex < Snapshot->LODs.Num(); ++LODIndex)
+	{
+		FStaticMeshLODSnapshot& LODSnapshot = Snapshot->LODs[LODIndex];
+		const bool bHasDescriptionCount = Snapshot->SourceModels.IsValidIndex(LODIndex) && Snapshot->SourceModels[LODIndex].NumDescriptionVertexInstances != INDEX_NONE;
+		const int64 NumVertexInstances = bHasDescriptionCount ? Snapshot->SourceModels[LODIndex].NumDescriptionVertexInstances : static_cast<int64>(LODSnapshot.GetNumTriangles()) * 3;
+		LODSnapshot.bOrderKeptByBuild = FMeshDescriptionReorderer::IsOrderKeptByBuild(NumVertexInstances);
+	}
+
+	for (const FStaticMaterial& StaticMaterial : InStaticMesh->GetStaticMaterials())
+	{
+		FStaticMeshMaterialSlotSnapshot& SlotSnapshot = Snapshot->MaterialSlots.AddDefaulted_GetRef();
+		SlotSnapshot.SlotName = StaticMaterial.MaterialSlotName;
+		SlotSnapshot.ImportedSlotName = StaticMaterial.ImportedMaterialSlotName;
+		SlotSnapshot.MaterialPath = FSoftObjectPath(StaticMaterial.MaterialInterface);
+		SlotSnapshot.MaxTextureSize = bReadTextureSizes ? StaticMeshSnapshotUtils::GetMaxTextureSize(StaticMaterial.MaterialInterface) : 0;
+		if (StaticMaterial.MaterialInterface)
+		{
+			SlotSnapshot.BlendMode = StaticMaterial.MaterialInterface->GetBlendMode();
+			SlotSnapshot.bTwoSided = StaticMaterial.MaterialInterface->IsTwoSided();
+		}
+	}
+
+	for (const UStaticMeshSocket* Socket : InStaticMesh->Sockets)
+	{
+		if (!Socket)
+		{
+			continue;
+		}
+
+		FStaticMeshSocketSnapshot& SocketSnapshot = Snapshot->Sockets.AddDefaulted_GetRef();
+		SocketSnapshot.SocketName = Socket->SocketName;
+		SocketSnapshot.RelativeLocation = Socket->RelativeLocation;
+		SocketSnapshot.RelativeRotation = Socket->RelativeRotation;
+		SocketSnapshot.RelativeScale = Socket->RelativeScale;
+		SocketSnapshot.Tag = Socket->Tag;
+	}
+
+	StaticMeshSnapshotUtils::CopyCollision(InStaticMesh->GetBodySetup(), Snapshot->Collision);
+
+	Snapshot->Bounds = InStaticMesh->GetBounds();
+	Snapshot->BoundingBox = InStaticMesh->GetBoundingBox();
+	Snapshot->LightMapResolution = InStaticMesh->GetLightMapResolution();
+	Snapshot->LightMapCoordinateIndex = InStaticMesh->GetLightMapCoordinateIndex();
+	Snapshot->bNaniteEnabled = InStaticMesh->NaniteSettings.bEnabled;
+	Snapshot->Resources.bSupportRayTracing = InStaticMesh->bSupportRayTracing;
+	Snapshot->Resources.bAllowCPUAccess = InStaticMesh->bAllowCPUAccess;
+	Snapshot->Resources.LODForCollision = InStaticMesh->GetLODForCollision();
+
+	UE_LOG(LogPipelineGuardian, VeryVerbose, TEXT("FStaticMeshAnalysisSnapshot: Extracted %s (%d LODs, %d triangles in LOD0)"),
+		*Snapshot->AssetName, Snapshot->GetNumLODs(), Snapshot->GetNumTriangles(0));
+
+	return Snapshot;
+}
+
+const FStaticMeshAnalysisSnapshot* FStaticMeshAnalysisSnapshot::FromSnapshot(const FAssetAnalysisSnapshot& Snapshot)
+{
+	if (Snapshot.AssetClass && Snapshot.AssetClass->IsChildOf(UStaticMesh::StaticClass()))
+	{
+		return static_cast<const FStaticMeshAnalysisSnapshot*>(&Snapshot);
+	}
+	return nullptr;
+}
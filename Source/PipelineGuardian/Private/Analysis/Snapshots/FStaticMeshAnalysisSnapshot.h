@@ -0,0 +1,203 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Analysis/FAssetAnalysisSnapshot.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/EngineTypes.h"
+#include "PhysicsEngine/BodySetupEnums.h"
+#include "UObject/SoftObjectPath.h"
+
+/** Render section of one LOD, copied from FStaticMeshSection */
+struct FStaticMeshSectionSnapshot
+{
+	int32 MaterialIndex = INDEX_NONE;
+	uint32 FirstIndex = 0;
+	uint32 NumTriangles = 0;
+	uint32 MinVertexIndex = 0;
+	uint32 MaxVertexIndex = 0;
+	bool bEnableCollision = false;
+	bool bCastShadow = false;
+};
+
+/**
+ * Render data of one LOD in structure-of-arrays layout.
+ * Every per-vertex stream is indexed by the same vertex index as Positions.
+ */
+struct FStaticMeshLODSnapshot
+{
+	TArray<FVector3f> Positions;
+
+	/** Tangent basis X (tangent) per vertex */
+	TArray<FVector3f> TangentX;
+
+	/** Tangent basis Z (normal) per vertex */
+	TArray<FVector3f> TangentZ;
+
+	/** Texture coordinates, one array per UV channel */
+	TArray<TArray<FVector2f>> UVChannels;
+
+	/** Vertex colors. Empty when the LOD has no color buffer. */
+	TArray<FColor> Colors;
+
+	/** Triangle list indices */
+	TArray<uint32> Indices;
+
+	TArray<FStaticMeshSectionSnapshot> Sections;
+
+	/** Screen size at which this LOD becomes active */
+	float ScreenSize = 0.0f;
+
+	bool bUseFullPrecisionUVs = false;
+	bool bUseHighPrecisionTangentBasis = false;
+
+	/** Whether the index buffer stores 32-bit indices */
+	bool bUse32BitIndices = false;
+
+	/**
+	 * Whether rebuilding the mesh keeps this LOD's triangle order, see FMeshDescriptionReorderer::IsOrderKeptByBuild().
+	 * Judged from the mesh description's vertex instances when they were read, else from three per render triangle.
+	 */
+	bool bOrderKeptByBuild = false;
+
+	/** Bytes of the depth-only and reversed index buffers kept next to the main index buffer */
+	int64 AdditionalIndexBytes = 0;
+
+	int32 GetNumVertices() const { return Positions.Num(); }
+	int32 GetNumTriangles() const { return Indices.Num() / 3; }
+	int32 GetNumTexCoords() const { return UVChannels.Num(); }
+	bool HasVertexColors() const { return Colors.Num() > 0 && Colors.Num() == Positions.Num(); }
+};
+
+/** Summary of the simple collision set up on the mesh's body setup */
+struct FStaticMeshCollisionSnapshot
+{
+	bool bHasBodySetup = false;
+	int32 NumBoxes = 0;
+	int32 NumSpheres = 0;
+	int32 NumCapsules = 0;
+	int32 NumTaperedCapsules = 0;
+	int32 NumConvexElements = 0;
+
+	/** Total vertex count over all convex elements */
+	int32 NumConvexVertices = 0;
+
+	TEnumAsByte<ECollisionTraceFlag> CollisionTraceFlag = CTF_UseDefault;
+	FName CollisionProfileName;
+
+	int32 GetNumPrimitives() const { return NumBoxes + NumSpheres + NumCapsules + NumTaperedCapsules + NumConvexElements; }
+};
+
+/** Sizes of the resources built next to the render LODs, for memory estimates */
+struct FStaticMeshResourceSnapshot
+{
+	/** Distance field volume built for LOD 0; 0 when none is built */
+	int64 DistanceFieldBytes = 0;
+
+	/** Lumen mesh cards built for LOD 0 */
+	int32 NumLumenCards = 0;
+	int64 LumenCardBytes = 0;
+
+	/** Nanite root pages, hierarchy and imposter, which stay resident while the mesh is loaded */
+	int64 NaniteResidentBytes = 0;
+
+	/** Nanite pages streamed in on demand */
+	int64 NaniteStreamingBytes = 0;
+
+	bool bSupportRayTracing = false;
+
+	/** Whether the vertex and index data is kept in CPU memory after upload */
+	bool bAllowCPUAccess = false;
+
+	/** Render LOD the complex collision is cooked from */
+	int32 LODForCollision = 0;
+};
+
+/** Copy of a UStaticMeshSocket */
+struct FStaticMeshSocketSnapshot
+{
+	FName SocketName;
+	FVector RelativeLocation = FVector::ZeroVector;
+	FRotator RelativeRotation = FRotator::ZeroRotator;
+	FVector RelativeScale = FVector::OneVector;
+	FString Tag;
+};
+
+/** Copy of an FStaticMaterial entry */
+struct FStaticMeshMaterialSlotSnapshot
+{
+	FName SlotName;
+	FName ImportedSlotName;
+
+	/** Path of the assigned material; null when the slot is empty */
+	FSoftObjectPath MaterialPath;
+
+	/** Largest width or height, in texels, of the textures the material samples; 0 when the slot is empty, samples none or the texel density rule is disabled */
+	int32 MaxTextureSize = 0;
+
+	/** Blend mode of the assigned material; opaque when the slot is empty */
+	TEnumAsByte<EBlendMode> BlendMode = BLEND_Opaque;
+
+	/** Whether the assigned material renders back faces */
+	bool bTwoSided = false;
+};
+
+/** Build inputs of one source model */
+struct FStaticMeshSourceModelSnapshot
+{
+	FMeshBuildSettings BuildSettings;
+	FMeshReductionSettings ReductionSettings;
+	float ScreenSize = 0.0f;
+
+	/** Vertices (distinct positions) of the mesh description; INDEX_NONE when it was not read or not loaded */
+	int32 NumDescriptionVertices = INDEX_NONE;
+
+	/** Vertex instances (face corners) of the mesh description; INDEX_NONE when it was not read or not loaded */
+	int32 NumDescriptionVertexInstances = INDEX_NONE;
+};
+
+/**
+ * Immutable snapshot of a UStaticMesh used by static mesh rules.
+ * Extracted once per mesh on the game thread so that rules can run on worker threads
+ * without each of them walking the render data, body setup and sockets again.
+ */
+struct FStaticMeshAnalysisSnapshot : public FAssetAnalysisSnapshot
+{
+	/** Render LODs; empty when the mesh has no render data */
+	TArray<FStaticMeshLODSnapshot> LODs;
+
+	TArray<FStaticMeshSourceModelSnapshot> SourceModels;
+	TArray<FStaticMeshMaterialSlotSnapshot> MaterialSlots;
+	TArray<FStaticMeshSocketSnapshot> Sockets;
+	FStaticMeshCollisionSnapshot Collision;
+	FStaticMeshResourceSnapshot Resources;
+
+	FBoxSphereBounds Bounds = FBoxSphereBounds(ForceInit);
+	FBox BoundingBox = FBox(ForceInit);
+
+	int32 LightMapResolution = 0;
+	int32 LightMapCoordinateIndex = 0;
+	bool bNaniteEnabled = false;
+
+	int32 GetNumLODs() const { return LODs.Num(); }
+	int32 GetNumTriangles(int32 LODIndex = 0) const { return LODs.IsValidIndex(LODIndex) ? LODs[LODIndex].GetNumTriangles() : 0; }
+	int32 GetNumVertices(int32 LODIndex = 0) const { return LODs.IsValidIndex(LODIndex) ? LODs[LODIndex].GetNumVertices() : 0; }
+
+	/**
+	 * Extracts a snapshot from a loaded static mesh. Game thread only.
+	 * Texture sizes are only read while the texel density rule is enabled, and mesh description counts only while a rule
+	 * that needs them is enabled and only from mesh descriptions that are already loaded.
+	 * @param InAssetData Asset data to report results against.
+	 * @param InStaticMesh The mesh to copy from.
+	 * @return The populated snapshot.
+	 */
+	static TSharedRef<FStaticMeshAnalysisSnapshot> Create(const FAssetData& InAssetData, const UStaticMesh* InStaticMesh);
+
+	/**
+	 * Downcasts a generic snapshot if it was taken from a static mesh.
+	 * @param Snapshot The snapshot handed to a rule.
+	 * @return The static mesh snapshot, or nullptr for other asset types.
+	 */
+	static const FStaticMeshAnalysisSnapshot* FromSnapshot(const FAssetAnalysisSnapshot& Snapshot);
+};
@@ -0,0 +1,135 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Analysis/Snapshots/FStaticMeshDrawCallEstimator.h"
+#include "Analysis/Snapshots/FStaticMeshAnalysisSnapshot.h"
+
+namespace StaticMeshDrawCallEstimator
+{
+	/** @return Draw calls per instance of a section drawn with a material of the given blend mode. */
+	int32 GetNumDrawCalls(EBlendMode BlendMode, bool bCastShadow, int32 NumShadowPasses)
+	{
+		if (BlendMode != BLEND_Opaque && BlendMode != BLEND_Masked)
+		{
+			return 1;
+		}
+
+		// Base pass and depth prepass, then the shadow depth passes
+		return 2 + (bCastShadow ? NumShadowPasses : 0);
+	}
+
+	/** @return True if both sections can be drawn as one: the same material, and the same shadow and collision flags. */
+	bool CanMergeSections(const FStaticMeshAnalysisSnapshot& MeshSnapshot, const FStaticMeshSectionSnapshot& A, const FStaticMeshSectionSnapshot& B)
+	{
+		if (A.bCastShadow != B.bCastShadow || A.bEnableCollision != B.bEnableCollision)
+		{
+			return false;
+		}
+		if (A.MaterialIndex == B.MaterialIndex)
+		{
+			return true;
+		}
+
+		// Different slots with the same material; empty slots are left apart, since each may be assigned its own material later
+		const TArray<FStaticMeshMaterialSlotSnapshot>& MaterialSlots = MeshSnapshot.MaterialSlots;
+		return MaterialSlots.IsValidIndex(A.MaterialIndex) && MaterialSlots.IsValidIndex(B.MaterialIndex)
+			&& !MaterialSlots[A.MaterialIndex].MaterialPath.IsNull()
+			&& MaterialSlots[A.MaterialIndex].MaterialPath == MaterialSlots[B.MaterialIndex].MaterialPath;
+	}
+}
+
+int32 FLODDrawCost::GetNumMergeableSections() const
+{
+	int32 NumMergeable = 0;
+	for (const FSectionDrawCost& Section : Sections)
+	{
+		NumMergeable += Section.MergeTarget != INDEX_NONE ? 1 : 0;
+	}
+	return NumMergeable;
+}
+
+FStaticMeshDrawCost FStaticMeshDrawCallEstimator::Estimate(const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 NumShadowPasses)
+{
+	using namespace StaticMeshDrawCallEstimator;
+
+	FStaticMeshDrawCost DrawCost;
+	NumShadowPasses = FMath::Max(NumShadowPasses, 0);
+
+	DrawCost.LODs.Reserve(MeshSnapshot.GetNumLODs());
+	for (const FStaticMeshLODSnapshot& LOD : MeshSnapshot.LODs)
+	{
+		FLODDrawCost& LODCost = DrawCost.LODs.AddDefaulted_GetRef();
+		LODCost.Sections.SetNum(LOD.Sections.Num());
+
+		const uint32 NumVertices = static_cast<uint32>(LOD.GetNumVertices());
+		double TotalArea = 0.0;
+		TArray<double> SectionAreas;
+		SectionAreas.SetNumZeroed(LOD.Sections.Num());
+		for (int32 SectionIndex = 0; SectionIndex < LOD.Sections.Num(); ++SectionIndex)
+		{
+			const FStaticMeshSectionSnapshot& Section = LOD.Sections[SectionIndex];
+			const int64 LastIndex = FMath::Min(static_cast<int64>(Section.FirstIndex) + 3 * static_cast<int64>(Section.NumTriangles), static_cast<int64>(LOD.Indices.Num()));
+			for (int64 Index = Section.FirstIndex; Index + 2 < LastIndex; Index += 3)
+			{
+				const uint32 Index0 = LOD.Indices[Index];
+				const uint32 Index1 = LOD.Indices[Index + 1];
+				const uint32 Index2 = LOD.Indices[Index + 2];
+				if (Index0 < NumVertices && Index1 < NumVertices && Index2 < NumVertices)
+				{
+					const FVector3f Edge1 = LOD.Positions[Index1] - LOD.Positions[Index0];
+					const FVector3f Edge2 = LOD.Positions[Index2] - LOD.Positions[Index0];
+					SectionAreas[SectionIndex] += 0.5 * FVector3f::CrossProduct(Edge1, Edge2).Size();
+				}
+			}
+			TotalArea += SectionAreas[SectionIndex];
+		}
+
+		for (int32 SectionIndex = 0; SectionIndex < LOD.Sections.Num(); ++SectionIndex)
+		{
+			const FStaticMeshSectionSnapshot& Section = LOD.Sections[SectionIndex];
+			const EBlendMode BlendMode = MeshSnapshot.MaterialSlots.IsValidIndex(Section.MaterialIndex) ? MeshSnapshot.MaterialSlots[Section.MaterialIndex].BlendMode.GetValue() : BLEND_Opaque;
+
+			FSectionDrawCost& SectionCost = LODCost.Sections[SectionIndex];
+			SectionCost.MaterialIndex = Section.MaterialIndex;
+			SectionCost.NumTriangles = static_cast<int32>(Section.NumTriangles);
+			SectionCost.AreaFraction = TotalArea > 0.0 ? static_cast<float>(SectionAreas[SectionIndex] / TotalArea) : 0.0f;
+			SectionCost.NumDrawCalls = GetNumDrawCalls(BlendMode, Section.bCastShadow, NumShadowPasses);
+			LODCost.NumDrawCalls += SectionCost.NumDrawCalls;
+
+			for (int32 OtherIndex = 0; OtherIndex < SectionIndex; ++OtherIndex)
+			{
+				if (LODCost.Sections[OtherIndex].MergeTarget == INDEX_NONE && CanMergeSections(MeshSnapshot, LOD.Sections[OtherIndex], Section))
+				{
+					SectionCost.MergeTarget = OtherIndex;
+					break;
+				}
+			}
+			if (SectionCost.MergeTarget == INDEX_NONE)
+			{
+				LODCost.NumMergedDrawCalls += SectionCost.NumDrawCalls;
+			}
+		}
+	}
+
+	// Slots are matched by material path, not by object, so that the estimate does not need the materials loaded
+	TMap<FSoftObjectPath, int32> GroupByMaterial;
+	for (int32 SlotIndex = 0; SlotIndex < MeshSnapshot.MaterialSlots.Num(); ++SlotIndex)
+	{
+		const FSoftObjectPath& MaterialPath = MeshSnapshot.MaterialSlots[SlotIndex].MaterialPath;
+		if (MaterialPath.IsNull())
+		{
+			continue;
+		}
+		if (const int32* GroupIndex = GroupByMaterial.Find(MaterialPath))
+		{
+			DrawCost.SharedMaterialSlots[*GroupIndex].Add(SlotIndex);
+		}
+		else
+		{
+			GroupByMaterial.Add(MaterialPath, DrawCost.SharedMaterialSlots.Num());
+			DrawCost.SharedMaterialSlots.Add({ SlotIndex });
+		}
+	}
+	DrawCost.SharedMaterialSlots.RemoveAll([](const TArray<int32>& Slots) { return Slots.Num() < 2; });
+
+	return DrawCost;
+}
@@ -0,0 +1,66 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FStaticMeshAnalysisSnapshot;
+
+/** Draw cost of one render section */
+struct FSectionDrawCost
+{
+	int32 MaterialIndex = INDEX_NONE;
+	int32 NumTriangles = 0;
+
+	/** Share of the LOD's surface area, from 0 to 1 */
+	float AreaFraction = 0.0f;
+
+	/** Draw calls the section issues per instance, over every pass it is drawn in */
+	int32 NumDrawCalls = 0;
+
+	/** Earlier section of the same LOD with the same material and flags it can be merged into; INDEX_NONE if none */
+	int32 MergeTarget = INDEX_NONE;
+};
+
+/** Draw cost of one LOD */
+struct FLODDrawCost
+{
+	TArray<FSectionDrawCost> Sections;
+
+	/** Draw calls per instance over all sections */
+	int32 NumDrawCalls = 0;
+
+	/** Draw calls per instance once sections with the same material and flags are merged */
+	int32 NumMergedDrawCalls = 0;
+
+	int32 GetNumSections() const { return Sections.Num(); }
+	int32 GetNumMergeableSections() const;
+};
+
+/** Draw cost of a static mesh instance, per LOD */
+struct FStaticMeshDrawCost
+{
+	TArray<FLODDrawCost> LODs;
+
+	/** Groups of two or more material slots with the same assigned material, in slot order */
+	TArray<TArray<int32>> SharedMaterialSlots;
+};
+
+/**
+ * Estimates the draw calls a static mesh instance issues on the non-Nanite mesh path from its analysis snapshot.
+ * Every section of the visible LOD is one draw in the base pass; opaque and masked sections are drawn again in the
+ * depth prepass and, when they cast shadows, once per shadow depth pass. Translucent sections only draw in the
+ * translucency pass. Instancing and auto-instancing batch instances together but not sections, so sections remain
+ * the multiplier.
+ * Thread-safe; holds no state.
+ */
+class FStaticMeshDrawCallEstimator
+{
+public:
+	/**
+	 * @param MeshSnapshot Snapshot of the mesh.
+	 * @param NumShadowPasses Shadow depth passes a shadow-casting section is drawn in, e.g. cascades times lights.
+	 * @return Estimated draw cost.
+	 */
+	static FStaticMeshDrawCost Estimate(const FStaticMeshAnalysisSnapshot& MeshSnapshot, int32 NumShadowPasses);
+};
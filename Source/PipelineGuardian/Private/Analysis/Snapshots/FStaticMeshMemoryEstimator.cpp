@@ -0,0 +1,122 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Analysis/Snapshots/FStaticMeshMemoryEstimator.h"
+#include "Analysis/Snapshots/FStaticMeshAnalysisSnapshot.h"
+#include "Math/Vector2DHalf.h"
+#include "PackedNormal.h"
+
+int64 FStaticMeshMemoryFootprint::GetTotalGPUBytes() const
+{
+	int64 Total = 0;
+	for (const int64 Bytes : GPUBytes)
+	{
+		Total += Bytes;
+	}
+	return Total;
+}
+
+int64 FStaticMeshMemoryFootprint::GetTotalCPUBytes() const
+{
+	int64 Total = 0;
+	for (const int64 Bytes : CPUBytes)
+	{
+		Total += Bytes;
+	}
+	return Total;
+}
+
+const TCHAR* FStaticMeshMemoryFootprint::GetCategoryName(EStaticMeshMemoryCategory Category)
+{
+	switch (Category)
+	{
+		case EStaticMeshMemoryCategory::VertexBuffers: return TEXT("Vertex buffers");
+		case EStaticMeshMemoryCategory::IndexBuffers: return TEXT("Index buffers");
+		case EStaticMeshMemoryCategory::DistanceField: return TEXT("Distance field");
+		case EStaticMeshMemoryCategory::LumenCards: return TEXT("Lumen mesh cards");
+		case EStaticMeshMemoryCategory::RayTracing: return TEXT("Ray tracing");
+		case EStaticMeshMemoryCategory::SimpleCollision: return TEXT("Simple collision");
+		case EStaticMeshMemoryCategory::ComplexCollision: return TEXT("Complex collision");
+		case EStaticMeshMemoryCategory::Nanite: return TEXT("Nanite");
+		default: return TEXT("Unknown");
+	}
+}
+
+FStaticMeshMemoryFootprint FStaticMeshMemoryEstimator::Estimate(const FStaticMeshAnalysisSnapshot& MeshSnapshot)
+{
+	FStaticMeshMemoryFootprint Footprint;
+	int64* GPUBytes = Footprint.GPUBytes;
+	int64* CPUBytes = Footprint.CPUBytes;
+	const FStaticMeshResourceSnapshot& Resources = MeshSnapshot.Resources;
+
+	constexpr int32 VertexBuffers = static_cast<int32>(EStaticMeshMemoryCategory::VertexBuffers);
+	constexpr int32 IndexBuffers = static_cast<int32>(EStaticMeshMemoryCategory::IndexBuffers);
+
+	Footprint.LODBytes.Reserve(MeshSnapshot.GetNumLODs());
+	for (const FStaticMeshLODSnapshot& LOD : MeshSnapshot.LODs)
+	{
+		const int64 NumVertices = LOD.GetNumVertices();
+		const int64 UVBytes = LOD.bUseFullPrecisionUVs ? sizeof(FVector2f) : sizeof(FVector2DHalf);
+		const int64 TangentBytes = LOD.bUseHighPrecisionTangentBasis ? 2 * sizeof(FPackedRGBA16N) : 2 * sizeof(FPackedNormal);
+		const int64 VertexStride = sizeof(FVector3f) + TangentBytes + LOD.GetNumTexCoords() * UVBytes + (LOD.HasVertexColors() ? sizeof(FColor) : 0);
+
+		const int64 LODVertexBytes = NumVertices * VertexStride;
+		const int64 LODIndexBytes = static_cast<int64>(LOD.Indices.Num()) * (LOD.bUse32BitIndices ? sizeof(uint32) : sizeof(uint16)) + LOD.AdditionalIndexBytes;
+		GPUBytes[VertexBuffers] += LODVertexBytes;
+		GPUBytes[IndexBuffers] += LODIndexBytes;
+		Footprint.LODBytes.Add(LODVertexBytes + LODIndexBytes);
+
+		if (LOD.bUseFullPrecisionUVs)
+		{
+			Footprint.FullPrecisionUVBytes += NumVertices * LOD.GetNumTexCoords() * (sizeof(FVector2f) - sizeof(FVector2DHalf));
+		}
+		if (LOD.bUseHighPrecisionTangentBasis)
+		{
+			Footprint.HighPrecisionTangentBytes += NumVertices * 2 * (sizeof(FPackedRGBA16N) - sizeof(FPackedNormal));
+		}
+
+		if (Resources.bSupportRayTracing)
+		{
+			GPUBytes[static_cast<int32>(EStaticMeshMemoryCategory::RayTracing)] += static_cast<int64>(LOD.GetNumTriangles()) * RayTracingBytesPerTriangle;
+		}
+	}
+
+	// Meshes that allow CPU access keep a copy of their buffers after upload
+	if (Resources.bAllowCPUAccess)
+	{
+		CPUBytes[VertexBuffers] = GPUBytes[VertexBuffers];
+		CPUBytes[IndexBuffers] = GPUBytes[IndexBuffers];
+	}
+
+	GPUBytes[static_cast<int32>(EStaticMeshMemoryCategory::DistanceField)] = Resources.DistanceFieldBytes;
+	CPUBytes[static_cast<int32>(EStaticMeshMemoryCategory::LumenCards)] = Resources.LumenCardBytes;
+	GPUBytes[static_cast<int32>(EStaticMeshMemoryCategory::Nanite)] = Resources.NaniteResidentBytes;
+	Footprint.StreamedBytes = Resources.NaniteStreamingBytes;
+
+	const FStaticMeshCollisionSnapshot& Collision = MeshSnapshot.Collision;
+	if (Collision.bHasBodySetup)
+	{
+		const int32 NumShapes = Collision.NumBoxes + Collision.NumSpheres + Collision.NumCapsules + Collision.NumTaperedCapsules;
+		CPUBytes[static_cast<int32>(EStaticMeshMemoryCategory::SimpleCollision)] = static_cast<int64>(NumShapes) * SimpleShapeBytes
+			+ static_cast<int64>(Collision.NumConvexVertices) * ConvexBytesPerVertex;
+
+		// The triangle mesh is cooked from the sections of the collision LOD that have collision enabled
+		if (Collision.CollisionTraceFlag != CTF_UseSimpleAsComplex && MeshSnapshot.LODs.IsValidIndex(Resources.LODForCollision))
+		{
+			int64 NumCollisionTriangles = 0;
+			int64 NumCollisionVertices = 0;
+			for (const FStaticMeshSectionSnapshot& Section : MeshSnapshot.LODs[Resources.LODForCollision].Sections)
+			{
+				if (Section.bEnableCollision && Section.NumTriangles > 0)
+				{
+					NumCollisionTriangles += Section.NumTriangles;
+					NumCollisionVertices += static_cast<int64>(Section.MaxVertexIndex) - Section.MinVertexIndex + 1;
+				}
+			}
+
+			CPUBytes[static_cast<int32>(EStaticMeshMemoryCategory::ComplexCollision)] = NumCollisionTriangles * TriangleMeshBytesPerTriangle
+				+ NumCollisionVertices * TriangleMeshBytesPerVertex;
+		}
+	}
+
+	return Footprint;
+}
@@ -0,0 +1,92 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FStaticMeshAnalysisSnapshot;
+
+/** Kinds of memory a static mesh occupies */
+enum class EStaticMeshMemoryCategory : uint8
+{
+	/** Position, tangent, UV and color streams of all LODs */
+	VertexBuffers,
+	/** Index buffers of all LODs, including depth-only and reversed copies */
+	IndexBuffers,
+	DistanceField,
+	LumenCards,
+	/** Bottom level acceleration structures of all LODs */
+	RayTracing,
+	/** Boxes, spheres, capsules and convex hulls of the body setup */
+	SimpleCollision,
+	/** Triangle mesh cooked from the collision LOD */
+	ComplexCollision,
+	/** Resident Nanite data; streamed pages are tracked separately */
+	Nanite,
+	Num
+};
+
+/** Estimated resident memory of a static mesh, split by category and by where it lives */
+struct FStaticMeshMemoryFootprint
+{
+	int64 GPUBytes[static_cast<int32>(EStaticMeshMemoryCategory::Num)] = {};
+	int64 CPUBytes[static_cast<int32>(EStaticMeshMemoryCategory::Num)] = {};
+
+	/** Nanite pages streamed in on demand; they live in the shared streaming pool and are not counted as resident */
+	int64 StreamedBytes = 0;
+
+	/** Vertex and index buffer bytes of each LOD */
+	TArray<int64> LODBytes;
+
+	/** Vertex buffer bytes full precision UVs take over half precision ones, summed over LODs */
+	int64 FullPrecisionUVBytes = 0;
+
+	/** Vertex buffer bytes high precision tangents take over 8-bit ones, summed over LODs */
+	int64 HighPrecisionTangentBytes = 0;
+
+	int64 GetGPUBytes(EStaticMeshMemoryCategory Category) const { return GPUBytes[static_cast<int32>(Category)]; }
+	int64 GetCPUBytes(EStaticMeshMemoryCategory Category) const { return CPUBytes[static_cast<int32>(Category)]; }
+
+	/** @return Resident GPU bytes over all categories. */
+	int64 GetTotalGPUBytes() const;
+
+	/** @return Resident CPU bytes over all categories. */
+	int64 GetTotalCPUBytes() const;
+
+	int64 GetTotalBytes() const { return GetTotalGPUBytes() + GetTotalCPUBytes(); }
+
+	/** @return Display name of a category. */
+	static const TCHAR* GetCategoryName(EStaticMeshMemoryCategory Category);
+};
+
+/**
+ * Estimates the memory a static mesh takes once loaded from its analysis snapshot. Vertex and index buffers are sized
+ * from the vertex counts and the UV, tangent and index precision of each LOD; distance field, mesh card and Nanite
+ * sizes come from the built render data. Ray tracing and collision are estimated from triangle and vertex counts,
+ * since their layout depends on the GPU and the physics cooker.
+ * Thread-safe; holds no state.
+ */
+class FStaticMeshMemoryEstimator
+{
+public:
+	/** Compacted bottom level acceleration structure bytes per triangle, typical of current desktop GPUs */
+	static constexpr int32 RayTracingBytesPerTriangle = 40;
+
+	/** Bytes per hull vertex of a cooked convex, including its planes and half-edge structure */
+	static constexpr int32 ConvexBytesPerVertex = 96;
+
+	/** Bytes of a box, sphere or capsule element */
+	static constexpr int32 SimpleShapeBytes = 64;
+
+	/** Bytes per triangle of a cooked triangle mesh: indices, material index and its share of the bounding volume tree */
+	static constexpr int32 TriangleMeshBytesPerTriangle = 24;
+
+	/** Bytes per vertex of a cooked triangle mesh */
+	static constexpr int32 TriangleMeshBytesPerVertex = 12;
+
+	/**
+	 * @param MeshSnapshot Snapshot of the mesh.
+	 * @return Estimated footprint.
+	 */
+	static FStaticMeshMemoryFootprint Estimate(const FStaticMeshAnalysisSnapshot& MeshSnapshot);
+};
@@ -0,0 +1,123 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Benchmark/FAllocationCounter.h"
+
+FAllocationCounter& FAllocationCounter::Get()
+{
+	// Leaked on purpose; see the class comment
+	static FAllocationCounter* Instance = new FAllocationCounter();
+	return *Instance;
+}
+
+void FAllocationCounter::Install()
+{
+	check(IsInGameThread());
+
+	if (GMalloc != this)
+	{
+		InnerMalloc = GMalloc;
+		GMalloc = this;
+	}
+}
+
+void FAllocationCounter::Uninstall()
+{
+	if (GMalloc == this)
+	{
+		GMalloc = InnerMalloc;
+	}
+}
+
+void FAllocationCounter::BeginCounting()
+{
+	NumAllocations = 0;
+	NumBytes = 0;
+	bCounting = true;
+}
+
+void FAllocationCounter::EndCounting(uint64& OutNumAllocations, uint64& OutNumBytes)
+{
+	bCounting = false;
+	OutNumAllocations = NumAllocations;
+	OutNumBytes = NumBytes;
+}
+
+void* FAllocationCounter::Malloc(SIZE_T Count, uint32 Alignment)
+{
+	CountAllocation(Count);
+	return InnerMalloc->Malloc(Count, Alignment);
+}
+
+void* FAllocationCounter::Realloc(void* Original, SIZE_T Count, uint32 Alignment)
+{
+	if (Count > 0)
+	{
+		CountAllocation(Count);
+	}
+	return InnerMalloc->Realloc(Original, Count, Alignment);
+}
+
+void FAllocationCounter::Free(void* Original)
+{
+	InnerMalloc->Free(Original);
+}
+
+SIZE_T FAllocationCounter::QuantizeSize(SIZE_T Count, uint32 Alignment)
+{
+	return InnerMalloc->QuantizeSize(Count, Alignment);
+}
+
+bool FAllocationCounter::GetAllocationSize(void* Original, SIZE_T& SizeOut)
+{
+	return InnerMalloc->GetAllocationSize(Original, SizeOut);
+}
+
+void FAllocationCounter::Trim(bool bTrimThreadCaches)
+{
+	InnerMalloc->Trim(bTrimThreadCaches);
+}
+
+void FAllocationCounter::SetupTLSCachesOnCurrentThread()
+{
+	InnerMalloc->SetupTLSCachesOnCurrentThread();
+}
+
+void FAllocationCounter::ClearAndDisableTLSCachesOnCurrentThread()
+{
+	InnerMalloc->ClearAndDisableTLSCachesOnCurrentThread();
+}
+
+void FAllocationCounter::InitializeStatsMetadata()
+{
+	InnerMalloc->InitializeStatsMetadata();
+}
+
+void FAllocationCounter::UpdateStats()
+{
+	InnerMalloc->UpdateStats();
+}
+
+void FAllocationCounter::GetAllocatorStats(FGenericMemoryStats& OutStats)
+{
+	InnerMalloc->GetAllocatorStats(OutStats);
+}
+
+void FAllocationCounter::DumpAllocatorStats(FOutputDevice& Ar)
+{
+	InnerMalloc->DumpAllocatorStats(Ar);
+}
+
+bool FAllocationCounter::IsInternallyThreadSafe() const
+{
+	return InnerMalloc->IsInternallyThreadSafe();
+}
+
+bool FAllocationCounter::ValidateHeap()
+{
+	return InnerMalloc->ValidateHeap();
+}
+
+const TCHAR* FAllocationCounter::GetDescriptiveName()
+{
+	return InnerMalloc->GetDescriptiveName();
+}
@@ -0,0 +1,77 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/MemoryBase.h"
+#include <atomic>
+
+/**
+ * Counts the heap allocations made while counting, by standing in for GMalloc while installed.
+ * Allocations on every thread are counted, so work a rule hands to the task graph is included, and so is anything
+ * other threads allocate meanwhile; measure while the process is otherwise idle.
+ * Every call is forwarded to the allocator it replaced, so blocks allocated before Install() or after Uninstall()
+ * can be reallocated and freed through it. It is never destroyed, because other threads may still hold it.
+ */
+class FAllocationCounter final : public FMalloc
+{
+public:
+	/** @return The process-wide counter. */
+	static FAllocationCounter& Get();
+
+	/** Replaces GMalloc with this counter. Call from the game thread. */
+	void Install();
+
+	/** Restores the allocator Install() replaced. */
+	void Uninstall();
+
+	/** Resets the counts and starts counting allocations made by any thread. */
+	void BeginCounting();
+
+	/**
+	 * Stops counting.
+	 * @param OutNumAllocations Allocations and reallocations made since BeginCounting().
+	 * @param OutNumBytes Bytes requested by them.
+	 */
+	void EndCounting(uint64& OutNumAllocations, uint64& OutNumBytes);
+
+	//~ Begin FMalloc Interface
+	virtual void* Malloc(SIZE_T Count, uint32 Alignment) override;
+	virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override;
+	virtual void Free(void* Original) override;
+	virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override;
+	virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override;
+	virtual void Trim(bool bTrimThreadCaches) override;
+	virtual void SetupTLSCachesOnCurrentThread() override;
+	virtual void ClearAndDisableTLSCachesOnCurrentThread() override;
+	virtual void InitializeStatsMetadata() override;
+	virtual void UpdateStats() override;
+	virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override;
+	virtual void DumpAllocatorStats(FOutputDevice& Ar) override;
+	virtual bool IsInternallyThreadSafe() const override;
+	virtual bool ValidateHeap() override;
+	virtual const TCHAR* GetDescriptiveName() override;
+	//~ End FMalloc Interface
+
+private:
+	FAllocationCounter() = default;
+
+	void CountAllocation(SIZE_T Count)
+	{
+		if (bCounting.load(std::memory_order_relaxed))
+		{
+			NumAllocations.fetch_add(1, std::memory_order_relaxed);
+			NumBytes.fetch_add(Count, std::memory_order_relaxed);
+		}
+	}
+
+	/** The allocator calls are forwarded to */
+	FMalloc* InnerMalloc = nullptr;
+
+	/** Whether allocations are counted, between BeginCounting() and EndCounting() */
+	std::atomic<bool> bCounting = false;
+
+	/** Updated by every allocating thread while counting */
+	std::atomic<uint64> NumAllocations = 0;
+	std::atomic<uint64> NumBytes = 0;
+};
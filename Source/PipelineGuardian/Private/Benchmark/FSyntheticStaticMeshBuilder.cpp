@@ -0,0 +1,160 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Benchmark/FSyntheticStaticMeshBuilder.h"
+#include "PipelineGuardian.h"
+#include "Engine/StaticMesh.h"
+#include "MeshDescription.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "StaticMeshAttributes.h"
+#include "UObject/Package.h"
+
+namespace SyntheticStaticMeshBuilder
+{
+	/** Distance between grid vertices, in centimeters */
+	constexpr float GridSpacing = 10.0f;
+
+	/** Height of the waves that keep the grid from being planar */
+	constexpr float WaveAmplitude = 20.0f;
+
+	const FName MaterialSlotName(TEXT("Synthetic"));
+}
+
+UStaticMesh* FSyntheticStaticMeshBuilder::Build(const FSyntheticMeshSpec& Spec)
+{
+	using namespace SyntheticStaticMeshBuilder;
+
+	check(IsInGameThread());
+
+	const FName ObjectName = MakeUniqueObjectName(GetTransientPackage(), UStaticMesh::StaticClass(), FName(*Spec.Name));
+	UStaticMesh* StaticMesh = NewObject<UStaticMesh>(GetTransientPackage(), ObjectName, RF_Transient);
+	StaticMesh->GetStaticMaterials().Add(FStaticMaterial(nullptr, MaterialSlotName, MaterialSlotName));
+	if (Spec.bLightmapUVs)
+	{
+		StaticMesh->SetLightMapCoordinateIndex(1);
+		StaticMesh->SetLightMapResolution(64);
+	}
+
+	const int32 NumLODs = FMath::Max(1, Spec.NumLODs);
+	TArray<FMeshDescription> MeshDescriptions;
+	MeshDescriptions.SetNum(NumLODs);
+
+	TArray<const FMeshDescription*> MeshDescriptionPtrs;
+	for (int32 LODIndex = 0; LODIndex < NumLODs; ++LODIndex)
+	{
+		BuildMeshDescription(Spec, FMath::Max(2, Spec.NumTriangles >> (2 * LODIndex)), MeshDescriptions[LODIndex]);
+		MeshDescriptionPtrs.Add(&MeshDescriptions[LODIndex]);
+	}
+
+	UStaticMesh::FBuildMeshDescriptionsParams BuildParams;
+	BuildParams.bMarkPackageDirty = false;
+	BuildParams.bCommitMeshDescription = true;
+	BuildParams.bFastBuild = true;
+	BuildParams.bAllowCpuAccess = true;
+	BuildParams.bBuildSimpleCollision = (Spec.Collision == ESyntheticCollision::SimpleBox);
+	if (!StaticMesh->BuildFromMeshDescriptions(MeshDescriptionPtrs, BuildParams))
+	{
+		UE_LOG(LogPipelineGuardian, Error, TEXT("FSyntheticStaticMeshBuilder: Failed to build render data for %s"), *Spec.Name);
+		return nullptr;
+	}
+
+	if (Spec.Collision == ESyntheticCollision::ComplexAsSimple)
+	{
+		StaticMesh->CreateBodySetup();
+		StaticMesh->GetBodySetup()->CollisionTraceFlag = CTF_UseComplexAsSimple;
+	}
+
+	return StaticMesh;
+}
+
+void FSyntheticStaticMeshBuilder::BuildMeshDescription(const FSyntheticMeshSpec& Spec, int32 NumTriangles, FMeshDescription& OutMeshDescription)
+{
+	using namespace SyntheticStaticMeshBuilder;
+
+	const int32 NumDegenerate = FMath::RoundToInt(NumTriangles * FMath::Clamp(Spec.DegenerateRatio, 0.0f, 1.0f));
+	const int32 NumQuads = FMath::Max(1, (NumTriangles - NumDegenerate + 1) / 2);
+	const int32 QuadsX = FMath::Max(1, FMath::CeilToInt(FMath::Sqrt(static_cast<float>(NumQuads))));
+	const int32 QuadsY = FMath::DivideAndRoundUp(NumQuads, QuadsX);
+	const int32 NumGridVertices = (QuadsX + 1) * (QuadsY + 1);
+	const int32 NumUVChannels = Spec.bLightmapUVs ? 2 : 1;
+
+	FStaticMeshAttributes Attributes(OutMeshDescription);
+	Attributes.Register();
+
+	TVertexAttributesRef<FVector3f> Positions = Attributes.GetVertexPositions();
+	TVertexInstanceAttributesRef<FVector3f> Normals = Attributes.GetVertexInstanceNormals();
+	TVertexInstanceAttributesRef<FVector3f> Tangents = Attributes.GetVertexInstanceTangents();
+	TVertexInstanceAttributesRef<float> BinormalSigns = Attributes.GetVertexInstanceBinormalSigns();
+	TVertexInstanceAttributesRef<FVector2f> UVs = Attributes.GetVertexInstanceUVs();
+	UVs.SetNumChannels(NumUVChannels);
+	const FPolygonGroupID PolygonGroup = OutMeshDescription.CreatePolygonGroup();
+	Attributes.GetPolygonGroupMaterialSlotNames()[PolygonGroup] = MaterialSlotName;
+
+	OutMeshDescription.ReserveNewVertices(NumGridVertices + NumDegenerate * 3);
+	OutMeshDescription.ReserveNewVertexInstances(NumGridVertices + NumDegenerate * 3);
+	OutMeshDescription.ReserveNewTriangles(NumQuads * 2 + NumDegenerate);
+
+	// Grid vertices each have a single instance, so UVs are shared by the quads around a vertex
+	TArray<FVertexInstanceID> GridInstances;
+	GridInstances.Reserve(NumGridVertices);
+	for (int32 Y = 0; Y <= QuadsY; ++Y)
+	{
+		for (int32 X = 0; X <= QuadsX; ++X)
+		{
+			const FVertexID VertexID = OutMeshDescription.CreateVertex();
+			Positions[VertexID] = FVector3f(X * GridSpacing, Y * GridSpacing, WaveAmplitude * FMath::Sin(X * 0.1f) * FMath::Cos(Y * 0.1f));
+
+			const FVertexInstanceID InstanceID = OutMeshDescription.CreateVertexInstance(VertexID);
+			Normals[InstanceID] = FVector3f::UpVector;
+			Tangents[InstanceID] = FVector3f::ForwardVector;
+			BinormalSigns[InstanceID] = 1.0f;
+
+			const FVector2f UV = Spec.UVLayout == ESyntheticUVLayout::Tiled
+				? FVector2f(static_cast<float>(X % 2), static_cast<float>(Y % 2))
+				: FVector2f(static_cast<float>(X) / QuadsX, static_cast<float>(Y) / QuadsY);
+			for (int32 UVIndex = 0; UVIndex < NumUVChannels; ++UVIndex)
+			{
+				UVs.Set(InstanceID, UVIndex, UV);
+			}
+			GridInstances.Add(InstanceID);
+		}
+	}
+
+	for (int32 QuadIndex = 0; QuadIndex < NumQuads; ++QuadIndex)
+	{
+		const int32 X = QuadIndex % QuadsX;
+		const int32 Y = QuadIndex / QuadsX;
+		const FVertexInstanceID Corner00 = GridInstances[Y * (QuadsX + 1) + X];
+		const FVertexInstanceID Corner10 = GridInstances[Y * (QuadsX + 1) + X + 1];
+		const FVertexInstanceID Corner01 = GridInstances[(Y + 1) * (QuadsX + 1) + X];
+		const FVertexInstanceID Corner11 = GridInstances[(Y + 1) * (QuadsX + 1) + X + 1];
+
+		const FVertexInstanceID FirstTriangle[3] = { Corner00, Corner01, Corner11 };
+		const FVertexInstanceID SecondTriangle[3] = { Corner00, Corner11, Corner10 };
+		OutMeshDescription.CreateTriangle(PolygonGroup, FirstTriangle);
+		OutMeshDescription.CreateTriangle(PolygonGroup, SecondTriangle);
+	}
+
+	// Zero-area triangles spread over the grid: three distinct vertices at the same position
+	for (int32 DegenerateIndex = 0; DegenerateIndex < NumDegenerate; ++DegenerateIndex)
+	{
+		const FVertexInstanceID GridInstance = GridInstances[(static_cast<int64>(DegenerateIndex) * 7919) % NumGridVertices];
+		const FVertexID GridVertex = OutMeshDescription.GetVertexInstanceVertex(GridInstance);
+
+		FVertexInstanceID Corners[3];
+		for (FVertexInstanceID& Corner : Corners)
+		{
+			const FVertexID VertexID = OutMeshDescription.CreateVertex();
+			Positions[VertexID] = Positions[GridVertex];
+
+			Corner = OutMeshDescription.CreateVertexInstance(VertexID);
+			Normals[Corner] = FVector3f::UpVector;
+			Tangents[Corner] = FVector3f::ForwardVector;
+			BinormalSigns[Corner] = 1.0f;
+			for (int32 UVIndex = 0; UVIndex < NumUVChannels; ++UVIndex)
+			{
+				UVs.Set(Corner, UVIndex, UVs.Get(GridInstance, UVIndex));
+			}
+		}
+		OutMeshDescription.CreateTriangle(PolygonGroup, Corners);
+	}
+}
@@ -0,0 +1,76 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Forward Declarations
+struct FMeshDescription;
+class UStaticMesh;
+
+/** How texture coordinates are laid out on a synthetic mesh */
+enum class ESyntheticUVLayout : uint8
+{
+	/** Every quad gets its own region of the 0-1 square */
+	Unique,
+	/** Every quad covers the whole 0-1 square, so all of them overlap */
+	Tiled
+};
+
+/** Collision given to a synthetic mesh */
+enum class ESyntheticCollision : uint8
+{
+	None,
+	/** A simple box around the mesh */
+	SimpleBox,
+	/** No simple shapes; the render mesh is used for collision */
+	ComplexAsSimple
+};
+
+/** Describes a procedurally generated static mesh */
+struct FSyntheticMeshSpec
+{
+	/** Object name; also used as the asset name by rules */
+	FString Name;
+
+	/** Triangles in LOD0, degenerate ones included. Every further LOD has a quarter of the previous one. */
+	int32 NumTriangles = 1000;
+
+	int32 NumLODs = 1;
+
+	ESyntheticUVLayout UVLayout = ESyntheticUVLayout::Unique;
+
+	/** Whether a second UV channel is generated and used as the lightmap coordinate index. It follows UVLayout. */
+	bool bLightmapUVs = true;
+
+	ESyntheticCollision Collision = ESyntheticCollision::None;
+
+	/** Fraction of the triangles, 0-1, that have zero area */
+	float DegenerateRatio = 0.0f;
+};
+
+/**
+ * Builds transient static meshes with a known triangle count for benchmarking rules.
+ * The surface is a gently curved grid of quads; degenerate triangles are added as three coincident vertices.
+ * Render data is built with CPU access and the mesh descriptions are committed, so both snapshot and source model rules can run.
+ * Must be called from the game thread.
+ */
+class FSyntheticStaticMeshBuilder
+{
+public:
+	/**
+	 * Builds a mesh in the transient package. It is not rooted; keep it referenced while in use.
+	 * @param Spec The mesh to build.
+	 * @return The mesh, or nullptr if building its render data failed.
+	 */
+	static UStaticMesh* Build(const FSyntheticMeshSpec& Spec);
+
+private:
+	/**
+	 * Fills a mesh description with one LOD of the mesh.
+	 * @param Spec The mesh being built.
+	 * @param NumTriangles Triangles in this LOD, degenerate ones included.
+	 * @param OutMeshDescription Empty mesh description to fill.
+	 */
+	static void BuildMeshDescription(const FSyntheticMeshSpec& Spec, int32 NumTriangles, FMeshDescription& OutMeshDescription);
+};
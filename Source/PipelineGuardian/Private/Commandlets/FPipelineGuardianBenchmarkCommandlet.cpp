@@ -0,0 +1,374 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Commandlets/FPipelineGuardianBenchmarkCommandlet.h"
+#include "Benchmark/FAllocationCounter.h"
+#include "Benchmark/FSyntheticStaticMeshBuilder.h"
+#include "Analysis/AssetTypeAnalyzers/FStaticMeshAnalyzer.h"
+#include "Analysis/IAssetCheckRule.h"
+#include "Analysis/FAssetAnalysisResult.h"
+#include "Analysis/FPipelineGuardianProfile.h"
+#include "Analysis/Snapshots/FStaticMeshAnalysisSnapshot.h"
+#include "FPipelineGuardianSettings.h"
+#include "PipelineGuardian.h"
+#include "AssetRegistry/AssetData.h"
+#include "Dom/JsonObject.h"
+#include "Engine/StaticMesh.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "StaticMeshResources.h"
+#include "Templates/Function.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace PipelineGuardianBenchmark
+{
+	/** Process exit codes */
+	constexpr int32 ExitSuccess = 0;
+	constexpr int32 ExitRegression = 1;
+	constexpr int32 ExitInvalidArguments = 2;
+
+	/** Report entry name of the snapshot extraction, which snapshot rules depend on */
+	const TCHAR* SnapshotEntryName = TEXT("Snapshot");
+
+	/** A family of meshes built at every requested scale */
+	struct FScenario
+	{
+		const TCHAR* Name;
+		ESyntheticUVLayout UVLayout;
+		bool bLightmapUVs;
+		int32 NumLODs;
+		ESyntheticCollision Collision;
+		float DegenerateRatio;
+	};
+
+	const FScenario Scenarios[] =
+	{
+		{ TEXT("Clean"), ESyntheticUVLayout::Unique, true, 4, ESyntheticCollision::SimpleBox, 0.0f },
+		{ TEXT("OverlappingUVs"), ESyntheticUVLayout::Tiled, true, 1, ESyntheticCollision::None, 0.0f },
+		{ TEXT("Degenerate"), ESyntheticUVLayout::Unique, false, 2, ESyntheticCollision::ComplexAsSimple, 0.05f }
+	};
+
+	/** Timing and allocations of repeated runs of one piece of work */
+	struct FMeasurement
+	{
+		double BestSeconds = TNumericLimits<double>::Max();
+		double TotalSeconds = 0.0;
+		uint64 NumAllocations = 0;
+		uint64 NumBytes = 0;
+	};
+
+	FMeasurement Measure(int32 NumIterations, TFunctionRef<void()> Work)
+	{
+		FAllocationCounter& AllocationCounter = FAllocationCounter::Get();
+
+		FMeasurement Measurement;
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			AllocationCounter.BeginCounting();
+			const double StartTime = FPlatformTime::Seconds();
+			Work();
+			const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+			uint64 NumAllocations = 0;
+			uint64 NumBytes = 0;
+			AllocationCounter.EndCounting(NumAllocations, NumBytes);
+
+			Measurement.BestSeconds = FMath::Min(Measurement.BestSeconds, Seconds);
+			Measurement.TotalSeconds += Seconds;
+			Measurement.NumAllocations += NumAllocations;
+			Measurement.NumBytes += NumBytes;
+		}
+		return Measurement;
+	}
+
+	TSharedPtr<FJsonValue> MakeResultValue(const FString& MeshName, const FString& EntryName, bool bEnabled, int32 NumTriangles, int32 NumIterations, const FMeasurement& Measurement)
+	{
+		TSharedPtr<FJsonObject> ResultObject = MakeShareable(new FJsonObject);
+		ResultObject->SetStringField(TEXT("Mesh"), MeshName);
+		ResultObject->SetStringField(TEXT("RuleID"), EntryName);
+		ResultObject->SetBoolField(TEXT("Enabled"), bEnabled);
+		ResultObject->SetNumberField(TEXT("Triangles"), NumTriangles);
+		ResultObject->SetNumberField(TEXT("Iterations"), NumIterations);
+		ResultObject->SetNumberField(TEXT("BestSeconds"), Measurement.BestSeconds);
+		ResultObject->SetNumberField(TEXT("MeanSeconds"), Measurement.TotalSeconds / NumIterations);
+		ResultObject->SetNumberField(TEXT("TrianglesPerSecond"), NumTriangles / FMath::Max(Measurement.BestSeconds, UE_DOUBLE_SMALL_NUMBER));
+		ResultObject->SetNumberField(TEXT("AllocationsPerCheck"), static_cast<double>(Measurement.NumAllocations) / NumIterations);
+		ResultObject->SetNumberField(TEXT("BytesPerCheck"), static_cast<double>(Measurement.NumBytes) / NumIterations);
+		return MakeShareable(new FJsonValueObject(ResultObject));
+	}
+
+	/** @return Key identifying a rule and mesh pair across reports. */
+	FString MakeResultKey(const FJsonObject& ResultObject)
+	{
+		return ResultObject.GetStringField(TEXT("Mesh")) + TEXT("|") + ResultObject.GetStringField(TEXT("RuleID"));
+	}
+}
+
+UPipelineGuardianBenchmarkCommandlet::UPipelineGuardianBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+
+	HelpDescription = TEXT("Benchmarks Pipeline Guardian rules on generated static meshes and writes a JSON report.");
+	HelpUsage = TEXT("-run=PipelineGuardianBenchmark [-Scales=1000+100000+1000000+10000000] [-Iterations=3] [-Rules=SM_A+SM_B] [-Output=<benchmark.json>] [-Baseline=<benchmark.json>] [-MaxRegression=0.1]");
+	HelpParamNames = { TEXT("Scales"), TEXT("Iterations"), TEXT("Rules"), TEXT("Output"), TEXT("Baseline"), TEXT("MaxRegression") };
+	HelpParamDescriptions = {
+		TEXT("LOD0 triangle counts to build every scenario at, separated by '+' or ','."),
+		TEXT("Times each rule runs on each mesh. The best run is used for throughput. Defaults to 3."),
+		TEXT("Rule IDs to benchmark, separated by '+' or ','. Defaults to every static mesh rule."),
+		TEXT("Report file. Defaults to Saved/PipelineGuardian/Benchmark.json."),
+		TEXT("Report of an earlier run to compare throughput against."),
+		TEXT("Fraction by which throughput may drop below the baseline before the run fails. Defaults to 0.1.")
+	};
+}
+
+int32 UPipelineGuardianBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace PipelineGuardianBenchmark;
+
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamValues;
+	ParseCommandLine(*Params, Tokens, Switches, ParamValues);
+
+	TArray<int32> Scales = { 1000, 100000, 1000000, 10000000 };
+	if (const FString* ScalesArgument = ParamValues.Find(TEXT("Scales")))
+	{
+		TArray<FString> ScaleStrings;
+		ScalesArgument->Replace(TEXT(","), TEXT("+")).ParseIntoArray(ScaleStrings, TEXT("+"), true);
+		Scales.Reset();
+		for (const FString& ScaleString : ScaleStrings)
+		{
+			const int32 Scale = ScaleString.IsNumeric() ? FCString::Atoi(*ScaleString) : 0;
+			if (Scale < 2)
+			{
+				UE_LOG(LogPipelineGuardian, Error, TEXT("PipelineGuardianBenchmark: Invalid scale '%s'"), *ScaleString);
+				return ExitInvalidArguments;
+			}
+			Scales.Add(Scale);
+		}
+	}
+
+	int32 NumIterations = 3;
+	if (const FString* IterationsArgument = ParamValues.Find(TEXT("Iterations")))
+	{
+		NumIterations = IterationsArgument->IsNumeric() ? FCString::Atoi(**IterationsArgument) : 0;
+		if (NumIterations < 1)
+		{
+			UE_LOG(LogPipelineGuardian, Error, TEXT("PipelineGuardianBenchmark: Invalid iteration count '%s'"), **IterationsArgument);
+			return ExitInvalidArguments;
+		}
+	}
+
+	TSet<FName> RuleFilter;
+	if (const FString* RulesArgument = ParamValues.Find(TEXT("Rules")))
+	{
+		TArray<FString> RuleStrings;
+		RulesArgument->Replace(TEXT(","), TEXT("+")).ParseIntoArray(RuleStrings, TEXT("+"), true);
+		for (const FString& RuleString : RuleStrings)
+		{
+			RuleFilter.Add(FName(*RuleString));
+		}
+	}
+
+	double MaxRegression = 0.1;
+	if (const FString* MaxRegressionArgument = ParamValues.Find(TEXT("MaxRegression")))
+	{
+		MaxRegression = FCString::Atod(**MaxRegressionArgument);
+		if (MaxRegression < 0.0)
+		{
+			UE_LOG(LogPipelineGuardian, Error, TEXT("PipelineGuardianBenchmark: Invalid regression threshold '%s'"), **MaxRegressionArgument);
+			return ExitInvalidArguments;
+		}
+	}
+
+	const FString ReportPath = ParamValues.Contains(TEXT("Output"))
+		? FPaths::ConvertRelativePathToFull(ParamValues[TEXT("Output")])
+		: FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("PipelineGuardian"), TEXT("Benchmark.json"));
+
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	TStrongObjectPtr<UPipelineGuardianProfile> Profile(Settings ? Settings->GetActiveProfile() : nullptr);
+	if (!Profile.IsValid())
+	{
+		UE_LOG(LogPipelineGuardian, Error, TEXT("PipelineGuardianBenchmark: No active profile available"));
+		return ExitInvalidArguments;
+	}
+
+	FStaticMeshAnalyzer Analyzer;
+	FAllocationCounter::Get().Install();
+
+	TArray<TSharedPtr<FJsonValue>> MeshValues;
+	TArray<TSharedPtr<FJsonValue>> ResultValues;
+	TArray<FAssetAnalysisResult> Results;
+	for (const FScenario& Scenario : Scenarios)
+	{
+		for (const int32 Scale : Scales)
+		{
+			FSyntheticMeshSpec Spec;
+			Spec.Name = FString::Printf(TEXT("SM_Benchmark_%s_%d"), Scenario.Name, Scale);
+			Spec.NumTriangles = Scale;
+			Spec.NumLODs = Scenario.NumLODs;
+			Spec.UVLayout = Scenario.UVLayout;
+			Spec.bLightmapUVs = Scenario.bLightmapUVs;
+			Spec.Collision = Scenario.Collision;
+			Spec.DegenerateRatio = Scenario.DegenerateRatio;
+
+			const double BuildStartTime = FPlatformTime::Seconds();
+			TStrongObjectPtr<UStaticMesh> StaticMesh(FSyntheticStaticMeshBuilder::Build(Spec));
+			const double BuildSeconds = FPlatformTime::Seconds() - BuildStartTime;
+			if (!StaticMesh.IsValid() || !StaticMesh->GetRenderData() || StaticMesh->GetRenderData()->LODResources.Num() == 0)
+			{
+				UE_LOG(LogPipelineGuardian, Error, TEXT("PipelineGuardianBenchmark: Could not build %s, skipping it"), *Spec.Name);
+				continue;
+			}
+
+			const int32 NumTriangles = StaticMesh->GetRenderData()->LODResources[0].GetNumTriangles();
+			UE_LOG(LogPipelineGuardian, Display, TEXT("PipelineGuardianBenchmark: Built %s (%d triangles, %d LODs) in %.2fs"), *Spec.Name, NumTriangles, Spec.NumLODs, BuildSeconds);
+
+			TSharedPtr<FJsonObject> MeshObject = MakeShareable(new FJsonObject);
+			MeshObject->SetStringField(TEXT("Mesh"), Spec.Name);
+			MeshObject->SetStringField(TEXT("Scenario"), Scenario.Name);
+			MeshObject->SetNumberField(TEXT("Triangles"), NumTriangles);
+			MeshObject->SetNumberField(TEXT("LODs"), Spec.NumLODs);
+			MeshObject->SetStringField(TEXT("UVLayout"), Spec.UVLayout == ESyntheticUVLayout::Tiled ? TEXT("Tiled") : TEXT("Unique"));
+			MeshObject->SetBoolField(TEXT("LightmapUVs"), Spec.bLightmapUVs);
+			MeshObject->SetStringField(TEXT("Collision"), Spec.Collision == ESyntheticCollision::SimpleBox ? TEXT("SimpleBox")
+				: Spec.Collision == ESyntheticCollision::ComplexAsSimple ? TEXT("ComplexAsSimple") : TEXT("None"));
+			MeshObject->SetNumberField(TEXT("DegenerateRatio"), Spec.DegenerateRatio);
+			MeshObject->SetNumberField(TEXT("BuildSeconds"), BuildSeconds);
+			MeshValues.Add(MakeShareable(new FJsonValueObject(MeshObject)));
+
+			const FAssetData AssetData(StaticMesh.Get());
+			TSharedPtr<const FStaticMeshAnalysisSnapshot> Snapshot;
+			const FMeasurement SnapshotMeasurement = Measure(NumIterations, [&Snapshot, &AssetData, &StaticMesh]()
+			{
+				Snapshot = FStaticMeshAnalysisSnapshot::Create(AssetData, StaticMesh.Get());
+			});
+			ResultValues.Add(MakeResultValue(Spec.Name, SnapshotEntryName, true, NumTriangles, NumIterations, SnapshotMeasurement));
+
+			for (const TSharedPtr<IAssetCheckRule>& Rule : Analyzer.GetRules())
+			{
+				if (!Rule.IsValid() || (RuleFilter.Num() > 0 && !RuleFilter.Contains(Rule->GetRuleID())))
+				{
+					continue;
+				}
+
+				// Rules run the way the analyzer would run them when a snapshot is available
+				const bool bUseSnapshot = Snapshot.IsValid() && Rule->SupportsSnapshot();
+				const FMeasurement RuleMeasurement = Measure(NumIterations, [&Rule, &Results, &Snapshot, &StaticMesh, &Profile, bUseSnapshot]()
+				{
+					Results.Reset();
+					if (bUseSnapshot)
+					{
+						Rule->CheckSnapshot(*Snapshot, Profile.Get(), Results);
+					}
+					else
+					{
+						Rule->Check(StaticMesh.Get(), Profile.Get(), Results);
+					}
+				});
+				ResultValues.Add(MakeResultValue(Spec.Name, Rule->GetRuleID().ToString(), Rule->IsEnabled(Profile.Get()), NumTriangles, NumIterations, RuleMeasurement));
+
+				UE_LOG(LogPipelineGuardian, Display, TEXT("PipelineGuardianBenchmark:   %-40s %10.3f ms %14.0f tris/s %10.1f allocs"), *Rule->GetRuleID().ToString(),
+					RuleMeasurement.BestSeconds * 1000.0, NumTriangles / FMath::Max(RuleMeasurement.BestSeconds, UE_DOUBLE_SMALL_NUMBER),
+					static_cast<double>(RuleMeasurement.NumAllocations) / NumIterations);
+			}
+
+			// Large meshes are released before the next one is built
+			Results.Empty();
+			Snapshot.Reset();
+			StaticMesh.Reset();
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+	}
+
+	FAllocationCounter::Get().Uninstall();
+
+	TSharedRef<FJsonObject> ReportObject = MakeShared<FJsonObject>();
+	ReportObject->SetNumberField(TEXT("Iterations"), NumIterations);
+	ReportObject->SetArrayField(TEXT("Meshes"), MeshValues);
+	ReportObject->SetArrayField(TEXT("Results"), ResultValues);
+
+	FString OutputString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	FJsonSerializer::Serialize(ReportObject, Writer);
+	if (!FFileHelper::SaveStringToFile(OutputString, *ReportPath))
+	{
+		UE_LOG(LogPipelineGuardian, Error, TEXT("PipelineGuardianBenchmark: Failed to write report to %s"), *ReportPath);
+	}
+	UE_LOG(LogPipelineGuardian, Display, TEXT("PipelineGuardianBenchmark: %d measurements on %d meshes. Report: %s"), ResultValues.Num(), MeshValues.Num(), *ReportPath);
+
+	if (const FString* BaselineArgument = ParamValues.Find(TEXT("Baseline")))
+	{
+		int32 NumRegressions = 0;
+		if (!CompareToBaseline(*ReportObject, FPaths::ConvertRelativePathToFull(*BaselineArgument), MaxRegression, NumRegressions))
+		{
+			UE_LOG(LogPipelineGuardian, Error, TEXT("PipelineGuardianBenchmark: Could not read baseline '%s'"), **BaselineArgument);
+			return ExitInvalidArguments;
+		}
+		if (NumRegressions > 0)
+		{
+			UE_LOG(LogPipelineGuardian, Error, TEXT("PipelineGuardianBenchmark: %d measurements regressed by more than %.0f%%"), NumRegressions, MaxRegression * 100.0);
+			return ExitRegression;
+		}
+	}
+
+	return ExitSuccess;
+}
+
+bool UPipelineGuardianBenchmarkCommandlet::CompareToBaseline(const FJsonObject& Report, const FString& BaselinePath, double MaxRegression, int32& OutNumRegressions)
+{
+	using namespace PipelineGuardianBenchmark;
+
+	OutNumRegressions = 0;
+
+	FString JsonString;
+	TSharedPtr<FJsonObject> BaselineObject;
+	if (!FFileHelper::LoadFileToString(JsonString, *BaselinePath)
+		|| !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(JsonString), BaselineObject)
+		|| !BaselineObject.IsValid())
+	{
+		return false;
+	}
+
+	TMap<FString, double> BaselineThroughput;
+	const TArray<TSharedPtr<FJsonValue>>* BaselineResults = nullptr;
+	if (BaselineObject->TryGetArrayField(TEXT("Results"), BaselineResults))
+	{
+		for (const TSharedPtr<FJsonValue>& ResultValue : *BaselineResults)
+		{
+			const TSharedPtr<FJsonObject>* ResultObject = nullptr;
+			if (ResultValue->TryGetObject(ResultObject))
+			{
+				BaselineThroughput.Add(MakeResultKey(**ResultObject), (*ResultObject)->GetNumberField(TEXT("TrianglesPerSecond")));
+			}
+		}
+	}
+
+	// Pairs missing from either report (new rules, other scales) are not compared
+	for (const TSharedPtr<FJsonValue>& ResultValue : Report.GetArrayField(TEXT("Results")))
+	{
+		const TSharedPtr<FJsonObject>& ResultObject = ResultValue->AsObject();
+		const FString Key = MakeResultKey(*ResultObject);
+		const double* Baseline = BaselineThroughput.Find(Key);
+		if (!Baseline || *Baseline <= 0.0)
+		{
+			continue;
+		}
+
+		const double Throughput = ResultObject->GetNumberField(TEXT("TrianglesPerSecond"));
+		if (Throughput < *Baseline * (1.0 - MaxRegression))
+		{
+			++OutNumRegressions;
+			UE_LOG(LogPipelineGuardian, Warning, TEXT("PipelineGuardianBenchmark: %s dropped from %.0f to %.0f triangles/s (%.1f%%)"),
+				*Key, *Baseline, Throughput, (Throughput / *Baseline - 1.0) * 100.0);
+		}
+	}
+
+	return true;
+}
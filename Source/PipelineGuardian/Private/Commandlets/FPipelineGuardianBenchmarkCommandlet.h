@@ -0,0 +1,49 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "FPipelineGuardianBenchmarkCommandlet.generated.h"
+
+// Forward Declarations
+class FJsonObject;
+
+/**
+ * Measures rule throughput on procedurally generated static meshes, to catch performance regressions.
+ *
+ * Usage: UnrealEditor-Cmd.exe <Project> -run=PipelineGuardianBenchmark [-Scales=1000+100000+1000000+10000000] [-Iterations=3]
+ *        [-Rules=SM_A+SM_B] [-Output=<benchmark.json>] [-Baseline=<benchmark.json>] [-MaxRegression=0.1] -unattended -nullrhi
+ *
+ * Every scenario (clean, overlapping UVs, degenerate triangles) is built at every scale, each with its own LOD chain,
+ * collision and lightmap UV setup. Every static mesh rule then runs against each mesh; snapshot rules are given a
+ * snapshot, which is timed separately under the "Snapshot" entry. For each rule and mesh the report holds the best and
+ * mean time, triangles per second (LOD0 triangles over the best time) and heap allocations per check, counted on every
+ * thread so that work a rule runs on the task graph is included.
+ *
+ * The exit code is 0 on success, 1 when a rule's throughput dropped by more than -MaxRegression below the -Baseline
+ * report, and 2 for invalid arguments.
+ */
+UCLASS()
+class UPipelineGuardianBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UPipelineGuardianBenchmarkCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+
+private:
+	/**
+	 * Compares a report against a baseline report.
+	 * @param Report The report of this run.
+	 * @param BaselinePath Report of an earlier run.
+	 * @param MaxRegression Fraction by which throughput may drop before it counts as a regression.
+	 * @param OutNumRegressions Number of rule and mesh pairs that regressed.
+	 * @return False if the baseline could not be read.
+	 */
+	static bool CompareToBaseline(const FJsonObject& Report, const FString& BaselinePath, double MaxRegression, int32& OutNumRegressions);
+};
@@ -0,0 +1,627 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Commandlets/FPipelineGuardianCommandlet.h"
+#include "Core/FAssetScanner.h"
+#include "Core/FAssetAnalysisScheduler.h"
+#include "Core/FAssetAnalysisCache.h"
+#include "Core/FAnalysisTimingStats.h"
+#include "Core/FTexelDensityHistogram.h"
+#include "Core/FDuplicateGeometryIndex.h"
+#include "Core/FAssetMemoryGovernor.h"
+#include "Core/FAssetStreamingLoader.h"
+#include "Analysis/FAssetAnalysisResult.h"
+#include "Analysis/FPipelineGuardianProfile.h"
+#include "Analysis/Rules/StaticMesh/FStaticMeshDuplicateGeometryRule.h"
+#include "Analysis/Rules/StaticMesh/FStaticMeshNearDuplicateRule.h"
+#include "FPipelineGuardianSettings.h"
+#include "PipelineGuardian.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace PipelineGuardianCommandlet
+{
+	/** Process exit codes */
+	constexpr int32 ExitSuccess = 0;
+	constexpr int32 ExitIssuesFound = 1;
+	constexpr int32 ExitInvalidArguments = 2;
+	constexpr int32 ExitShardFailed = 3;
+
+	/** Seconds between checks on running shard processes */
+	constexpr float ShardPollInterval = 1.0f;
+
+	/** @return True if Severity is at least as severe as Threshold. Lower enum values are more severe. */
+	bool IsAtOrAbove(EAssetIssueSeverity Severity, EAssetIssueSeverity Threshold)
+	{
+		return static_cast<uint8>(Severity) <= static_cast<uint8>(Threshold);
+	}
+
+	FString SeverityToString(EAssetIssueSeverity Severity)
+	{
+		return StaticEnum<EAssetIssueSeverity>()->GetNameStringByValue(static_cast<int64>(Severity));
+	}
+
+	bool SeverityFromString(const FString& SeverityName, EAssetIssueSeverity& OutSeverity)
+	{
+		const int64 SeverityValue = StaticEnum<EAssetIssueSeverity>()->GetValueByNameString(SeverityName);
+		if (SeverityValue == INDEX_NONE)
+		{
+			return false;
+		}
+		OutSeverity = static_cast<EAssetIssueSeverity>(SeverityValue);
+		return true;
+	}
+
+	/**
+	 * Shard assignment must agree between processes, so it hashes the package name string rather than
+	 * using FName indices or GetTypeHash, which differ from run to run.
+	 */
+	bool IsAssetInShard(const FAssetData& AssetData, int32 ShardIndex, int32 NumShards)
+	{
+		if (NumShards <= 1)
+		{
+			return true;
+		}
+		const uint32 PackageHash = FCrc::StrCrc32(*AssetData.PackageName.ToString());
+		return static_cast<int32>(PackageHash % static_cast<uint32>(NumShards)) == ShardIndex;
+	}
+
+	/** Parses "i/N" */
+	bool ParseShard(const FString& ShardArgument, int32& OutShardIndex, int32& OutNumShards)
+	{
+		FString IndexString;
+		FString CountString;
+		if (!ShardArgument.Split(TEXT("/"), &IndexString, &CountString) || !IndexString.IsNumeric() || !CountString.IsNumeric())
+		{
+			return false;
+		}
+		OutShardIndex = FCString::Atoi(*IndexString);
+		OutNumShards = FCString::Atoi(*CountString);
+		return OutNumShards >= 1 && OutShardIndex >= 0 && OutShardIndex < OutNumShards;
+	}
+
+	FString GetShardDirectory()
+	{
+		return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("PipelineGuardian"), TEXT("Shards"));
+	}
+
+	/** @return The content paths of -Paths, or /Game if none were given. */
+	TArray<FString> GetContentPaths(const TMap<FString, FString>& ParamValues)
+	{
+		TArray<FString> ContentPaths;
+		const FString PathsArgument = ParamValues.FindRef(TEXT("Paths"));
+		PathsArgument.Replace(TEXT(","), TEXT("+")).ParseIntoArray(ContentPaths, TEXT("+"), true);
+		if (ContentPaths.Num() == 0)
+		{
+			ContentPaths.Add(TEXT("/Game"));
+		}
+		return ContentPaths;
+	}
+
+	/** Collects the analyzable assets of one shard under the content paths, each once even if the paths overlap */
+	void ScanContentPaths(const FAssetScanner& AssetScanner, const TArray<FString>& ContentPaths, int32 ShardIndex, int32 NumShards, TArray<FAssetData>& OutAssets)
+	{
+		// The asset registry is still gathering when commandlets start
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+		AssetRegistry.SearchAllAssets(true);
+
+		TSet<FSoftObjectPath> SeenAssets;
+		for (const FString& ContentPath : ContentPaths)
+		{
+			TArray<FAssetData> AssetsInPath;
+			AssetScanner.ScanAssetsInPath(ContentPath, true, AssetsInPath);
+			for (FAssetData& AssetData : AssetsInPath)
+			{
+				if (!IsAssetInShard(AssetData, ShardIndex, NumShards))
+				{
+					continue;
+				}
+
+				bool bAlreadySeen = false;
+				SeenAssets.Add(AssetData.GetSoftObjectPath(), &bAlreadySeen);
+				if (!bAlreadySeen)
+				{
+					OutAssets.Add(MoveTemp(AssetData));
+				}
+			}
+		}
+	}
+
+	/** @return The paths of the assets, to limit the duplicate geometry results to the meshes of the run. */
+	TSet<FSoftObjectPath> GetAssetPaths(const TArray<FAssetData>& Assets)
+	{
+		TSet<FSoftObjectPath> AssetPaths;
+		AssetPaths.Reserve(Assets.Num());
+		for (const FAssetData& AssetData : Assets)
+		{
+			AssetPaths.Add(AssetData.GetSoftObjectPath());
+		}
+		return AssetPaths;
+	}
+}
+
+UPipelineGuardianCommandlet::UPipelineGuardianCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+
+	HelpDescription = TEXT("Analyzes assets with Pipeline Guardian and writes a JSON report.");
+	HelpUsage = TEXT("-run=PipelineGuardian [-Paths=/Game/A+/Game/B] [-Profile=<asset path or .json>] [-FailOn=Critical|Error|Warning|Info] [-Output=<report.json>] [-NoCache] [-Shards=N | -Shard=i/N]");
+	HelpParamNames = { TEXT("Paths"), TEXT("Profile"), TEXT("FailOn"), TEXT("Output"), TEXT("NoCache"), TEXT("Shards"), TEXT("Shard") };
+	HelpParamDescriptions = {
+		TEXT("Content paths to scan recursively, separated by '+' or ','. Defaults to /Game."),
+		TEXT("Profile asset path or exported profile JSON file. Defaults to the active profile in the project settings."),
+		TEXT("Lowest severity that makes the commandlet fail. Defaults to Error."),
+		TEXT("Report file. Defaults to Saved/PipelineGuardian/Report.json."),
+		TEXT("Ignore and do not update the incremental analysis cache."),
+		TEXT("Run N child processes, one per shard, and merge their reports."),
+		TEXT("Analyze only shard i of N (0-based), partitioned by package name hash.")
+	};
+}
+
+int32 UPipelineGuardianCommandlet::Main(const FString& Params)
+{
+	using namespace PipelineGuardianCommandlet;
+
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamValues;
+	ParseCommandLine(*Params, Tokens, Switches, ParamValues);
+
+	// Severity threshold
+	EAssetIssueSeverity FailOnSeverity = EAssetIssueSeverity::Error;
+	if (const FString* FailOnArgument = ParamValues.Find(TEXT("FailOn")))
+	{
+		if (!SeverityFromString(*FailOnArgument, FailOnSeverity))
+		{
+			UE_LOG(LogPipelineGuardian, Error, TEXT("PipelineGuardianCommandlet: Unknown severity '%s'. Expected Critical, Error, Warning or Info."), **FailOnArgument);
+			return ExitInvalidArguments;
+		}
+	}
+
+	const FString ReportPath = ParamValues.Contains(TEXT("Output"))
+		? FPaths::ConvertRelativePathToFull(ParamValues[TEXT("Output")])
+		: FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("PipelineGuardian"), TEXT("Report.json"));
+
+	// Sharding
+	int32 ShardIndex = 0;
+	int32 NumShards = 1;
+	if (const FString* ShardArgument = ParamValues.Find(TEXT("Shard")))
+	{
+		if (!ParseShard(*ShardArgument, ShardIndex, NumShards))
+		{
+			UE_LOG(LogPipelineGuardian, Error, TEXT("PipelineGuardianCommandlet: Invalid shard '%s'. Expected i/N with 0 <= i < N."), **ShardArgument);
+			return ExitInvalidArguments;
+		}
+	}
+	else if (const FString* ShardsArgument = ParamValues.Find(TEXT("Shards")))
+	{
+		const int32 NumChildShards = ShardsArgument->IsNumeric() ? FCString::Atoi(**ShardsArgument) : 0;
+		if (NumChildShards < 1)
+		{
+			UE_LOG(LogPipelineGuardian, Error, TEXT("PipelineGuardianCommandlet: Invalid shard count '%s'"), **ShardsArgument);
+			return ExitInvalidArguments;
+		}
+		if (NumChildShards > 1)
+		{
+			return RunCoordinator(ParamValues, Switches, FailOnSeverity, ReportPath, NumChildShards);
+		}
+	}
+
+	return RunAnalysis(ParamValues, Switches, FailOnSeverity, ReportPath, ShardIndex, NumShards);
+}
+
+int32 UPipelineGuardianCommandlet::RunAnalysis(const TMap<FString, FString>& ParamValues, const TArray<FString>& Switches, EAssetIssueSeverity FailOnSeverity, const FString& ReportPath, int32 ShardIndex, int32 NumShards)
+{
+	using namespace PipelineGuardianCommandlet;
+
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+	if (!Settings)
+	{
+		UE_LOG(LogPipelineGuardian, Error, TEXT("PipelineGuardianCommandlet: Could not get Pipeline Guardian settings"));
+		return ExitInvalidArguments;
+	}
+
+	const TArray<FString> ContentPaths = GetContentPaths(ParamValues);
+
+	// Profile. Kept referenced so garbage collection between batches cannot take a transient profile away.
+	TStrongObjectPtr<UPipelineGuardianProfile> Profile;
+	if (const FString* ProfileArgument = ParamValues.Find(TEXT("Profile")))
+	{
+		Profile.Reset(LoadProfile(*ProfileArgument));
+		if (!Profile.IsValid())
+		{
+			UE_LOG(LogPipelineGuardian, Error, TEXT("PipelineGuardianCommandlet: Could not load profile '%s'"), **ProfileArgument);
+			return ExitInvalidArguments;
+		}
+	}
+	else
+	{
+		Profile.Reset(Settings->GetActiveProfile());
+	}
+	if (!Profile.IsValid())
+	{
+		UE_LOG(LogPipelineGuardian, Error, TEXT("PipelineGuardianCommandlet: No active profile available"));
+		return ExitInvalidArguments;
+	}
+
+	TSharedPtr<FAssetScanner> AssetScanner = MakeShared<FAssetScanner>();
+	AssetScanner->RegisterDefaultAnalyzers();
+
+	TArray<FAssetData> AssetsToAnalyze;
+	ScanContentPaths(*AssetScanner, ContentPaths, ShardIndex, NumShards, AssetsToAnalyze);
+
+	if (NumShards > 1)
+	{
+		UE_LOG(LogPipelineGuardian, Display, TEXT("PipelineGuardianCommandlet: Shard %d/%d"), ShardIndex, NumShards);
+	}
+	UE_LOG(LogPipelineGuardian, Display, TEXT("PipelineGuardianCommandlet: Analyzing %d assets in %s with profile '%s'"),
+		AssetsToAnalyze.Num(), *FString::Join(ContentPaths, TEXT(", ")), *Profile->ProfileName);
+
+	TSharedPtr<FAssetStreamingLoader> StreamingLoader;
+	if (Settings->bEnableAsyncAssetLoading)
+	{
+		StreamingLoader = MakeShared<FAssetStreamingLoader>(Settings->AsyncLoadMaxInFlight, Settings->AsyncLoadMemoryCeilingMB);
+	}
+
+	TSharedPtr<FAssetAnalysisCache> AnalysisCache;
+	if (Settings->bEnableAnalysisCache && !Switches.Contains(TEXT("NoCache")))
+	{
+		// Shards run concurrently, so each keeps its own cache file. Assignment is stable, so a shard finds its entries again next run.
+		AnalysisCache = NumShards > 1
+			? MakeShared<FAssetAnalysisCache>(FPaths::ConvertRelativePathToFull(FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("PipelineGuardian"),
+				FString::Printf(TEXT("AnalysisCache_Shard%dof%d.json"), ShardIndex, NumShards))))
+			: MakeShared<FAssetAnalysisCache>();
+		AnalysisCache->Load();
+		AnalysisCache->BeginRun(Profile.Get(), Settings);
+	}
+
+	// Packages loaded before this point, including the profile, are never unloaded
+	TSharedPtr<FAssetMemoryGovernor> MemoryGovernor;
+	if (Settings->bEnableMemoryGovernor)
+	{
+		MemoryGovernor = MakeShared<FAssetMemoryGovernor>(Settings->ScanMemoryBudgetMB);
+	}
+	FAssetAnalysisScheduler AnalysisScheduler(AssetScanner, Settings->AnalysisMaxConcurrency, StreamingLoader, AnalysisCache, MemoryGovernor);
+	const int32 BatchSize = FMath::Max(1, Settings->AnalysisBatchSize);
+	const TConstArrayView<FAssetData> AllAssets(AssetsToAnalyze);
+
+	TArray<FAssetAnalysisResult> Results;
+	FAnalysisTimingStats& TimingStats = FAnalysisTimingStats::Get();
+	FTexelDensityHistogram& TexelDensityHistogram = FTexelDensityHistogram::Get();
+	FDuplicateGeometryIndex& DuplicateGeometryIndex = FDuplicateGeometryIndex::Get();
+	TimingStats.Begin();
+	TexelDensityHistogram.Begin(NumShards > 1 ? FTexelDensityHistogram::GetShardMeshesFilePath(ShardIndex, NumShards) : FTexelDensityHistogram::GetDefaultMeshesFilePath());
+	DuplicateGeometryIndex.Begin(NumShards > 1 ? FDuplicateGeometryIndex::GetShardFilePath(ShardIndex, NumShards) : FDuplicateGeometryIndex::GetDefaultFilePath());
+	AnalysisScheduler.PrefetchBatch(AllAssets.Slice(0, FMath::Min(BatchSize, AllAssets.Num())), Profile.Get());
+	for (int32 BatchStart = 0; BatchStart < AllAssets.Num(); BatchStart += BatchSize)
+	{
+		const int32 BatchCount = FMath::Min(BatchSize, AllAssets.Num() - BatchStart);
+		const int32 NextBatchStart = BatchStart + BatchCount;
+		AnalysisScheduler.PrefetchBatch(AllAssets.Slice(NextBatchStart, FMath::Min(BatchSize, AllAssets.Num() - NextBatchStart)), Profile.Get());
+
+		AnalysisScheduler.AnalyzeBatch(AllAssets.Slice(BatchStart, BatchCount), Profile.Get(), Results);
+
+		UE_LOG(LogPipelineGuardian, Display, TEXT("PipelineGuardianCommandlet: Analyzed %d/%d assets, %d issues so far"), NextBatchStart, AllAssets.Num(), Results.Num());
+	}
+
+	TimingStats.End();
+	TimingStats.LogSummary();
+	TexelDensityHistogram.End();
+	TexelDensityHistogram.LogSummary();
+	DuplicateGeometryIndex.End();
+
+	// A shard only sees its own meshes; the coordinator groups the duplicates of all shards
+	if (NumShards <= 1)
+	{
+		const TSet<FSoftObjectPath> ScannedAssets = GetAssetPaths(AssetsToAnalyze);
+		FStaticMeshDuplicateGeometryRule::AppendGroupResults(ScannedAssets, Results);
+		FStaticMeshNearDuplicateRule::AppendClusterResults(ScannedAssets, Results);
+	}
+
+	if (AnalysisCache.IsValid())
+	{
+		AnalysisCache->Save();
+		UE_LOG(LogPipelineGuardian, Display, TEXT("PipelineGuardianCommandlet: Analysis cache %d hits, %d misses"), AnalysisCache->GetNumHits(), AnalysisCache->GetNumMisses());
+	}
+
+	if (MemoryGovernor.IsValid())
+	{
+		UE_LOG(LogPipelineGuardian, Display, TEXT("PipelineGuardianCommandlet: Peak memory %llu MB of a %llu MB budget, %d collections"),
+			MemoryGovernor->GetPeakUsedBytes() / (1024 * 1024), MemoryGovernor->GetMemoryBudgetBytes() / (1024 * 1024), MemoryGovernor->GetNumCollections());
+	}
+
+	// Fix actions may open dialogs and modify assets; the commandlet only reports
+	int32 NumFailingIssues = 0;
+	TArray<TSharedPtr<FJsonValue>> IssueValues;
+	IssueValues.Reserve(Results.Num());
+	for (const FAssetAnalysisResult& Result : Results)
+	{
+		IssueValues.Add(MakeIssueValue(Result));
+
+		if (IsAtOrAbove(Result.Severity, FailOnSeverity))
+		{
+			++NumFailingIssues;
+			UE_LOG(LogPipelineGuardian, Warning, TEXT("[%s] %s: %s"), *SeverityToString(Result.Severity), *Result.Asset.GetSoftObjectPath().ToString(), *Result.Description.ToString());
+		}
+	}
+
+	const TArray<TSharedPtr<FJsonValue>> TimingValues = { MakeShareable(new FJsonValueObject(TimingStats.ToJson())) };
+	if (!WriteReport(ReportPath, IssueValues, AssetsToAnalyze.Num(), FailOnSeverity, TimingValues, TexelDensityHistogram.ToJson()))
+	{
+		UE_LOG(LogPipelineGuardian, Error, TEXT("PipelineGuardianCommandlet: Failed to write report to %s"), *ReportPath);
+	}
+
+	UE_LOG(LogPipelineGuardian, Display, TEXT("PipelineGuardianCommandlet: %d issues found, %d at or above %s. Report: %s"),
+		Results.Num(), NumFailingIssues, *SeverityToString(FailOnSeverity), *ReportPath);
+
+	return NumFailingIssues > 0 ? ExitIssuesFound : ExitSuccess;
+}
+
+int32 UPipelineGuardianCommandlet::RunCoordinator(const TMap<FString, FString>& ParamValues, const TArray<FString>& Switches, EAssetIssueSeverity FailOnSeverity, const FString& ReportPath, int32 NumShards)
+{
+	using namespace PipelineGuardianCommandlet;
+
+	const FString ShardDirectory = FPaths::ConvertRelativePathToFull(GetShardDirectory());
+	IFileManager::Get().MakeDirectory(*ShardDirectory, true);
+
+	// Arguments every child shares
+	FString CommonArguments = FString::Printf(TEXT("\"%s\" -run=PipelineGuardian -FailOn=%s"),
+		*FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath()), *SeverityToString(FailOnSeverity));
+	for (const TCHAR* ForwardedParam : { TEXT("Paths"), TEXT("Profile") })
+	{
+		if (const FString* Value = ParamValues.Find(ForwardedParam))
+		{
+			CommonArguments += FString::Printf(TEXT(" -%s=\"%s\""), ForwardedParam, **Value);
+		}
+	}
+	if (Switches.Contains(TEXT("NoCache")))
+	{
+		CommonArguments += TEXT(" -NoCache");
+	}
+	CommonArguments += TEXT(" -unattended -nullrhi -nosplash -nopause");
+
+	struct FShardProcess
+	{
+		FProcHandle Handle;
+		FString ReportPath;
+		int32 ReturnCode = ExitShardFailed;
+	};
+
+	TArray<FShardProcess> ShardProcesses;
+	ShardProcesses.SetNum(NumShards);
+	for (int32 ShardIndex = 0; ShardIndex < NumShards; ++ShardIndex)
+	{
+		FShardProcess& ShardProcess = ShardProcesses[ShardIndex];
+		ShardProcess.ReportPath = FPaths::Combine(ShardDirectory, FString::Printf(TEXT("Report_%d.json"), ShardIndex));
+
+		// A report left over from an earlier run must not be merged if this shard fails
+		IFileManager::Get().Delete(*ShardProcess.ReportPath, false, true, true);
+
+		const FString LogPath = FPaths::Combine(ShardDirectory, FString::Printf(TEXT("Shard_%d.log"), ShardIndex));
+		const FString Arguments = FString::Printf(TEXT("%s -Shard=%d/%d -Output=\"%s\" -abslog=\"%s\""),
+			*CommonArguments, ShardIndex, NumShards, *ShardProcess.ReportPath, *LogPath);
+
+		ShardProcess.Handle = FPlatformProcess::CreateProc(FPlatformProcess::ExecutablePath(), *Arguments, false, true, true, nullptr, 0, nullptr, nullptr);
+		if (!ShardProcess.Handle.IsValid())
+		{
+			UE_LOG(LogPipelineGuardian, Error, TEXT("PipelineGuardianCommandlet: Could not start shard %d/%d"), ShardIndex, NumShards);
+			continue;
+		}
+		UE_LOG(LogPipelineGuardian, Display, TEXT("PipelineGuardianCommandlet: Started shard %d/%d, log: %s"), ShardIndex, NumShards, *LogPath);
+	}
+
+	// The coordinator needs the assets of all shards to tell their duplicates from those other scans left in the index;
+	// the registry scan overlaps with the children starting up
+	FAssetScanner AssetScanner;
+	AssetScanner.RegisterDefaultAnalyzers();
+	TArray<FAssetData> ScannedAssetList;
+	ScanContentPaths(AssetScanner, GetContentPaths(ParamValues), 0, 1, ScannedAssetList);
+	const TSet<FSoftObjectPath> ScannedAssets = GetAssetPaths(ScannedAssetList);
+
+	// Wait for every child
+	int32 NumRunning = NumShards;
+	while (NumRunning > 0)
+	{
+		NumRunning = 0;
+		for (FShardProcess& ShardProcess : ShardProcesses)
+		{
+			if (ShardProcess.Handle.IsValid() && FPlatformProcess::IsProcRunning(ShardProcess.Handle))
+			{
+				++NumRunning;
+			}
+		}
+		if (NumRunning > 0)
+		{
+			FPlatformProcess::Sleep(ShardPollInterval);
+		}
+	}
+
+	// Merge the partial reports in shard order
+	bool bAllShardsSucceeded = true;
+	int32 NumAssetsAnalyzed = 0;
+	int32 NumFailingIssues = 0;
+	TArray<TSharedPtr<FJsonValue>> IssueValues;
+	TArray<TSharedPtr<FJsonValue>> TimingValues;
+	FTexelDensityHistogram& TexelDensityHistogram = FTexelDensityHistogram::Get();
+	TexelDensityHistogram.Begin();
+	FDuplicateGeometryIndex& DuplicateGeometryIndex = FDuplicateGeometryIndex::Get();
+	DuplicateGeometryIndex.Begin();
+	for (int32 ShardIndex = 0; ShardIndex < NumShards; ++ShardIndex)
+	{
+		FShardProcess& ShardProcess = ShardProcesses[ShardIndex];
+		if (ShardProcess.Handle.IsValid())
+		{
+			FPlatformProcess::GetProcReturnCode(ShardProcess.Handle, &ShardProcess.ReturnCode);
+			FPlatformProcess::CloseProc(ShardProcess.Handle);
+		}
+
+		FString JsonString;
+		TSharedPtr<FJsonObject> ShardReport;
+		const bool bShardCompleted = ShardProcess.ReturnCode == ExitSuccess || ShardProcess.ReturnCode == ExitIssuesFound;
+		if (!bShardCompleted
+			|| !FFileHelper::LoadFileToString(JsonString, *ShardProcess.ReportPath)
+			|| !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(JsonString), ShardReport)
+			|| !ShardReport.IsValid())
+		{
+			UE_LOG(LogPipelineGuardian, Error, TEXT("PipelineGuardianCommandlet: Shard %d/%d failed with exit code %d"), ShardIndex, NumShards, ShardProcess.ReturnCode);
+			bAllShardsSucceeded = false;
+			continue;
+		}
+
+		NumAssetsAnalyzed += static_cast<int32>(ShardReport->GetNumberField(TEXT("AssetsAnalyzed")));
+
+		const TArray<TSharedPtr<FJsonValue>>* ShardIssues = nullptr;
+		if (ShardReport->TryGetArrayField(TEXT("Issues"), ShardIssues))
+		{
+			for (const TSharedPtr<FJsonValue>& IssueValue : *ShardIssues)
+			{
+				const TSharedPtr<FJsonObject>* IssueObject = nullptr;
+				EAssetIssueSeverity Severity;
+				if (IssueValue->TryGetObject(IssueObject) && SeverityFromString((*IssueObject)->GetStringField(TEXT("Severity")), Severity) && IsAtOrAbove(Severity, FailOnSeverity))
+				{
+					++NumFailingIssues;
+				}
+				IssueValues.Add(IssueValue);
+			}
+		}
+
+		// Shards are timed separately; their per-rule summaries are kept side by side rather than merged
+		const TArray<TSharedPtr<FJsonValue>>* ShardTimings = nullptr;
+		if (ShardReport->TryGetArrayField(TEXT("Timings"), ShardTimings))
+		{
+			TimingValues.Append(*ShardTimings);
+		}
+
+		// Each shard saved the texel densities of its meshes, including those it served from the analysis cache
+		TexelDensityHistogram.AddFromFile(FTexelDensityHistogram::GetShardMeshesFilePath(ShardIndex, NumShards));
+
+		// Each shard saved the geometry hashes and shape descriptors of its meshes; duplicates are found across all of them
+		DuplicateGeometryIndex.AddFromFile(FDuplicateGeometryIndex::GetShardFilePath(ShardIndex, NumShards));
+	}
+	TexelDensityHistogram.End();
+	TexelDensityHistogram.LogSummary();
+	DuplicateGeometryIndex.End();
+
+	TArray<FAssetAnalysisResult> DuplicateGeometryResults;
+	FStaticMeshDuplicateGeometryRule::AppendGroupResults(ScannedAssets, DuplicateGeometryResults);
+	FStaticMeshNearDuplicateRule::AppendClusterResults(ScannedAssets, DuplicateGeometryResults);
+	for (const FAssetAnalysisResult& Result : DuplicateGeometryResults)
+	{
+		IssueValues.Add(MakeIssueValue(Result));
+		if (IsAtOrAbove(Result.Severity, FailOnSeverity))
+		{
+			++NumFailingIssues;
+		}
+	}
+
+	if (!WriteReport(ReportPath, IssueValues, NumAssetsAnalyzed, FailOnSeverity, TimingValues, TexelDensityHistogram.ToJson()))
+	{
+		UE_LOG(LogPipelineGuardian, Error, TEXT("PipelineGuardianCommandlet: Failed to write report to %s"), *ReportPath);
+	}
+
+	UE_LOG(LogPipelineGuardian, Display, TEXT("PipelineGuardianCommandlet: %d shards analyzed %d assets, %d issues found, %d at or above %s. Report: %s"),
+		NumShards, NumAssetsAnalyzed, IssueValues.Num(), NumFailingIssues, *SeverityToString(FailOnSeverity), *ReportPath);
+
+	if (!bAllShardsSucceeded)
+	{
+		return ExitShardFailed;
+	}
+	return NumFailingIssues > 0 ? ExitIssuesFound : ExitSuccess;
+}
+
+UPipelineGuardianProfile* UPipelineGuardianCommandlet::LoadProfile(const FString& ProfileArgument)
+{
+	if (FPaths::GetExtension(ProfileArgument).Equals(TEXT("json"), ESearchCase::IgnoreCase))
+	{
+		FString JsonString;
+		if (!FFileHelper::LoadFileToString(JsonString, *ProfileArgument))
+		{
+			return nullptr;
+		}
+
+		UPipelineGuardianProfile* Profile = NewObject<UPipelineGuardianProfile>(GetTransientPackage(), NAME_None, RF_Transient);
+		return Profile->ImportFromJSON(JsonString) ? Profile : nullptr;
+	}
+
+	return Cast<UPipelineGuardianProfile>(FSoftObjectPath(ProfileArgument).TryLoad());
+}
+
+TSharedPtr<FJsonValue> UPipelineGuardianCommandlet::MakeIssueValue(const FAssetAnalysisResult& Result)
+{
+	using namespace PipelineGuardianCommandlet;
+
+	TSharedPtr<FJsonObject> IssueObject = MakeShareable(new FJsonObject);
+	IssueObject->SetStringField(TEXT("Asset"), Result.Asset.GetSoftObjectPath().ToString());
+	IssueObject->SetStringField(TEXT("Package"), Result.Asset.PackageName.ToString());
+	IssueObject->SetStringField(TEXT("Class"), Result.Asset.AssetClassPath.ToString());
+	IssueObject->SetStringField(TEXT("RuleID"), Result.RuleID.ToString());
+	IssueObject->SetStringField(TEXT("Severity"), SeverityToString(Result.Severity));
+	IssueObject->SetStringField(TEXT("Description"), Result.Description.ToString());
+	IssueObject->SetNumberField(TEXT("MemoryBytes"), static_cast<double>(Result.MemoryBytes));
+	IssueObject->SetBoolField(TEXT("HasFix"), Result.FixAction.IsBound());
+	return MakeShareable(new FJsonValueObject(IssueObject));
+}
+
+bool UPipelineGuardianCommandlet::WriteReport(const FString& ReportPath, const TArray<TSharedPtr<FJsonValue>>& IssueValues, int32 NumAssetsAnalyzed, EAssetIssueSeverity FailOnSeverity,
+	const TArray<TSharedPtr<FJsonValue>>& TimingValues, const TSharedRef<FJsonObject>& TexelDensityObject)
+{
+	using namespace PipelineGuardianCommandlet;
+
+	TSharedPtr<FJsonObject> RootObject = MakeShareable(new FJsonObject);
+	RootObject->SetNumberField(TEXT("AssetsAnalyzed"), NumAssetsAnalyzed);
+	RootObject->SetStringField(TEXT("FailOn"), SeverityToString(FailOnSeverity));
+
+	TMap<FString, int32> CountsBySeverity;
+	TMap<FString, int64> MemoryBytesByRule;
+	for (const TSharedPtr<FJsonValue>& IssueValue : IssueValues)
+	{
+		const TSharedPtr<FJsonObject>* IssueObject = nullptr;
+		if (IssueValue.IsValid() && IssueValue->TryGetObject(IssueObject))
+		{
+			++CountsBySeverity.FindOrAdd((*IssueObject)->GetStringField(TEXT("Severity")));
+
+			int64 MemoryBytes = 0;
+			if ((*IssueObject)->TryGetNumberField(TEXT("MemoryBytes"), MemoryBytes) && MemoryBytes > 0)
+			{
+				MemoryBytesByRule.FindOrAdd((*IssueObject)->GetStringField(TEXT("RuleID"))) += MemoryBytes;
+			}
+		}
+	}
+
+	TSharedPtr<FJsonObject> SummaryObject = MakeShareable(new FJsonObject);
+	for (const TPair<FString, int32>& Count : CountsBySeverity)
+	{
+		SummaryObject->SetNumberField(Count.Key, Count.Value);
+	}
+	RootObject->SetObjectField(TEXT("Summary"), SummaryObject);
+
+	// Totals of the memory the issues of each rule account for
+	TSharedPtr<FJsonObject> MemoryObject = MakeShareable(new FJsonObject);
+	for (const TPair<FString, int64>& MemoryBytes : MemoryBytesByRule)
+	{
+		MemoryObject->SetNumberField(MemoryBytes.Key, static_cast<double>(MemoryBytes.Value));
+	}
+	RootObject->SetObjectField(TEXT("MemoryBytesByRule"), MemoryObject);
+	RootObject->SetArrayField(TEXT("Issues"), IssueValues);
+	RootObject->SetArrayField(TEXT("Timings"), TimingValues);
+	RootObject->SetObjectField(TEXT("TexelDensity"), TexelDensityObject);
+
+	FString OutputString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	FJsonSerializer::Serialize(RootObject.ToSharedRef(), Writer);
+
+	return FFileHelper::SaveStringToFile(OutputString, *ReportPath);
+}
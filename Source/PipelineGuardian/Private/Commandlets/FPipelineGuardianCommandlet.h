@@ -0,0 +1,90 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "FPipelineGuardianCommandlet.generated.h"
+
+// Forward Declarations
+class FJsonObject;
+class FJsonValue;
+class UPipelineGuardianProfile;
+struct FAssetAnalysisResult;
+enum class EAssetIssueSeverity : uint8;
+
+/**
+ * Runs Pipeline Guardian analysis without the editor UI, for build agents.
+ *
+ * Usage: UnrealEditor-Cmd.exe <Project> -run=PipelineGuardian [-Paths=/Game/A+/Game/B] [-Profile=<asset path or .json file>]
+ *        [-FailOn=Error] [-Output=<report.json>] [-NoCache] [-Shards=N | -Shard=i/N] -unattended -nullrhi
+ *
+ * -Shard=i/N analyzes only the assets whose package name hashes to shard i of N. -Shards=N runs as a coordinator:
+ * it starts N local child processes, one per shard, and merges their reports into the -Output report.
+ *
+ * Results are written as JSON. The exit code is 0 when no issue is at or above the -FailOn severity,
+ * 1 when there are such issues, 2 for invalid arguments and 3 when a shard process failed. Fix actions are never executed.
+ */
+UCLASS()
+class UPipelineGuardianCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UPipelineGuardianCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+
+private:
+	/**
+	 * Analyzes the assets under the requested paths in this process.
+	 * @param ParamValues Parsed -Key=Value arguments.
+	 * @param Switches Parsed -Switch arguments.
+	 * @param FailOnSeverity Lowest severity that fails the run.
+	 * @param ReportPath File to write the report to.
+	 * @param ShardIndex Shard of the asset list to analyze.
+	 * @param NumShards Number of shards the asset list is split into; 1 analyzes everything.
+	 * @return The process exit code.
+	 */
+	static int32 RunAnalysis(const TMap<FString, FString>& ParamValues, const TArray<FString>& Switches, EAssetIssueSeverity FailOnSeverity, const FString& ReportPath, int32 ShardIndex, int32 NumShards);
+
+	/**
+	 * Runs one child process per shard, waits for all of them and merges their reports.
+	 * @param ParamValues Parsed -Key=Value arguments, forwarded to the children.
+	 * @param Switches Parsed -Switch arguments, forwarded to the children.
+	 * @param FailOnSeverity Lowest severity that fails the run.
+	 * @param ReportPath File to write the merged report to.
+	 * @param NumShards Number of child processes.
+	 * @return The process exit code.
+	 */
+	static int32 RunCoordinator(const TMap<FString, FString>& ParamValues, const TArray<FString>& Switches, EAssetIssueSeverity FailOnSeverity, const FString& ReportPath, int32 NumShards);
+
+	/**
+	 * Loads the profile named on the command line.
+	 * @param ProfileArgument Either a profile asset path or a JSON file exported from the editor.
+	 * @return The profile, or nullptr if it could not be loaded.
+	 */
+	static UPipelineGuardianProfile* LoadProfile(const FString& ProfileArgument);
+
+	/**
+	 * Converts an analysis result to its report entry.
+	 * @param Result The issue to convert.
+	 * @return JSON value holding the issue.
+	 */
+	static TSharedPtr<FJsonValue> MakeIssueValue(const FAssetAnalysisResult& Result);
+
+	/**
+	 * Writes a JSON report.
+	 * @param ReportPath File to write.
+	 * @param IssueValues Every issue found, as made by MakeIssueValue().
+	 * @param NumAssetsAnalyzed Number of assets that were analyzed.
+	 * @param FailOnSeverity The severity threshold the run was checked against.
+	 * @param TimingValues Rule and asset timings of each process that analyzed assets, as made by FAnalysisTimingStats::ToJson().
+	 * @param TexelDensityObject Texel density histogram of every recorded mesh, as made by FTexelDensityHistogram::ToJson().
+	 * @return True if the file was written.
+	 */
+	static bool WriteReport(const FString& ReportPath, const TArray<TSharedPtr<FJsonValue>>& IssueValues, int32 NumAssetsAnalyzed, EAssetIssueSeverity FailOnSeverity,
+		const TArray<TSharedPtr<FJsonValue>>& TimingValues, const TSharedRef<FJsonObject>& TexelDensityObject);
+};
@@ -0,0 +1,202 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Core/FAnalysisTimingStats.h"
+#include "PipelineGuardian.h"
+#include "Dom/JsonObject.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+FAnalysisTimingStats& FAnalysisTimingStats::Get()
+{
+	static FAnalysisTimingStats Instance;
+	return Instance;
+}
+
+void FAnalysisTimingStats::Begin()
+{
+	FScopeLock Lock(&Mutex);
+	RuleSamples.Reset();
+	AssetTimings.Reset();
+	bCollecting = true;
+}
+
+void FAnalysisTimingStats::End()
+{
+	bCollecting = false;
+}
+
+void FAnalysisTimingStats::RecordRule(FName RuleID, const FSoftObjectPath& AssetPath, double Seconds)
+{
+	if (!IsCollecting())
+	{
+		return;
+	}
+
+	FScopeLock Lock(&Mutex);
+	RuleSamples.FindOrAdd(RuleID).Add(static_cast<float>(Seconds));
+
+	FAssetTiming& AssetTiming = AssetTimings.FindOrAdd(AssetPath);
+	AssetTiming.AssetPath = AssetPath;
+	AssetTiming.RuleSeconds += Seconds;
+}
+
+void FAnalysisTimingStats::RecordPhase(EAnalysisTimingPhase Phase, const FSoftObjectPath& AssetPath, double Seconds)
+{
+	if (!IsCollecting())
+	{
+		return;
+	}
+
+	FScopeLock Lock(&Mutex);
+	FAssetTiming& AssetTiming = AssetTimings.FindOrAdd(AssetPath);
+	AssetTiming.AssetPath = AssetPath;
+	if (Phase == EAnalysisTimingPhase::Load)
+	{
+		AssetTiming.LoadSeconds += Seconds;
+	}
+	else
+	{
+		AssetTiming.SnapshotSeconds += Seconds;
+	}
+}
+
+TArray<FAnalysisTimingStats::FRuleSummary> FAnalysisTimingStats::SummarizeRules() const
+{
+	FScopeLock Lock(&Mutex);
+
+	TArray<FRuleSummary> Summaries;
+	Summaries.Reserve(RuleSamples.Num());
+	for (const TPair<FName, TArray<float>>& Pair : RuleSamples)
+	{
+		if (Pair.Value.Num() == 0)
+		{
+			continue;
+		}
+
+		TArray<float> SortedSamples = Pair.Value;
+		SortedSamples.Sort();
+
+		FRuleSummary& Summary = Summaries.AddDefaulted_GetRef();
+		Summary.RuleID = Pair.Key;
+		Summary.NumCalls = SortedSamples.Num();
+		for (const float Sample : SortedSamples)
+		{
+			Summary.TotalSeconds += Sample;
+		}
+		Summary.MeanSeconds = Summary.TotalSeconds / Summary.NumCalls;
+
+		// Nearest-rank percentile
+		const int32 P95Index = FMath::Clamp(FMath::CeilToInt(0.95 * SortedSamples.Num()) - 1, 0, SortedSamples.Num() - 1);
+		Summary.P95Seconds = SortedSamples[P95Index];
+		Summary.MaxSeconds = SortedSamples.Last();
+	}
+
+	Summaries.Sort([](const FRuleSummary& A, const FRuleSummary& B)
+	{
+		return A.TotalSeconds > B.TotalSeconds;
+	});
+	return Summaries;
+}
+
+TArray<FAnalysisTimingStats::FAssetTiming> FAnalysisTimingStats::GetSlowestAssets() const
+{
+	TArray<FAssetTiming> Assets;
+	{
+		FScopeLock Lock(&Mutex);
+		AssetTimings.GenerateValueArray(Assets);
+	}
+
+	Assets.Sort([](const FAssetTiming& A, const FAssetTiming& B)
+	{
+		return A.GetTotalSeconds() > B.GetTotalSeconds();
+	});
+	if (Assets.Num() > NumSlowestAssets)
+	{
+		Assets.SetNum(NumSlowestAssets);
+	}
+	return Assets;
+}
+
+void FAnalysisTimingStats::LogSummary() const
+{
+	const TArray<FRuleSummary> Rules = SummarizeRules();
+	if (Rules.Num() == 0)
+	{
+		return;
+	}
+
+	UE_LOG(LogPipelineGuardian, Log, TEXT("Rule timings:"));
+	UE_LOG(LogPipelineGuardian, Log, TEXT("  %-40s %8s %12s %10s %10s %10s"), TEXT("Rule"), TEXT("Calls"), TEXT("Total (ms)"), TEXT("Mean (ms)"), TEXT("P95 (ms)"), TEXT("Max (ms)"));
+	for (const FRuleSummary& Summary : Rules)
+	{
+		UE_LOG(LogPipelineGuardian, Log, TEXT("  %-40s %8d %12.2f %10.3f %10.3f %10.3f"), *Summary.RuleID.ToString(), Summary.NumCalls,
+			Summary.TotalSeconds * 1000.0, Summary.MeanSeconds * 1000.0, Summary.P95Seconds * 1000.0, Summary.MaxSeconds * 1000.0);
+	}
+
+	const TArray<FAssetTiming> SlowestAssets = GetSlowestAssets();
+	UE_LOG(LogPipelineGuardian, Log, TEXT("Slowest %d assets:"), SlowestAssets.Num());
+	UE_LOG(LogPipelineGuardian, Log, TEXT("  %12s %10s %14s %11s  %s"), TEXT("Total (ms)"), TEXT("Load (ms)"), TEXT("Snapshot (ms)"), TEXT("Rules (ms)"), TEXT("Asset"));
+	for (const FAssetTiming& AssetTiming : SlowestAssets)
+	{
+		UE_LOG(LogPipelineGuardian, Log, TEXT("  %12.2f %10.2f %14.2f %11.2f  %s"), AssetTiming.GetTotalSeconds() * 1000.0,
+			AssetTiming.LoadSeconds * 1000.0, AssetTiming.SnapshotSeconds * 1000.0, AssetTiming.RuleSeconds * 1000.0, *AssetTiming.AssetPath.ToString());
+	}
+}
+
+TSharedRef<FJsonObject> FAnalysisTimingStats::ToJson() const
+{
+	TSharedRef<FJsonObject> RootObject = MakeShared<FJsonObject>();
+
+	TArray<TSharedPtr<FJsonValue>> RuleValues;
+	for (const FRuleSummary& Summary : SummarizeRules())
+	{
+		TSharedPtr<FJsonObject> RuleObject = MakeShareable(new FJsonObject);
+		RuleObject->SetStringField(TEXT("RuleID"), Summary.RuleID.ToString());
+		RuleObject->SetNumberField(TEXT("Calls"), Summary.NumCalls);
+		RuleObject->SetNumberField(TEXT("TotalMs"), Summary.TotalSeconds * 1000.0);
+		RuleObject->SetNumberField(TEXT("MeanMs"), Summary.MeanSeconds * 1000.0);
+		RuleObject->SetNumberField(TEXT("P95Ms"), Summary.P95Seconds * 1000.0);
+		RuleObject->SetNumberField(TEXT("MaxMs"), Summary.MaxSeconds * 1000.0);
+		RuleValues.Add(MakeShareable(new FJsonValueObject(RuleObject)));
+	}
+	RootObject->SetArrayField(TEXT("Rules"), RuleValues);
+
+	TArray<TSharedPtr<FJsonValue>> AssetValues;
+	for (const FAssetTiming& AssetTiming : GetSlowestAssets())
+	{
+		TSharedPtr<FJsonObject> AssetObject = MakeShareable(new FJsonObject);
+		AssetObject->SetStringField(TEXT("Asset"), AssetTiming.AssetPath.ToString());
+		AssetObject->SetNumberField(TEXT("TotalMs"), AssetTiming.GetTotalSeconds() * 1000.0);
+		AssetObject->SetNumberField(TEXT("LoadMs"), AssetTiming.LoadSeconds * 1000.0);
+		AssetObject->SetNumberField(TEXT("SnapshotMs"), AssetTiming.SnapshotSeconds * 1000.0);
+		AssetObject->SetNumberField(TEXT("RulesMs"), AssetTiming.RuleSeconds * 1000.0);
+		AssetValues.Add(MakeShareable(new FJsonValueObject(AssetObject)));
+	}
+	RootObject->SetArrayField(TEXT("SlowestAssets"), AssetValues);
+
+	return RootObject;
+}
+
+bool FAnalysisTimingStats::SaveToFile(const FString& FilePath) const
+{
+	FString OutputString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	FJsonSerializer::Serialize(ToJson(), Writer);
+
+	if (!FFileHelper::SaveStringToFile(OutputString, *FilePath))
+	{
+		UE_LOG(LogPipelineGuardian, Warning, TEXT("FAnalysisTimingStats: Failed to write timings to %s"), *FilePath);
+		return false;
+	}
+
+	UE_LOG(LogPipelineGuardian, Log, TEXT("FAnalysisTimingStats: Wrote timings to %s"), *FilePath);
+	return true;
+}
+
+FString FAnalysisTimingStats::GetDefaultFilePath()
+{
+	return FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("PipelineGuardian") / TEXT("Timings.json"));
+}
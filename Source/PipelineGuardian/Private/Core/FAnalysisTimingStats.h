@@ -0,0 +1,114 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/SoftObjectPath.h"
+#include <atomic>
+
+// Forward Declarations
+class FJsonObject;
+
+/** Phases of analyzing one asset that are timed besides the rules */
+enum class EAnalysisTimingPhase : uint8
+{
+	Load,
+	Snapshot
+};
+
+/**
+ * Wall-clock timings of an analysis run: every rule check and the load and snapshot of every asset.
+ * Rules run on worker threads, so recording is thread-safe; Begin(), End() and the reports belong to the game thread.
+ * Nothing is recorded outside of a Begin()/End() pair.
+ */
+class FAnalysisTimingStats
+{
+public:
+	/** @return The process-wide collector. */
+	static FAnalysisTimingStats& Get();
+
+	/** Drops the samples of the previous run and starts recording. */
+	void Begin();
+
+	/** Stops recording; the samples stay available for the reports. */
+	void End();
+
+	/** @return True between Begin() and End(). */
+	bool IsCollecting() const { return bCollecting.load(std::memory_order_relaxed); }
+
+	/**
+	 * Records one rule check.
+	 * @param RuleID The rule that ran.
+	 * @param AssetPath The asset it ran on.
+	 * @param Seconds Time the check took.
+	 */
+	void RecordRule(FName RuleID, const FSoftObjectPath& AssetPath, double Seconds);
+
+	/**
+	 * Records the load or snapshot of an asset.
+	 * @param Phase The phase that was timed.
+	 * @param AssetPath The asset.
+	 * @param Seconds Time the phase took.
+	 */
+	void RecordPhase(EAnalysisTimingPhase Phase, const FSoftObjectPath& AssetPath, double Seconds);
+
+	/** Logs the per-rule summary (total, mean, p95, max) and the slowest assets. */
+	void LogSummary() const;
+
+	/** @return The per-rule summary and the slowest assets, as written by SaveToFile(). */
+	TSharedRef<FJsonObject> ToJson() const;
+
+	/**
+	 * Writes ToJson() to disk.
+	 * @param FilePath Absolute path of the file to write.
+	 * @return True if the file was written.
+	 */
+	bool SaveToFile(const FString& FilePath) const;
+
+	/** @return Default file for SaveToFile(), Saved/PipelineGuardian/Timings.json. */
+	static FString GetDefaultFilePath();
+
+	/** Number of assets listed in the slowest assets section */
+	static constexpr int32 NumSlowestAssets = 20;
+
+private:
+	struct FRuleSummary
+	{
+		FName RuleID;
+		int32 NumCalls = 0;
+		double TotalSeconds = 0.0;
+		double MeanSeconds = 0.0;
+		double P95Seconds = 0.0;
+		double MaxSeconds = 0.0;
+	};
+
+	struct FAssetTiming
+	{
+		FSoftObjectPath AssetPath;
+		double LoadSeconds = 0.0;
+		double SnapshotSeconds = 0.0;
+		double RuleSeconds = 0.0;
+
+		double GetTotalSeconds() const { return LoadSeconds + SnapshotSeconds + RuleSeconds; }
+	};
+
+	/** @return One summary per rule, slowest total first. */
+	TArray<FRuleSummary> SummarizeRules() const;
+
+	/** @return Up to NumSlowestAssets assets, slowest total first. */
+	TArray<FAssetTiming> GetSlowestAssets() const;
+
+	mutable FCriticalSection Mutex;
+
+	/** Duration of every check, per rule, in seconds */
+	TMap<FName, TArray<float>> RuleSamples;
+
+	/** Accumulated time per asset */
+	TMap<FSoftObjectPath, FAssetTiming> AssetTimings;
+
+	std::atomic<bool> bCollecting = false;
+};
@@ -0,0 +1,452 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Core/FAssetAnalysisCache.h"
+#include "Analysis/IAssetAnalyzer.h"
+#include "Analysis/FAssetAnalysisResult.h"
+#include "Analysis/FPipelineGuardianProfile.h"
+#include "FPipelineGuardianSettings.h"
+#include "PipelineGuardian.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Texture.h"
+#include "HAL/FileManager.h"
+#include "IO/IoHash.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Materials/MaterialFunctionInterface.h"
+#include "Materials/MaterialInterface.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/Package.h"
+#include "UObject/UnrealType.h"
+
+FAssetAnalysisCache::FAssetAnalysisCache()
+	: FAssetAnalysisCache(FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("PipelineGuardian"), TEXT("AnalysisCache.json")))
+{
+}
+
+FAssetAnalysisCache::FAssetAnalysisCache(const FString& InCacheFilePath)
+	: CacheFilePath(InCacheFilePath)
+	, NumHits(0)
+	, NumMisses(0)
+	, bDirty(false)
+{
+}
+
+bool FAssetAnalysisCache::Load()
+{
+	Entries.Empty();
+	bDirty = false;
+
+	FString JsonString;
+	if (!FFileHelper::LoadFileToString(JsonString, *CacheFilePath))
+	{
+		UE_LOG(LogPipelineGuardian, Verbose, TEXT("FAssetAnalysisCache: No cache file at %s"), *CacheFilePath);
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> RootObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+	if (!FJsonSerializer::Deserialize(Reader, RootObject) || !RootObject.IsValid())
+	{
+		UE_LOG(LogPipelineGuardian, Warning, TEXT("FAssetAnalysisCache: Could not parse %s, starting with an empty cache"), *CacheFilePath);
+		return false;
+	}
+
+	int32 FormatVersion = 0;
+	if (!RootObject->TryGetNumberField(TEXT("Version"), FormatVersion) || FormatVersion != CacheFormatVersion)
+	{
+		UE_LOG(LogPipelineGuardian, Log, TEXT("FAssetAnalysisCache: Discarding cache with format version %d (current: %d)"), FormatVersion, CacheFormatVersion);
+		return false;
+	}
+
+	const TSharedPtr<FJsonObject>* EntriesObject = nullptr;
+	if (!RootObject->TryGetObjectField(TEXT("Entries"), EntriesObject))
+	{
+		return false;
+	}
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& EntryPair : (*EntriesObject)->Values)
+	{
+		const TSharedPtr<FJsonObject> EntryObject = EntryPair.Value.IsValid() ? EntryPair.Value->AsObject() : nullptr;
+		if (!EntryObject.IsValid())
+		{
+			continue;
+		}
+
+		FCacheEntry Entry;
+		Entry.PackageKey = EntryObject->GetStringField(TEXT("PackageKey"));
+		Entry.DependencyKey = EntryObject->GetStringField(TEXT("DependencyKey"));
+		Entry.AnalyzerVersion = static_cast<int32>(EntryObject->GetNumberField(TEXT("AnalyzerVersion")));
+		Entry.ConfigHash = EntryObject->GetStringField(TEXT("ConfigHash"));
+
+		const TArray<TSharedPtr<FJsonValue>>* ResultValues = nullptr;
+		if (EntryObject->TryGetArrayField(TEXT("Results"), ResultValues))
+		{
+			for (const TSharedPtr<FJsonValue>& ResultValue : *ResultValues)
+			{
+				const TSharedPtr<FJsonObject> ResultObject = ResultValue.IsValid() ? ResultValue->AsObject() : nullptr;
+				if (!ResultObject.IsValid())
+				{
+					continue;
+				}
+
+				FCachedResult& CachedResult = Entry.Results.AddDefaulted_GetRef();
+				CachedResult.RuleID = FName(*ResultObject->GetStringField(TEXT("RuleID")));
+				CachedResult.Severity = static_cast<EAssetIssueSeverity>(static_cast<uint8>(ResultObject->GetNumberField(TEXT("Severity"))));
+				CachedResult.Description = ResultObject->GetStringField(TEXT("Description"));
+				CachedResult.FilePath = ResultObject->GetStringField(TEXT("FilePath"));
+				ResultObject->TryGetNumberField(TEXT("MemoryBytes"), CachedResult.MemoryBytes);
+				CachedResult.bHasFixAction = ResultObject->GetBoolField(TEXT("HasFixAction"));
+			}
+		}
+
+		Entries.Add(EntryPair.Key, MoveTemp(Entry));
+	}
+
+	UE_LOG(LogPipelineGuardian, Log, TEXT("FAssetAnalysisCache: Loaded %d cached assets from %s"), Entries.Num(), *CacheFilePath);
+	return true;
+}
+
+bool FAssetAnalysisCache::Save()
+{
+	if (!bDirty)
+	{
+		return true;
+	}
+
+	TSharedPtr<FJsonObject> RootObject = MakeShareable(new FJsonObject);
+	RootObject->SetNumberField(TEXT("Version"), CacheFormatVersion);
+
+	TSharedPtr<FJsonObject> EntriesObject = MakeShareable(new FJsonObject);
+	for (const TPair<FString, FCacheEntry>& EntryPair : Entries)
+	{
+		const FCacheEntry& Entry = EntryPair.Value;
+
+		TSharedPtr<FJsonObject> EntryObject = MakeShareable(new FJsonObject);
+		EntryObject->SetStringField(TEXT("PackageKey"), Entry.PackageKey);
+		EntryObject->SetStringField(TEXT("DependencyKey"), Entry.DependencyKey);
+		EntryObject->SetNumberField(TEXT("AnalyzerVersion"), Entry.AnalyzerVersion);
+		EntryObject->SetStringField(TEXT("ConfigHash"), Entry.ConfigHash);
+
+		TArray<TSharedPtr<FJsonValue>> ResultValues;
+		ResultValues.Reserve(Entry.Results.Num());
+		for (const FCachedResult& CachedResult : Entry.Results)
+		{
+			TSharedPtr<FJsonObject> ResultObject = MakeShareable(new FJsonObject);
+			ResultObject->SetStringField(TEXT("RuleID"), CachedResult.RuleID.ToString());
+			ResultObject->SetNumberField(TEXT("Severity"), static_cast<uint8>(CachedResult.Severity));
+			ResultObject->SetStringField(TEXT("Description"), CachedResult.Description);
+			ResultObject->SetStringField(TEXT("FilePath"), CachedResult.FilePath);
+			ResultObject->SetNumberField(TEXT("MemoryBytes"), static_cast<double>(CachedResult.MemoryBytes));
+			ResultObject->SetBoolField(TEXT("HasFixAction"), CachedResult.bHasFixAction);
+			ResultValues.Add(MakeShareable(new FJsonValueObject(ResultObject)));
+		}
+		EntryObject->SetArrayField(TEXT("Results"), ResultValues);
+
+		EntriesObject->SetObjectField(EntryPair.Key, EntryObject);
+	}
+	RootObject->SetObjectField(TEXT("Entries"), EntriesObject);
+
+	FString OutputString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	FJsonSerializer::Serialize(RootObject.ToSharedRef(), Writer);
+
+	if (!FFileHelper::SaveStringToFile(OutputString, *CacheFilePath))
+	{
+		UE_LOG(LogPipelineGuardian, Warning, TEXT("FAssetAnalysisCache: Failed to write %s"), *CacheFilePath);
+		return false;
+	}
+
+	bDirty = false;
+	UE_LOG(LogPipelineGuardian, Log, TEXT("FAssetAnalysisCache: Saved %d cached assets to %s"), Entries.Num(), *CacheFilePath);
+	return true;
+}
+
+void FAssetAnalysisCache::Clear()
+{
+	bDirty = bDirty || Entries.Num() > 0;
+	Entries.Empty();
+	PackageKeys.Empty();
+	DependencyKeys.Empty();
+}
+
+void FAssetAnalysisCache::BeginRun(const UPipelineGuardianProfile* Profile, const UPipelineGuardianSettings* Settings)
+{
+	check(IsInGameThread());
+
+	ConfigHash = ComputeConfigHash(Profile, Settings);
+
+	// Packages may have been saved since the last run
+	PackageKeys.Empty();
+	DependencyKeys.Empty();
+	NumHits = 0;
+	NumMisses = 0;
+}
+
+bool FAssetAnalysisCache::IsUpToDate(const FAssetData& AssetData, const IAssetAnalyzer& Analyzer)
+{
+	check(IsInGameThread());
+
+	const FCacheEntry* Entry = Entries.Find(AssetData.GetSoftObjectPath().ToString());
+	return Entry
+		&& Entry->AnalyzerVersion == Analyzer.GetAnalyzerVersion()
+		&& Entry->ConfigHash == ConfigHash
+		&& !Entry->PackageKey.IsEmpty()
+		&& Entry->PackageKey == GetPackageKey(AssetData.PackageName)
+		&& !Entry->DependencyKey.IsEmpty()
+		&& Entry->DependencyKey == GetDependencyKey(AssetData.PackageName);
+}
+
+bool FAssetAnalysisCache::TryGetResults(const FAssetData& AssetData, const TSharedPtr<IAssetAnalyzer>& Analyzer, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	check(IsInGameThread());
+
+	if (!Analyzer.IsValid() || !IsUpToDate(AssetData, *Analyzer))
+	{
+		++NumMisses;
+		return false;
+	}
+
+	const FCacheEntry* Entry = Entries.Find(AssetData.GetSoftObjectPath().ToString());
+	check(Entry);
+
+	const TWeakPtr<IAssetAnalyzer> WeakAnalyzer = Analyzer;
+	const TWeakObjectPtr<const UPipelineGuardianProfile> WeakProfile = Profile;
+
+	for (const FCachedResult& CachedResult : Entry->Results)
+	{
+		FAssetAnalysisResult& Result = OutResults.AddDefaulted_GetRef();
+		Result.Asset = AssetData;
+		Result.RuleID = CachedResult.RuleID;
+		Result.Severity = CachedResult.Severity;
+		Result.Description = FText::FromString(CachedResult.Description);
+		Result.FilePath = FText::FromString(CachedResult.FilePath);
+		Result.MemoryBytes = CachedResult.MemoryBytes;
+
+		if (CachedResult.bHasFixAction)
+		{
+			// Fix actions cannot be stored, so re-analyze the asset and run the fix of the matching fresh result
+			const FName RuleID = CachedResult.RuleID;
+			const FString Description = CachedResult.Description;
+			Result.FixAction.BindLambda([WeakAnalyzer, WeakProfile, AssetData, RuleID, Description]()
+			{
+				TSharedPtr<IAssetAnalyzer> PinnedAnalyzer = WeakAnalyzer.Pin();
+				if (!PinnedAnalyzer.IsValid() || !WeakProfile.IsValid())
+				{
+					UE_LOG(LogPipelineGuardian, Warning, TEXT("FAssetAnalysisCache: Cannot fix %s, its analyzer or profile is gone"), *AssetData.AssetName.ToString());
+					return;
+				}
+
+				TArray<FAssetAnalysisResult> FreshResults;
+				PinnedAnalyzer->AnalyzeAsset(AssetData, WeakProfile.Get(), FreshResults);
+
+				const FAssetAnalysisResult* Match = FreshResults.FindByPredicate([&RuleID, &Description](const FAssetAnalysisResult& Fresh)
+				{
+					return Fresh.RuleID == RuleID && Fresh.Description.ToString() == Description;
+				});
+				if (!Match)
+				{
+					Match = FreshResults.FindByPredicate([&RuleID](const FAssetAnalysisResult& Fresh) { return Fresh.RuleID == RuleID; });
+				}
+
+				if (Match && Match->FixAction.IsBound())
+				{
+					Match->FixAction.Execute();
+				}
+				else
+				{
+					UE_LOG(LogPipelineGuardian, Log, TEXT("FAssetAnalysisCache: %s no longer reports %s, nothing to fix"), *AssetData.AssetName.ToString(), *RuleID.ToString());
+				}
+			});
+		}
+	}
+
+	++NumHits;
+	return true;
+}
+
+void FAssetAnalysisCache::StoreResults(const FAssetData& AssetData, const IAssetAnalyzer& Analyzer, TConstArrayView<FAssetAnalysisResult> Results)
+{
+	check(IsInGameThread());
+
+	const FString ObjectPath = AssetData.GetSoftObjectPath().ToString();
+	const FString& PackageKey = GetPackageKey(AssetData.PackageName);
+	const FString& DependencyKey = GetDependencyKey(AssetData.PackageName);
+	if (PackageKey.IsEmpty() || DependencyKey.IsEmpty())
+	{
+		// Unsaved or missing packages would be stale the moment they are written
+		if (Entries.Remove(ObjectPath) > 0)
+		{
+			bDirty = true;
+		}
+		return;
+	}
+
+	FCacheEntry& Entry = Entries.FindOrAdd(ObjectPath);
+	Entry.PackageKey = PackageKey;
+	Entry.DependencyKey = DependencyKey;
+	Entry.AnalyzerVersion = Analyzer.GetAnalyzerVersion();
+	Entry.ConfigHash = ConfigHash;
+	Entry.Results.Reset(Results.Num());
+	for (const FAssetAnalysisResult& Result : Results)
+	{
+		FCachedResult& CachedResult = Entry.Results.AddDefaulted_GetRef();
+		CachedResult.RuleID = Result.RuleID;
+		CachedResult.Severity = Result.Severity;
+		CachedResult.Description = Result.Description.ToString();
+		CachedResult.FilePath = Result.FilePath.ToString();
+		CachedResult.MemoryBytes = Result.MemoryBytes;
+		CachedResult.bHasFixAction = Result.FixAction.IsBound();
+	}
+	bDirty = true;
+}
+
+const FString& FAssetAnalysisCache::GetPackageKey(FName PackageName)
+{
+	if (const FString* ExistingKey = PackageKeys.Find(PackageName))
+	{
+		return *ExistingKey;
+	}
+
+	FString& PackageKey = PackageKeys.Add(PackageName);
+
+	// In-memory edits are not reflected by the file on disk
+	const UPackage* Package = FindPackage(nullptr, *PackageName.ToString());
+	if (Package && Package->IsDirty())
+	{
+		return PackageKey;
+	}
+
+	FString Filename;
+	if (!FPackageName::DoesPackageExist(PackageName.ToString(), &Filename))
+	{
+		return PackageKey;
+	}
+
+	const FFileStatData StatData = IFileManager::Get().GetStatData(*Filename);
+	if (!StatData.bIsValid)
+	{
+		return PackageKey;
+	}
+
+	PackageKey = FString::Printf(TEXT("%lld-%lld"), StatData.ModificationTime.GetTicks(), StatData.FileSize);
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+	const TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(PackageName);
+	if (PackageData.IsSet() && !PackageData->GetPackageSavedHash().IsZero())
+	{
+		PackageKey += TEXT("-") + LexToString(PackageData->GetPackageSavedHash());
+	}
+
+	return PackageKey;
+}
+
+const FString& FAssetAnalysisCache::GetDependencyKey(FName PackageName)
+{
+	if (const FString* ExistingKey = DependencyKeys.Find(PackageName))
+	{
+		return *ExistingKey;
+	}
+
+	// Materials lead to their parents, functions and textures; textures lead nowhere that changes results
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+	TArray<FName> Dependencies;
+	TSet<FName> VisitedPackages = { PackageName };
+	TArray<FName> PendingPackages = { PackageName };
+	while (PendingPackages.Num() > 0)
+	{
+		const FName CurrentPackage = PendingPackages.Pop();
+
+		TArray<FName> DirectDependencies;
+		AssetRegistry.GetDependencies(CurrentPackage, DirectDependencies, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+		for (const FName Dependency : DirectDependencies)
+		{
+			bool bAlreadyVisited = false;
+			VisitedPackages.Add(Dependency, &bAlreadyVisited);
+			if (bAlreadyVisited || FPackageName::IsScriptPackage(Dependency.ToString()))
+			{
+				continue;
+			}
+
+			TArray<FAssetData> DependencyAssets;
+			AssetRegistry.GetAssetsByPackageName(Dependency, DependencyAssets);
+			bool bIsMaterial = false;
+			bool bIsTexture = false;
+			for (const FAssetData& DependencyAsset : DependencyAssets)
+			{
+				const UClass* AssetClass = DependencyAsset.GetClass();
+				bIsMaterial |= AssetClass && (AssetClass->IsChildOf(UMaterialInterface::StaticClass()) || AssetClass->IsChildOf(UMaterialFunctionInterface::StaticClass()));
+				bIsTexture |= AssetClass && AssetClass->IsChildOf(UTexture::StaticClass());
+			}
+
+			if (bIsMaterial || bIsTexture)
+			{
+				Dependencies.Add(Dependency);
+			}
+			if (bIsMaterial)
+			{
+				PendingPackages.Add(Dependency);
+			}
+		}
+	}
+	Dependencies.Sort(FNameLexicalLess());
+
+	FSHA1 HashState;
+	for (const FName Dependency : Dependencies)
+	{
+		// In-memory edits are not reflected by the file on disk
+		const UPackage* Package = FindPackage(nullptr, *Dependency.ToString());
+		if (Package && Package->IsDirty())
+		{
+			return DependencyKeys.Add(PackageName);
+		}
+
+		// A missing dependency hashes as an empty key, so restoring it invalidates the entry again
+		const FString DependencyLine = Dependency.ToString() + TEXT("=") + GetPackageKey(Dependency) + TEXT("\n");
+		HashState.UpdateWithString(*DependencyLine, DependencyLine.Len());
+	}
+
+	return DependencyKeys.Add(PackageName, HashState.Finalize().ToString());
+}
+
+FString FAssetAnalysisCache::ComputeConfigHash(const UPipelineGuardianProfile* Profile, const UPipelineGuardianSettings* Settings)
+{
+	FSHA1 HashState;
+	auto HashString = [&HashState](const FString& Value)
+	{
+		HashState.UpdateWithString(*Value, Value.Len());
+		HashState.Update(reinterpret_cast<const uint8*>(TEXT("\n")), sizeof(TCHAR));
+	};
+
+	HashString(Profile ? Profile->ExportToJSON() : FString());
+
+	if (Settings)
+	{
+		for (TFieldIterator<FProperty> PropertyIt(UPipelineGuardianSettings::StaticClass()); PropertyIt; ++PropertyIt)
+		{
+			const FProperty* Property = *PropertyIt;
+			if (!Property->HasAnyPropertyFlags(CPF_Config))
+			{
+				continue;
+			}
+
+			const FString& Category = Property->GetMetaData(TEXT("Category"));
+			if (Category == TEXT("Analysis Performance") || Category == TEXT("Profile Management"))
+			{
+				continue;
+			}
+
+			FString Value;
+			Property->ExportTextItem_InContainer(Value, Settings, nullptr, nullptr, PPF_None);
+			HashString(Property->GetName());
+			HashString(Value);
+		}
+	}
+
+	return HashState.Finalize().ToString();
+}
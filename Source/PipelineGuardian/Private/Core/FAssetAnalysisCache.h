@@ -0,0 +1,155 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Containers/Map.h"
+#include "Templates/SharedPointer.h"
+
+// Forward Declarations
+class IAssetAnalyzer;
+class UPipelineGuardianProfile;
+class UPipelineGuardianSettings;
+struct FAssetAnalysisResult;
+enum class EAssetIssueSeverity : uint8;
+
+/**
+ * On-disk cache of analysis results, stored under Saved/PipelineGuardian.
+ * An entry is reused only while the asset's package file (timestamp, size and saved hash), the package files of the
+ * materials, material functions and textures it depends on, the analyzer version and the hash of the active profile
+ * and rule settings are all unchanged, so cached assets never need to be loaded.
+ * Results restored from the cache keep a fix action if they had one; it re-analyzes the asset when invoked.
+ * All methods must be called from the game thread.
+ */
+class FAssetAnalysisCache
+{
+public:
+	/** Uses the default cache file, Saved/PipelineGuardian/AnalysisCache.json */
+	FAssetAnalysisCache();
+
+	/**
+	 * @param InCacheFilePath Absolute path of the cache file.
+	 */
+	explicit FAssetAnalysisCache(const FString& InCacheFilePath);
+
+	/**
+	 * Reads the cache file. A missing, unreadable or outdated file leaves the cache empty.
+	 * @return True if entries were read from disk.
+	 */
+	bool Load();
+
+	/**
+	 * Writes the cache file if anything changed since it was loaded.
+	 * @return True if the cache is up to date on disk.
+	 */
+	bool Save();
+
+	/** Drops every entry, in memory and on the next Save(). */
+	void Clear();
+
+	/**
+	 * Hashes the configuration results depend on. Must be called before lookups and stores of an analysis run.
+	 * @param Profile The active profile.
+	 * @param Settings The current pipeline guardian settings.
+	 */
+	void BeginRun(const UPipelineGuardianProfile* Profile, const UPipelineGuardianSettings* Settings);
+
+	/**
+	 * Whether the cache holds results for the asset that are still valid. Does not count as a lookup.
+	 * @param AssetData The asset to look up.
+	 * @param Analyzer The analyzer that would analyze the asset.
+	 * @return True if TryGetResults() would hit.
+	 */
+	bool IsUpToDate(const FAssetData& AssetData, const IAssetAnalyzer& Analyzer);
+
+	/**
+	 * Returns the cached results of an unchanged asset without loading it.
+	 * @param AssetData The asset to look up.
+	 * @param Analyzer The analyzer that would analyze the asset; used for its version and to re-run fixes.
+	 * @param Profile The active profile, used when a restored fix action re-analyzes the asset.
+	 * @param OutResults Array to append the cached results to.
+	 * @return True on a cache hit.
+	 */
+	bool TryGetResults(const FAssetData& AssetData, const TSharedPtr<IAssetAnalyzer>& Analyzer, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults);
+
+	/**
+	 * Records the results of a freshly analyzed asset.
+	 * @param AssetData The analyzed asset.
+	 * @param Analyzer The analyzer that produced the results.
+	 * @param Results Every result reported for the asset; empty if it passed all rules.
+	 */
+	void StoreResults(const FAssetData& AssetData, const IAssetAnalyzer& Analyzer, TConstArrayView<FAssetAnalysisResult> Results);
+
+	/** @return Number of lookups answered from the cache since BeginRun(). */
+	int32 GetNumHits() const { return NumHits; }
+
+	/** @return Number of lookups that missed since BeginRun(). */
+	int32 GetNumMisses() const { return NumMisses; }
+
+private:
+	/** One result as stored on disk. The asset itself is implied by the entry. */
+	struct FCachedResult
+	{
+		FName RuleID;
+		EAssetIssueSeverity Severity;
+		FString Description;
+		FString FilePath;
+		int64 MemoryBytes = 0;
+		bool bHasFixAction = false;
+	};
+
+	/** All results of one asset along with the key they were produced under */
+	struct FCacheEntry
+	{
+		FString PackageKey;
+		FString DependencyKey;
+		int32 AnalyzerVersion = 0;
+		FString ConfigHash;
+		TArray<FCachedResult> Results;
+	};
+
+	/**
+	 * Builds the key identifying the saved state of a package: file timestamp and size, plus the saved hash
+	 * recorded by the asset registry when available. Memoized for the current run.
+	 * @param PackageName The package to describe.
+	 * @return The key, or an empty string if the package cannot be cached (missing on disk or modified in memory).
+	 */
+	const FString& GetPackageKey(FName PackageName);
+
+	/**
+	 * Hashes the package keys of the materials and material functions a package depends on, directly or through other
+	 * materials, and of the textures they use. Rules read blend modes, two-sidedness and texture sizes from them.
+	 * Memoized for the current run.
+	 * @param PackageName The package whose dependencies to describe.
+	 * @return The key, or an empty string if a dependency is modified in memory.
+	 */
+	const FString& GetDependencyKey(FName PackageName);
+
+	/**
+	 * Hashes the rule configuration of the profile and every rule setting.
+	 * Performance and profile management settings do not change results and are left out.
+	 */
+	static FString ComputeConfigHash(const UPipelineGuardianProfile* Profile, const UPipelineGuardianSettings* Settings);
+
+	/** Bump when the file layout changes; older files are discarded */
+	static constexpr int32 CacheFormatVersion = 2;
+
+	FString CacheFilePath;
+
+	/** Keyed by object path */
+	TMap<FString, FCacheEntry> Entries;
+
+	/** Package keys computed during the current run */
+	TMap<FName, FString> PackageKeys;
+
+	/** Dependency keys computed during the current run */
+	TMap<FName, FString> DependencyKeys;
+
+	FString ConfigHash;
+	int32 NumHits;
+	int32 NumMisses;
+	bool bDirty;
+};
@@ -0,0 +1,403 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Core/FAssetAnalysisScheduler.h"
+#include "Core/FAssetScanner.h"
+#include "Core/FAssetAnalysisCache.h"
+#include "Core/FAnalysisTimingStats.h"
+#include "Core/FAssetMemoryGovernor.h"
+#include "Core/FAssetStreamingLoader.h"
+#include "Analysis/IAssetAnalyzer.h"
+#include "Analysis/FAssetAnalysisResult.h"
+#include "Analysis/FAssetAnalysisSnapshot.h"
+#include "Analysis/FPipelineGuardianProfile.h"
+#include "PipelineGuardian.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Tasks/Task.h"
+#include <atomic>
+
+FAssetAnalysisScheduler::FAssetAnalysisScheduler(TSharedPtr<FAssetScanner> InAssetScanner, int32 InMaxConcurrency, TSharedPtr<FAssetStreamingLoader> InStreamingLoader,
+	TSharedPtr<FAssetAnalysisCache> InAnalysisCache, TSharedPtr<FAssetMemoryGovernor> InMemoryGovernor)
+	: AssetScanner(InAssetScanner)
+	, StreamingLoader(InStreamingLoader)
+	, AnalysisCache(InAnalysisCache)
+	, MemoryGovernor(InMemoryGovernor)
+	, Concurrency(ResolveConcurrency(InMaxConcurrency))
+{
+}
+
+FAssetAnalysisScheduler::~FAssetAnalysisScheduler()
+{
+	// A batch worker task still references this scheduler
+	CancelBatch();
+}
+
+void FAssetAnalysisScheduler::PrefetchBatch(TConstArrayView<FAssetData> Assets, const UPipelineGuardianProfile* Profile)
+{
+	check(IsInGameThread());
+
+	if (!StreamingLoader.IsValid() || !AssetScanner.IsValid())
+	{
+		return;
+	}
+
+	TArray<FAssetData> AssetsToLoad;
+	AssetsToLoad.Reserve(Assets.Num());
+	for (const FAssetData& AssetData : Assets)
+	{
+		if (NeedsLoad(AssetData, Profile))
+		{
+			AssetsToLoad.Add(AssetData);
+			if (MemoryGovernor.IsValid())
+			{
+				MemoryGovernor->RecordScanLoad(AssetData);
+			}
+		}
+	}
+
+	StreamingLoader->Prefetch(AssetsToLoad);
+}
+
+bool FAssetAnalysisScheduler::NeedsLoad(const FAssetData& AssetData, const UPipelineGuardianProfile* Profile) const
+{
+	if (!AssetData.IsValid())
+	{
+		return false;
+	}
+
+	if (AnalysisCache.IsValid() && AssetData.GetClass())
+	{
+		const TSharedPtr<IAssetAnalyzer> Analyzer = AssetScanner->FindAnalyzerForClass(AssetData.GetClass());
+		if (Analyzer.IsValid() && AnalysisCache->IsUpToDate(AssetData, *Analyzer))
+		{
+			return false;
+		}
+	}
+
+	return !AssetScanner->FindAnalyzerWithoutLoading(AssetData, Profile).IsValid();
+}
+
+int32 FAssetAnalysisScheduler::ResolveConcurrency(int32 RequestedConcurrency)
+{
+	// The calling (game) thread takes part in ParallelFor, so it counts as one lane
+	const int32 AvailableLanes = FTaskGraphInterface::IsRunning() ? FTaskGraphInterface::Get().GetNumWorkerThreads() + 1 : 1;
+	if (RequestedConcurrency <= 0)
+	{
+		return AvailableLanes;
+	}
+	return FMath::Clamp(RequestedConcurrency, 1, AvailableLanes);
+}
+
+void FAssetAnalysisScheduler::LoadBatch(TConstArrayView<FAssetData> Assets, const UPipelineGuardianProfile* Profile, TArray<FScheduledAsset>& OutScheduledAssets) const
+{
+	check(IsInGameThread());
+
+	OutScheduledAssets.Reset(Assets.Num());
+
+	// Make sure every asset of this batch that needs loading is requested; already prefetched ones are skipped
+	if (StreamingLoader.IsValid())
+	{
+		TArray<FAssetData> AssetsToLoad;
+		for (const FAssetData& AssetData : Assets)
+		{
+			if (NeedsLoad(AssetData, Profile))
+			{
+				AssetsToLoad.Add(AssetData);
+				if (MemoryGovernor.IsValid())
+				{
+					MemoryGovernor->RecordScanLoad(AssetData);
+				}
+			}
+		}
+		StreamingLoader->Prefetch(AssetsToLoad);
+	}
+
+	for (const FAssetData& AssetData : Assets)
+	{
+		LoadAsset(AssetData, Profile, OutScheduledAssets);
+	}
+}
+
+void FAssetAnalysisScheduler::LoadAsset(const FAssetData& AssetData, const UPipelineGuardianProfile* Profile, TArray<FScheduledAsset>& OutScheduledAssets) const
+{
+	if (!AssetData.IsValid())
+	{
+		UE_LOG(LogPipelineGuardian, Warning, TEXT("FAssetAnalysisScheduler: Skipping invalid AssetData."));
+		return;
+	}
+
+	// Unchanged assets are answered from the cache without loading
+	if (AnalysisCache.IsValid() && AssetData.GetClass())
+	{
+		TSharedPtr<IAssetAnalyzer> Analyzer = AssetScanner->FindAnalyzerForClass(AssetData.GetClass());
+		FScheduledAsset Scheduled;
+		if (Analyzer.IsValid() && AnalysisCache->TryGetResults(AssetData, Analyzer, Profile, Scheduled.Results))
+		{
+			Scheduled.AssetData = AssetData;
+			Scheduled.Analyzer = Analyzer;
+			Scheduled.bFromCache = true;
+			OutScheduledAssets.Add(MoveTemp(Scheduled));
+			return;
+		}
+	}
+
+	// Assets whose rules only need registry tags are analyzed inline; cheap enough to stay on the game thread
+	if (TSharedPtr<IAssetAnalyzer> TagAnalyzer = AssetScanner->FindAnalyzerWithoutLoading(AssetData, Profile))
+	{
+		FScheduledAsset& Scheduled = OutScheduledAssets.AddDefaulted_GetRef();
+		Scheduled.AssetData = AssetData;
+		Scheduled.Analyzer = TagAnalyzer;
+		Scheduled.Analyzer->AnalyzeAssetData(AssetData, Profile, Scheduled.Results);
+		return;
+	}
+
+	// Streamed assets were recorded when they were prefetched
+	if (MemoryGovernor.IsValid() && !StreamingLoader.IsValid())
+	{
+		MemoryGovernor->RecordScanLoad(AssetData);
+	}
+
+	// With a streaming loader this only measures the time spent waiting on a load that was not done in the background yet
+	const double LoadStartTime = FPlatformTime::Seconds();
+	UObject* AssetObj = nullptr;
+	{
+		SCOPE_CYCLE_COUNTER(STAT_PipelineGuardian_LoadAsset);
+		AssetObj = StreamingLoader.IsValid() ? StreamingLoader->WaitForAsset(AssetData) : AssetData.GetAsset();
+	}
+	FAnalysisTimingStats::Get().RecordPhase(EAnalysisTimingPhase::Load, AssetData.GetSoftObjectPath(), FPlatformTime::Seconds() - LoadStartTime);
+	if (!AssetObj)
+	{
+		UE_LOG(LogPipelineGuardian, Error, TEXT("Failed to load asset: %s. Cannot perform analysis."), *AssetData.AssetName.ToString());
+		return;
+	}
+
+	TSharedPtr<IAssetAnalyzer> Analyzer = AssetScanner->FindAnalyzerForClass(AssetObj->GetClass());
+	if (!Analyzer.IsValid())
+	{
+		UE_LOG(LogPipelineGuardian, Warning, TEXT("No analyzer registered for asset type: %s (or its parent classes) (Asset: %s)"), *AssetObj->GetClass()->GetName(), *AssetData.AssetName.ToString());
+		return;
+	}
+
+	FScheduledAsset& Scheduled = OutScheduledAssets.AddDefaulted_GetRef();
+	Scheduled.AssetData = AssetData;
+	Scheduled.LoadedObject.Reset(AssetObj);
+	Scheduled.Analyzer = Analyzer;
+	if (MemoryGovernor.IsValid())
+	{
+		MemoryGovernor->TrackLoadedAsset(AssetObj);
+	}
+	Scheduled.Snapshot = Analyzer->CreateSnapshot(AssetData, AssetObj);
+}
+
+void FAssetAnalysisScheduler::ReleaseBatch(TConstArrayView<FAssetData> Assets) const
+{
+	// The batch no longer needs its assets; let the loader drop its references so they can be collected
+	if (StreamingLoader.IsValid())
+	{
+		for (const FAssetData& AssetData : Assets)
+		{
+			StreamingLoader->Release(AssetData);
+		}
+	}
+}
+
+void FAssetAnalysisScheduler::EvaluateWorkerRules(TArray<FScheduledAsset>& ScheduledAssets, const UPipelineGuardianProfile* Profile) const
+{
+	// A fixed number of lanes pull assets from a shared cursor, which bounds concurrency independently of the worker pool size
+	const int32 NumLanes = FMath::Min(Concurrency, ScheduledAssets.Num());
+	if (NumLanes <= 0)
+	{
+		return;
+	}
+
+	std::atomic<int32> NextAssetIndex(0);
+	ParallelFor(NumLanes, [&ScheduledAssets, &NextAssetIndex, Profile](int32 /*LaneIndex*/)
+	{
+		for (int32 AssetIndex = NextAssetIndex++; AssetIndex < ScheduledAssets.Num(); AssetIndex = NextAssetIndex++)
+		{
+			FScheduledAsset& Scheduled = ScheduledAssets[AssetIndex];
+			if (!Scheduled.LoadedObject.IsValid())
+			{
+				continue;
+			}
+			Scheduled.Analyzer->AnalyzeLoadedAsset(Scheduled.AssetData, Scheduled.LoadedObject.Get(), Scheduled.Snapshot.Get(), Profile, EAssetAnalysisPass::WorkerThread, Scheduled.Results);
+		}
+	}, NumLanes <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::Unbalanced);
+}
+
+void FAssetAnalysisScheduler::FinishAsset(FScheduledAsset& Scheduled, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) const
+{
+	if (Scheduled.LoadedObject.IsValid())
+	{
+		Scheduled.Analyzer->AnalyzeLoadedAsset(Scheduled.AssetData, Scheduled.LoadedObject.Get(), Scheduled.Snapshot.Get(), Profile, EAssetAnalysisPass::GameThread, Scheduled.Results);
+		if (MemoryGovernor.IsValid())
+		{
+			MemoryGovernor->ReleaseAnalyzedAsset(Scheduled.LoadedObject.Get());
+		}
+	}
+	if (AnalysisCache.IsValid() && !Scheduled.bFromCache)
+	{
+		AnalysisCache->StoreResults(Scheduled.AssetData, *Scheduled.Analyzer, Scheduled.Results);
+	}
+	OutResults.Append(MoveTemp(Scheduled.Results));
+}
+
+void FAssetAnalysisScheduler::FinishBatch(TConstArrayView<FAssetData> Assets, TArray<FScheduledAsset>& ScheduledAssets) const
+{
+	ScheduledAssets.Empty();
+	ReleaseBatch(Assets);
+
+	// Nothing of this batch is referenced any more, so its packages can be unloaded if memory is over budget
+	if (MemoryGovernor.IsValid())
+	{
+		MemoryGovernor->CollectIfOverBudget();
+	}
+}
+
+void FAssetAnalysisScheduler::AnalyzeBatch(TConstArrayView<FAssetData> Assets, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PipelineGuardian_AnalyzeBatch);
+	check(IsInGameThread());
+	check(!PendingBatch.IsValid());
+
+	if (!AssetScanner.IsValid() || Assets.Num() == 0)
+	{
+		return;
+	}
+
+	if (!Profile)
+	{
+		UE_LOG(LogPipelineGuardian, Warning, TEXT("FAssetAnalysisScheduler: No active profile available, skipping batch of %d assets"), Assets.Num());
+		return;
+	}
+
+	// Phase 1 (game thread): load every asset of the batch, snapshot it and keep it referenced until analysis is done
+	TArray<FScheduledAsset> ScheduledAssets;
+	LoadBatch(Assets, Profile, ScheduledAssets);
+	if (ScheduledAssets.Num() == 0)
+	{
+		ReleaseBatch(Assets);
+		return;
+	}
+
+	// Phase 2 (task graph): snapshot rules. The game thread blocks inside
+	// ParallelFor, so garbage collection cannot run while workers read the loaded objects.
+	EvaluateWorkerRules(ScheduledAssets, Profile);
+
+	// Phase 3 (game thread): remaining rules, then merge per-asset slots in input order
+	for (FScheduledAsset& Scheduled : ScheduledAssets)
+	{
+		FinishAsset(Scheduled, Profile, OutResults);
+	}
+
+	const int32 NumScheduled = ScheduledAssets.Num();
+	FinishBatch(Assets, ScheduledAssets);
+
+	UE_LOG(LogPipelineGuardian, Verbose, TEXT("FAssetAnalysisScheduler: Analyzed batch of %d assets across %d lanes"), NumScheduled, FMath::Min(Concurrency, NumScheduled));
+}
+
+void FAssetAnalysisScheduler::BeginBatch(TConstArrayView<FAssetData> Assets, const UPipelineGuardianProfile* Profile)
+{
+	check(IsInGameThread());
+	check(!PendingBatch.IsValid());
+
+	if (!AssetScanner.IsValid() || Assets.Num() == 0)
+	{
+		return;
+	}
+
+	if (!Profile)
+	{
+		UE_LOG(LogPipelineGuardian, Warning, TEXT("FAssetAnalysisScheduler: No active profile available, skipping batch of %d assets"), Assets.Num());
+		return;
+	}
+
+	PendingBatch = MakeUnique<FPendingBatch>();
+	PendingBatch->Assets = Assets;
+	PendingBatch->Profile.Reset(Profile);
+	PendingBatch->ScheduledAssets.Reserve(Assets.Num());
+
+	// Request everything this batch will load up front; loads then complete while the editor keeps ticking
+	PrefetchBatch(Assets, Profile);
+}
+
+bool FAssetAnalysisScheduler::TickBatch(double TimeLimitSeconds, TArray<FAssetAnalysisResult>& OutResults)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PipelineGuardian_AnalyzeBatch);
+	check(IsInGameThread());
+
+	if (!PendingBatch.IsValid())
+	{
+		return true;
+	}
+
+	FPendingBatch& Batch = *PendingBatch;
+	const double EndTime = FPlatformTime::Seconds() + TimeLimitSeconds;
+
+	// Phase 1 (game thread): one asset at a time. Assets still streaming in are waited for on a later tick instead of blocking.
+	while (Batch.NextLoadIndex < Batch.Assets.Num())
+	{
+		const FAssetData& AssetData = Batch.Assets[Batch.NextLoadIndex];
+		if (StreamingLoader.IsValid() && NeedsLoad(AssetData, Batch.Profile.Get()) && !StreamingLoader->IsAssetReady(AssetData))
+		{
+			return false;
+		}
+
+		LoadAsset(AssetData, Batch.Profile.Get(), Batch.ScheduledAssets);
+		++Batch.NextLoadIndex;
+
+		if (FPlatformTime::Seconds() >= EndTime)
+		{
+			return false;
+		}
+	}
+
+	// Phase 2 (task graph): runs in the background while the game thread keeps ticking, and the user may edit the very
+	// assets being analyzed, so only snapshot rules run here. They read no asset state; the batch's strong references
+	// keep the loaded objects and the profile alive, so garbage collection does not need to wait for the task.
+	if (!Batch.WorkerTask.IsValid())
+	{
+		FPendingBatch* BatchPtr = &Batch;
+		Batch.WorkerTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [this, BatchPtr]()
+		{
+			EvaluateWorkerRules(BatchPtr->ScheduledAssets, BatchPtr->Profile.Get());
+		});
+	}
+	if (!Batch.WorkerTask.IsCompleted())
+	{
+		return false;
+	}
+
+	// Phase 3 (game thread): one asset at a time, in input order
+	while (Batch.NextFinishIndex < Batch.ScheduledAssets.Num())
+	{
+		FinishAsset(Batch.ScheduledAssets[Batch.NextFinishIndex++], Batch.Profile.Get(), OutResults);
+
+		if (Batch.NextFinishIndex < Batch.ScheduledAssets.Num() && FPlatformTime::Seconds() >= EndTime)
+		{
+			return false;
+		}
+	}
+
+	FinishBatch(Batch.Assets, Batch.ScheduledAssets);
+	PendingBatch.Reset();
+	return true;
+}
+
+void FAssetAnalysisScheduler::CancelBatch()
+{
+	check(IsInGameThread());
+
+	if (!PendingBatch.IsValid())
+	{
+		return;
+	}
+
+	if (PendingBatch->WorkerTask.IsValid())
+	{
+		PendingBatch->WorkerTask.Wait();
+	}
+
+	FinishBatch(PendingBatch->Assets, PendingBatch->ScheduledAssets);
+	PendingBatch.Reset();
+}
@@ -0,0 +1,194 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Templates/SharedPointer.h"
+#include "Templates/UniquePtr.h"
+#include "Tasks/Task.h"
+#include "UObject/StrongObjectPtr.h"
+
+// Forward Declarations
+class FAssetAnalysisCache;
+class FAssetMemoryGovernor;
+class FAssetScanner;
+class FAssetStreamingLoader;
+class IAssetAnalyzer;
+class UPipelineGuardianProfile;
+struct FAssetAnalysisResult;
+struct FAssetAnalysisSnapshot;
+
+/**
+ * Analyzes batches of assets using the analyzers registered with an FAssetScanner.
+ * Loading, snapshot extraction and rules that read the live asset run on the game thread; snapshot rules are
+ * evaluated on the task graph with a bounded number of concurrent assets.
+ * Results are always appended in input order, regardless of how work was scheduled.
+ */
+class FAssetAnalysisScheduler
+{
+public:
+	/**
+	 * @param InAssetScanner Scanner holding the registered asset analyzers.
+	 * @param InMaxConcurrency Maximum number of assets evaluated at once. 0 or less uses every task graph worker.
+	 * @param InStreamingLoader Optional loader that streams assets in asynchronously. Without it assets are loaded synchronously.
+	 * @param InAnalysisCache Optional results cache. Unchanged assets are answered from it and new results are stored in it.
+	 * @param InMemoryGovernor Optional governor that releases memory after each batch.
+	 */
+	FAssetAnalysisScheduler(TSharedPtr<FAssetScanner> InAssetScanner, int32 InMaxConcurrency, TSharedPtr<FAssetStreamingLoader> InStreamingLoader = nullptr,
+		TSharedPtr<FAssetAnalysisCache> InAnalysisCache = nullptr, TSharedPtr<FAssetMemoryGovernor> InMemoryGovernor = nullptr);
+
+	/** Waits for and abandons a batch still in progress */
+	~FAssetAnalysisScheduler();
+
+	/**
+	 * Starts loading assets that will be analyzed by a later AnalyzeBatch() call. No-op without a streaming loader.
+	 * Assets that can be analyzed from their asset registry tags or answered from the cache are not loaded.
+	 * @param Assets The assets of an upcoming batch.
+	 * @param Profile The profile the batch will be analyzed with.
+	 */
+	void PrefetchBatch(TConstArrayView<FAssetData> Assets, const UPipelineGuardianProfile* Profile);
+
+	/**
+	 * Loads and analyzes a batch of assets. Must be called from the game thread.
+	 * @param Assets The assets to analyze.
+	 * @param Profile The profile to analyze with, usually the active profile of the settings.
+	 * @param OutResults Array to append any issues found to, in the order of Assets.
+	 */
+	void AnalyzeBatch(TConstArrayView<FAssetData> Assets, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults);
+
+	/**
+	 * Starts analyzing a batch without blocking, for callers that must keep the editor responsive such as a ticker.
+	 * Call TickBatch() until it returns true. Only one batch can be in progress at a time.
+	 * @param Assets The assets to analyze.
+	 * @param Profile The profile to analyze with. Must stay valid until the batch completes or is cancelled.
+	 */
+	void BeginBatch(TConstArrayView<FAssetData> Assets, const UPipelineGuardianProfile* Profile);
+
+	/**
+	 * Advances the batch started by BeginBatch(). Assets that are still streaming in and snapshot rules that are
+	 * still running on the task graph are waited for over several calls instead of blocking the game thread.
+	 * @param TimeLimitSeconds Game thread time to spend in this call. At least one asset is always processed when possible.
+	 * @param OutResults Array to append results to as assets finish, in input order.
+	 * @return True once the batch is complete, or if no batch is in progress.
+	 */
+	bool TickBatch(double TimeLimitSeconds, TArray<FAssetAnalysisResult>& OutResults);
+
+	/** Abandons the batch in progress, waiting for its worker task if it is running. Results already appended are kept. */
+	void CancelBatch();
+
+	/** @return True between BeginBatch() and the TickBatch() call that completes it. */
+	bool IsBatchInProgress() const { return PendingBatch.IsValid(); }
+
+	/** @return The number of assets evaluated concurrently. */
+	int32 GetConcurrency() const { return Concurrency; }
+
+private:
+	/** Per-asset state for one batch. Each worker writes only to its own slot. */
+	struct FScheduledAsset
+	{
+		FAssetData AssetData;
+
+		/** Unset for assets answered from the cache or analyzed from their asset registry tags; those have their results filled in during loading */
+		TStrongObjectPtr<UObject> LoadedObject;
+		TSharedPtr<IAssetAnalyzer> Analyzer;
+
+		/** Extracted on the game thread during loading; read-only afterwards */
+		TSharedPtr<const FAssetAnalysisSnapshot> Snapshot;
+
+		TArray<FAssetAnalysisResult> Results;
+
+		/** Results came from the analysis cache and must not be stored back */
+		bool bFromCache = false;
+	};
+
+	/** State of a batch advanced by TickBatch() */
+	struct FPendingBatch
+	{
+		TArray<FAssetData> Assets;
+
+		/** Held so that garbage collection while the worker task reads it cannot take a transient profile away */
+		TStrongObjectPtr<const UPipelineGuardianProfile> Profile;
+		TArray<FScheduledAsset> ScheduledAssets;
+
+		/** Next entry of Assets to load */
+		int32 NextLoadIndex = 0;
+
+		/** Next entry of ScheduledAssets to run game thread rules on */
+		int32 NextFinishIndex = 0;
+
+		/** Snapshot rules of the whole batch; launched once every asset is loaded */
+		UE::Tasks::FTask WorkerTask;
+	};
+
+	/**
+	 * Loads the assets of a batch (through the streaming loader when set), resolves their analyzers and extracts their snapshots. Game thread only.
+	 * Assets with up-to-date cached results, and assets whose enabled rules only need asset registry tags, are resolved here instead of being loaded.
+	 * @param Assets The assets to load.
+	 * @param Profile The active profile.
+	 * @param OutScheduledAssets Slots for the assets that loaded or were analyzed from tags.
+	 */
+	void LoadBatch(TConstArrayView<FAssetData> Assets, const UPipelineGuardianProfile* Profile, TArray<FScheduledAsset>& OutScheduledAssets) const;
+
+	/**
+	 * Resolves one asset of a batch: answers it from the cache or its tags, or loads it and extracts its snapshot. Game thread only.
+	 * @param AssetData The asset.
+	 * @param Profile The active profile.
+	 * @param OutScheduledAssets Slots to add the asset's slot to; nothing is added if it fails to load.
+	 */
+	void LoadAsset(const FAssetData& AssetData, const UPipelineGuardianProfile* Profile, TArray<FScheduledAsset>& OutScheduledAssets) const;
+
+	/**
+	 * Runs the snapshot rules of every loaded slot across the configured number of lanes. Blocks until done.
+	 * @param ScheduledAssets The batch slots.
+	 * @param Profile The active profile.
+	 */
+	void EvaluateWorkerRules(TArray<FScheduledAsset>& ScheduledAssets, const UPipelineGuardianProfile* Profile) const;
+
+	/**
+	 * Runs the game thread rules of one slot, stores its results in the cache and appends them. Game thread only.
+	 * @param Scheduled The slot to finish.
+	 * @param Profile The active profile.
+	 * @param OutResults Array to append the slot's results to.
+	 */
+	void FinishAsset(FScheduledAsset& Scheduled, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) const;
+
+	/**
+	 * Drops every reference to the assets of a finished batch and lets the memory governor reclaim memory.
+	 * @param Assets The assets of the batch.
+	 * @param ScheduledAssets The batch slots; emptied.
+	 */
+	void FinishBatch(TConstArrayView<FAssetData> Assets, TArray<FScheduledAsset>& ScheduledAssets) const;
+
+	/**
+	 * Whether an asset has to be loaded to be analyzed, as opposed to being answered from the cache or its tags.
+	 * @param AssetData The asset.
+	 * @param Profile The active profile.
+	 * @return True if the asset will be loaded.
+	 */
+	bool NeedsLoad(const FAssetData& AssetData, const UPipelineGuardianProfile* Profile) const;
+
+	/**
+	 * Releases the streaming loader's references to the assets of a finished batch.
+	 * @param Assets The assets of the batch.
+	 */
+	void ReleaseBatch(TConstArrayView<FAssetData> Assets) const;
+
+	/**
+	 * Resolves the effective concurrency for a requested limit.
+	 * @param RequestedConcurrency The configured limit; 0 or less means no explicit limit.
+	 * @return Number of concurrent lanes, at least 1.
+	 */
+	static int32 ResolveConcurrency(int32 RequestedConcurrency);
+
+	TSharedPtr<FAssetScanner> AssetScanner;
+	TSharedPtr<FAssetStreamingLoader> StreamingLoader;
+	TSharedPtr<FAssetAnalysisCache> AnalysisCache;
+	TSharedPtr<FAssetMemoryGovernor> MemoryGovernor;
+	int32 Concurrency;
+
+	/** Batch being advanced by TickBatch(), if any */
+	TUniquePtr<FPendingBatch> PendingBatch;
+};
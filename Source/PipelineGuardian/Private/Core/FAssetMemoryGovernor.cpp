@@ -0,0 +1,162 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Core/FAssetMemoryGovernor.h"
+#include "PipelineGuardian.h"
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Editor.h"
+#include "Engine/StaticMesh.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/PackageName.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+
+FAssetMemoryGovernor::FAssetMemoryGovernor(int32 InMemoryBudgetMB)
+	: MemoryBudgetBytes(InMemoryBudgetMB > 0 ? static_cast<uint64>(InMemoryBudgetMB) * 1024 * 1024 : FPlatformMemory::GetConstants().TotalPhysical / 2)
+	, PeakUsedBytes(0)
+	, NumCollections(0)
+{
+	check(IsInGameThread());
+}
+
+void FAssetMemoryGovernor::RecordScanLoad(const FAssetData& AssetData)
+{
+	check(IsInGameThread());
+
+	// Dependencies of a package that is already loaded are loaded too, so the walk stops there
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+	TArray<FName> PendingPackages = { AssetData.PackageName };
+	while (PendingPackages.Num() > 0)
+	{
+		const FName PackageName = PendingPackages.Pop();
+		if (ScanLoadedPackages.Contains(PackageName) || FPackageName::IsScriptPackage(PackageName.ToString()) || FindObjectFast<UPackage>(nullptr, PackageName))
+		{
+			continue;
+		}
+
+		ScanLoadedPackages.Add(PackageName);
+		AssetRegistry.GetDependencies(PackageName, PendingPackages, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+	}
+}
+
+void FAssetMemoryGovernor::TrackLoadedAsset(UObject* LoadedObject)
+{
+	check(IsInGameThread());
+
+	UStaticMesh* StaticMesh = Cast<UStaticMesh>(LoadedObject);
+	if (!StaticMesh || ResidentMeshDescriptions.Contains(StaticMesh))
+	{
+		return;
+	}
+
+	TBitArray<>& ResidentLODs = ResidentMeshDescriptions.Add(StaticMesh);
+	for (int32 LODIndex = 0; LODIndex < StaticMesh->GetNumSourceModels(); ++LODIndex)
+	{
+		ResidentLODs.Add(StaticMesh->GetSourceModel(LODIndex).GetCachedMeshDescription() != nullptr);
+	}
+}
+
+void FAssetMemoryGovernor::ReleaseAnalyzedAsset(UObject* LoadedObject)
+{
+	check(IsInGameThread());
+
+	UStaticMesh* StaticMesh = Cast<UStaticMesh>(LoadedObject);
+	TBitArray<> ResidentLODs;
+	if (!StaticMesh || !ResidentMeshDescriptions.RemoveAndCopyValue(StaticMesh, ResidentLODs))
+	{
+		return;
+	}
+
+	// A dirty mesh may hold edits that only exist in its mesh description
+	if (StaticMesh->GetPackage()->IsDirty())
+	{
+		return;
+	}
+
+	for (int32 LODIndex = 0; LODIndex < StaticMesh->GetNumSourceModels(); ++LODIndex)
+	{
+		const bool bWasResident = LODIndex < ResidentLODs.Num() && ResidentLODs[LODIndex];
+		if (!bWasResident && StaticMesh->GetSourceModel(LODIndex).GetCachedMeshDescription() != nullptr)
+		{
+			// Only the cached copy is freed; it is reloaded from bulk data the next time it is requested
+			StaticMesh->ClearMeshDescription(LODIndex);
+		}
+	}
+}
+
+bool FAssetMemoryGovernor::CollectIfOverBudget()
+{
+	check(IsInGameThread());
+
+	const uint64 UsedBytes = FPlatformMemory::GetStats().UsedPhysical;
+	PeakUsedBytes = FMath::Max(PeakUsedBytes, UsedBytes);
+	if (UsedBytes <= MemoryBudgetBytes)
+	{
+		return false;
+	}
+
+	int32 NumUnloaded = 0;
+	for (const FName PackageName : ScanLoadedPackages)
+	{
+		UPackage* Package = FindObjectFast<UPackage>(nullptr, PackageName);
+		if (!Package || !CanUnloadPackage(Package))
+		{
+			continue;
+		}
+
+		// Loaded assets are standalone and survive garbage collection until the flag is cleared
+		ForEachObjectWithPackage(Package, [](UObject* Object)
+		{
+			Object->ClearFlags(RF_Standalone);
+			return true;
+		}, false);
+		++NumUnloaded;
+	}
+
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	++NumCollections;
+
+	// Unloaded packages are forgotten: if the scan loads them again they are recorded again, if anyone else does they are theirs
+	for (auto It = ScanLoadedPackages.CreateIterator(); It; ++It)
+	{
+		if (!FindObjectFast<UPackage>(nullptr, *It))
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	UE_LOG(LogPipelineGuardian, Log, TEXT("FAssetMemoryGovernor: %llu MB used exceeds the %llu MB budget, released %d packages, now %llu MB"),
+		UsedBytes / (1024 * 1024), MemoryBudgetBytes / (1024 * 1024), NumUnloaded, FPlatformMemory::GetStats().UsedPhysical / (1024 * 1024));
+
+	return true;
+}
+
+bool FAssetMemoryGovernor::CanUnloadPackage(const UPackage* Package)
+{
+	if (!Package
+		|| Package == GetTransientPackage()
+		|| Package->HasAnyFlags(RF_Transient)
+		|| Package->HasAnyPackageFlags(PKG_CompiledIn)
+		|| Package->IsDirty()
+		|| Package->ContainsMap())
+	{
+		return false;
+	}
+
+	UAssetEditorSubsystem* AssetEditorSubsystem = GEditor ? GEditor->GetEditorSubsystem<UAssetEditorSubsystem>() : nullptr;
+	if (!AssetEditorSubsystem)
+	{
+		return true;
+	}
+
+	bool bOpenInEditor = false;
+	ForEachObjectWithPackage(Package, [AssetEditorSubsystem, &bOpenInEditor](UObject* Object)
+	{
+		bOpenInEditor = Object->IsAsset() && AssetEditorSubsystem->FindEditorForAsset(Object, false) != nullptr;
+		return !bOpenInEditor;
+	}, false);
+
+	return !bOpenInEditor;
+}
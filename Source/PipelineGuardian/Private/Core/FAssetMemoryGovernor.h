@@ -0,0 +1,84 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/BitArray.h"
+#include "Containers/Map.h"
+#include "Containers/Set.h"
+#include "UObject/ObjectKey.h"
+
+// Forward Declarations
+class UPackage;
+class UStaticMesh;
+struct FAssetData;
+
+/**
+ * Keeps editor memory bounded while a scan loads assets.
+ * Mesh descriptions that analysis pulled in are dropped again as soon as each asset is done, and when used physical
+ * memory exceeds the budget, every clean package the scan loaded is unloaded and garbage is collected.
+ * Only packages recorded with RecordScanLoad() are unloaded; packages the user or other editor systems load during the
+ * scan are left alone, as are dirty packages, maps and assets open in an editor.
+ * All methods must be called from the game thread.
+ */
+class FAssetMemoryGovernor
+{
+public:
+	/**
+	 * @param InMemoryBudgetMB Used physical memory (MB) above which the packages the scan loaded are unloaded. 0 uses half of the machine's physical memory.
+	 */
+	explicit FAssetMemoryGovernor(int32 InMemoryBudgetMB);
+
+	/**
+	 * Records the package of an asset the scan is about to load, and its hard dependencies, as loaded by the scan.
+	 * Packages that are already in memory are skipped. Call before requesting the load.
+	 * @param AssetData The asset about to be loaded.
+	 */
+	void RecordScanLoad(const FAssetData& AssetData);
+
+	/**
+	 * Notes which mesh descriptions of a freshly loaded asset are already in memory. Call before any rule runs on it.
+	 * @param LoadedObject The loaded asset.
+	 */
+	void TrackLoadedAsset(UObject* LoadedObject);
+
+	/**
+	 * Drops the mesh descriptions analysis loaded for an asset, unless its package has unsaved changes.
+	 * @param LoadedObject An asset previously passed to TrackLoadedAsset().
+	 */
+	void ReleaseAnalyzedAsset(UObject* LoadedObject);
+
+	/**
+	 * Unloads the clean packages recorded by RecordScanLoad() and collects garbage if used physical memory exceeds the budget.
+	 * Objects still referenced elsewhere, such as prefetched assets, survive and are collected by a later pass.
+	 * @return True if a collection ran.
+	 */
+	bool CollectIfOverBudget();
+
+	/** @return The memory budget in bytes. */
+	uint64 GetMemoryBudgetBytes() const { return MemoryBudgetBytes; }
+
+	/** @return Highest used physical memory seen by CollectIfOverBudget(), in bytes. */
+	uint64 GetPeakUsedBytes() const { return PeakUsedBytes; }
+
+	/** @return Number of collections run. */
+	int32 GetNumCollections() const { return NumCollections; }
+
+private:
+	/**
+	 * Whether a package loaded during the scan can be unloaded.
+	 * @param Package The package to test.
+	 * @return True if the package is clean, not a map and none of its assets are open in an editor.
+	 */
+	static bool CanUnloadPackage(const UPackage* Package);
+
+	/** Names of the packages the scan loaded; dropped once they are unloaded, so a later load by someone else is left alone */
+	TSet<FName> ScanLoadedPackages;
+
+	/** Per tracked mesh, the LODs whose mesh description was in memory before analysis */
+	TMap<TObjectKey<UStaticMesh>, TBitArray<>> ResidentMeshDescriptions;
+
+	uint64 MemoryBudgetBytes;
+	uint64 PeakUsedBytes;
+	int32 NumCollections;
+};
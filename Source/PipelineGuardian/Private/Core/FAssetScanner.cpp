@@ -3,6 +3,8 @@
 #include "Core/FAssetScanner.h"
 #include "PipelineGuardian.h" // For LogPipelineGuardian
 #include "Analysis/IAssetAnalyzer.h" // For IAssetAnalyzer TSharedPtr, though often included via FAssetScanner.h through forward decls
+#include "Analysis/AssetTypeAnalyzers/FStaticMeshAnalyzer.h" // For RegisterDefaultAnalyzers
+#include "Engine/StaticMesh.h" // For UStaticMesh::StaticClass()
 #include "FPipelineGuardianSettings.h" // For UPipelineGuardianSettings
 #include "Analysis/FPipelineGuardianProfile.h" // For UPipelineGuardianProfile
 #include "UObject/UObjectGlobals.h" // For GetName()
@@ -34,6 +36,12 @@ void FAssetScanner::RegisterAssetAnalyzer(UClass* AssetClass, TSharedPtr<IAssetA
 	}
 }
 
+void FAssetScanner::RegisterDefaultAnalyzers()
+{
+	// Register Static Mesh Analyzer
+	RegisterAssetAnalyzer(UStaticMesh::StaticClass(), MakeShared<FStaticMeshAnalyzer>());
+}
+
 void FAssetScanner::AnalyzeSingleAsset(const FAssetData& AssetData, const UPipelineGuardianSettings* Settings, TArray<FAssetAnalysisResult>& OutResults)
 {
 	if (!AssetData.IsValid())
@@ -42,6 +50,15 @@ void FAssetScanner::AnalyzeSingleAsset(const FAssetData& AssetData, const UPipel
 		return;
 	}
 
+	// Skip loading entirely when every enabled rule can be answered from asset registry tags
+	const UPipelineGuardianProfile* ActiveProfile = Settings ? Settings->GetActiveProfile() : nullptr;
+	if (TSharedPtr<IAssetAnalyzer> TagAnalyzer = FindAnalyzerWithoutLoading(AssetData, ActiveProfile))
+	{
+		UE_LOG(LogPipelineGuardian, Verbose, TEXT("Analyzing %s from asset registry tags without loading it."), *AssetData.AssetName.ToString());
+		TagAnalyzer->AnalyzeAssetData(AssetData, ActiveProfile, OutResults);
+		return;
+	}
+
 	// Load the asset to get its actual UClass for accurate analyzer lookup.
 	// The IAssetAnalyzer itself will also load the asset, but we need the class here first.
 	UObject* AssetObj = AssetData.GetAsset();
@@ -62,22 +79,7 @@ void FAssetScanner::AnalyzeSingleAsset(const FAssetData& AssetData, const UPipel
 	UClass* AssetClass = AssetObj->GetClass();
 	// AssetClass should be valid if AssetObj is valid.
 
-	TSharedPtr<IAssetAnalyzer> FoundAnalyzer = nullptr;
-	UClass* CurrentClass = AssetClass;
-
-	// Iterate up the class hierarchy to find a registered analyzer
-	while (CurrentClass != nullptr)
-	{
-		TSharedPtr<IAssetAnalyzer>* AnalyzerPtr = AssetAnalyzersMap.Find(CurrentClass);
-		if (AnalyzerPtr && AnalyzerPtr->IsValid())
-		{
-			FoundAnalyzer = *AnalyzerPtr;
-			UE_LOG(LogPipelineGuardian, Verbose, TEXT("Analyzer found for class %s (Asset: %s, Analyzer for: %s)"), 
-				*AssetClass->GetName(), *AssetData.AssetName.ToString(), *CurrentClass->GetName());
-			break;
-		}
-		CurrentClass = CurrentClass->GetSuperClass();
-	}
+	TSharedPtr<IAssetAnalyzer> FoundAnalyzer = FindAnalyzerForClass(AssetClass);
 
 	if (FoundAnalyzer.IsValid())
 	{
@@ -99,6 +101,45 @@ void FAssetScanner::AnalyzeSingleAsset(const FAssetData& AssetData, const UPipel
 	}
 }
 
+TSharedPtr<IAssetAnalyzer> FAssetScanner::FindAnalyzerForClass(const UClass* AssetClass) const
+{
+	// Iterate up the class hierarchy to find a registered analyzer
+	for (const UClass* CurrentClass = AssetClass; CurrentClass != nullptr; CurrentClass = CurrentClass->GetSuperClass())
+	{
+		const TSharedPtr<IAssetAnalyzer>* AnalyzerPtr = AssetAnalyzersMap.Find(const_cast<UClass*>(CurrentClass));
+		if (AnalyzerPtr && AnalyzerPtr->IsValid())
+		{
+			UE_LOG(LogPipelineGuardian, Verbose, TEXT("Analyzer found for class %s (Analyzer for: %s)"), *AssetClass->GetName(), *CurrentClass->GetName());
+			return *AnalyzerPtr;
+		}
+	}
+
+	return nullptr;
+}
+
+TSharedPtr<IAssetAnalyzer> FAssetScanner::FindAnalyzerWithoutLoading(const FAssetData& AssetData, const UPipelineGuardianProfile* Profile) const
+{
+	if (!Profile || !AssetData.IsValid())
+	{
+		return nullptr;
+	}
+
+	// Resolves the class without loading the asset; classes that are not in memory yet are not found
+	const UClass* AssetClass = AssetData.GetClass();
+	if (!AssetClass)
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<IAssetAnalyzer> Analyzer = FindAnalyzerForClass(AssetClass);
+	if (Analyzer.IsValid() && Analyzer->CanAnalyzeWithoutLoading(AssetData, Profile))
+	{
+		return Analyzer;
+	}
+
+	return nullptr;
+}
+
 void FAssetScanner::ScanAssetsInPath(const FString& Path, bool bRecursive, TArray<FAssetData>& OutAssetDataList) const
 {
 	OutAssetDataList.Empty();
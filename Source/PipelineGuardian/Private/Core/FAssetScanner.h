@@ -12,6 +12,7 @@
 // Forward Declarations
 class IAssetAnalyzer;
 class UPipelineGuardianSettings;
+class UPipelineGuardianProfile;
 struct FAssetAnalysisResult;
 
 /**
@@ -44,6 +45,12 @@ public:
 	 */
 	void RegisterAssetAnalyzer(UClass* AssetClass, TSharedPtr<IAssetAnalyzer> Analyzer);
 
+	/**
+	 * Registers the analyzers for every asset type Pipeline Guardian supports.
+	 * Shared by the editor window and the commandlet so both run the same rules.
+	 */
+	void RegisterDefaultAnalyzers();
+
 	/**
 	 * Analyzes a single asset using the appropriate registered analyzer.
 	 * @param AssetData The FAssetData of the asset to analyze.
@@ -52,6 +59,21 @@ public:
 	 */
 	void AnalyzeSingleAsset(const FAssetData& AssetData, const UPipelineGuardianSettings* Settings, TArray<FAssetAnalysisResult>& OutResults);
 
+	/**
+	 * Finds the analyzer registered for a class or the nearest of its parent classes.
+	 * @param AssetClass The UClass of the loaded asset.
+	 * @return The analyzer, or an invalid pointer if none is registered for the hierarchy.
+	 */
+	TSharedPtr<IAssetAnalyzer> FindAnalyzerForClass(const UClass* AssetClass) const;
+
+	/**
+	 * Finds the analyzer for an asset that can be analyzed from its asset registry tags alone, without loading it.
+	 * @param AssetData The FAssetData of the (possibly unloaded) asset.
+	 * @param Profile The active profile; decides which rules run.
+	 * @return The analyzer, or an invalid pointer if the asset has to be loaded.
+	 */
+	TSharedPtr<IAssetAnalyzer> FindAnalyzerWithoutLoading(const FAssetData& AssetData, const UPipelineGuardianProfile* Profile) const;
+
 	/**
 	 * Clears all registered asset analyzers.
 	 */
@@ -0,0 +1,192 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Core/FAssetStreamingLoader.h"
+#include "HAL/PlatformMemory.h"
+#include "PipelineGuardian.h"
+
+FAssetStreamingLoader::FAssetStreamingLoader(int32 InMaxInFlight, int32 InMemoryCeilingMB)
+	: PendingHead(0)
+	, MaxInFlight(FMath::Max(1, InMaxInFlight))
+	, MemoryCeilingBytes(static_cast<uint64>(FMath::Max(0, InMemoryCeilingMB)) * 1024 * 1024)
+{
+}
+
+FAssetStreamingLoader::~FAssetStreamingLoader()
+{
+	CancelAll();
+}
+
+void FAssetStreamingLoader::Prefetch(TConstArrayView<FAssetData> Assets)
+{
+	check(IsInGameThread());
+
+	for (const FAssetData& AssetData : Assets)
+	{
+		if (!AssetData.IsValid())
+		{
+			continue;
+		}
+
+		const FSoftObjectPath ObjectPath = AssetData.GetSoftObjectPath();
+		if (ActiveHandles.Contains(ObjectPath) || PendingSet.Contains(ObjectPath))
+		{
+			continue;
+		}
+
+		PendingPaths.Add(ObjectPath);
+		PendingSet.Add(ObjectPath);
+	}
+
+	IssuePendingRequests();
+}
+
+UObject* FAssetStreamingLoader::WaitForAsset(const FAssetData& AssetData)
+{
+	check(IsInGameThread());
+
+	const FSoftObjectPath ObjectPath = AssetData.GetSoftObjectPath();
+
+	TSharedPtr<FStreamableHandle> Handle = ActiveHandles.FindRef(ObjectPath);
+	if (!Handle.IsValid())
+	{
+		// Not prefetched, or still queued behind the limits: the analyzer needs it now, so request it regardless.
+		// The stale queue entry is skipped when the queue reaches it.
+		PendingSet.Remove(ObjectPath);
+		Handle = IssueRequest(ObjectPath);
+	}
+
+	UObject* LoadedObject = nullptr;
+	if (Handle.IsValid())
+	{
+		Handle->WaitUntilComplete();
+		LoadedObject = Handle->GetLoadedAsset();
+	}
+
+	if (!LoadedObject)
+	{
+		// Fall back to a synchronous load so behavior matches the non-streaming path
+		UE_LOG(LogPipelineGuardian, Verbose, TEXT("FAssetStreamingLoader: Async load of %s produced no object, loading synchronously"), *ObjectPath.ToString());
+		LoadedObject = AssetData.GetAsset();
+	}
+
+	// A completed request frees a slot
+	IssuePendingRequests();
+
+	return LoadedObject;
+}
+
+bool FAssetStreamingLoader::IsAssetReady(const FAssetData& AssetData)
+{
+	check(IsInGameThread());
+
+	const FSoftObjectPath ObjectPath = AssetData.GetSoftObjectPath();
+
+	TSharedPtr<FStreamableHandle> Handle = ActiveHandles.FindRef(ObjectPath);
+	if (!Handle.IsValid())
+	{
+		PendingSet.Remove(ObjectPath);
+		Handle = IssueRequest(ObjectPath);
+		if (!Handle.IsValid())
+		{
+			// WaitForAsset() falls back to a synchronous load
+			return true;
+		}
+	}
+
+	return !Handle->IsLoadingInProgress();
+}
+
+void FAssetStreamingLoader::Release(const FAssetData& AssetData)
+{
+	check(IsInGameThread());
+
+	TSharedPtr<FStreamableHandle> Handle;
+	if (ActiveHandles.RemoveAndCopyValue(AssetData.GetSoftObjectPath(), Handle) && Handle.IsValid())
+	{
+		Handle->ReleaseHandle();
+	}
+}
+
+void FAssetStreamingLoader::CancelAll()
+{
+	for (TPair<FSoftObjectPath, TSharedPtr<FStreamableHandle>>& Pair : ActiveHandles)
+	{
+		if (Pair.Value.IsValid())
+		{
+			Pair.Value->CancelHandle();
+		}
+	}
+	ActiveHandles.Empty();
+	PendingPaths.Empty();
+	PendingSet.Empty();
+	PendingHead = 0;
+}
+
+int32 FAssetStreamingLoader::GetNumInFlight() const
+{
+	int32 NumInFlight = 0;
+	for (const TPair<FSoftObjectPath, TSharedPtr<FStreamableHandle>>& Pair : ActiveHandles)
+	{
+		if (Pair.Value.IsValid() && Pair.Value->IsLoadingInProgress())
+		{
+			++NumInFlight;
+		}
+	}
+	return NumInFlight;
+}
+
+void FAssetStreamingLoader::IssuePendingRequests()
+{
+	int32 NumInFlight = GetNumInFlight();
+	while (PendingHead < PendingPaths.Num() && NumInFlight < MaxInFlight)
+	{
+		if (!IsUnderMemoryCeiling())
+		{
+			UE_LOG(LogPipelineGuardian, Verbose, TEXT("FAssetStreamingLoader: Memory ceiling reached, holding %d prefetches"), GetNumPending());
+			break;
+		}
+
+		const FSoftObjectPath ObjectPath = PendingPaths[PendingHead++];
+		if (PendingSet.Remove(ObjectPath) == 0)
+		{
+			// Already requested by WaitForAsset
+			continue;
+		}
+
+		TSharedPtr<FStreamableHandle> Handle = IssueRequest(ObjectPath);
+		if (Handle.IsValid() && Handle->IsLoadingInProgress())
+		{
+			++NumInFlight;
+		}
+	}
+
+	// Compact the queue once everything in it has been issued
+	if (PendingHead >= PendingPaths.Num())
+	{
+		PendingPaths.Reset();
+		PendingHead = 0;
+	}
+}
+
+TSharedPtr<FStreamableHandle> FAssetStreamingLoader::IssueRequest(const FSoftObjectPath& ObjectPath)
+{
+	TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(ObjectPath, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+	if (!Handle.IsValid())
+	{
+		UE_LOG(LogPipelineGuardian, Warning, TEXT("FAssetStreamingLoader: Could not request async load of %s"), *ObjectPath.ToString());
+		return nullptr;
+	}
+
+	ActiveHandles.Add(ObjectPath, Handle);
+	return Handle;
+}
+
+bool FAssetStreamingLoader::IsUnderMemoryCeiling() const
+{
+	if (MemoryCeilingBytes == 0)
+	{
+		return true;
+	}
+
+	return FPlatformMemory::GetStats().UsedPhysical < MemoryCeilingBytes;
+}
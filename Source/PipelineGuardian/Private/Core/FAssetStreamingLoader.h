@@ -0,0 +1,94 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "Containers/ArrayView.h"
+#include "Engine/StreamableManager.h"
+#include "UObject/SoftObjectPath.h"
+
+/**
+ * Streams assets in ahead of the analyzer with asynchronous package loads.
+ * Callers prefetch the assets they will need next and then wait for each one in turn; while they
+ * analyze one batch, the requests for the following batch are already in flight.
+ * The number of outstanding requests and the memory used by prefetching are both bounded.
+ * All methods must be called from the game thread.
+ */
+class FAssetStreamingLoader
+{
+public:
+	/**
+	 * @param InMaxInFlight Maximum number of asynchronous loads outstanding at once.
+	 * @param InMemoryCeilingMB Used physical memory (MB) above which no new prefetches are issued. 0 disables the limit.
+	 */
+	FAssetStreamingLoader(int32 InMaxInFlight, int32 InMemoryCeilingMB);
+	~FAssetStreamingLoader();
+
+	/**
+	 * Queues assets to be loaded asynchronously and issues as many requests as the limits allow.
+	 * Assets that are already queued or loaded are ignored.
+	 * @param Assets The assets that will be needed next, in the order they will be needed.
+	 */
+	void Prefetch(TConstArrayView<FAssetData> Assets);
+
+	/**
+	 * Returns the loaded object for an asset, blocking until its load completes.
+	 * Assets that were never prefetched, or are still waiting for a free slot, are requested immediately.
+	 * @param AssetData The asset to wait for.
+	 * @return The loaded object, or nullptr if the asset failed to load.
+	 */
+	UObject* WaitForAsset(const FAssetData& AssetData);
+
+	/**
+	 * Non-blocking counterpart to WaitForAsset(), for callers that must keep the game thread responsive.
+	 * An asset that is still queued behind the limits is requested immediately.
+	 * @param AssetData The asset that is needed next.
+	 * @return True if WaitForAsset() would return without blocking.
+	 */
+	bool IsAssetReady(const FAssetData& AssetData);
+
+	/**
+	 * Drops the loader's reference to an asset so it can be garbage collected once nothing else uses it.
+	 * @param AssetData The asset to release.
+	 */
+	void Release(const FAssetData& AssetData);
+
+	/** Cancels every queued and in-flight request. */
+	void CancelAll();
+
+	/** @return Number of requests issued that have not completed yet. */
+	int32 GetNumInFlight() const;
+
+	/** @return Number of assets queued but not requested yet. */
+	int32 GetNumPending() const { return PendingPaths.Num() - PendingHead; }
+
+private:
+	/** Issues queued requests until the in-flight limit or the memory ceiling is reached. */
+	void IssuePendingRequests();
+
+	/**
+	 * Issues the asynchronous load for one asset.
+	 * @param ObjectPath Path of the asset to load.
+	 * @return The streamable handle of the request.
+	 */
+	TSharedPtr<FStreamableHandle> IssueRequest(const FSoftObjectPath& ObjectPath);
+
+	/** @return True if prefetching is currently allowed by the memory ceiling. */
+	bool IsUnderMemoryCeiling() const;
+
+	FStreamableManager StreamableManager;
+
+	/** Handles of issued requests, kept until the asset is released */
+	TMap<FSoftObjectPath, TSharedPtr<FStreamableHandle>> ActiveHandles;
+
+	/** Assets waiting for a free request slot. Entries before PendingHead have been issued. */
+	TArray<FSoftObjectPath> PendingPaths;
+	int32 PendingHead;
+
+	/** Fast membership test for PendingPaths */
+	TSet<FSoftObjectPath> PendingSet;
+
+	int32 MaxInFlight;
+	uint64 MemoryCeilingBytes;
+};
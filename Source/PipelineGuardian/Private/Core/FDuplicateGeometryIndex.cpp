@@ -0,0 +1,524 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Core/FDuplicateGeometryIndex.h"
+#include "PipelineGuardian.h"
+#include "Analysis/Geometry/FShapeDescriptorClusterer.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Dom/JsonObject.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Modules/ModuleManager.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace DuplicateGeometryIndex
+{
+	/** @return The saved hash the asset registry holds for a package, or an empty string if it has none. */
+	FString GetPackageSavedHash(const IAssetRegistry& AssetRegistry, FName PackageName)
+	{
+		const TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(PackageName);
+		return PackageData.IsSet() && !PackageData->GetPackageSavedHash().IsZero() ? LexToString(PackageData->GetPackageSavedHash()) : FString();
+	}
+
+	/** 64-bit hashes do not fit the double precision of JSON numbers, so they are stored as hex strings */
+	FString HashToString(uint64 Hash)
+	{
+		return FString::Printf(TEXT("%016llx"), Hash);
+	}
+
+	uint64 HashFromString(const FString& String)
+	{
+		return FCString::Strtoui64(*String, nullptr, 16);
+	}
+
+	TArray<TSharedPtr<FJsonValue>> VectorToJson(const FVector3f& Vector)
+	{
+		return { MakeShareable(new FJsonValueNumber(Vector.X)), MakeShareable(new FJsonValueNumber(Vector.Y)), MakeShareable(new FJsonValueNumber(Vector.Z)) };
+	}
+
+	FVector3f VectorFromJson(const TArray<TSharedPtr<FJsonValue>>& Values, int32 FirstValue)
+	{
+		if (!Values.IsValidIndex(FirstValue + 2))
+		{
+			return FVector3f::ZeroVector;
+		}
+		return FVector3f(Values[FirstValue]->AsNumber(), Values[FirstValue + 1]->AsNumber(), Values[FirstValue + 2]->AsNumber());
+	}
+
+	/** @return Bytes freed by replacing every member but the canonical one. */
+	int64 GetReclaimableBytes(const FDuplicateGeometryGroup& Group)
+	{
+		int64 Bytes = 0;
+		for (int32 MemberIndex = 1; MemberIndex < Group.Members.Num(); ++MemberIndex)
+		{
+			Bytes += Group.Members[MemberIndex].Entry.MemoryBytes;
+		}
+		return Bytes;
+	}
+
+	/** @return Estimated resident bytes of every member. */
+	int64 GetCombinedBytes(const FNearDuplicateCluster& Cluster)
+	{
+		int64 Bytes = 0;
+		for (const FDuplicateGeometryGroup::FMember& Member : Cluster.Members)
+		{
+			Bytes += Member.Entry.MemoryBytes;
+		}
+		return Bytes;
+	}
+}
+
+FDuplicateGeometryIndex& FDuplicateGeometryIndex::Get()
+{
+	static FDuplicateGeometryIndex Instance;
+	return Instance;
+}
+
+void FDuplicateGeometryIndex::Begin(const FString& InFilePath)
+{
+	{
+		FScopeLock Lock(&Mutex);
+		Entries.Reset();
+		RecordedAssets.Reset();
+		FilePath = InFilePath;
+	}
+
+	if (!FilePath.IsEmpty() && FPaths::FileExists(FilePath))
+	{
+		AddFromFile(FilePath);
+	}
+	bCollecting = true;
+}
+
+void FDuplicateGeometryIndex::End()
+{
+	if (!IsCollecting())
+	{
+		return;
+	}
+	bCollecting = false;
+
+	// Later runs tell from the hash whether a mesh they did not analyze again has changed since
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+	{
+		FScopeLock Lock(&Mutex);
+		for (const FSoftObjectPath& AssetPath : RecordedAssets)
+		{
+			if (FDuplicateGeometryEntry* Entry = Entries.Find(AssetPath))
+			{
+				Entry->PackageSavedHash = DuplicateGeometryIndex::GetPackageSavedHash(AssetRegistry, AssetPath.GetLongPackageFName());
+			}
+		}
+		RecordedAssets.Reset();
+	}
+
+	if (!FilePath.IsEmpty())
+	{
+		SaveToFile(FilePath);
+	}
+}
+
+void FDuplicateGeometryIndex::RecordGeometry(const FSoftObjectPath& AssetPath, const FMeshGeometryHash& Hash, uint32 MaterialHash, int64 MemoryBytes)
+{
+	if (!IsCollecting() || !Hash.IsValid())
+	{
+		return;
+	}
+
+	FScopeLock Lock(&Mutex);
+	FDuplicateGeometryEntry& Entry = FindOrResetEntry(AssetPath);
+	Entry.Hash = Hash;
+	Entry.MaterialHash = MaterialHash;
+	Entry.MemoryBytes = MemoryBytes;
+}
+
+void FDuplicateGeometryIndex::RecordShape(const FSoftObjectPath& AssetPath, const FShapeDescriptor& Shape, int64 MemoryBytes)
+{
+	if (!IsCollecting() || !Shape.IsValid())
+	{
+		return;
+	}
+
+	FScopeLock Lock(&Mutex);
+	FDuplicateGeometryEntry& Entry = FindOrResetEntry(AssetPath);
+	Entry.Shape = Shape;
+	Entry.MemoryBytes = MemoryBytes;
+}
+
+FDuplicateGeometryEntry& FDuplicateGeometryIndex::FindOrResetEntry(const FSoftObjectPath& AssetPath)
+{
+	// The first record of a run drops what earlier runs left, which a rule disabled since would never replace
+	bool bAlreadyRecorded = false;
+	RecordedAssets.Add(AssetPath, &bAlreadyRecorded);
+	FDuplicateGeometryEntry& Entry = Entries.FindOrAdd(AssetPath);
+	if (!bAlreadyRecorded)
+	{
+		Entry = FDuplicateGeometryEntry();
+	}
+	return Entry;
+}
+
+bool FDuplicateGeometryIndex::AddFromFile(const FString& InFilePath)
+{
+	FString JsonString;
+	TSharedPtr<FJsonObject> RootObject;
+	if (!FFileHelper::LoadFileToString(JsonString, *InFilePath)
+		|| !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(JsonString), RootObject)
+		|| !RootObject.IsValid())
+	{
+		UE_LOG(LogPipelineGuardian, Warning, TEXT("FDuplicateGeometryIndex: Could not read %s"), *InFilePath);
+		return false;
+	}
+
+	AddFromJson(*RootObject);
+	return true;
+}
+
+void FDuplicateGeometryIndex::AddFromJson(const FJsonObject& JsonObject)
+{
+	using namespace DuplicateGeometryIndex;
+
+	int32 Version = 0;
+	const TArray<TSharedPtr<FJsonValue>>* MeshValues = nullptr;
+	if (!JsonObject.TryGetNumberField(TEXT("Version"), Version) || Version != FormatVersion || !JsonObject.TryGetArrayField(TEXT("Meshes"), MeshValues))
+	{
+		UE_LOG(LogPipelineGuardian, Log, TEXT("FDuplicateGeometryIndex: Ignoring entries of a different format version"));
+		return;
+	}
+
+	FScopeLock Lock(&Mutex);
+	for (const TSharedPtr<FJsonValue>& MeshValue : *MeshValues)
+	{
+		const TSharedPtr<FJsonObject>* MeshObject = nullptr;
+		if (!MeshValue->TryGetObject(MeshObject))
+		{
+			continue;
+		}
+
+		FDuplicateGeometryEntry Entry;
+		Entry.Hash.ExactHash = HashFromString((*MeshObject)->GetStringField(TEXT("Exact")));
+		Entry.Hash.TopologyHash = HashFromString((*MeshObject)->GetStringField(TEXT("Topology")));
+		Entry.Hash.NumVertices = static_cast<int32>((*MeshObject)->GetNumberField(TEXT("Vertices")));
+		Entry.Hash.NumTriangles = static_cast<int32>((*MeshObject)->GetNumberField(TEXT("Triangles")));
+		Entry.Hash.Extent = static_cast<float>((*MeshObject)->GetNumberField(TEXT("Extent")));
+
+		const TArray<TSharedPtr<FJsonValue>>* CenterValues = nullptr;
+		if ((*MeshObject)->TryGetArrayField(TEXT("Center"), CenterValues))
+		{
+			Entry.Hash.Center = VectorFromJson(*CenterValues, 0);
+		}
+		const TArray<TSharedPtr<FJsonValue>>* SketchValues = nullptr;
+		if ((*MeshObject)->TryGetArrayField(TEXT("Sketch"), SketchValues))
+		{
+			for (int32 SketchIndex = 0; SketchIndex < FMeshGeometryHash::NumShapeSketches; ++SketchIndex)
+			{
+				Entry.Hash.ShapeSketch[SketchIndex] = VectorFromJson(*SketchValues, SketchIndex * 3);
+			}
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* ShapeValues = nullptr;
+		if ((*MeshObject)->TryGetArrayField(TEXT("Shape"), ShapeValues) && ShapeValues->Num() == FShapeDescriptor::NumBins)
+		{
+			for (int32 Bin = 0; Bin < FShapeDescriptor::NumBins; ++Bin)
+			{
+				Entry.Shape.Bins[Bin] = static_cast<float>((*ShapeValues)[Bin]->AsNumber());
+			}
+			Entry.Shape.bValid = true;
+		}
+
+		Entry.MaterialHash = static_cast<uint32>(HashFromString((*MeshObject)->GetStringField(TEXT("Materials"))));
+		(*MeshObject)->TryGetNumberField(TEXT("MemoryBytes"), Entry.MemoryBytes);
+		(*MeshObject)->TryGetStringField(TEXT("PackageHash"), Entry.PackageSavedHash);
+
+		if (Entry.Hash.IsValid() || Entry.Shape.IsValid())
+		{
+			Entries.Add(FSoftObjectPath((*MeshObject)->GetStringField(TEXT("Asset"))), MoveTemp(Entry));
+		}
+	}
+}
+
+TSharedRef<FJsonObject> FDuplicateGeometryIndex::ToJson() const
+{
+	using namespace DuplicateGeometryIndex;
+
+	TSharedRef<FJsonObject> RootObject = MakeShared<FJsonObject>();
+	RootObject->SetNumberField(TEXT("Version"), FormatVersion);
+
+	FScopeLock Lock(&Mutex);
+	TArray<TSharedPtr<FJsonValue>> MeshValues;
+	MeshValues.Reserve(Entries.Num());
+	for (const TPair<FSoftObjectPath, FDuplicateGeometryEntry>& Pair : Entries)
+	{
+		const FDuplicateGeometryEntry& Entry = Pair.Value;
+		TSharedPtr<FJsonObject> MeshObject = MakeShareable(new FJsonObject);
+		MeshObject->SetStringField(TEXT("Asset"), Pair.Key.ToString());
+		MeshObject->SetStringField(TEXT("Exact"), HashToString(Entry.Hash.ExactHash));
+		MeshObject->SetStringField(TEXT("Topology"), HashToString(Entry.Hash.TopologyHash));
+		MeshObject->SetNumberField(TEXT("Vertices"), Entry.Hash.NumVertices);
+		MeshObject->SetNumberField(TEXT("Triangles"), Entry.Hash.NumTriangles);
+		MeshObject->SetArrayField(TEXT("Center"), VectorToJson(Entry.Hash.Center));
+		MeshObject->SetNumberField(TEXT("Extent"), Entry.Hash.Extent);
+
+		TArray<TSharedPtr<FJsonValue>> SketchValues;
+		SketchValues.Reserve(FMeshGeometryHash::NumShapeSketches * 3);
+		for (const FVector3f& Sketch : Entry.Hash.ShapeSketch)
+		{
+			SketchValues.Append(VectorToJson(Sketch));
+		}
+		MeshObject->SetArrayField(TEXT("Sketch"), SketchValues);
+
+		if (Entry.Shape.IsValid())
+		{
+			TArray<TSharedPtr<FJsonValue>> ShapeValues;
+			ShapeValues.Reserve(FShapeDescriptor::NumBins);
+			for (const float Bin : Entry.Shape.Bins)
+			{
+				ShapeValues.Add(MakeShareable(new FJsonValueNumber(Bin)));
+			}
+			MeshObject->SetArrayField(TEXT("Shape"), ShapeValues);
+		}
+
+		MeshObject->SetStringField(TEXT("Materials"), HashToString(Entry.MaterialHash));
+		MeshObject->SetNumberField(TEXT("MemoryBytes"), static_cast<double>(Entry.MemoryBytes));
+		MeshObject->SetStringField(TEXT("PackageHash"), Entry.PackageSavedHash);
+		MeshValues.Add(MakeShareable(new FJsonValueObject(MeshObject)));
+	}
+	RootObject->SetArrayField(TEXT("Meshes"), MeshValues);
+
+	return RootObject;
+}
+
+bool FDuplicateGeometryIndex::SaveToFile(const FString& InFilePath) const
+{
+	FString OutputString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	FJsonSerializer::Serialize(ToJson(), Writer);
+
+	if (!FFileHelper::SaveStringToFile(OutputString, *InFilePath))
+	{
+		UE_LOG(LogPipelineGuardian, Warning, TEXT("FDuplicateGeometryIndex: Failed to write %s"), *InFilePath);
+		return false;
+	}
+
+	UE_LOG(LogPipelineGuardian, Log, TEXT("FDuplicateGeometryIndex: Saved %d meshes to %s"), Entries.Num(), *InFilePath);
+	return true;
+}
+
+TArray<FDuplicateGeometryGroup::FMember> FDuplicateGeometryIndex::GetValidMembers() const
+{
+	using namespace DuplicateGeometryIndex;
+	using FMember = FDuplicateGeometryGroup::FMember;
+
+	TArray<TPair<FSoftObjectPath, FDuplicateGeometryEntry>> EntriesCopy;
+	{
+		FScopeLock Lock(&Mutex);
+		EntriesCopy = Entries.Array();
+	}
+
+	// Members in path order, so groups and canonical ties come out the same every run
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+	TArray<FMember> Members;
+	Members.Reserve(EntriesCopy.Num());
+	for (TPair<FSoftObjectPath, FDuplicateGeometryEntry>& Pair : EntriesCopy)
+	{
+		FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(Pair.Key);
+		if (!AssetData.IsValid())
+		{
+			continue;
+		}
+
+		// Saved since it was recorded, by someone who did not analyze it again
+		if (!Pair.Value.PackageSavedHash.IsEmpty())
+		{
+			const FString CurrentHash = GetPackageSavedHash(AssetRegistry, AssetData.PackageName);
+			if (!CurrentHash.IsEmpty() && CurrentHash != Pair.Value.PackageSavedHash)
+			{
+				continue;
+			}
+		}
+
+		FMember& Member = Members.AddDefaulted_GetRef();
+		Member.AssetData = MoveTemp(AssetData);
+		Member.Entry = MoveTemp(Pair.Value);
+	}
+	Members.Sort([](const FMember& A, const FMember& B) { return A.AssetData.GetSoftObjectPath().ToString() < B.AssetData.GetSoftObjectPath().ToString(); });
+	return Members;
+}
+
+void FDuplicateGeometryIndex::FillPackageInfo(FDuplicateGeometryGroup::FMember& Member)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+
+	TArray<FName> Referencers;
+	AssetRegistry.GetReferencers(Member.AssetData.PackageName, Referencers);
+	Member.NumReferencers = Referencers.Num();
+
+	const TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(Member.AssetData.PackageName);
+	Member.DiskBytes = PackageData.IsSet() ? FMath::Max<int64>(PackageData->DiskSize, 0) : 0;
+}
+
+TArray<FDuplicateGeometryGroup> FDuplicateGeometryIndex::FindGroups(bool bIncludeTransformed) const
+{
+	using namespace DuplicateGeometryIndex;
+	using FMember = FDuplicateGeometryGroup::FMember;
+
+	// Meshes recorded by the near-duplicate rule alone have no hashes to group by
+	TArray<FMember> Members = GetValidMembers();
+	Members.RemoveAll([](const FMember& Member) { return !Member.Entry.Hash.IsValid(); });
+
+	// Meshes with identical geometry
+	TArray<TArray<int32>> ExactClasses;
+	{
+		TMap<uint64, int32> ClassByHash;
+		for (int32 MemberIndex = 0; MemberIndex < Members.Num(); ++MemberIndex)
+		{
+			const int32* ClassIndex = ClassByHash.Find(Members[MemberIndex].Entry.Hash.ExactHash);
+			if (ClassIndex)
+			{
+				ExactClasses[*ClassIndex].Add(MemberIndex);
+			}
+			else
+			{
+				ClassByHash.Add(Members[MemberIndex].Entry.Hash.ExactHash, ExactClasses.Num());
+				ExactClasses.Add({ MemberIndex });
+			}
+		}
+	}
+
+	// Classes whose first meshes only differ by translation and uniform scale. Only classes with the same topology
+	// hash are compared, so the candidates of each comparison are few.
+	TArray<TArray<int32>> ClassClusters;
+	if (bIncludeTransformed)
+	{
+		TMap<uint64, TArray<int32>> ClassesByTopology;
+		for (int32 ClassIndex = 0; ClassIndex < ExactClasses.Num(); ++ClassIndex)
+		{
+			ClassesByTopology.FindOrAdd(Members[ExactClasses[ClassIndex][0]].Entry.Hash.TopologyHash).Add(ClassIndex);
+		}
+
+		for (const TPair<uint64, TArray<int32>>& Bucket : ClassesByTopology)
+		{
+			const int32 FirstCluster = ClassClusters.Num();
+			for (const int32 ClassIndex : Bucket.Value)
+			{
+				const FMeshGeometryHash& Hash = Members[ExactClasses[ClassIndex][0]].Entry.Hash;
+				int32 ClusterIndex = FirstCluster;
+				while (ClusterIndex < ClassClusters.Num() && !FMeshGeometryHasher::IsSameShape(Members[ExactClasses[ClassClusters[ClusterIndex][0]][0]].Entry.Hash, Hash))
+				{
+					++ClusterIndex;
+				}
+				if (ClusterIndex == ClassClusters.Num())
+				{
+					ClassClusters.AddDefaulted();
+				}
+				ClassClusters[ClusterIndex].Add(ClassIndex);
+			}
+		}
+	}
+	else
+	{
+		for (int32 ClassIndex = 0; ClassIndex < ExactClasses.Num(); ++ClassIndex)
+		{
+			ClassClusters.Add({ ClassIndex });
+		}
+	}
+
+	TArray<FDuplicateGeometryGroup> Groups;
+	for (const TArray<int32>& Cluster : ClassClusters)
+	{
+		int32 NumMembers = 0;
+		for (const int32 ClassIndex : Cluster)
+		{
+			NumMembers += ExactClasses[ClassIndex].Num();
+		}
+		if (NumMembers < 2)
+		{
+			continue;
+		}
+
+		FDuplicateGeometryGroup& Group = Groups.AddDefaulted_GetRef();
+		Group.bExact = Cluster.Num() == 1;
+		for (const int32 ClassIndex : Cluster)
+		{
+			for (const int32 MemberIndex : ExactClasses[ClassIndex])
+			{
+				FillPackageInfo(Group.Members.Add_GetRef(Members[MemberIndex]));
+			}
+		}
+
+		// Most referenced first; a stable sort keeps path order between equally referenced meshes
+		Group.Members.StableSort([](const FMember& A, const FMember& B) { return A.NumReferencers > B.NumReferencers; });
+	}
+
+	Groups.StableSort([](const FDuplicateGeometryGroup& A, const FDuplicateGeometryGroup& B) { return GetReclaimableBytes(A) > GetReclaimableBytes(B); });
+	return Groups;
+}
+
+TArray<FNearDuplicateCluster> FDuplicateGeometryIndex::FindNearDuplicateClusters(float MinSimilarity) const
+{
+	using namespace DuplicateGeometryIndex;
+	using FMember = FDuplicateGeometryGroup::FMember;
+
+	TArray<FMember> Members = GetValidMembers();
+	Members.RemoveAll([](const FMember& Member) { return !Member.Entry.Shape.IsValid(); });
+
+	// Exact copies have the same descriptor, so only the first of each is clustered; meshes without hashes stand alone
+	TArray<TArray<int32>> ExactClasses;
+	{
+		TMap<uint64, int32> ClassByHash;
+		for (int32 MemberIndex = 0; MemberIndex < Members.Num(); ++MemberIndex)
+		{
+			const FMeshGeometryHash& Hash = Members[MemberIndex].Entry.Hash;
+			const int32* ClassIndex = Hash.IsValid() ? ClassByHash.Find(Hash.ExactHash) : nullptr;
+			if (ClassIndex)
+			{
+				ExactClasses[*ClassIndex].Add(MemberIndex);
+			}
+			else
+			{
+				if (Hash.IsValid())
+				{
+					ClassByHash.Add(Hash.ExactHash, ExactClasses.Num());
+				}
+				ExactClasses.Add({ MemberIndex });
+			}
+		}
+	}
+
+	TArray<FShapeDescriptor> Descriptors;
+	Descriptors.Reserve(ExactClasses.Num());
+	for (const TArray<int32>& ExactClass : ExactClasses)
+	{
+		Descriptors.Add(Members[ExactClass[0]].Entry.Shape);
+	}
+
+	TArray<FNearDuplicateCluster> Clusters;
+	for (const FShapeCluster& ShapeCluster : FShapeDescriptorClusterer::Cluster(Descriptors, MinSimilarity))
+	{
+		FNearDuplicateCluster& Cluster = Clusters.AddDefaulted_GetRef();
+		for (int32 ClusterMember = 0; ClusterMember < ShapeCluster.Members.Num(); ++ClusterMember)
+		{
+			for (const int32 MemberIndex : ExactClasses[ShapeCluster.Members[ClusterMember]])
+			{
+				FillPackageInfo(Cluster.Members.Add_GetRef(Members[MemberIndex]));
+				Cluster.Similarities.Add(ShapeCluster.Similarities[ClusterMember]);
+			}
+		}
+	}
+
+	Clusters.StableSort([](const FNearDuplicateCluster& A, const FNearDuplicateCluster& B) { return GetCombinedBytes(A) > GetCombinedBytes(B); });
+	return Clusters;
+}
+
+FString FDuplicateGeometryIndex::GetDefaultFilePath()
+{
+	return FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("PipelineGuardian") / TEXT("GeometryHashes.json"));
+}
+
+FString FDuplicateGeometryIndex::GetShardFilePath(int32 ShardIndex, int32 NumShards)
+{
+	return FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("PipelineGuardian") / FString::Printf(TEXT("GeometryHashes_Shard%dof%d.json"), ShardIndex, NumShards));
+}
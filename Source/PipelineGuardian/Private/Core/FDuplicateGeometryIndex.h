@@ -0,0 +1,181 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Analysis/Geometry/FMeshGeometryHasher.h"
+#include "Analysis/Geometry/FShapeDescriptorBuilder.h"
+#include "AssetRegistry/AssetData.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/SoftObjectPath.h"
+#include <atomic>
+
+// Forward Declarations
+class FJsonObject;
+
+/** Geometry of one static mesh as recorded in the duplicate geometry index */
+struct FDuplicateGeometryEntry
+{
+	/** Hashes of LOD 0; invalid if only the shape was recorded */
+	FMeshGeometryHash Hash;
+
+	/** Shape descriptor of LOD 0; invalid if only the hashes were recorded */
+	FShapeDescriptor Shape;
+
+	/** CRC of the material paths of the mesh's slots, in slot order */
+	uint32 MaterialHash = 0;
+
+	/** Estimated resident GPU and CPU bytes of the mesh */
+	int64 MemoryBytes = 0;
+
+	/** Saved hash of the package when the mesh was recorded; empty if the asset registry had none */
+	FString PackageSavedHash;
+};
+
+/** Meshes with the same geometry */
+struct FDuplicateGeometryGroup
+{
+	struct FMember
+	{
+		FAssetData AssetData;
+		FDuplicateGeometryEntry Entry;
+
+		/** Packages that reference the mesh's package */
+		int32 NumReferencers = 0;
+
+		/** Size of the package file; 0 if unknown */
+		int64 DiskBytes = 0;
+	};
+
+	/** Members, the canonical mesh the others can be replaced with first */
+	TArray<FMember> Members;
+
+	/** True if every member has the exact same geometry; false if some only match up to translation and uniform scale */
+	bool bExact = true;
+};
+
+/** Meshes with similar shape descriptors */
+struct FNearDuplicateCluster
+{
+	/** Members, the representative first; exact copies of a member follow it */
+	TArray<FDuplicateGeometryGroup::FMember> Members;
+
+	/** Shape similarity of each member to the representative, in member order */
+	TArray<float> Similarities;
+};
+
+/**
+ * Project-wide index of static mesh geometry hashes and shape descriptors, to find meshes that were imported more than
+ * once and meshes that are near-identical variants of each other.
+ * Filled by the duplicate geometry and near-duplicate rules on worker threads, so recording is thread-safe; everything else belongs to the game thread.
+ * Entries are kept in a file between runs, so meshes served from the analysis cache are still compared. Entries of meshes
+ * that were deleted, or whose package was saved since they were recorded, are ignored when grouping.
+ */
+class FDuplicateGeometryIndex
+{
+public:
+	/** @return The process-wide index. */
+	static FDuplicateGeometryIndex& Get();
+
+	/**
+	 * Loads the entries of earlier runs and starts recording.
+	 * @param InFilePath File to load from and to save to on End(); empty keeps the index in memory only.
+	 */
+	void Begin(const FString& InFilePath = GetDefaultFilePath());
+
+	/** Stops recording, stamps the entries recorded since Begin() with their package hash and saves the index. */
+	void End();
+
+	/** @return True between Begin() and End(). */
+	bool IsCollecting() const { return bCollecting.load(std::memory_order_relaxed); }
+
+	/**
+	 * Records the geometry hashes of one mesh, replacing its earlier ones.
+	 * @param AssetPath The mesh.
+	 * @param Hash Hashes of its LOD 0.
+	 * @param MaterialHash CRC of its material paths.
+	 * @param MemoryBytes Its estimated resident bytes.
+	 */
+	void RecordGeometry(const FSoftObjectPath& AssetPath, const FMeshGeometryHash& Hash, uint32 MaterialHash, int64 MemoryBytes);
+
+	/**
+	 * Records the shape descriptor of one mesh, replacing its earlier one.
+	 * @param AssetPath The mesh.
+	 * @param Shape Descriptor of its LOD 0.
+	 * @param MemoryBytes Its estimated resident bytes.
+	 */
+	void RecordShape(const FSoftObjectPath& AssetPath, const FShapeDescriptor& Shape, int64 MemoryBytes);
+
+	/**
+	 * Adds the entries saved by another run, e.g. of a commandlet shard.
+	 * @param FilePath File written by End() or SaveToFile().
+	 * @return True if the file was read.
+	 */
+	bool AddFromFile(const FString& FilePath);
+
+	/**
+	 * Adds the entries of another run.
+	 * @param JsonObject Entries as written by ToJson().
+	 */
+	void AddFromJson(const FJsonObject& JsonObject);
+
+	/** @return Every entry, as written by SaveToFile(). */
+	TSharedRef<FJsonObject> ToJson() const;
+
+	/**
+	 * Writes ToJson() to disk.
+	 * @param FilePath Absolute path of the file to write.
+	 * @return True if the file was written.
+	 */
+	bool SaveToFile(const FString& FilePath) const;
+
+	/**
+	 * Groups the meshes with the same geometry. The canonical mesh of a group is the one most packages reference,
+	 * so consolidating onto it touches the fewest referencers.
+	 * @param bIncludeTransformed Also group meshes that only match up to translation and uniform scale.
+	 * @return Groups of two or more meshes, largest reclaimable memory first.
+	 */
+	TArray<FDuplicateGeometryGroup> FindGroups(bool bIncludeTransformed) const;
+
+	/**
+	 * Clusters meshes with similar shape descriptors through FShapeDescriptorClusterer, so meshes are not compared
+	 * pairwise. Exact copies are clustered once and listed together.
+	 * @param MinSimilarity Shape similarity at which two meshes are linked.
+	 * @return Clusters of two or more meshes that are not all exact copies of each other, largest combined memory first.
+	 */
+	TArray<FNearDuplicateCluster> FindNearDuplicateClusters(float MinSimilarity) const;
+
+	/** @return Default file of the index, Saved/PipelineGuardian/GeometryHashes.json. */
+	static FString GetDefaultFilePath();
+
+	/** @return File of the index of one commandlet shard; shards run concurrently, so each keeps its own. */
+	static FString GetShardFilePath(int32 ShardIndex, int32 NumShards);
+
+private:
+	/** Bump when the entry layout or the hashes change; older files are discarded */
+	static constexpr int32 FormatVersion = 3;
+
+	/** @return The entry of a mesh, emptied if it was not recorded since Begin(). Call with the mutex held. */
+	FDuplicateGeometryEntry& FindOrResetEntry(const FSoftObjectPath& AssetPath);
+
+	/**
+	 * Copies the entries whose mesh still exists and has not been saved since it was recorded.
+	 * @return The members in path order, without referencer counts and disk sizes.
+	 */
+	TArray<FDuplicateGeometryGroup::FMember> GetValidMembers() const;
+
+	/** Fills the referencer count and package size of a member from the asset registry. */
+	static void FillPackageInfo(FDuplicateGeometryGroup::FMember& Member);
+
+	mutable FCriticalSection Mutex;
+
+	TMap<FSoftObjectPath, FDuplicateGeometryEntry> Entries;
+
+	/** Meshes recorded since Begin(), stamped with their package hash by End() */
+	TSet<FSoftObjectPath> RecordedAssets;
+
+	FString FilePath;
+
+	std::atomic<bool> bCollecting = false;
+};
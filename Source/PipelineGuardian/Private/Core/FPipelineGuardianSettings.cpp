@@ -10,6 +10,16 @@
 
 UPipelineGuardianSettings::UPipelineGuardianSettings()
 	: bMasterSwitch_EnableAnalysis(true) // Default to enabled
+	, AnalysisMaxConcurrency(0) // Default to all task graph workers
+	, AnalysisBatchSize(64)
+	, bEnableAsyncAssetLoading(true)
+	, AsyncLoadMaxInFlight(32)
+	, AsyncLoadMemoryCeilingMB(0) // Default to no limit
+	, bEnableAnalysisCache(true)
+	, bEnableMemoryGovernor(true)
+	, ScanMemoryBudgetMB(0) // Default to half of physical memory
+	, bEnableTimeSlicedAnalysis(true)
+	, AnalysisFrameBudgetMs(8.0f)
 	, bEnableStaticMeshNamingRule(true) // Default to enabled
 	, StaticMeshNamingPattern(TEXT("SM_*")) // Default pattern
 	, bEnableStaticMeshLODRule(true) // Default to enabled
@@ -37,6 +47,8 @@ UPipelineGuardianSettings::UPipelineGuardianSettings()
 	, TextureUVOverlapErrorThreshold(15.0f) // 15% overlap triggers error
 	, LightmapUVOverlapWarningThreshold(2.0f) // 2% overlap triggers warning for lightmaps
 	, LightmapUVOverlapErrorThreshold(8.0f) // 8% overlap triggers error for lightmaps
+	, bRasterizeUVOverlaps(true)
+	, TextureUVOverlapRasterResolution(1024)
 	// bAllowUVOverlapAutoFix removed - use external UV tools instead
 
 	// Triangle Count Rule settings
@@ -50,6 +62,8 @@ UPipelineGuardianSettings::UPipelineGuardianSettings()
 	, DegenerateFacesIssueSeverity(EAssetIssueSeverity::Warning)
 	, DegenerateFacesWarningThreshold(1.0f)  // 1% degenerate faces - warning
 	, DegenerateFacesErrorThreshold(5.0f)    // 5% degenerate faces - error
+	, DegenerateFacesMinArea(1e-6f)          // 0.0001 mm^2
+	, DegenerateFacesSliverAspectRatio(1000.0f)
 	, bAllowDegenerateFacesAutoFix(true)     // Allow automatic removal when safe
 	, bEnableStaticMeshCollisionMissingRule(true)
 	, CollisionMissingIssueSeverity(EAssetIssueSeverity::Error) // Missing collision is critical
@@ -96,6 +110,55 @@ UPipelineGuardianSettings::UPipelineGuardianSettings()
 	, LightmapResolutionMin(4)              // 16x16 minimum
 	, LightmapResolutionMax(16)             // 65536x65536 maximum (but clamped to 32 in UI)
 	, bAllowLightmapResolutionAutoFix(true) // Allow automatic resolution setting
+	, LightmapTargetTexelDensity(0.2f)      // Engine default IdealLightMapDensity
+	, LightmapDensityTolerance(2.0f)
+	, LightmapMinUtilization(30.0f)
+	, bEnableStaticMeshTexelDensityRule(true)
+	, TexelDensityIssueSeverity(EAssetIssueSeverity::Warning)
+	, TargetTexelDensity(5.12f)             // 512 texels per meter
+	, TexelDensityTolerance(2.0f)
+	, TexelDensityUVChannel(0)
+	, bEnableStaticMeshVertexCacheRule(true)
+	, VertexCacheIssueSeverity(EAssetIssueSeverity::Warning)
+	, VertexCacheSize(16)
+	, bSimulateLRUVertexCache(false)
+	, VertexCacheMaxATVR(1.5f)
+	, VertexCacheMinImprovement(10.0f)      // 10% fewer vertex shader invocations
+	, bAllowVertexCacheAutoFix(true)
+	, bEnableStaticMeshOverdrawRule(true)
+	, OverdrawIssueSeverity(EAssetIssueSeverity::Warning)
+	, OverdrawThreshold(1.25f)              // 25% of covered pixels shaded twice
+	, OverdrawCacheThreshold(1.05f)         // 5% worse ACMR than the cache-optimized order
+	, bAllowOverdrawAutoFix(true)
+	, bEnableStaticMeshVertexSplitRule(true)
+	, VertexSplitIssueSeverity(EAssetIssueSeverity::Warning)
+	, VertexSplitMaxRatio(2.0f)             // Twice as many render vertices as positions
+	, VertexSplitMinWastedKB(16)
+	, bEnableStaticMeshLODGeometricErrorRule(true)
+	, LODGeometricErrorIssueSeverity(EAssetIssueSeverity::Warning)
+	, LODPixelErrorBudget(1.0f)             // One pixel of deviation at the switch
+	, LODReferenceScreenHeight(1080)
+	, LODScreenSizeTolerance(4.0f)          // Between 0.25 and 4 pixels is acceptable
+	, bAllowLODScreenSizeAutoFix(true)
+	, bCalibrateGeneratedLODScreenSizes(false) // Keep the configured screen sizes unless asked
+	, bEnableStaticMeshMemoryBudgetRule(true)
+	, MemoryBudgetIssueSeverity(EAssetIssueSeverity::Warning)
+	, MemoryBudgetGPUKB(16384)              // 16 MB resident on the GPU
+	, MemoryBudgetCPUKB(4096)               // 4 MB in system memory
+	, bEnableStaticMeshDuplicateGeometryRule(true)
+	, DuplicateGeometryIssueSeverity(EAssetIssueSeverity::Warning)
+	, bDetectTransformedDuplicates(true)
+	, bAllowDuplicateGeometryAutoFix(false)
+	, bEnableStaticMeshNearDuplicateRule(true)
+	, NearDuplicateIssueSeverity(EAssetIssueSeverity::Info)
+	, NearDuplicateMinSimilarity(0.95f)     // Variants with small edits, not merely similar silhouettes
+	, bEnableStaticMeshDrawCallRule(true)
+	, DrawCallIssueSeverity(EAssetIssueSeverity::Warning)
+	, MaxDrawCallsPerInstance(24)           // 8 opaque shadow-casting sections with one shadow pass
+	, DrawCallShadowPasses(1)               // One shadow-casting light, no cascades
+	, TinySectionMaxTriangles(32)
+	, TinySectionMaxAreaPercent(0.5f)       // Half a percent of the LOD's surface
+	, bAllowDrawCallAutoFix(true)
 	, bEnableStaticMeshSocketNamingRule(true)
 	, SocketNamingIssueSeverity(EAssetIssueSeverity::Warning)
 	, SocketNamingPrefix(TEXT("Socket_"))   // Default prefix
@@ -273,6 +336,8 @@ void UPipelineGuardianSettings::SyncQuickSettingsToProfile()
 	SMUVOverlappingRule.Parameters.Add(TEXT("TextureErrorThreshold"), FString::SanitizeFloat(TextureUVOverlapErrorThreshold));
 	SMUVOverlappingRule.Parameters.Add(TEXT("LightmapWarningThreshold"), FString::SanitizeFloat(LightmapUVOverlapWarningThreshold));
 	SMUVOverlappingRule.Parameters.Add(TEXT("LightmapErrorThreshold"), FString::SanitizeFloat(LightmapUVOverlapErrorThreshold));
+	SMUVOverlappingRule.Parameters.Add(TEXT("RasterizeOverlaps"), bRasterizeUVOverlaps ? TEXT("true") : TEXT("false"));
+	SMUVOverlappingRule.Parameters.Add(TEXT("TextureRasterResolution"), FString::FromInt(TextureUVOverlapRasterResolution));
 	// Note: AllowAutoFix parameter removed - UV fixes should be done in external tools
 	
 	ActiveProfile->SetRuleConfig(SMUVOverlappingRule);
@@ -296,6 +361,8 @@ void UPipelineGuardianSettings::SyncQuickSettingsToProfile()
 	SMDegenerateFacesRule.Parameters.Add(TEXT("Severity"), FString::FromInt(static_cast<int32>(DegenerateFacesIssueSeverity)));
 	SMDegenerateFacesRule.Parameters.Add(TEXT("WarningThreshold"), FString::SanitizeFloat(DegenerateFacesWarningThreshold));
 	SMDegenerateFacesRule.Parameters.Add(TEXT("ErrorThreshold"), FString::SanitizeFloat(DegenerateFacesErrorThreshold));
+	SMDegenerateFacesRule.Parameters.Add(TEXT("MinArea"), FString::SanitizeFloat(DegenerateFacesMinArea));
+	SMDegenerateFacesRule.Parameters.Add(TEXT("SliverAspectRatio"), FString::SanitizeFloat(DegenerateFacesSliverAspectRatio));
 	SMDegenerateFacesRule.Parameters.Add(TEXT("AllowAutoFix"), bAllowDegenerateFacesAutoFix ? TEXT("true") : TEXT("false"));
 	
 	ActiveProfile->SetRuleConfig(SMDegenerateFacesRule);
@@ -379,8 +446,102 @@ void UPipelineGuardianSettings::SyncQuickSettingsToProfile()
 	SMLightmapResolutionRule.Parameters.Add(TEXT("MinResolution"), FString::FromInt(LightmapResolutionMin));
 	SMLightmapResolutionRule.Parameters.Add(TEXT("MaxResolution"), FString::FromInt(LightmapResolutionMax));
 	SMLightmapResolutionRule.Parameters.Add(TEXT("AllowAutoFix"), bAllowLightmapResolutionAutoFix ? TEXT("true") : TEXT("false"));
+	SMLightmapResolutionRule.Parameters.Add(TEXT("TargetTexelDensity"), FString::SanitizeFloat(LightmapTargetTexelDensity));
+	SMLightmapResolutionRule.Parameters.Add(TEXT("DensityTolerance"), FString::SanitizeFloat(LightmapDensityTolerance));
+	SMLightmapResolutionRule.Parameters.Add(TEXT("MinUtilization"), FString::SanitizeFloat(LightmapMinUtilization));
 	ActiveProfile->SetRuleConfig(SMLightmapResolutionRule);
 
+	// Texel Density Rule configuration
+	FPipelineGuardianRuleConfig SMTexelDensityRule;
+	SMTexelDensityRule.RuleID = TEXT("SM_TexelDensity");
+	SMTexelDensityRule.bEnabled = bEnableStaticMeshTexelDensityRule;
+	SMTexelDensityRule.Parameters.Add(TEXT("Severity"), FString::FromInt(static_cast<int32>(TexelDensityIssueSeverity)));
+	SMTexelDensityRule.Parameters.Add(TEXT("TargetTexelDensity"), FString::SanitizeFloat(TargetTexelDensity));
+	SMTexelDensityRule.Parameters.Add(TEXT("Tolerance"), FString::SanitizeFloat(TexelDensityTolerance));
+	SMTexelDensityRule.Parameters.Add(TEXT("UVChannel"), FString::FromInt(TexelDensityUVChannel));
+	ActiveProfile->SetRuleConfig(SMTexelDensityRule);
+
+	// Vertex Cache Rule configuration
+	FPipelineGuardianRuleConfig SMVertexCacheRule;
+	SMVertexCacheRule.RuleID = TEXT("SM_VertexCache");
+	SMVertexCacheRule.bEnabled = bEnableStaticMeshVertexCacheRule;
+	SMVertexCacheRule.Parameters.Add(TEXT("Severity"), FString::FromInt(static_cast<int32>(VertexCacheIssueSeverity)));
+	SMVertexCacheRule.Parameters.Add(TEXT("CacheSize"), FString::FromInt(VertexCacheSize));
+	SMVertexCacheRule.Parameters.Add(TEXT("SimulateLRU"), bSimulateLRUVertexCache ? TEXT("true") : TEXT("false"));
+	SMVertexCacheRule.Parameters.Add(TEXT("MaxATVR"), FString::SanitizeFloat(VertexCacheMaxATVR));
+	SMVertexCacheRule.Parameters.Add(TEXT("MinImprovement"), FString::SanitizeFloat(VertexCacheMinImprovement));
+	SMVertexCacheRule.Parameters.Add(TEXT("AllowAutoFix"), bAllowVertexCacheAutoFix ? TEXT("true") : TEXT("false"));
+	ActiveProfile->SetRuleConfig(SMVertexCacheRule);
+
+	// Overdraw Rule configuration
+	FPipelineGuardianRuleConfig SMOverdrawRule;
+	SMOverdrawRule.RuleID = TEXT("SM_Overdraw");
+	SMOverdrawRule.bEnabled = bEnableStaticMeshOverdrawRule;
+	SMOverdrawRule.Parameters.Add(TEXT("Severity"), FString::FromInt(static_cast<int32>(OverdrawIssueSeverity)));
+	SMOverdrawRule.Parameters.Add(TEXT("Threshold"), FString::SanitizeFloat(OverdrawThreshold));
+	SMOverdrawRule.Parameters.Add(TEXT("CacheThreshold"), FString::SanitizeFloat(OverdrawCacheThreshold));
+	SMOverdrawRule.Parameters.Add(TEXT("AllowAutoFix"), bAllowOverdrawAutoFix ? TEXT("true") : TEXT("false"));
+	ActiveProfile->SetRuleConfig(SMOverdrawRule);
+
+	// Vertex Split Rule configuration
+	FPipelineGuardianRuleConfig SMVertexSplitRule;
+	SMVertexSplitRule.RuleID = TEXT("SM_VertexSplit");
+	SMVertexSplitRule.bEnabled = bEnableStaticMeshVertexSplitRule;
+	SMVertexSplitRule.Parameters.Add(TEXT("Severity"), FString::FromInt(static_cast<int32>(VertexSplitIssueSeverity)));
+	SMVertexSplitRule.Parameters.Add(TEXT("MaxRatio"), FString::SanitizeFloat(VertexSplitMaxRatio));
+	SMVertexSplitRule.Parameters.Add(TEXT("MinWastedKB"), FString::FromInt(VertexSplitMinWastedKB));
+	ActiveProfile->SetRuleConfig(SMVertexSplitRule);
+
+	// LOD Geometric Error Rule configuration
+	FPipelineGuardianRuleConfig SMLODGeometricErrorRule;
+	SMLODGeometricErrorRule.RuleID = TEXT("SM_LODGeometricError");
+	SMLODGeometricErrorRule.bEnabled = bEnableStaticMeshLODGeometricErrorRule;
+	SMLODGeometricErrorRule.Parameters.Add(TEXT("Severity"), FString::FromInt(static_cast<int32>(LODGeometricErrorIssueSeverity)));
+	SMLODGeometricErrorRule.Parameters.Add(TEXT("PixelErrorBudget"), FString::SanitizeFloat(LODPixelErrorBudget));
+	SMLODGeometricErrorRule.Parameters.Add(TEXT("ReferenceScreenHeight"), FString::FromInt(LODReferenceScreenHeight));
+	SMLODGeometricErrorRule.Parameters.Add(TEXT("ScreenSizeTolerance"), FString::SanitizeFloat(LODScreenSizeTolerance));
+	SMLODGeometricErrorRule.Parameters.Add(TEXT("AllowAutoFix"), bAllowLODScreenSizeAutoFix ? TEXT("true") : TEXT("false"));
+	SMLODGeometricErrorRule.Parameters.Add(TEXT("CalibrateGeneratedLODs"), bCalibrateGeneratedLODScreenSizes ? TEXT("true") : TEXT("false"));
+	ActiveProfile->SetRuleConfig(SMLODGeometricErrorRule);
+
+	// Memory Budget Rule configuration
+	FPipelineGuardianRuleConfig SMMemoryBudgetRule;
+	SMMemoryBudgetRule.RuleID = TEXT("SM_MemoryBudget");
+	SMMemoryBudgetRule.bEnabled = bEnableStaticMeshMemoryBudgetRule;
+	SMMemoryBudgetRule.Parameters.Add(TEXT("Severity"), FString::FromInt(static_cast<int32>(MemoryBudgetIssueSeverity)));
+	SMMemoryBudgetRule.Parameters.Add(TEXT("GPUBudgetKB"), FString::FromInt(MemoryBudgetGPUKB));
+	SMMemoryBudgetRule.Parameters.Add(TEXT("CPUBudgetKB"), FString::FromInt(MemoryBudgetCPUKB));
+	ActiveProfile->SetRuleConfig(SMMemoryBudgetRule);
+
+	// Duplicate Geometry Rule configuration
+	FPipelineGuardianRuleConfig SMDuplicateGeometryRule;
+	SMDuplicateGeometryRule.RuleID = TEXT("SM_DuplicateGeometry");
+	SMDuplicateGeometryRule.bEnabled = bEnableStaticMeshDuplicateGeometryRule;
+	SMDuplicateGeometryRule.Parameters.Add(TEXT("Severity"), FString::FromInt(static_cast<int32>(DuplicateGeometryIssueSeverity)));
+	SMDuplicateGeometryRule.Parameters.Add(TEXT("DetectTransformed"), bDetectTransformedDuplicates ? TEXT("true") : TEXT("false"));
+	SMDuplicateGeometryRule.Parameters.Add(TEXT("AllowAutoFix"), bAllowDuplicateGeometryAutoFix ? TEXT("true") : TEXT("false"));
+	ActiveProfile->SetRuleConfig(SMDuplicateGeometryRule);
+
+	// Near-Duplicate Geometry Rule configuration
+	FPipelineGuardianRuleConfig SMNearDuplicateRule;
+	SMNearDuplicateRule.RuleID = TEXT("SM_NearDuplicateGeometry");
+	SMNearDuplicateRule.bEnabled = bEnableStaticMeshNearDuplicateRule;
+	SMNearDuplicateRule.Parameters.Add(TEXT("Severity"), FString::FromInt(static_cast<int32>(NearDuplicateIssueSeverity)));
+	SMNearDuplicateRule.Parameters.Add(TEXT("MinSimilarity"), FString::SanitizeFloat(NearDuplicateMinSimilarity));
+	ActiveProfile->SetRuleConfig(SMNearDuplicateRule);
+
+	// Draw Call Rule configuration
+	FPipelineGuardianRuleConfig SMDrawCallRule;
+	SMDrawCallRule.RuleID = TEXT("SM_DrawCallCost");
+	SMDrawCallRule.bEnabled = bEnableStaticMeshDrawCallRule;
+	SMDrawCallRule.Parameters.Add(TEXT("Severity"), FString::FromInt(static_cast<int32>(DrawCallIssueSeverity)));
+	SMDrawCallRule.Parameters.Add(TEXT("MaxDrawCallsPerInstance"), FString::FromInt(MaxDrawCallsPerInstance));
+	SMDrawCallRule.Parameters.Add(TEXT("ShadowPasses"), FString::FromInt(DrawCallShadowPasses));
+	SMDrawCallRule.Parameters.Add(TEXT("TinySectionMaxTriangles"), FString::FromInt(TinySectionMaxTriangles));
+	SMDrawCallRule.Parameters.Add(TEXT("TinySectionMaxAreaPercent"), FString::SanitizeFloat(TinySectionMaxAreaPercent));
+	SMDrawCallRule.Parameters.Add(TEXT("AllowAutoFix"), bAllowDrawCallAutoFix ? TEXT("true") : TEXT("false"));
+	ActiveProfile->SetRuleConfig(SMDrawCallRule);
+
 	// Socket Naming Rule configuration
 	FPipelineGuardianRuleConfig SMSocketNamingRule;
 	SMSocketNamingRule.RuleID = TEXT("SM_SocketNaming");
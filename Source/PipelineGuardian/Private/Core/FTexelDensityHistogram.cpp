@@ -0,0 +1,292 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Core/FTexelDensityHistogram.h"
+#include "PipelineGuardian.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Dom/JsonObject.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Modules/ModuleManager.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace TexelDensityHistogram
+{
+	/** @return The saved hash the asset registry holds for a package, or an empty string if it has none. */
+	FString GetPackageSavedHash(const IAssetRegistry& AssetRegistry, FName PackageName)
+	{
+		const TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(PackageName);
+		return PackageData.IsSet() && !PackageData->GetPackageSavedHash().IsZero() ? LexToString(PackageData->GetPackageSavedHash()) : FString();
+	}
+}
+
+FTexelDensityHistogram& FTexelDensityHistogram::Get()
+{
+	static FTexelDensityHistogram Instance;
+	return Instance;
+}
+
+void FTexelDensityHistogram::Begin(const FString& InFilePath)
+{
+	{
+		FScopeLock Lock(&Mutex);
+		Entries.Reset();
+		RecordedAssets.Reset();
+		FilePath = InFilePath;
+	}
+
+	if (!FilePath.IsEmpty() && FPaths::FileExists(FilePath))
+	{
+		AddFromFile(FilePath);
+	}
+	bCollecting = true;
+}
+
+void FTexelDensityHistogram::End()
+{
+	if (!IsCollecting())
+	{
+		return;
+	}
+	bCollecting = false;
+
+	// Later runs tell from the hash whether a mesh they did not analyze again has changed since
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+	{
+		FScopeLock Lock(&Mutex);
+		for (const FSoftObjectPath& AssetPath : RecordedAssets)
+		{
+			if (FTexelDensityEntry* Entry = Entries.Find(AssetPath))
+			{
+				Entry->PackageSavedHash = TexelDensityHistogram::GetPackageSavedHash(AssetRegistry, AssetPath.GetLongPackageFName());
+			}
+		}
+		RecordedAssets.Reset();
+	}
+
+	if (FilePath.IsEmpty())
+	{
+		return;
+	}
+
+	FString OutputString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	FJsonSerializer::Serialize(MeshesToJson(), Writer);
+	if (!FFileHelper::SaveStringToFile(OutputString, *FilePath))
+	{
+		UE_LOG(LogPipelineGuardian, Warning, TEXT("FTexelDensityHistogram: Failed to write %s"), *FilePath);
+	}
+}
+
+void FTexelDensityHistogram::Record(const FSoftObjectPath& AssetPath, float TexelsPerUnit, double WorldArea)
+{
+	if (!IsCollecting())
+	{
+		return;
+	}
+
+	FScopeLock Lock(&Mutex);
+	if (TexelsPerUnit <= 0.0f)
+	{
+		Entries.Remove(AssetPath);
+		return;
+	}
+
+	FTexelDensityEntry& Entry = Entries.FindOrAdd(AssetPath);
+	Entry.TexelsPerUnit = TexelsPerUnit;
+	Entry.WorldArea = WorldArea;
+	RecordedAssets.Add(AssetPath);
+}
+
+bool FTexelDensityHistogram::AddFromFile(const FString& InFilePath)
+{
+	FString JsonString;
+	TSharedPtr<FJsonObject> RootObject;
+	if (!FFileHelper::LoadFileToString(JsonString, *InFilePath)
+		|| !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(JsonString), RootObject)
+		|| !RootObject.IsValid())
+	{
+		UE_LOG(LogPipelineGuardian, Warning, TEXT("FTexelDensityHistogram: Could not read %s"), *InFilePath);
+		return false;
+	}
+
+	int32 Version = 0;
+	const TArray<TSharedPtr<FJsonValue>>* MeshValues = nullptr;
+	if (!RootObject->TryGetNumberField(TEXT("Version"), Version) || Version != FormatVersion || !RootObject->TryGetArrayField(TEXT("Meshes"), MeshValues))
+	{
+		UE_LOG(LogPipelineGuardian, Log, TEXT("FTexelDensityHistogram: Ignoring meshes of a different format version"));
+		return true;
+	}
+
+	FScopeLock Lock(&Mutex);
+	for (const TSharedPtr<FJsonValue>& MeshValue : *MeshValues)
+	{
+		const TSharedPtr<FJsonObject>* MeshObject = nullptr;
+		if (!MeshValue->TryGetObject(MeshObject))
+		{
+			continue;
+		}
+
+		FTexelDensityEntry Entry;
+		Entry.TexelsPerUnit = static_cast<float>((*MeshObject)->GetNumberField(TEXT("TexelsPerUnit")));
+		Entry.WorldArea = (*MeshObject)->GetNumberField(TEXT("WorldArea"));
+		(*MeshObject)->TryGetStringField(TEXT("PackageHash"), Entry.PackageSavedHash);
+		if (Entry.TexelsPerUnit > 0.0f)
+		{
+			Entries.Add(FSoftObjectPath((*MeshObject)->GetStringField(TEXT("Asset"))), MoveTemp(Entry));
+		}
+	}
+	return true;
+}
+
+void FTexelDensityHistogram::GetBins(FBin (&OutBins)[NumBins]) const
+{
+	TArray<TPair<FSoftObjectPath, FTexelDensityEntry>> EntriesCopy;
+	{
+		FScopeLock Lock(&Mutex);
+		EntriesCopy = Entries.Array();
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+	for (const TPair<FSoftObjectPath, FTexelDensityEntry>& Pair : EntriesCopy)
+	{
+		const FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(Pair.Key);
+		if (!AssetData.IsValid())
+		{
+			continue;
+		}
+
+		// Saved since it was recorded, by someone who did not analyze it again
+		if (!Pair.Value.PackageSavedHash.IsEmpty())
+		{
+			const FString CurrentHash = TexelDensityHistogram::GetPackageSavedHash(AssetRegistry, AssetData.PackageName);
+			if (!CurrentHash.IsEmpty() && CurrentHash != Pair.Value.PackageSavedHash)
+			{
+				continue;
+			}
+		}
+
+		const int32 BinIndex = FMath::Clamp(FMath::FloorToInt(FMath::Log2(Pair.Value.TexelsPerUnit)) - MinExponent, 0, NumBins - 1);
+		++OutBins[BinIndex].NumMeshes;
+		OutBins[BinIndex].WorldArea += Pair.Value.WorldArea;
+	}
+}
+
+void FTexelDensityHistogram::LogSummary() const
+{
+	FBin Bins[NumBins];
+	GetBins(Bins);
+
+	int32 TotalMeshes = 0;
+	double TotalWorldArea = 0.0;
+	for (const FBin& Bin : Bins)
+	{
+		TotalMeshes += Bin.NumMeshes;
+		TotalWorldArea += Bin.WorldArea;
+	}
+
+	if (TotalMeshes == 0)
+	{
+		return;
+	}
+
+	// Bars are scaled to the fullest bin
+	constexpr int32 BarWidth = 40;
+	int32 MaxMeshes = 0;
+	for (const FBin& Bin : Bins)
+	{
+		MaxMeshes = FMath::Max(MaxMeshes, Bin.NumMeshes);
+	}
+
+	UE_LOG(LogPipelineGuardian, Log, TEXT("Texel density of %d meshes (texels per unit):"), TotalMeshes);
+	UE_LOG(LogPipelineGuardian, Log, TEXT("  %20s %8s %8s %8s"), TEXT("Density"), TEXT("Meshes"), TEXT("Mesh %"), TEXT("Area %"));
+	for (int32 BinIndex = 0; BinIndex < NumBins; ++BinIndex)
+	{
+		const FBin& Bin = Bins[BinIndex];
+		const FString Range = FString::Printf(TEXT("%s%g - %s%g"), BinIndex == 0 ? TEXT("<") : TEXT(""), GetBinMin(BinIndex),
+			BinIndex == NumBins - 1 ? TEXT(">") : TEXT(""), GetBinMin(BinIndex + 1));
+		UE_LOG(LogPipelineGuardian, Log, TEXT("  %20s %8d %7.1f%% %7.1f%%  %s"), *Range, Bin.NumMeshes,
+			100.0 * Bin.NumMeshes / TotalMeshes, TotalWorldArea > 0.0 ? 100.0 * Bin.WorldArea / TotalWorldArea : 0.0,
+			*FString::ChrN(FMath::DivideAndRoundUp(Bin.NumMeshes * BarWidth, MaxMeshes), TEXT('#')));
+	}
+}
+
+TSharedRef<FJsonObject> FTexelDensityHistogram::ToJson() const
+{
+	FBin Bins[NumBins];
+	GetBins(Bins);
+
+	TSharedRef<FJsonObject> RootObject = MakeShared<FJsonObject>();
+	int32 TotalMeshes = 0;
+	TArray<TSharedPtr<FJsonValue>> BinValues;
+	for (int32 BinIndex = 0; BinIndex < NumBins; ++BinIndex)
+	{
+		TSharedPtr<FJsonObject> BinObject = MakeShareable(new FJsonObject);
+		BinObject->SetNumberField(TEXT("MinTexelsPerUnit"), GetBinMin(BinIndex));
+		BinObject->SetNumberField(TEXT("MaxTexelsPerUnit"), GetBinMin(BinIndex + 1));
+		BinObject->SetNumberField(TEXT("Meshes"), Bins[BinIndex].NumMeshes);
+		BinObject->SetNumberField(TEXT("WorldArea"), Bins[BinIndex].WorldArea);
+		BinValues.Add(MakeShareable(new FJsonValueObject(BinObject)));
+		TotalMeshes += Bins[BinIndex].NumMeshes;
+	}
+	RootObject->SetNumberField(TEXT("Meshes"), TotalMeshes);
+	RootObject->SetArrayField(TEXT("Bins"), BinValues);
+
+	return RootObject;
+}
+
+TSharedRef<FJsonObject> FTexelDensityHistogram::MeshesToJson() const
+{
+	TSharedRef<FJsonObject> RootObject = MakeShared<FJsonObject>();
+	RootObject->SetNumberField(TEXT("Version"), FormatVersion);
+
+	FScopeLock Lock(&Mutex);
+	TArray<TSharedPtr<FJsonValue>> MeshValues;
+	MeshValues.Reserve(Entries.Num());
+	for (const TPair<FSoftObjectPath, FTexelDensityEntry>& Pair : Entries)
+	{
+		TSharedPtr<FJsonObject> MeshObject = MakeShareable(new FJsonObject);
+		MeshObject->SetStringField(TEXT("Asset"), Pair.Key.ToString());
+		MeshObject->SetNumberField(TEXT("TexelsPerUnit"), Pair.Value.TexelsPerUnit);
+		MeshObject->SetNumberField(TEXT("WorldArea"), Pair.Value.WorldArea);
+		MeshObject->SetStringField(TEXT("PackageHash"), Pair.Value.PackageSavedHash);
+		MeshValues.Add(MakeShareable(new FJsonValueObject(MeshObject)));
+	}
+	RootObject->SetArrayField(TEXT("Meshes"), MeshValues);
+
+	return RootObject;
+}
+
+bool FTexelDensityHistogram::SaveToFile(const FString& InFilePath) const
+{
+	FString OutputString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	FJsonSerializer::Serialize(ToJson(), Writer);
+
+	if (!FFileHelper::SaveStringToFile(OutputString, *InFilePath))
+	{
+		UE_LOG(LogPipelineGuardian, Warning, TEXT("FTexelDensityHistogram: Failed to write histogram to %s"), *InFilePath);
+		return false;
+	}
+
+	UE_LOG(LogPipelineGuardian, Log, TEXT("FTexelDensityHistogram: Wrote histogram to %s"), *InFilePath);
+	return true;
+}
+
+FString FTexelDensityHistogram::GetDefaultFilePath()
+{
+	return FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("PipelineGuardian") / TEXT("TexelDensity.json"));
+}
+
+FString FTexelDensityHistogram::GetDefaultMeshesFilePath()
+{
+	return FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("PipelineGuardian") / TEXT("TexelDensityMeshes.json"));
+}
+
+FString FTexelDensityHistogram::GetShardMeshesFilePath(int32 ShardIndex, int32 NumShards)
+{
+	return FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("PipelineGuardian") / FString::Printf(TEXT("TexelDensityMeshes_Shard%dof%d.json"), ShardIndex, NumShards));
+}
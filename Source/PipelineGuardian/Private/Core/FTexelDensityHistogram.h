@@ -0,0 +1,125 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/SoftObjectPath.h"
+#include <atomic>
+
+// Forward Declarations
+class FJsonObject;
+
+/** Texel density of one static mesh as recorded in the histogram */
+struct FTexelDensityEntry
+{
+	/** Surface-weighted texel density of the mesh */
+	float TexelsPerUnit = 0.0f;
+
+	/** Surface area the density was measured over, in world units squared */
+	double WorldArea = 0.0;
+
+	/** Saved hash of the package when the mesh was recorded; empty if the asset registry had none */
+	FString PackageSavedHash;
+};
+
+/**
+ * Project-wide distribution of static mesh texel densities, in octave bins.
+ * Filled by the texel density rule on worker threads, so recording is thread-safe; Begin(), End() and the reports belong to the game thread.
+ * The density of every mesh is kept in a file between runs, so meshes served from the analysis cache still count. Meshes
+ * that were deleted, or whose package was saved since they were recorded, are left out of the bins.
+ */
+class FTexelDensityHistogram
+{
+public:
+	/** Lower bound of the first bin is 2^MinExponent texels per unit; smaller densities are counted in the first bin */
+	static constexpr int32 MinExponent = -4;
+
+	/** Upper bound of the last bin is 2^MaxExponent texels per unit; larger densities are counted in the last bin */
+	static constexpr int32 MaxExponent = 8;
+
+	static constexpr int32 NumBins = MaxExponent - MinExponent;
+
+	/** @return The process-wide collector. */
+	static FTexelDensityHistogram& Get();
+
+	/**
+	 * Loads the meshes of earlier runs and starts recording.
+	 * @param InFilePath File to load the meshes from and to save them to on End(); empty keeps them in memory only.
+	 */
+	void Begin(const FString& InFilePath = GetDefaultMeshesFilePath());
+
+	/** Stops recording, stamps the meshes recorded since Begin() with their package hash and saves them; the bins stay available for the reports. */
+	void End();
+
+	/** @return True between Begin() and End(). */
+	bool IsCollecting() const { return bCollecting.load(std::memory_order_relaxed); }
+
+	/**
+	 * Records one mesh, replacing its earlier density.
+	 * @param AssetPath The mesh.
+	 * @param TexelsPerUnit Surface-weighted texel density of the mesh; 0 or less drops the mesh, e.g. when it has no measurable sections.
+	 * @param WorldArea Surface area the density was measured over, in world units squared.
+	 */
+	void Record(const FSoftObjectPath& AssetPath, float TexelsPerUnit, double WorldArea);
+
+	/**
+	 * Adds the meshes saved by another run, e.g. of a commandlet shard.
+	 * @param FilePath File written by End().
+	 * @return True if the file was read.
+	 */
+	bool AddFromFile(const FString& FilePath);
+
+	/** Logs the bins with the share of meshes and of surface area in each. */
+	void LogSummary() const;
+
+	/** @return The bins, as written by SaveToFile(). */
+	TSharedRef<FJsonObject> ToJson() const;
+
+	/**
+	 * Writes ToJson() to disk.
+	 * @param FilePath Absolute path of the file to write.
+	 * @return True if the file was written.
+	 */
+	bool SaveToFile(const FString& FilePath) const;
+
+	/** @return Default file for SaveToFile(), Saved/PipelineGuardian/TexelDensity.json. */
+	static FString GetDefaultFilePath();
+
+	/** @return Default file of the recorded meshes, Saved/PipelineGuardian/TexelDensityMeshes.json. */
+	static FString GetDefaultMeshesFilePath();
+
+	/** @return File of the recorded meshes of one commandlet shard; shards run concurrently, so each keeps its own. */
+	static FString GetShardMeshesFilePath(int32 ShardIndex, int32 NumShards);
+
+private:
+	struct FBin
+	{
+		int32 NumMeshes = 0;
+		double WorldArea = 0.0;
+	};
+
+	/** Bump when the entry layout changes; older files are discarded */
+	static constexpr int32 FormatVersion = 1;
+
+	/** @return Lower bound of a bin in texels per unit. */
+	static float GetBinMin(int32 BinIndex) { return FMath::Pow(2.0f, static_cast<float>(MinExponent + BinIndex)); }
+
+	/** Fills the bins from the meshes that still exist and have not been saved since they were recorded. Game thread only. */
+	void GetBins(FBin (&OutBins)[NumBins]) const;
+
+	/** @return The meshes, as written by End(). */
+	TSharedRef<FJsonObject> MeshesToJson() const;
+
+	mutable FCriticalSection Mutex;
+
+	TMap<FSoftObjectPath, FTexelDensityEntry> Entries;
+
+	/** Meshes recorded since Begin(), stamped with their package hash by End() */
+	TSet<FSoftObjectPath> RecordedAssets;
+
+	FString FilePath;
+
+	std::atomic<bool> bCollecting = false;
+};
@@ -17,6 +17,12 @@
 
 DEFINE_LOG_CATEGORY(LogPipelineGuardian);
 
+DEFINE_STAT(STAT_PipelineGuardian_AnalyzeBatch);
+DEFINE_STAT(STAT_PipelineGuardian_LoadAsset);
+DEFINE_STAT(STAT_PipelineGuardian_CreateSnapshot);
+DEFINE_STAT(STAT_PipelineGuardian_RuleCheck);
+DEFINE_STAT(STAT_PipelineGuardian_FixAction);
+
 static const FName PipelineGuardianTabName("PipelineGuardian");
 
 #define LOCTEXT_NAMESPACE "FPipelineGuardianModule"
@@ -24,6 +30,12 @@ static const FName PipelineGuardianTabName("PipelineGuardian");
 void FPipelineGuardianModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+
+	// Commandlets (see UPipelineGuardianCommandlet) have no UI to extend and must not rewrite the project config
+	if (IsRunningCommandlet())
+	{
+		return;
+	}
 	
 	FPipelineGuardianStyle::Initialize();
 	FPipelineGuardianStyle::ReloadTextures();
@@ -68,6 +80,11 @@ void FPipelineGuardianModule::ShutdownModule()
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
 
+	if (IsRunningCommandlet())
+	{
+		return;
+	}
+
 	UToolMenus::UnRegisterStartupCallback(this);
 
 	UToolMenus::UnregisterOwner(this);
@@ -13,6 +13,7 @@
 #include "AssetRegistry/AssetData.h"
 #include "PipelineGuardian.h"
 #include "Misc/MessageDialog.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 #define LOCTEXT_NAMESPACE "SPipelineGuardianReportView"
 
@@ -84,6 +85,16 @@ void SPipelineGuardianReportView::Construct(const FArguments& InArgs)
                     .Text(this, &SPipelineGuardianReportView::GetSeverityFilterText)
                 ]
             ]
+            // Memory totals of the displayed results, per rule
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .VAlign(VAlign_Center)
+            .Padding(15.f, 0.f, 5.f, 0.f)
+            [
+                SNew(STextBlock)
+                .Text(this, &SPipelineGuardianReportView::GetDisplayedMemoryText)
+                .ToolTipText(LOCTEXT("MemoryTotalTooltip", "Memory the visible issues account for, totaled per rule. Rules measure different things (a mesh's footprint, the memory merging duplicates would reclaim, the combined memory of a cluster), so their totals are not added up."))
+            ]
             // Spacer
             + SHorizontalBox::Slot()
             .FillWidth(1.0f)
@@ -132,6 +143,9 @@ void SPipelineGuardianReportView::Construct(const FArguments& InArgs)
                 + SHeaderRow::Column("AssetName").DefaultLabel(LOCTEXT("AssetNameHeader", "Asset Name")).FillWidth(0.25f)
                 + SHeaderRow::Column("IssueDescription").DefaultLabel(LOCTEXT("IssueDescriptionHeader", "Description")).FillWidth(0.5f)
                 + SHeaderRow::Column("Severity").DefaultLabel(LOCTEXT("SeverityHeader", "Severity")).FillWidth(0.15f)
+                + SHeaderRow::Column("Memory").DefaultLabel(LOCTEXT("MemoryHeader", "Memory")).FillWidth(0.1f)
+                    .SortMode(this, &SPipelineGuardianReportView::GetMemorySortMode)
+                    .OnSort(this, &SPipelineGuardianReportView::OnMemorySortModeChanged)
                 + SHeaderRow::Column("Actions").DefaultLabel(LOCTEXT("ActionsHeader", "Actions")).FixedWidth(80.f)
             )
         ]
@@ -233,6 +247,8 @@ void SPipelineGuardianReportView::ExecuteFixesAndRefresh(const TArray<TSharedPtr
         {
             if (Result.IsValid() && Result->FixAction.IsBound())
             {
+                SCOPE_CYCLE_COUNTER(STAT_PipelineGuardian_FixAction);
+                TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*FString::Printf(TEXT("Fix %s"), *Result->RuleID.ToString()));
                 Result->FixAction.ExecuteIfBound();
                 SuccessCount++;
             }
@@ -377,6 +393,16 @@ void SPipelineGuardianReportView::ApplyFilters()
         }
     }
     
+    // Sort by memory if requested; equal entries keep analysis order
+    if (MemorySortMode != EColumnSortMode::None)
+    {
+        const bool bAscending = (MemorySortMode == EColumnSortMode::Ascending);
+        DisplayedResults.StableSort([bAscending](const TSharedPtr<FAssetAnalysisResult>& A, const TSharedPtr<FAssetAnalysisResult>& B)
+        {
+            return bAscending ? A->MemoryBytes < B->MemoryBytes : A->MemoryBytes > B->MemoryBytes;
+        });
+    }
+    
     // Refresh the list view
     if (ResultsListView.IsValid())
     {
@@ -384,6 +410,42 @@ void SPipelineGuardianReportView::ApplyFilters()
     }
 }
 
+EColumnSortMode::Type SPipelineGuardianReportView::GetMemorySortMode() const
+{
+    return MemorySortMode;
+}
+
+void SPipelineGuardianReportView::OnMemorySortModeChanged(EColumnSortPriority::Type SortPriority, const FName& ColumnId, EColumnSortMode::Type NewSortMode)
+{
+    MemorySortMode = NewSortMode;
+    ApplyFilters();
+}
+
+FText SPipelineGuardianReportView::GetDisplayedMemoryText() const
+{
+    // The same mesh can be counted by several rules, so only results of one rule are summed
+    TMap<FName, int64> BytesByRule;
+    for (const TSharedPtr<FAssetAnalysisResult>& Result : DisplayedResults)
+    {
+        if (Result.IsValid() && Result->MemoryBytes > 0)
+        {
+            BytesByRule.FindOrAdd(Result->RuleID) += Result->MemoryBytes;
+        }
+    }
+
+    if (BytesByRule.Num() == 0)
+    {
+        return FText::GetEmpty();
+    }
+
+    TArray<FText> RuleTotals;
+    for (const TPair<FName, int64>& RuleBytes : BytesByRule)
+    {
+        RuleTotals.Add(FText::Format(LOCTEXT("MemoryRuleTotal", "{0} {1}"), FText::FromName(RuleBytes.Key), FText::AsMemory(RuleBytes.Value)));
+    }
+    return FText::Format(LOCTEXT("MemoryTotal", "Memory: {0}"), FText::Join(LOCTEXT("MemoryRuleTotalSeparator", ", "), RuleTotals));
+}
+
 int32 SPipelineGuardianReportView::GetSelectedItemCount() const
 {
     int32 Count = 0;
@@ -500,6 +562,17 @@ TSharedRef<ITableRow> SPipelineGuardianReportView::OnGenerateRowForResultList(TS
                 .ColorAndOpacity(RowColor)
                 .Font(FCoreStyle::GetDefaultFontStyle("Bold", 9))
             ]
+            // Memory
+            + SHorizontalBox::Slot()
+            .FillWidth(0.1f)
+            .Padding(10.f, 0.f)
+            .VAlign(VAlign_Center)
+            .HAlign(HAlign_Right)
+            [
+                SNew(STextBlock)
+                .Text(Item->MemoryBytes > 0 ? FText::AsMemory(Item->MemoryBytes) : FText::GetEmpty())
+                .ColorAndOpacity(RowColor)
+            ]
             // Individual Fix Button
             + SHorizontalBox::Slot()
             .AutoWidth()
@@ -3,11 +3,22 @@
 #include "UI/SPipelineGuardianWindow.h"
 #include "Core/FAssetScanner.h" 
 #include "Core/FAssetScanTask.h"
+#include "Core/FAssetAnalysisScheduler.h"
+#include "Core/FAssetStreamingLoader.h"
+#include "Core/FAssetAnalysisCache.h"
+#include "Core/FAnalysisTimingStats.h"
+#include "Core/FTexelDensityHistogram.h"
+#include "Core/FDuplicateGeometryIndex.h"
+#include "Analysis/Rules/StaticMesh/FStaticMeshDuplicateGeometryRule.h"
+#include "Analysis/Rules/StaticMesh/FStaticMeshNearDuplicateRule.h"
+#include "Core/FAssetMemoryGovernor.h"
 #include "UI/SPipelineGuardianReportView.h" 
 #include "Widgets/SBoxPanel.h"
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/Input/SButton.h"
 #include "Widgets/Images/SThrobber.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Notifications/SProgressBar.h"
 #include "Misc/MessageDialog.h"
 #include "PipelineGuardian.h"
 #include "FPipelineGuardianSettings.h"
@@ -27,7 +38,6 @@
 #include "Async/TaskGraphInterfaces.h" // For AsyncTask
 #include "Misc/ScopedSlowTask.h" // For progress dialog
 #include "Framework/Application/SlateApplication.h" // For PumpMessages
-#include "Analysis/AssetTypeAnalyzers/FStaticMeshAnalyzer.h" // For static mesh analysis
 #include "Engine/StaticMesh.h" // For UStaticMesh::StaticClass()
 
 #define LOCTEXT_NAMESPACE "SPipelineGuardianWindow"
@@ -112,6 +122,30 @@ void SPipelineGuardianWindow::Construct(const FArguments& InArgs)
 				SAssignNew(StatusTextBlock, STextBlock)
 				.Text(LOCTEXT("ReadyStatus", "Ready."))
 			]
+			// Inline progress and cancel for time-sliced analysis
+			+SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(5.f, 0.f)
+			[
+				SNew(SBox)
+				.WidthOverride(200.f)
+				.Visibility(this, &SPipelineGuardianWindow::GetTimeSlicedAnalysisControlsVisibility)
+				[
+					SNew(SProgressBar)
+					.Percent(this, &SPipelineGuardianWindow::GetTimeSlicedAnalysisProgress)
+				]
+			]
+			+SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("CancelAnalysisButton", "Cancel"))
+				.ToolTipText(LOCTEXT("CancelAnalysisButton_Tooltip", "Stops the running analysis and shows the issues found so far."))
+				.OnClicked(this, &SPipelineGuardianWindow::OnCancelAnalysisClicked)
+				.Visibility(this, &SPipelineGuardianWindow::GetTimeSlicedAnalysisControlsVisibility)
+			]
 		]
 		// Report View Area
 		+ SVerticalBox::Slot()
@@ -140,15 +174,52 @@ void SPipelineGuardianWindow::RegisterAssetAnalyzers()
 		return;
 	}
 
-	// Register Static Mesh Analyzer
-	TSharedPtr<FStaticMeshAnalyzer> StaticMeshAnalyzer = MakeShared<FStaticMeshAnalyzer>();
-	AssetScanner->RegisterAssetAnalyzer(UStaticMesh::StaticClass(), StaticMeshAnalyzer);
+	AssetScanner->RegisterDefaultAnalyzers();
 
 	UE_LOG(LogPipelineGuardian, Log, TEXT("SPipelineGuardianWindow: Registered asset analyzers"));
 }
 
+// Ends the timing, texel density and duplicate geometry collection started by CreateAnalysisScheduler(), logs the summaries and writes them next to the analysis cache
+static void ReportAnalysisStats()
+{
+	FAnalysisTimingStats& TimingStats = FAnalysisTimingStats::Get();
+	if (!TimingStats.IsCollecting())
+	{
+		return;
+	}
+
+	TimingStats.End();
+	TimingStats.LogSummary();
+	TimingStats.SaveToFile(FAnalysisTimingStats::GetDefaultFilePath());
+
+	FTexelDensityHistogram& TexelDensityHistogram = FTexelDensityHistogram::Get();
+	TexelDensityHistogram.End();
+	TexelDensityHistogram.LogSummary();
+	TexelDensityHistogram.SaveToFile(FTexelDensityHistogram::GetDefaultFilePath());
+
+	FDuplicateGeometryIndex::Get().End();
+}
+
 SPipelineGuardianWindow::~SPipelineGuardianWindow()
 {
+	if (AnalysisTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(AnalysisTickerHandle);
+		AnalysisTickerHandle.Reset();
+	}
+
+	// Closing the tab mid-scan stops the analysis; what was analyzed so far stays in the cache
+	if (TimeSlicedAnalysis.IsValid())
+	{
+		TimeSlicedAnalysis->Scheduler->CancelBatch();
+		TimeSlicedAnalysis->Scheduler.Reset();
+		if (TimeSlicedAnalysis->AnalysisCache.IsValid())
+		{
+			TimeSlicedAnalysis->AnalysisCache->Save();
+		}
+		TimeSlicedAnalysis.Reset();
+		ReportAnalysisStats();
+	}
 }
 
 void SPipelineGuardianWindow::SetAnalysisInProgress(bool bInProgress, const FText& StatusMessage)
@@ -258,43 +329,70 @@ void SPipelineGuardianWindow::OnAssetScanPhaseComplete(
 			SetAnalysisInProgress(true, FText::Format(LOCTEXT("GTPhase_PreDiscoveredLoad", "Starting detailed analysis of {0} assets..."), AssetsToActuallyAnalyze.Num()));
 		}
 		
+		if (AssetsToActuallyAnalyze.Num() > 0 && Settings->bEnableTimeSlicedAnalysis)
+		{
+			// Analysis continues on the core ticker within a per-frame budget; results are shown when it finishes
+			StartTimeSlicedAnalysis(MoveTemp(AssetsToActuallyAnalyze), TaskCompletionMessage);
+			return;
+		}
+
 		TArray<FAssetAnalysisResult> FinalResults;
 		if (AssetsToActuallyAnalyze.Num() > 0)
 		{
+			// Assets are loaded on the game thread in batches; rule evaluation for each batch is spread across worker threads.
+			// With async loading enabled, the next batch is streamed in while the current one is analyzed.
+			const UPipelineGuardianProfile* ActiveProfile = Settings->GetActiveProfile();
+			TSharedPtr<FAssetAnalysisCache> AnalysisCache;
+			TUniquePtr<FAssetAnalysisScheduler> AnalysisScheduler = CreateAnalysisScheduler(Settings, ActiveProfile, AnalysisCache);
+			const int32 BatchSize = FMath::Max(1, Settings->AnalysisBatchSize);
+			const int32 TotalAssets = AssetsToActuallyAnalyze.Num();
+			const TConstArrayView<FAssetData> AllAssets(AssetsToActuallyAnalyze);
+
 			// Show a progress dialog to inform user about the analysis process
-			FText ProgressTitle = LOCTEXT("AnalysisProgressTitle", "Analyzing Assets");
 			FText ProgressMessage = FText::Format(LOCTEXT("AnalysisProgressMessage", 
-				"Analyzing {0} assets...\n\nThis process may take some time as each asset needs to be loaded and checked.\nThe editor may appear unresponsive during this process, but it is working normally."), 
-				AssetsToActuallyAnalyze.Num());
+				"Analyzing {0} assets on {1} thread(s)...\n\nThis process may take some time as each asset needs to be loaded and checked."), 
+				TotalAssets, AnalysisScheduler->GetConcurrency());
 			
 			// Create a slow task scope to show progress and allow cancellation
-			FScopedSlowTask SlowTask(AssetsToActuallyAnalyze.Num(), ProgressMessage);
+			FScopedSlowTask SlowTask(TotalAssets, ProgressMessage);
 			SlowTask.MakeDialog(true); // true = allow cancellation
 			
 			int32 ProcessedCount = 0;
-			for (const FAssetData& AssetData : AssetsToActuallyAnalyze)
+			AnalysisScheduler->PrefetchBatch(AllAssets.Slice(0, FMath::Min(BatchSize, TotalAssets)), ActiveProfile);
+			while (ProcessedCount < TotalAssets)
 			{
 				// Check if user cancelled
 				if (SlowTask.ShouldCancel())
 				{
 					FinalOperationSummaryMessage = FText::Format(LOCTEXT("AnalysisCancelledByUser", "Analysis cancelled by user. Processed {0} of {1} assets."), 
-						ProcessedCount, AssetsToActuallyAnalyze.Num());
+						ProcessedCount, TotalAssets);
 					break;
 				}
 				
+				const int32 BatchCount = FMath::Min(BatchSize, TotalAssets - ProcessedCount);
+				
 				// Update progress
-				SlowTask.EnterProgressFrame(1.0f, FText::Format(LOCTEXT("AnalyzingAssetProgress", "Analyzing: {0}"), 
-					FText::FromName(AssetData.AssetName)));
+				SlowTask.EnterProgressFrame(static_cast<float>(BatchCount), FText::Format(LOCTEXT("AnalyzingBatchProgress", "Analyzing assets {0}-{1} of {2}"), 
+					ProcessedCount + 1, ProcessedCount + BatchCount, TotalAssets));
 				
-				AssetScanner->AnalyzeSingleAsset(AssetData, Settings, FinalResults);
-				ProcessedCount++;
+				// Queue the following batch behind this one so its loads overlap with this batch's analysis
+				const int32 NextBatchStart = ProcessedCount + BatchCount;
+				AnalysisScheduler->PrefetchBatch(AllAssets.Slice(NextBatchStart, FMath::Min(BatchSize, TotalAssets - NextBatchStart)), ActiveProfile);
+
+				AnalysisScheduler->AnalyzeBatch(AllAssets.Slice(ProcessedCount, BatchCount), ActiveProfile, FinalResults);
+				ProcessedCount += BatchCount;
 				
-				// Periodically allow UI updates (every 10 assets)
-				if (ProcessedCount % 10 == 0)
-				{
-					FSlateApplication::Get().PumpMessages();
-				}
+				// Allow UI updates between batches
+				FSlateApplication::Get().PumpMessages();
+			}
+
+			if (AnalysisCache.IsValid())
+			{
+				// Keep whatever was analyzed, even if the user cancelled part way
+				AnalysisCache->Save();
+				UE_LOG(LogPipelineGuardian, Log, TEXT("Analysis cache: %d hits, %d misses"), AnalysisCache->GetNumHits(), AnalysisCache->GetNumMisses());
 			}
+			ReportAnalysisStats();
 		}
 		else if (CompletedScanMode == EAssetScanMode::Project || CompletedScanMode == EAssetScanMode::SelectedFolders)
 		{ 
@@ -302,17 +400,204 @@ void SPipelineGuardianWindow::OnAssetScanPhaseComplete(
 			FinalOperationSummaryMessage = FText::Format(LOCTEXT("NoAssetsFoundAfterGTDiscovery", "{0} No assets found to analyze after detailed scan."), FinalOperationSummaryMessage);
 		}
 
-		ReportView->SetResults(ConvertResultsToSharedPointers(FinalResults));
-		FText OverallCompletionStatus = FText::Format(LOCTEXT("AnalysisFullyCompleteWithDetailsFmt", "{0} Analysis complete. Analyzed {1} assets. {2} issues found."), 
-			TaskCompletionMessage, // Original high-level message from task
-			AssetsToActuallyAnalyze.Num(), 
-			FinalResults.Num()
-		);
-		SetAnalysisInProgress(false, OverallCompletionStatus);
-		UE_LOG(LogPipelineGuardian, Log, TEXT("Analysis fully complete. Final issues: %d"), FinalResults.Num());
+		ShowAnalysisResults(FinalResults, AssetsToActuallyAnalyze, TaskCompletionMessage);
 	});
 }
 
+TUniquePtr<FAssetAnalysisScheduler> SPipelineGuardianWindow::CreateAnalysisScheduler(const UPipelineGuardianSettings* Settings, const UPipelineGuardianProfile* ActiveProfile, TSharedPtr<FAssetAnalysisCache>& OutAnalysisCache) const
+{
+	TSharedPtr<FAssetStreamingLoader> StreamingLoader;
+	if (Settings->bEnableAsyncAssetLoading)
+	{
+		StreamingLoader = MakeShared<FAssetStreamingLoader>(Settings->AsyncLoadMaxInFlight, Settings->AsyncLoadMemoryCeilingMB);
+	}
+
+	// Unchanged assets are answered from the on-disk cache instead of being loaded again
+	OutAnalysisCache.Reset();
+	if (Settings->bEnableAnalysisCache)
+	{
+		OutAnalysisCache = MakeShared<FAssetAnalysisCache>();
+		OutAnalysisCache->Load();
+		OutAnalysisCache->BeginRun(ActiveProfile, Settings);
+	}
+
+	// Mesh descriptions and packages pulled in by the scan are released again so memory stays bounded
+	TSharedPtr<FAssetMemoryGovernor> MemoryGovernor;
+	if (Settings->bEnableMemoryGovernor)
+	{
+		MemoryGovernor = MakeShared<FAssetMemoryGovernor>(Settings->ScanMemoryBudgetMB);
+	}
+
+	// Rule, load and snapshot timings, the texel density histogram and the geometry hashes of this run; reported by ReportAnalysisStats() when it ends
+	FAnalysisTimingStats::Get().Begin();
+	FTexelDensityHistogram::Get().Begin();
+	FDuplicateGeometryIndex::Get().Begin();
+
+	return MakeUnique<FAssetAnalysisScheduler>(AssetScanner, Settings->AnalysisMaxConcurrency, StreamingLoader, OutAnalysisCache, MemoryGovernor);
+}
+
+void SPipelineGuardianWindow::ShowAnalysisResults(const TArray<FAssetAnalysisResult>& AssetResults, const TArray<FAssetData>& AnalyzedAssets, const FText& TaskCompletionMessage)
+{
+	TSet<FSoftObjectPath> ScannedAssets;
+	ScannedAssets.Reserve(AnalyzedAssets.Num());
+	for (const FAssetData& AssetData : AnalyzedAssets)
+	{
+		ScannedAssets.Add(AssetData.GetSoftObjectPath());
+	}
+
+	// Duplicate groups and near-duplicate clusters span assets, so they are only known once the whole run is done
+	TArray<FAssetAnalysisResult> Results(AssetResults);
+	FStaticMeshDuplicateGeometryRule::AppendGroupResults(ScannedAssets, Results);
+	FStaticMeshNearDuplicateRule::AppendClusterResults(ScannedAssets, Results);
+
+	ReportView->SetResults(ConvertResultsToSharedPointers(Results));
+	FText OverallCompletionStatus = FText::Format(LOCTEXT("AnalysisFullyCompleteWithDetailsFmt", "{0} Analysis complete. Analyzed {1} assets. {2} issues found."), 
+		TaskCompletionMessage, // Original high-level message from task
+		AnalyzedAssets.Num(), 
+		Results.Num()
+	);
+	SetAnalysisInProgress(false, OverallCompletionStatus);
+	UE_LOG(LogPipelineGuardian, Log, TEXT("Analysis fully complete. Final issues: %d"), Results.Num());
+}
+
+void SPipelineGuardianWindow::StartTimeSlicedAnalysis(TArray<FAssetData>&& Assets, const FText& TaskCompletionMessage)
+{
+	const UPipelineGuardianSettings* Settings = GetDefault<UPipelineGuardianSettings>();
+
+	TimeSlicedAnalysis = MakeUnique<FTimeSlicedAnalysis>();
+	TimeSlicedAnalysis->Assets = MoveTemp(Assets);
+	TimeSlicedAnalysis->Profile = Settings->GetActiveProfile();
+	TimeSlicedAnalysis->Scheduler = CreateAnalysisScheduler(Settings, TimeSlicedAnalysis->Profile.Get(), TimeSlicedAnalysis->AnalysisCache);
+	TimeSlicedAnalysis->BatchSize = FMath::Max(1, Settings->AnalysisBatchSize);
+	TimeSlicedAnalysis->FrameBudgetSeconds = FMath::Max(1.0f, Settings->AnalysisFrameBudgetMs) / 1000.0;
+	TimeSlicedAnalysis->TaskCompletionMessage = TaskCompletionMessage;
+
+	SetAnalysisInProgress(true, FText::Format(LOCTEXT("TimeSlicedAnalysisStarted", "Analyzing {0} assets on {1} thread(s)..."),
+		TimeSlicedAnalysis->Assets.Num(), TimeSlicedAnalysis->Scheduler->GetConcurrency()));
+
+	AnalysisTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &SPipelineGuardianWindow::TickTimeSlicedAnalysis));
+}
+
+bool SPipelineGuardianWindow::TickTimeSlicedAnalysis(float DeltaTime)
+{
+	if (!TimeSlicedAnalysis.IsValid())
+	{
+		AnalysisTickerHandle.Reset();
+		return false;
+	}
+
+	FTimeSlicedAnalysis& Analysis = *TimeSlicedAnalysis;
+	const UPipelineGuardianProfile* Profile = Analysis.Profile.Get();
+	if (!Profile)
+	{
+		UE_LOG(LogPipelineGuardian, Warning, TEXT("SPipelineGuardianWindow: Active profile went away during analysis, stopping"));
+		AnalysisTickerHandle.Reset();
+		FinishTimeSlicedAnalysis(true);
+		return false;
+	}
+
+	const int32 TotalAssets = Analysis.Assets.Num();
+	const TConstArrayView<FAssetData> AllAssets(Analysis.Assets);
+	const double EndTime = FPlatformTime::Seconds() + Analysis.FrameBudgetSeconds;
+	do
+	{
+		if (!Analysis.Scheduler->IsBatchInProgress())
+		{
+			if (Analysis.ProcessedCount >= TotalAssets)
+			{
+				AnalysisTickerHandle.Reset();
+				FinishTimeSlicedAnalysis(false);
+				return false;
+			}
+
+			Analysis.CurrentBatchCount = FMath::Min(Analysis.BatchSize, TotalAssets - Analysis.ProcessedCount);
+			Analysis.Scheduler->BeginBatch(AllAssets.Slice(Analysis.ProcessedCount, Analysis.CurrentBatchCount), Profile);
+
+			// Queue the following batch behind this one so its loads overlap with this batch's analysis
+			const int32 NextBatchStart = Analysis.ProcessedCount + Analysis.CurrentBatchCount;
+			Analysis.Scheduler->PrefetchBatch(AllAssets.Slice(NextBatchStart, FMath::Min(Analysis.BatchSize, TotalAssets - NextBatchStart)), Profile);
+		}
+
+		if (!Analysis.Scheduler->TickBatch(FMath::Max(0.0, EndTime - FPlatformTime::Seconds()), Analysis.Results))
+		{
+			// Out of time, or waiting for loads or worker threads
+			break;
+		}
+		Analysis.ProcessedCount += Analysis.CurrentBatchCount;
+	}
+	while (FPlatformTime::Seconds() < EndTime);
+
+	if (StatusTextBlock.IsValid())
+	{
+		StatusTextBlock->SetText(FText::Format(LOCTEXT("TimeSlicedAnalysisProgress", "Analyzing assets: {0} of {1} done, {2} issues found so far..."),
+			Analysis.ProcessedCount, TotalAssets, Analysis.Results.Num()));
+	}
+
+	return true;
+}
+
+void SPipelineGuardianWindow::FinishTimeSlicedAnalysis(bool bCancelled)
+{
+	TUniquePtr<FTimeSlicedAnalysis> Analysis = MoveTemp(TimeSlicedAnalysis);
+	if (!Analysis.IsValid())
+	{
+		return;
+	}
+
+	// Cancelling waits for a running worker task; the scheduler releases every asset it still holds
+	Analysis->Scheduler->CancelBatch();
+	Analysis->Scheduler.Reset();
+
+	if (Analysis->AnalysisCache.IsValid())
+	{
+		// Keep whatever was analyzed, even if the user cancelled part way
+		Analysis->AnalysisCache->Save();
+		UE_LOG(LogPipelineGuardian, Log, TEXT("Analysis cache: %d hits, %d misses"), Analysis->AnalysisCache->GetNumHits(), Analysis->AnalysisCache->GetNumMisses());
+	}
+	ReportAnalysisStats();
+
+	if (!ReportView.IsValid())
+	{
+		return;
+	}
+
+	if (bCancelled)
+	{
+		ReportView->SetResults(ConvertResultsToSharedPointers(Analysis->Results));
+		SetAnalysisInProgress(false, FText::Format(LOCTEXT("TimeSlicedAnalysisCancelled", "Analysis cancelled. Processed {0} of {1} assets. {2} issues found."),
+			Analysis->ProcessedCount, Analysis->Assets.Num(), Analysis->Results.Num()));
+		UE_LOG(LogPipelineGuardian, Log, TEXT("Analysis cancelled after %d of %d assets. Issues: %d"), Analysis->ProcessedCount, Analysis->Assets.Num(), Analysis->Results.Num());
+		return;
+	}
+
+	ShowAnalysisResults(Analysis->Results, Analysis->Assets, Analysis->TaskCompletionMessage);
+}
+
+FReply SPipelineGuardianWindow::OnCancelAnalysisClicked()
+{
+	if (AnalysisTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(AnalysisTickerHandle);
+		AnalysisTickerHandle.Reset();
+	}
+	FinishTimeSlicedAnalysis(true);
+	return FReply::Handled();
+}
+
+TOptional<float> SPipelineGuardianWindow::GetTimeSlicedAnalysisProgress() const
+{
+	if (!TimeSlicedAnalysis.IsValid() || TimeSlicedAnalysis->Assets.Num() == 0)
+	{
+		return 0.0f;
+	}
+	return static_cast<float>(TimeSlicedAnalysis->ProcessedCount) / static_cast<float>(TimeSlicedAnalysis->Assets.Num());
+}
+
+EVisibility SPipelineGuardianWindow::GetTimeSlicedAnalysisControlsVisibility() const
+{
+	return TimeSlicedAnalysis.IsValid() ? EVisibility::Visible : EVisibility::Collapsed;
+}
+
 FReply SPipelineGuardianWindow::OnAnalyzeProjectClicked()
 {
 	if (bIsAnalysisInProgress) return FReply::Handled();
@@ -37,6 +37,13 @@ struct FAssetAnalysisResult
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AnalysisResult")
 	FText FilePath;
 
+	/**
+	 * Memory the issue accounts for, in bytes, so reports can sort and total results; 0 when the rule does not measure memory.
+	 * What is measured depends on the rule, and a mesh may be counted by several rules, so only results of the same rule can be totaled.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AnalysisResult")
+	int64 MemoryBytes;
+
 	// Not a UPROPERTY as FSimpleDelegate is not directly exposable to BP in this way
 	// and it's for C++ internal use primarily.
 	FSimpleDelegate FixAction;
@@ -44,6 +51,7 @@ struct FAssetAnalysisResult
 	FAssetAnalysisResult()
 		: Severity(EAssetIssueSeverity::Info)
 		, RuleID(NAME_None)
+		, MemoryBytes(0)
 	{
 	}
 
@@ -52,6 +60,7 @@ struct FAssetAnalysisResult
 		, Severity(InSeverity)
 		, RuleID(InRuleID)
 		, Description(InDescription)
+		, MemoryBytes(0)
 	{
 		if (Asset.IsValid())
 		{
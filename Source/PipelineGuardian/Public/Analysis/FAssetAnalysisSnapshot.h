@@ -0,0 +1,31 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+
+// Forward Declarations
+class UClass;
+
+/**
+ * Immutable copy of the data a set of rules needs from one asset.
+ * Created on the game thread by an IAssetAnalyzer; after creation it may be read from any thread.
+ * Asset-type analyzers derive from this to add their own data.
+ */
+struct PIPELINEGUARDIAN_API FAssetAnalysisSnapshot
+{
+	virtual ~FAssetAnalysisSnapshot() = default;
+
+	/** Asset the snapshot was taken from. Used to fill FAssetAnalysisResult::Asset. */
+	FAssetData AssetData;
+
+	/** Object name of the asset (e.g. SM_Rock_01) */
+	FString AssetName;
+
+	/** Long package name of the asset (e.g. /Game/Props/SM_Rock_01) */
+	FString PackageName;
+
+	/** Class of the snapshotted object. Used to validate downcasts to derived snapshot types. */
+	const UClass* AssetClass = nullptr;
+};
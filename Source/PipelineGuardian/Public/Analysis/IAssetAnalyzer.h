@@ -5,10 +5,26 @@
 #include "CoreMinimal.h"
 #include "AssetRegistry/AssetData.h" // For FAssetData parameter
 #include "Containers/Array.h"      // For TArray
+#include "Templates/SharedPointer.h"
 
 // Forward Declarations
 struct FAssetAnalysisResult;
+struct FAssetAnalysisSnapshot;
 class UPipelineGuardianProfile;
+class UObject;
+
+/**
+ * Which subset of an analyzer's rules to run on an already-loaded asset.
+ * The scheduler runs the WorkerThread pass in parallel and the GameThread pass serially afterwards.
+ */
+enum class EAssetAnalysisPass : uint8
+{
+	/** Rules that are safe to evaluate off the game thread */
+	WorkerThread,
+
+	/** Rules that must be evaluated on the game thread */
+	GameThread
+};
 
 /**
  * Interface for an asset analyzer, responsible for loading an asset (if needed)
@@ -26,4 +42,55 @@ public:
 	 * @param OutResults Array to populate with any issues found.
 	 */
 	virtual void AnalyzeAsset(const FAssetData& AssetData, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) = 0;
+
+	/**
+	 * Version of the results this analyzer produces. Cached results from a different version are discarded,
+	 * so implementations bump it whenever a rule changes what it reports.
+	 * @return The analyzer version.
+	 */
+	virtual int32 GetAnalyzerVersion() const { return 0; }
+
+	/**
+	 * Whether every rule this analyzer would run on the asset can be evaluated from its asset registry tags.
+	 * When true, callers skip loading the asset and call AnalyzeAssetData() instead of AnalyzeAsset().
+	 * @param AssetData The FAssetData of the asset.
+	 * @param Profile The current pipeline guardian profile containing rule configurations.
+	 * @return True if the asset does not need to be loaded.
+	 */
+	virtual bool CanAnalyzeWithoutLoading(const FAssetData& AssetData, const UPipelineGuardianProfile* Profile) const { return false; }
+
+	/**
+	 * Analyzes an asset from its FAssetData alone. Only called when CanAnalyzeWithoutLoading() returned true.
+	 * @param AssetData The FAssetData of the asset to analyze.
+	 * @param Profile The current pipeline guardian profile containing rule configurations.
+	 * @param OutResults Array to populate with any issues found.
+	 */
+	virtual void AnalyzeAssetData(const FAssetData& AssetData, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) {}
+
+	/**
+	 * Copies everything the analyzer's snapshot rules need out of a loaded asset. Game thread only.
+	 * @param AssetData The FAssetData of the asset.
+	 * @param AssetObject The loaded asset object.
+	 * @return The snapshot, or an invalid pointer if this analyzer does not use snapshots.
+	 */
+	virtual TSharedPtr<const FAssetAnalysisSnapshot> CreateSnapshot(const FAssetData& AssetData, UObject* AssetObject) const { return nullptr; }
+
+	/**
+	 * Runs one pass of the analyzer's rules on an asset that has already been loaded on the game thread.
+	 * The default implementation does all of its work in the GameThread pass via AnalyzeAsset(),
+	 * so analyzers that have not been made thread-aware keep their existing behavior.
+	 * @param AssetData The FAssetData of the asset to analyze.
+	 * @param AssetObject The loaded asset object. Kept alive by the caller for the duration of the call.
+	 * @param Snapshot The snapshot returned by CreateSnapshot(), if any.
+	 * @param Profile The current pipeline guardian profile containing rule configurations.
+	 * @param Pass Which subset of rules to run.
+	 * @param OutResults Array to populate with any issues found.
+	 */
+	virtual void AnalyzeLoadedAsset(const FAssetData& AssetData, UObject* AssetObject, const FAssetAnalysisSnapshot* Snapshot, const UPipelineGuardianProfile* Profile, EAssetAnalysisPass Pass, TArray<FAssetAnalysisResult>& OutResults)
+	{
+		if (Pass == EAssetAnalysisPass::GameThread)
+		{
+			AnalyzeAsset(AssetData, Profile, OutResults);
+		}
+	}
 }; 
\ No newline at end of file
@@ -7,6 +7,8 @@
 
 // Forward Declarations
 struct FAssetAnalysisResult;
+struct FAssetData;
+struct FAssetAnalysisSnapshot;
 class UPipelineGuardianProfile;
 class UObject;
 
@@ -16,7 +18,7 @@ public:
 	virtual ~IAssetCheckRule() = default;
 
 	/**
-	 * Performs the check on the given AssetObject.
+	 * Performs the check on the given AssetObject. Always called on the game thread, since the editor may change the asset at any time.
 	 * @param AssetObject The loaded UObject to check.
 	 * @param Profile The current pipeline guardian profile containing rule configurations.
 	 * @param OutResults Array to populate with any issues found.
@@ -35,4 +37,48 @@ public:
 	 * @return FText describing the rule.
 	 */
 	virtual FText GetRuleDescription() const = 0;
+
+	/**
+	 * Whether this rule implements CheckSnapshot(). Snapshot rules are evaluated off the game thread when the analyzer
+	 * provides a snapshot; otherwise the analyzer takes one on the game thread and shares it between them. They are the
+	 * only rules that run in the background. Check() takes a snapshot of its own, so it is only meant for checking one rule.
+	 * @return True if CheckSnapshot() is implemented.
+	 */
+	virtual bool SupportsSnapshot() const { return false; }
+
+	/**
+	 * Performs the check on an immutable snapshot extracted on the game thread.
+	 * May be called from any thread; implementations must not dereference UObjects reachable from the snapshot.
+	 * @param Snapshot The snapshot of the asset to check.
+	 * @param Profile The current pipeline guardian profile containing rule configurations.
+	 * @param OutResults Array to populate with any issues found.
+	 * @return True if any issues were found, false otherwise.
+	 */
+	virtual bool CheckSnapshot(const FAssetAnalysisSnapshot& Snapshot, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) { return false; }
+
+	/**
+	 * Whether this rule will do any work under the given profile and the current settings.
+	 * Used to decide whether an asset has to be loaded at all, so rules that cannot tell must return true.
+	 * @param Profile The current pipeline guardian profile containing rule configurations.
+	 * @return False only if Check() would return without inspecting the asset.
+	 */
+	virtual bool IsEnabled(const UPipelineGuardianProfile* Profile) const { return true; }
+
+	/**
+	 * Whether CheckAssetData() can evaluate this asset from its asset registry tags, without loading it.
+	 * Assets saved before a tag existed do not carry it, so this is decided per asset.
+	 * @param AssetData The FAssetData of the asset.
+	 * @return True if every tag the rule needs is present.
+	 */
+	virtual bool CanCheckAssetData(const FAssetData& AssetData) const { return false; }
+
+	/**
+	 * Performs the check using only the asset's FAssetData. Only called when CanCheckAssetData() returned true.
+	 * Fix actions must load the asset themselves when they run.
+	 * @param AssetData The FAssetData of the asset to check.
+	 * @param Profile The current pipeline guardian profile containing rule configurations.
+	 * @param OutResults Array to populate with any issues found.
+	 * @return True if any issues were found, false otherwise.
+	 */
+	virtual bool CheckAssetData(const FAssetData& AssetData, const UPipelineGuardianProfile* Profile, TArray<FAssetAnalysisResult>& OutResults) { return false; }
 }; 
\ No newline at end of file
@@ -49,6 +49,50 @@ public:
 	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Profile Management")
 	TArray<FSoftObjectPath> AvailableProfiles;
 
+	// ========================================
+	// Analysis Performance
+	// ========================================
+
+	/** Maximum number of assets whose rules are evaluated concurrently (0 = one per task graph worker) */
+	UPROPERTY(Config, EditAnywhere, Category = "Analysis Performance", meta = (ToolTip = "Maximum number of assets whose rules are evaluated at the same time on worker threads. 0 uses every available task graph worker; 1 analyzes serially.", ClampMin = "0", ClampMax = "64"))
+	int32 AnalysisMaxConcurrency;
+
+	/** Number of assets loaded on the game thread before their rules are evaluated in parallel */
+	UPROPERTY(Config, EditAnywhere, Category = "Analysis Performance", meta = (ToolTip = "Number of assets loaded per batch before rule evaluation is dispatched to worker threads. Larger batches use more cores but hold more assets in memory and update progress less often.", ClampMin = "1", ClampMax = "1024"))
+	int32 AnalysisBatchSize;
+
+	/** Stream assets in with asynchronous package loads ahead of the analyzer instead of loading each one synchronously */
+	UPROPERTY(Config, EditAnywhere, Category = "Analysis Performance", meta = (ToolTip = "Issue asynchronous package loads for upcoming assets while the current batch is analyzed, so disk I/O overlaps with rule evaluation."))
+	bool bEnableAsyncAssetLoading;
+
+	/** Maximum number of asynchronous package loads in flight at once */
+	UPROPERTY(Config, EditAnywhere, Category = "Analysis Performance", meta = (ToolTip = "Maximum number of asset loads requested ahead of the analyzer at the same time.", ClampMin = "1", ClampMax = "512", EditCondition = "bEnableAsyncAssetLoading"))
+	int32 AsyncLoadMaxInFlight;
+
+	/** Used physical memory (MB) above which no further assets are prefetched (0 = no limit) */
+	UPROPERTY(Config, EditAnywhere, Category = "Analysis Performance", meta = (ToolTip = "When the editor's used physical memory exceeds this many megabytes, upcoming assets are no longer prefetched and are only loaded when the analyzer reaches them. 0 disables the limit.", ClampMin = "0", EditCondition = "bEnableAsyncAssetLoading"))
+	int32 AsyncLoadMemoryCeilingMB;
+
+	/** Reuse results of unchanged assets from the on-disk cache in Saved/PipelineGuardian instead of loading them again */
+	UPROPERTY(Config, EditAnywhere, Category = "Analysis Performance", meta = (ToolTip = "Keep analysis results on disk and reuse them for assets whose package, analyzer version, profile and rule settings have not changed since the last scan. Cached assets are not loaded."))
+	bool bEnableAnalysisCache;
+
+	/** Release mesh descriptions and unload scanned packages to keep memory bounded during large scans */
+	UPROPERTY(Config, EditAnywhere, Category = "Analysis Performance", meta = (ToolTip = "Drop mesh descriptions loaded for analysis once each asset is done, and unload the clean packages loaded by the scan and collect garbage whenever memory use exceeds ScanMemoryBudgetMB."))
+	bool bEnableMemoryGovernor;
+
+	/** Used physical memory (MB) above which packages loaded by a scan are unloaded (0 = half of physical memory) */
+	UPROPERTY(Config, EditAnywhere, Category = "Analysis Performance", meta = (ToolTip = "When the editor's used physical memory exceeds this many megabytes after a batch, packages the scan loaded are unloaded and garbage is collected. 0 uses half of the machine's physical memory.", ClampMin = "0", EditCondition = "bEnableMemoryGovernor"))
+	int32 ScanMemoryBudgetMB;
+
+	/** Analyze in the background on the editor ticker instead of behind a modal progress dialog */
+	UPROPERTY(Config, EditAnywhere, Category = "Analysis Performance", meta = (ToolTip = "Run analysis from the editor ticker a slice at a time, with progress and cancel shown in the Pipeline Guardian window, so the editor stays usable during scans. When disabled, scans run behind a modal progress dialog, which is slightly faster."))
+	bool bEnableTimeSlicedAnalysis;
+
+	/** Game thread time (ms) the time-sliced analysis may use per editor frame */
+	UPROPERTY(Config, EditAnywhere, Category = "Analysis Performance", meta = (ToolTip = "Milliseconds of game thread time the time-sliced analysis may use each frame. Snapshot rules and asset loads run in the background and do not count against it.", ClampMin = "1.0", ClampMax = "100.0", EditCondition = "bEnableTimeSlicedAnalysis"))
+	float AnalysisFrameBudgetMs;
+
 	// ========================================
 	// Static Mesh Rules - Quick Settings (these modify the active profile)
 	// ========================================
@@ -150,11 +194,11 @@ public:
 	bool bCheckUVChannel3;
 
 	/** Overlap tolerance for texture UV channels */
-	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|UV Overlapping", meta = (ToolTip = "Tolerance for detecting UV overlaps in texture channels (smaller values = more strict)", ClampMin = "0.0001", ClampMax = "0.01"))
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|UV Overlapping", meta = (ToolTip = "Depth in UV units by which two triangles must interpenetrate to count as overlapping in texture channels; shared edges never count (smaller values = more strict)", ClampMin = "0.0001", ClampMax = "0.01"))
 	float TextureUVOverlapTolerance;
 
 	/** Overlap tolerance for lightmap UV channels */
-	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|UV Overlapping", meta = (ToolTip = "Tolerance for detecting UV overlaps in lightmap channels (smaller values = more strict)", ClampMin = "0.0001", ClampMax = "0.01"))
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|UV Overlapping", meta = (ToolTip = "Depth in UV units by which two triangles must interpenetrate to count as overlapping in lightmap channels; shared edges never count (smaller values = more strict)", ClampMin = "0.0001", ClampMax = "0.01"))
 	float LightmapUVOverlapTolerance;
 
 	/** Overlap percentage threshold for warnings on texture channels */
@@ -173,6 +217,14 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|UV Overlapping", meta = (ToolTip = "Percentage of overlapping surface area that triggers an error for lightmap channels", ClampMin = "0.5", ClampMax = "50.0"))
 	float LightmapUVOverlapErrorThreshold;
 
+	/** Measure UV overlaps in texels */
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|UV Overlapping", meta = (ToolTip = "Rasterize channels with overlapping triangles into a texel grid (the lightmap resolution for lightmap channels) and report the share of used texels that overlap. Overlaps thinner than a texel are ignored."))
+	bool bRasterizeUVOverlaps;
+
+	/** Raster resolution for texture UV channels */
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|UV Overlapping", meta = (ToolTip = "Texels per side used to rasterize texture (non-lightmap) UV channels; lightmap channels use the mesh's lightmap resolution", ClampMin = "16", ClampMax = "4096", EditCondition = "bRasterizeUVOverlaps"))
+	int32 TextureUVOverlapRasterResolution;
+
 	/** Note: Auto-fix removed - UV overlapping should be fixed in external tools like Blender for best quality */
 	// bool bAllowUVOverlapAutoFix; // Removed - use external UV tools instead
 
@@ -219,6 +271,14 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Degenerate Faces", meta = (ToolTip = "Error when percentage of degenerate faces exceeds this threshold", ClampMin = "1.0", ClampMax = "25.0"))
 	float DegenerateFacesErrorThreshold;
 
+	/** Area below which a triangle is degenerate */
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Degenerate Faces", meta = (ToolTip = "Triangles with three distinct vertices and at most this area (in square centimeters) count as zero-area faces", ClampMin = "0.0", ClampMax = "1.0"))
+	float DegenerateFacesMinArea;
+
+	/** Aspect ratio above which a triangle is a sliver */
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Degenerate Faces", meta = (ToolTip = "Triangles whose longest edge is more than this many times their height count as sliver faces. 0 disables sliver detection.", ClampMin = "0.0"))
+	float DegenerateFacesSliverAspectRatio;
+
 	/** Allow automatic removal of degenerate faces */
 	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Degenerate Faces", meta = (ToolTip = "Allow Pipeline Guardian to automatically remove degenerate faces when safe to do so"))
 	bool bAllowDegenerateFacesAutoFix;
@@ -336,6 +396,122 @@ public:
 	int32 LightmapResolutionMax;
 	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Lightmap Resolution", meta = (ToolTip = "Allow Pipeline Guardian to automatically set optimal lightmap resolution"))
 	bool bAllowLightmapResolutionAutoFix;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Lightmap Resolution", meta = (ToolTip = "Target lightmap texels per world unit along a surface. The smallest resolution at which a mesh's lightmap UV layout reaches this density is recommended, and is what auto-fix sets. 0 disables the density check.", ClampMin = "0.0", ClampMax = "10.0"))
+	float LightmapTargetTexelDensity;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Lightmap Resolution", meta = (ToolTip = "Report meshes whose lightmap resolution is more than this factor above or below the resolution recommended for the target texel density", ClampMin = "1.0", ClampMax = "16.0"))
+	float LightmapDensityTolerance;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Lightmap Resolution", meta = (ToolTip = "Report meshes whose lightmap UV charts cover less than this percentage of the lightmap's texels at its current resolution", ClampMin = "0.0", ClampMax = "100.0"))
+	float LightmapMinUtilization;
+
+	// --- Texel Density Rule Settings ---
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Texel Density", meta = (ToolTip = "Enable checking the texel density of static mesh sections: the texels per world unit the largest texture of each section's material gets along the surface. Analysis runs also write a project-wide texel density histogram to Saved/PipelineGuardian/TexelDensity.json."))
+	bool bEnableStaticMeshTexelDensityRule;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Texel Density", meta = (ToolTip = "Severity level assigned to texel density violations"))
+	EAssetIssueSeverity TexelDensityIssueSeverity;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Texel Density", meta = (ToolTip = "Project target texel density in texels per world unit (e.g. 5.12 = 512 texels per meter). 0 only collects the histogram.", ClampMin = "0.0", ClampMax = "256.0"))
+	float TargetTexelDensity;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Texel Density", meta = (ToolTip = "Report sections whose texel density is more than this factor above or below the target", ClampMin = "1.0", ClampMax = "16.0"))
+	float TexelDensityTolerance;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Texel Density", meta = (ToolTip = "UV channel the materials are mapped through", ClampMin = "0", ClampMax = "7"))
+	int32 TexelDensityUVChannel;
+
+	// --- Vertex Cache Rule Settings ---
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Vertex Cache", meta = (ToolTip = "Enable checking how well each LOD's index buffer reuses the GPU's post-transform vertex cache (ACMR/ATVR). Nanite meshes are skipped."))
+	bool bEnableStaticMeshVertexCacheRule;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Vertex Cache", meta = (ToolTip = "Severity level assigned to vertex cache violations"))
+	EAssetIssueSeverity VertexCacheIssueSeverity;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Vertex Cache", meta = (ToolTip = "Entries in the simulated post-transform vertex cache", ClampMin = "4", ClampMax = "64"))
+	int32 VertexCacheSize;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Vertex Cache", meta = (ToolTip = "Simulate a least recently used cache instead of first in, first out"))
+	bool bSimulateLRUVertexCache;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Vertex Cache", meta = (ToolTip = "LODs that transform each vertex more often than this on average (ATVR) are compared with a cache-optimized triangle order", ClampMin = "1.0", ClampMax = "6.0"))
+	float VertexCacheMaxATVR;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Vertex Cache", meta = (ToolTip = "Report LODs whose vertex shader invocations the optimized order would reduce by at least this percentage", ClampMin = "0.0", ClampMax = "100.0"))
+	float VertexCacheMinImprovement;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Vertex Cache", meta = (ToolTip = "Allow Pipeline Guardian to reorder the triangles and vertices of the source mesh descriptions and rebuild the mesh. Only LODs the build does not cache-optimize again are reordered: those with 300,000 vertex instances or more, or any LOD while r.TriangleOrderOptimization is 2."))
+	bool bAllowVertexCacheAutoFix;
+
+	// --- Overdraw Rule Settings ---
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Overdraw", meta = (ToolTip = "Enable estimating the self-overdraw of LOD 0's opaque and masked sections from a set of canonical view directions. Nanite meshes are skipped."))
+	bool bEnableStaticMeshOverdrawRule;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Overdraw", meta = (ToolTip = "Severity level assigned to overdraw violations"))
+	EAssetIssueSeverity OverdrawIssueSeverity;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Overdraw", meta = (ToolTip = "Report sections whose triangles shade each covered pixel more often than this on average (1 means no self-overdraw)", ClampMin = "1.0", ClampMax = "4.0"))
+	float OverdrawThreshold;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Overdraw", meta = (ToolTip = "How much worse than a cache-optimized order the overdraw-optimized order's vertex cache miss ratio may get. Higher values reduce overdraw further.", ClampMin = "1.0", ClampMax = "2.0"))
+	float OverdrawCacheThreshold;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Overdraw", meta = (ToolTip = "Allow Pipeline Guardian to reorder the triangles of LOD 0's source mesh description for low overdraw and rebuild the mesh. Only offered when the build does not cache-optimize LOD 0 again: when it has 300,000 vertex instances or more, or while r.TriangleOrderOptimization is 2."))
+	bool bAllowOverdrawAutoFix;
+
+	// --- Vertex Split Rule Settings ---
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Vertex Split", meta = (ToolTip = "Enable comparing each LOD's render vertex count with its distinct positions and attributing the split vertices to UV seams, hard normals, tangents, vertex colors and sections. Mesh description vertex counts are only reported for descriptions that are already loaded."))
+	bool bEnableStaticMeshVertexSplitRule;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Vertex Split", meta = (ToolTip = "Severity level assigned to vertex split violations"))
+	EAssetIssueSeverity VertexSplitIssueSeverity;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Vertex Split", meta = (ToolTip = "Report LODs with more render vertices per distinct position than this", ClampMin = "1.0", ClampMax = "8.0"))
+	float VertexSplitMaxRatio;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Vertex Split", meta = (ToolTip = "Ignore LODs whose split vertices take up less vertex buffer memory than this, in KB", ClampMin = "0"))
+	int32 VertexSplitMinWastedKB;
+
+	// --- LOD Geometric Error Rule Settings ---
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|LOD Geometric Error", meta = (ToolTip = "Enable measuring each LOD's surface deviation from LOD 0 and checking it against the LOD's screen size. Nanite meshes are skipped."))
+	bool bEnableStaticMeshLODGeometricErrorRule;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|LOD Geometric Error", meta = (ToolTip = "Severity level assigned to LOD geometric error violations"))
+	EAssetIssueSeverity LODGeometricErrorIssueSeverity;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|LOD Geometric Error", meta = (ToolTip = "Largest deviation from LOD 0, in pixels, a LOD may show when it switches in", ClampMin = "0.1", ClampMax = "16.0"))
+	float LODPixelErrorBudget;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|LOD Geometric Error", meta = (ToolTip = "Screen height, in pixels, the pixel error budget refers to", ClampMin = "240", ClampMax = "4320"))
+	int32 LODReferenceScreenHeight;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|LOD Geometric Error", meta = (ToolTip = "Report LODs whose pixel error at their switch is more than this factor above the budget (switches too early) or below it (switches too late)", ClampMin = "1.0", ClampMax = "16.0"))
+	float LODScreenSizeTolerance;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|LOD Geometric Error", meta = (ToolTip = "Allow Pipeline Guardian to set every LOD's screen size to where its deviation spans the pixel error budget and rebuild the mesh. Turns off automatic LOD screen size computation."))
+	bool bAllowLODScreenSizeAutoFix;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|LOD Geometric Error", meta = (ToolTip = "When the LOD count and LOD quality fixes generate or regenerate LODs, also calibrate the screen sizes of all LODs from their measured deviation and the pixel error budget"))
+	bool bCalibrateGeneratedLODScreenSizes;
+
+	// --- Memory Budget Rule Settings ---
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Memory Budget", meta = (ToolTip = "Enable estimating the GPU and CPU memory of each static mesh: vertex and index buffers per LOD, distance field, Lumen mesh cards, ray tracing, collision and Nanite"))
+	bool bEnableStaticMeshMemoryBudgetRule;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Memory Budget", meta = (ToolTip = "Severity level assigned to memory budget violations"))
+	EAssetIssueSeverity MemoryBudgetIssueSeverity;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Memory Budget", meta = (ToolTip = "Report meshes whose resident GPU memory exceeds this, in KB. Streamed Nanite pages are not counted.", ClampMin = "0"))
+	int32 MemoryBudgetGPUKB;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Memory Budget", meta = (ToolTip = "Report meshes whose CPU memory (collision, mesh card data and CPU-accessible buffer copies) exceeds this, in KB", ClampMin = "0"))
+	int32 MemoryBudgetCPUKB;
+
+	// --- Duplicate Geometry Rule Settings ---
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Duplicate Geometry", meta = (ToolTip = "Enable hashing the LOD 0 positions, UVs and indices of every static mesh and reporting groups of meshes with the same geometry once a scan completes"))
+	bool bEnableStaticMeshDuplicateGeometryRule;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Duplicate Geometry", meta = (ToolTip = "Severity level assigned to duplicate geometry groups"))
+	EAssetIssueSeverity DuplicateGeometryIssueSeverity;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Duplicate Geometry", meta = (ToolTip = "Also group meshes whose geometry only differs by translation and uniform scale, such as the same model exported with another pivot or unit scale"))
+	bool bDetectTransformedDuplicates;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Duplicate Geometry", meta = (ToolTip = "Allow Pipeline Guardian to consolidate exact duplicates with the same materials onto the most referenced mesh of their group. References are replaced and the duplicates are deleted, leaving redirectors. Each group is compared in full and confirmed before it is consolidated."))
+	bool bAllowDuplicateGeometryAutoFix;
+
+	// --- Near-Duplicate Geometry Rule Settings ---
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Near-Duplicate Geometry", meta = (ToolTip = "Enable building a shape descriptor of the LOD 0 surface of every static mesh and reporting clusters of near-identical meshes once a scan completes"))
+	bool bEnableStaticMeshNearDuplicateRule;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Near-Duplicate Geometry", meta = (ToolTip = "Severity level assigned to near-duplicate clusters"))
+	EAssetIssueSeverity NearDuplicateIssueSeverity;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Near-Duplicate Geometry", meta = (ToolTip = "Shape similarity from 0 to 1 at which two meshes are clustered. Descriptors ignore rotation, translation and scale; lower values also cluster variants with larger edits.", ClampMin = "0.5", ClampMax = "0.999"))
+	float NearDuplicateMinSimilarity;
+
+	// --- Draw Call Rule Settings ---
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Draw Calls", meta = (ToolTip = "Enable estimating the draw calls each static mesh instance issues per LOD from its sections, and reporting tiny sections and sections or slots that share a material"))
+	bool bEnableStaticMeshDrawCallRule;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Draw Calls", meta = (ToolTip = "Severity level assigned to draw call issues"))
+	EAssetIssueSeverity DrawCallIssueSeverity;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Draw Calls", meta = (ToolTip = "Report meshes whose LOD 0 issues more draw calls per instance than this, over the base, depth and shadow passes", ClampMin = "1"))
+	int32 MaxDrawCallsPerInstance;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Draw Calls", meta = (ToolTip = "Shadow depth passes a shadow-casting section is drawn in per frame, e.g. cascades times shadow-casting lights. 0 leaves shadows out of the estimate.", ClampMin = "0", ClampMax = "16"))
+	int32 DrawCallShadowPasses;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Draw Calls", meta = (ToolTip = "LOD 0 sections with fewer triangles than this are reported as tiny: they cost a full draw call for little work and should be merged into another section", ClampMin = "1"))
+	int32 TinySectionMaxTriangles;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Draw Calls", meta = (ToolTip = "LOD 0 sections covering less than this percentage of its surface area are reported as tiny", ClampMin = "0.0", ClampMax = "50.0"))
+	float TinySectionMaxAreaPercent;
+	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Draw Calls", meta = (ToolTip = "Allow Pipeline Guardian to merge sections that use the same material and flags into one section per LOD by moving their polygons into one polygon group of the source mesh description, then rebuild the mesh"))
+	bool bAllowDrawCallAutoFix;
 
 	// --- Socket Naming Rule Settings ---
 	UPROPERTY(Config, EditAnywhere, Category = "Static Mesh Rules|Socket Naming", meta = (ToolTip = "Enable checking for static meshes with improper socket naming conventions"))
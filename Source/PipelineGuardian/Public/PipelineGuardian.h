@@ -6,9 +6,18 @@
 #include "Modules/ModuleManager.h"
 #include "Logging/LogMacros.h"
 #include "HAL/Platform.h"
+#include "Stats/Stats.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogPipelineGuardian, Log, All);
 
+// "stat PipelineGuardian"; the same scopes show up as CPU events in Unreal Insights
+DECLARE_STATS_GROUP(TEXT("PipelineGuardian"), STATGROUP_PipelineGuardian, STATCAT_Advanced);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Analyze Batch"), STAT_PipelineGuardian_AnalyzeBatch, STATGROUP_PipelineGuardian, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Load Asset"), STAT_PipelineGuardian_LoadAsset, STATGROUP_PipelineGuardian, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Create Snapshot"), STAT_PipelineGuardian_CreateSnapshot, STATGROUP_PipelineGuardian, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Rule Check"), STAT_PipelineGuardian_RuleCheck, STATGROUP_PipelineGuardian, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Fix Action"), STAT_PipelineGuardian_FixAction, STATGROUP_PipelineGuardian, );
+
 class FToolBarBuilder;
 class FMenuBuilder;
 
@@ -7,6 +7,7 @@
 #include "Widgets/SCompoundWidget.h"
 #include "Analysis/FAssetAnalysisResult.h" // For FAssetAnalysisResult
 #include "Widgets/Views/SListView.h" // For SListView
+#include "Widgets/Views/SHeaderRow.h" // For EColumnSortMode
 
 // Forward declarations
 class SCheckBox;
@@ -58,6 +59,9 @@ private:
     /** Select All checkbox */
     TSharedPtr<SCheckBox> SelectAllCheckBox;
 
+    /** Sort mode of the Memory column; results keep analysis order when none */
+    EColumnSortMode::Type MemorySortMode = EColumnSortMode::None;
+
     /**
      * Generates a row widget for the ResultsListView.
      * @param Item The FAssetAnalysisResult item for this row.
@@ -108,6 +112,15 @@ private:
     /** Apply current filters to the results */
     void ApplyFilters();
 
+    /** Get the sort mode of the Memory column */
+    EColumnSortMode::Type GetMemorySortMode() const;
+
+    /** Handle a click on the Memory column header */
+    void OnMemorySortModeChanged(EColumnSortPriority::Type SortPriority, const FName& ColumnId, EColumnSortMode::Type NewSortMode);
+
+    /** Get text for the memory totals of the displayed results, one per rule */
+    FText GetDisplayedMemoryText() const;
+
     /** Get the number of selected items */
     int32 GetSelectedItemCount() const;
 
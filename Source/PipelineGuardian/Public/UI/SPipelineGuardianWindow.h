@@ -6,10 +6,18 @@
 #include "Widgets/DeclarativeSyntaxSupport.h"
 #include "Widgets/SCompoundWidget.h"
 #include "Templates/SharedPointer.h" // For TSharedPtr
+#include "Templates/UniquePtr.h"
+#include "Containers/Ticker.h"
+#include "AssetRegistry/AssetData.h"
+#include "Analysis/FAssetAnalysisResult.h"
+#include "Core/FAssetAnalysisScheduler.h"
 #include "Core/FAssetScanTask.h" // For EAssetScanMode and FAssetScanCompletionDelegate (if not already via CoreMinimal/indirectly)
 
 // Forward Declarations
+class FAssetAnalysisCache;
 class FAssetScanner;
+class UPipelineGuardianProfile;
+class UPipelineGuardianSettings;
 class SPipelineGuardianReportView;
 class SThrobber;
 class STextBlock;
@@ -74,6 +82,65 @@ private:
 		const FText& TaskCompletionMessage
 	);
 
+	/**
+	 * Creates a scheduler configured by the performance settings, along with its streaming loader and memory governor.
+	 * @param Settings The plugin settings.
+	 * @param ActiveProfile The profile the scan runs with.
+	 * @param OutAnalysisCache Receives the loaded results cache, or null if caching is disabled.
+	 * @return The scheduler.
+	 */
+	TUniquePtr<FAssetAnalysisScheduler> CreateAnalysisScheduler(const UPipelineGuardianSettings* Settings, const UPipelineGuardianProfile* ActiveProfile, TSharedPtr<FAssetAnalysisCache>& OutAnalysisCache) const;
+
+	/** Shows the results of a finished analysis, along with the duplicate geometry groups of the analyzed assets, in the report view and status bar */
+	void ShowAnalysisResults(const TArray<FAssetAnalysisResult>& AssetResults, const TArray<FAssetData>& AnalyzedAssets, const FText& TaskCompletionMessage);
+
+	/** State of an analysis advanced on the core ticker */
+	struct FTimeSlicedAnalysis
+	{
+		TArray<FAssetData> Assets;
+		TWeakObjectPtr<const UPipelineGuardianProfile> Profile;
+		TUniquePtr<FAssetAnalysisScheduler> Scheduler;
+		TSharedPtr<FAssetAnalysisCache> AnalysisCache;
+		TArray<FAssetAnalysisResult> Results;
+		FText TaskCompletionMessage;
+		double FrameBudgetSeconds = 0.0;
+		int32 BatchSize = 1;
+
+		/** Assets of completed batches */
+		int32 ProcessedCount = 0;
+
+		/** Size of the batch in progress */
+		int32 CurrentBatchCount = 0;
+	};
+
+	/**
+	 * Starts analyzing assets a slice at a time on the core ticker, keeping the editor responsive.
+	 * @param Assets The assets to analyze.
+	 * @param TaskCompletionMessage Message of the discovery phase, shown with the results.
+	 */
+	void StartTimeSlicedAnalysis(TArray<FAssetData>&& Assets, const FText& TaskCompletionMessage);
+
+	/** Ticker callback: analyzes until the frame budget is used. @return False once the analysis is finished. */
+	bool TickTimeSlicedAnalysis(float DeltaTime);
+
+	/** Stops the time-sliced analysis, saves the cache and shows the results gathered so far. */
+	void FinishTimeSlicedAnalysis(bool bCancelled);
+
+	/** Handler for the inline cancel button */
+	FReply OnCancelAnalysisClicked();
+
+	/** @return Fraction of assets analyzed by the time-sliced analysis. */
+	TOptional<float> GetTimeSlicedAnalysisProgress() const;
+
+	/** @return Visible while a time-sliced analysis runs. */
+	EVisibility GetTimeSlicedAnalysisControlsVisibility() const;
+
+	/** Analysis in progress on the core ticker, if any */
+	TUniquePtr<FTimeSlicedAnalysis> TimeSlicedAnalysis;
+
+	/** Handle of the ticker driving TimeSlicedAnalysis */
+	FTSTicker::FDelegateHandle AnalysisTickerHandle;
+
 	//~ Begin Button Click Handlers
 	FReply OnAnalyzeProjectClicked();
 	FReply OnAnalyzeSelectedFolderClicked();